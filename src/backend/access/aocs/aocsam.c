@@ -63,6 +63,8 @@ static AOCSScanDesc aocs_beginscan_internal(Relation relation,
 static void reorder_qual_col(AOCSScanDesc scan);
 static bool aocs_col_predicate_test(AOCSScanDesc scan, TupleTableSlot *slot, int i, bool sample_phase);
 static bool aocs_getnext_sample(AOCSScanDesc scan, ScanDirection direction, TupleTableSlot *slot);
+static void aocs_late_materialize(AOCSScanDesc scan, AOCSFileSegInfo *curseginfo,
+								  int64 rowNum, Datum *d, bool *null);
 static void aocs_insert_finish_guts(AOCSInsertDesc aoInsertDesc);
 
 /* Hook for plugins to get control in aocs_delete() */
@@ -118,6 +120,16 @@ open_all_datumstreamread_segfiles(AOCSScanDesc scan, AOCSFileSegInfo *segInfo)
 	char *basepath = relpathbackend(rel->rd_node, rel->rd_backend, MAIN_FORKNUM);
 
 	Assert(proj_atts);
+
+	/*
+	 * Late materialization needs every block to be positioned by its row
+	 * number, and is of no use when the scan builds the block directory.
+	 */
+	scan->aos_late_materialize = gp_enable_aocs_late_materialize &&
+		scan->aos_qual_col_num > 0 &&
+		scan->aos_qual_col_num < num_proj_atts &&
+		blockDirectory == NULL;
+
 	for (AttrNumber i = 0; i < num_proj_atts; i++)
 	{
 		AttrNumber	attno = proj_atts[i];
@@ -126,6 +138,10 @@ open_all_datumstreamread_segfiles(AOCSScanDesc scan, AOCSFileSegInfo *segInfo)
 		open_datumstreamread_segfile(basepath, rel, segInfo, ds[attno], attno);
 		datumstreamread_block(ds[attno], blockDirectory, attno);
 
+		/* Pre-4.0 blocks do not store firstRowNum */
+		if (ds[attno]->getBlockInfo.firstRow < 0)
+			scan->aos_late_materialize = false;
+
 		AOCSScanDesc_UpdateTotalBytesRead(scan, attno);
 	}
 
@@ -821,6 +837,13 @@ ReadNext:
 		{
 			AttrNumber	attno = scan->columnScanInfo.proj_atts[i];
 
+			/*
+			 * With late materialization, the columns after the qual ones
+			 * are only read once the row passed the quals, see below.
+			 */
+			if (scan->aos_late_materialize && i >= scan->aos_qual_col_num)
+				break;
+
 			err = datumstreamread_advance(scan->columnScanInfo.ds[attno]);
 			Assert(err >= 0);
 			if (err == 0)
@@ -899,6 +922,10 @@ ReadNext:
 			rowNum = INT64CONST(-1);
 			goto ReadNext;
 		}
+
+		if (scan->aos_late_materialize)
+			aocs_late_materialize(scan, curseginfo, rowNum, d, null);
+
 		scan->cdb_fake_ctid = *((ItemPointer) &aoTupleId);
 
 		slot->tts_nvalid = natts;
@@ -2319,6 +2346,45 @@ aocs_col_predicate_test(AOCSScanDesc scan, TupleTableSlot *slot, int i, bool sam
 	return predicate_pass;
 }
 
+/*
+ * Read the columns not referenced by the pushed down quals for a row that
+ * passed them. Their datum streams are only moved forward to that row here,
+ * so the blocks holding nothing but rejected rows are skipped without being
+ * read in full nor decompressed.
+ */
+static void
+aocs_late_materialize(AOCSScanDesc scan, AOCSFileSegInfo *curseginfo,
+					  int64 rowNum, Datum *d, bool *null)
+{
+	Assert(rowNum != INT64CONST(-1));
+
+	for (AttrNumber i = scan->aos_qual_col_num; i < scan->columnScanInfo.num_proj_atts; i++)
+	{
+		AttrNumber	attno = scan->columnScanInfo.proj_atts[i];
+		DatumStreamRead *ds = scan->columnScanInfo.ds[attno];
+		int64		blockFileOffset = ds->blockFileOffset;
+
+		if (!datumstreamread_skip_to_row(ds, rowNum))
+			elog(ERROR, "could not find row " INT64_FORMAT " of column %d in segment file %d of relation %s",
+				 rowNum, attno + 1, curseginfo->segno,
+				 RelationGetRelationName(scan->rs_base.rs_rd));
+
+		if (ds->blockFileOffset != blockFileOffset)
+			AOCSScanDesc_UpdateTotalBytesRead(scan, attno);
+
+		datumstreamread_get(ds, &d[attno], &null[attno]);
+
+		/*
+		 * Perform any required upgrades on the Datum we just fetched.
+		 */
+		if (curseginfo->formatversion < AOSegfileFormatVersion_GetLatest ())
+		{
+			upgrade_datum_scan(scan, attno, d, null,
+							   curseginfo->formatversion);
+		}
+	}
+}
+
 static void
 move_attr_forward(AOCSScanDesc scan, int attrno, int pos)
 {
@@ -40,13 +40,18 @@
 #include "catalog/pg_inherits.h"
 #include "catalog/pg_type.h"
 #include "catalog/indexing.h"
+#include "cdb/cdbutil.h"
 #include "cdb/cdbvars.h"
+#include "miscadmin.h"
+#include "utils/acl.h"
 #include "utils/array.h"
 #include "utils/builtins.h"
+#include "utils/guc.h"
 #include "utils/rel.h"
 #include "utils/relcache.h"
 #include "utils/syscache.h"
 #include "utils/lsyscache.h"
+#include "utils/rls.h"
 #include "storage/lockdefs.h"
 #include "optimizer/optimizer.h"
 #include "optimizer/transform.h"
@@ -555,3 +560,61 @@ MatviewIsUpToDate(Oid mvoid)
 	Form_gp_matview_aux auxform = (Form_gp_matview_aux) GETSTRUCT(mvauxtup);
 	return (auxform->datastatus == MV_DATA_STATUS_UP_TO_DATE);
 }
+
+/*
+ * GetRelationUsableMatviews
+ *  Get the oids of the materialized views over a base table that can
+ *  answer queries of the current user over it: the view is populated,
+ *  its data is up to date, and the user can read it.
+ *
+ * This is used by ORCA to match queries against views, the Postgres
+ * planner scans the view rules itself.
+ */
+List *
+GetRelationUsableMatviews(Oid relid)
+{
+	Relation	mtRel;
+	HeapTuple	tup;
+	ScanKeyData key;
+	SysScanDesc desc;
+	List	   *mvoids = NIL;
+
+	mtRel = table_open(GpMatviewTablesId, AccessShareLock);
+
+	ScanKeyInit(&key,
+				Anum_gp_matview_tables_relid,
+				BTEqualStrategyNumber, F_OIDEQ, ObjectIdGetDatum(relid));
+	desc = systable_beginscan(mtRel,
+							  GpMatviewTablesRelIndexId,
+							  true,
+							  NULL, 1, &key);
+	while (HeapTupleIsValid(tup = systable_getnext(desc)))
+	{
+		Form_gp_matview_tables mt = (Form_gp_matview_tables) GETSTRUCT(tup);
+		Relation	matviewRel;
+		bool		usable;
+
+		matviewRel = table_open(mt->mvoid, AccessShareLock);
+
+		usable = RelationIsPopulated(matviewRel) &&
+			(RelationIsIVM(matviewRel) ||
+			 MatviewIsGeneralyUpToDate(mt->mvoid)) &&
+			(aqumv_allow_foreign_table ||
+			 !MatviewHasForeignTables(mt->mvoid)) &&
+			(matviewRel->rd_cdbpolicy == NULL ||
+			 matviewRel->rd_cdbpolicy->numsegments == getgpsegmentCount()) &&
+			check_enable_rls(mt->mvoid, InvalidOid, true) != RLS_ENABLED &&
+			pg_class_aclcheck(mt->mvoid, GetUserId(), ACL_SELECT) == ACLCHECK_OK;
+
+		/* Keep the lock, the view may end up in the plan. */
+		table_close(matviewRel, NoLock);
+
+		if (usable)
+			mvoids = lappend_oid(mvoids, mt->mvoid);
+	}
+
+	systable_endscan(desc);
+	table_close(mtRel, AccessShareLock);
+
+	return mvoids;
+}
@@ -1801,6 +1801,9 @@ UNION ALL
   SELECT gp_segment_id, gp_get_suboverflowed_backends() FROM gp_dist_random('gp_id') order by 1;
 
 
+CREATE VIEW gp_orca_plan_cache_stats AS
+    SELECT * FROM gp_orca_plan_cache_stats();
+
 CREATE OR REPLACE VIEW gp_stat_archiver AS
     SELECT -1 AS gp_segment_id, * FROM pg_stat_archiver
     UNION
@@ -4591,7 +4591,27 @@ merge_leaf_stats(VacAttrStatsP stats,
 		 */
 		if (fullhll_count == totalhll_count)
 		{
+			Datum	   *hll_values;
+			int16		hll_length;
+
 			ndistinct = gp_hyperloglog_estimate(finalHLLFull);
+
+			/*
+			 * Keep the merged counter in the stats of the root, as for the
+			 * leaves, so that the optimizer can estimate how the values of
+			 * the column overlap with the values of other columns.
+			 */
+			old_context = MemoryContextSwitchTo(stats->anl_context);
+			hll_values = (Datum *) palloc(sizeof(Datum));
+			hll_length = datumGetSize(PointerGetDatum(finalHLLFull), false, -1);
+			hll_values[0] = datumCopy(PointerGetDatum(finalHLLFull), false, hll_length);
+			MemoryContextSwitchTo(old_context);
+
+			stats->stakind[STATISTIC_NUM_SLOTS-1] = STATISTIC_KIND_FULLHLL;
+			stats->stavalues[STATISTIC_NUM_SLOTS-1] = hll_values;
+			stats->numvalues[STATISTIC_NUM_SLOTS-1] = 1;
+			stats->statyplen[STATISTIC_NUM_SLOTS-1] = hll_length;
+
 			pfree(finalHLLFull);
 			/*
 			 * For fullscan the ndistinct is calculated based on the entire table scan
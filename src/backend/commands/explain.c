@@ -153,6 +153,7 @@ static const char *explain_get_index_name(Oid indexId);
 static void show_buffer_usage(ExplainState *es, const BufferUsage *usage,
 							  bool planning);
 static void show_wal_usage(ExplainState *es, const WalUsage *usage);
+static void show_optimizer_profile(List *entries, ExplainState *es);
 static void ExplainIndexScanDetails(Oid indexid, ScanDirection indexorderdir,
 									ExplainState *es);
 static void ExplainScanTarget(Scan *plan, ExplainState *es);
@@ -838,6 +839,22 @@ ExplainOnePlan(PlannedStmt *plannedstmt, IntoClause *into, ExplainState *es,
 		ExplainPropertyFloat("Planning Time", "ms", 1000.0 * plantime, 3, es);
 	}
 
+	/* Show the search counters collected by GPORCA, if requested */
+	if (es->verbose && plannedstmt->optimizerProfile != NIL)
+	{
+		ExplainOpenGroup("Optimizer Profile", "Optimizer Profile", true, es);
+		if (es->format == EXPLAIN_FORMAT_TEXT)
+		{
+			ExplainIndentText(es);
+			appendStringInfoString(es->str, "Optimizer Profile:\n");
+			es->indent++;
+		}
+		show_optimizer_profile(plannedstmt->optimizerProfile, es);
+		if (es->format == EXPLAIN_FORMAT_TEXT)
+			es->indent--;
+		ExplainCloseGroup("Optimizer Profile", "Optimizer Profile", true, es);
+	}
+
 	/* Print slice table */
 	if (es->slicetable)
 		ExplainPrintSliceTable(es, queryDesc);
@@ -2811,6 +2828,10 @@ ExplainNode(PlanState *planstate, List *ancestors,
 					ExplainPropertyInteger("Hash Module", NULL,
 											pMotion->numHashSegments, es);
 				}
+				if (pMotion->hashSkewValues != NIL)
+					ExplainPropertyText("Hash Skew Values",
+										pMotion->hashSkewBroadcast ?
+										"Broadcast" : "Spread", es);
 			}
 			break;
 		case T_AssertOp:
@@ -4633,6 +4654,43 @@ show_wal_usage(ExplainState *es, const WalUsage *usage)
 	}
 }
 
+/*
+ * Show the counters of an optimizer profile.
+ *
+ * The profile is a tree of DefElems: a leaf holds an Integer count or a
+ * Float time in milliseconds, an inner node a list of DefElems.
+ */
+static void
+show_optimizer_profile(List *entries, ExplainState *es)
+{
+	ListCell   *lc;
+
+	foreach(lc, entries)
+	{
+		DefElem    *def = lfirst_node(DefElem, lc);
+
+		if (def->arg != NULL && IsA(def->arg, Integer))
+			ExplainPropertyInteger(def->defname, NULL, intVal(def->arg), es);
+		else if (def->arg != NULL && IsA(def->arg, Float))
+			ExplainPropertyFloat(def->defname, "ms", floatVal(def->arg), 3,
+								 es);
+		else
+		{
+			ExplainOpenGroup(def->defname, def->defname, true, es);
+			if (es->format == EXPLAIN_FORMAT_TEXT)
+			{
+				ExplainIndentText(es);
+				appendStringInfo(es->str, "%s:\n", def->defname);
+				es->indent++;
+			}
+			show_optimizer_profile((List *) def->arg, es);
+			if (es->format == EXPLAIN_FORMAT_TEXT)
+				es->indent--;
+			ExplainCloseGroup(def->defname, def->defname, true, es);
+		}
+	}
+}
+
 /*
  * Add some additional details about an IndexScan or IndexOnlyScan
  */
@@ -708,6 +708,34 @@ cdbexplain_recvExecStats(struct PlanState *planstate,
 }								/* cdbexplain_recvExecStats */
 
 
+/*
+ * cdbexplain_getNodeRows
+ *	  Called by qDisp after cdbexplain_recvExecStats() to get the average
+ *	  number of rows a node produced per loop, summed over all the QEs that
+ *	  executed it.  Returns false if no QE reported statistics for the node.
+ */
+bool
+cdbexplain_getNodeRows(struct PlanState *planstate, double *rows)
+{
+	CdbExplain_NodeSummary *ns;
+	double		loops;
+
+	if (planstate->instrument == NULL ||
+		planstate->instrument->cdbNodeSummary == NULL)
+		return false;
+
+	ns = planstate->instrument->cdbNodeSummary;
+	if (ns->nloops.vcnt == 0)
+		return false;
+
+	/* rescans of the node happen on every QE */
+	loops = ns->nloops.vsum / ns->nloops.vcnt;
+	*rows = ns->ntuples.vsum / Max(loops, 1.0);
+
+	return true;
+}								/* cdbexplain_getNodeRows */
+
+
 /*
  * cdbexplain_recvStatWalker
  *	  Update the given PlanState node's Instrument node with statistics
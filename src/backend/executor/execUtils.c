@@ -74,6 +74,7 @@
 
 #include "nodes/primnodes.h"
 #include "nodes/execnodes.h"
+#include "optimizer/orca.h"
 
 #include "cdb/cdbutil.h"
 #include "cdb/cdbvars.h"
@@ -2145,6 +2146,12 @@ uint64 mppExecutorWait(QueryDesc *queryDesc)
 			cdbexplain_recvExecStats(queryDesc->planstate, ds->primaryResults,
 										LocallyExecutingSliceIndex(queryDesc->estate),
 										estate->showstatctx);
+#ifdef USE_ORCA
+			/* report the rows the nodes produced back to GPORCA */
+			if (optimizer_cardinality_feedback &&
+				queryDesc->plannedstmt->planGen == PLANGEN_OPTIMIZER)
+				record_cardinality_feedback(queryDesc->planstate);
+#endif
 		}
 		/* get num of rows processed from writer QEs. */
 		es_processed +=
@@ -704,6 +704,8 @@ ExecInitMotion(Motion *node, EState *estate, int eflags)
 	motionstate->hashExprs = NIL;
 	motionstate->cdbhash = NULL;
 	motionstate->cdbhashworkers = NULL;
+	motionstate->skewHashes = NULL;
+	motionstate->numSkewHashes = 0;
 
 	/* Look up the sending and receiving gang's slice table entries. */
 	sendSlice = &sliceTable->slices[node->motionID];
@@ -847,6 +849,33 @@ ExecInitMotion(Motion *node, EState *estate, int eflags)
 					nkeys,
 					node->hashFuncs);
 		}
+
+		/*
+		 * Hybrid redistribute: remember the hashes of the skew values, rows
+		 * hashing to one of them are broadcast or spread instead.
+		 */
+		if (node->hashSkewValues != NIL)
+		{
+			ListCell   *lc;
+			int			i = 0;
+
+			Assert(nkeys == 1);
+			if (motionstate->parallel_workers >= 2)
+				elog(ERROR, "hybrid redistribute motion is not supported with parallel workers");
+
+			motionstate->numSkewHashes = list_length(node->hashSkewValues);
+			motionstate->skewHashes = (uint32 *)
+				palloc(motionstate->numSkewHashes * sizeof(uint32));
+			foreach(lc, node->hashSkewValues)
+			{
+				Const	   *skewValue = lfirst_node(Const, lc);
+
+				cdbhashinit(motionstate->cdbhash);
+				cdbhash(motionstate->cdbhash, 1, skewValue->constvalue,
+						skewValue->constisnull);
+				motionstate->skewHashes[i++] = motionstate->cdbhash->hash;
+			}
+		}
 	}
 
 	/*
@@ -1009,6 +1038,11 @@ ExecEndMotion(MotionState *node)
 		pfree(node->cdbhashworkers);
 		node->cdbhashworkers = NULL;
 	}
+	if (node->skewHashes != NULL)
+	{
+		pfree(node->skewHashes);
+		node->skewHashes = NULL;
+	}
 
 	/*
 	 * Free up this motion node's resources in the Motion Layer.
@@ -1284,6 +1318,23 @@ doSendTuple(Motion *motion, MotionState *node, TupleTableSlot *outerTupleSlot)
 		else
 			targetRoute = segIdx;
 
+		/*
+		 * Hybrid redistribute: a row with one of the skew values goes to all
+		 * segments on the build side of the join, and to a random segment on
+		 * the probe side, so that its matches are found wherever it lands.
+		 */
+		for (i = 0; i < node->numSkewHashes; i++)
+		{
+			if (node->cdbhash->hash == node->skewHashes[i])
+			{
+				if (motion->hashSkewBroadcast)
+					targetRoute = BROADCAST_SEGIDX;
+				else
+					targetRoute = cdbhashrandomseg(node->numHashSegments);
+				break;
+			}
+		}
+
 		/*
 		 * see MPP-2099, let's not run into this one again! NOTE: the
 		 * definition of BROADCAST_SEGIDX is key here, it *cannot* be a valid
@@ -1293,7 +1344,7 @@ doSendTuple(Motion *motion, MotionState *node, TupleTableSlot *outerTupleSlot)
 		 * makeDefaultSegIdxArray() in cdbmutate.c (it is the trivial map, and
 		 * is passed around our system a fair amount!).
 		 */
-		Assert(targetRoute != BROADCAST_SEGIDX);
+		Assert(targetRoute != BROADCAST_SEGIDX || motion->hashSkewBroadcast);
 	}
 	else if (motion->motionType == MOTIONTYPE_EXPLICIT)
 	{
@@ -27,6 +27,7 @@
 #include "gpopt/init.h"
 #include "naucrates/exception.h"
 #include "naucrates/init.h"
+#include "naucrates/statistics/CCardinalityFeedback.h"
 
 #include "utils/guc.h"
 #include "utils/memutils.h"
@@ -189,6 +190,23 @@ CGPOptimizer::TerminateGPOPT()
 	gpos_terminate();
 }
 
+//---------------------------------------------------------------------------
+//	@function:
+//		RecordCardinalityFeedback()
+//
+//	@doc:
+//		Record the rows an executed plan node produced, for the optimizer
+//		to use in place of its estimate for the same subexpression
+//
+//---------------------------------------------------------------------------
+void
+CGPOptimizer::RecordCardinalityFeedback(uint64 fingerprint, double rows)
+{
+	// recording does not allocate memory or raise exceptions, so it is
+	// done outside of an optimizer task
+	gpnaucrates::CCardinalityFeedback::Record(fingerprint, CDouble(rows));
+}
+
 //---------------------------------------------------------------------------
 //	@function:
 //		GPOPTOptimizedPlan
@@ -294,4 +312,20 @@ TerminateGPOPT()
 }
 }
 
+//---------------------------------------------------------------------------
+//	@function:
+//		GPOPTRecordCardinalityFeedback()
+//
+//	@doc:
+//		Expose cardinality feedback recording to C files
+//
+//---------------------------------------------------------------------------
+extern "C" {
+void
+GPOPTRecordCardinalityFeedback(uint64 fingerprint, double rows)
+{
+	CGPOptimizer::RecordCardinalityFeedback(fingerprint, rows);
+}
+}
+
 // EOF
@@ -16,6 +16,7 @@
 extern "C" {
 #include "postgres.h"
 
+#include "cdb/cdbvars.h"
 #include "utils/guc.h"
 }
 
@@ -88,6 +89,10 @@ CConfigParamMapping::SConfigMappingElem CConfigParamMapping::m_elements[] = {
 	 false,	 // m_negate_param
 	 GPOS_WSZ_LIT("Generate optimizer minidump.")},
 
+	{EopttraceMinidumpBinary, &optimizer_minidump_binary,
+	 false,	 // m_negate_param
+	 GPOS_WSZ_LIT("Write optimizer minidumps in binary DXL format.")},
+
 	{EopttraceDisableMotions, &optimizer_enable_motions,
 	 true,	// m_negate_param
 	 GPOS_WSZ_LIT("Disable motion nodes in optimizer.")},
@@ -144,6 +149,10 @@ CConfigParamMapping::SConfigMappingElem CConfigParamMapping::m_elements[] = {
 	 false,	 // m_negate_param
 	 GPOS_WSZ_LIT("Enable space pruning in optimizer.")},
 
+	{EopttraceEnableGlobalSpacePruning, &optimizer_enable_global_space_pruning,
+	 false,	 // m_negate_param
+	 GPOS_WSZ_LIT("Prune plans using the cost of the best complete plan.")},
+
 	{EopttraceForceMultiStageAgg, &optimizer_force_multistage_agg,
 	 false,	 // m_negate_param
 	 GPOS_WSZ_LIT(
@@ -275,6 +284,39 @@ CConfigParamMapping::SConfigMappingElem CConfigParamMapping::m_elements[] = {
 	 true,	// m_negate_param
 	 GPOS_WSZ_LIT("Disable ordered aggregate plans.")},
 
+	{EopttraceEnableMemoize, &optimizer_enable_memoize,
+	 false,	 // m_negate_param
+	 GPOS_WSZ_LIT(
+		 "Enable caching the inner side of index nested loop joins.")},
+
+	{EopttraceEnableIncrementalSort, &optimizer_enable_incremental_sort,
+	 false,	 // m_negate_param
+	 GPOS_WSZ_LIT(
+		 "Enable sorting inputs already sorted on a prefix of the sort keys "
+		 "incrementally.")},
+
+	{EopttraceEnableMatViewRewrite,
+	 &enable_answer_query_using_materialized_views,
+	 false,	 // m_negate_param
+	 GPOS_WSZ_LIT("Answer queries using materialized views.")},
+
+	{EopttraceEnableRuntimeFilter, &gp_enable_runtime_filter,
+	 false,	 // m_negate_param
+	 GPOS_WSZ_LIT("Enable runtime filters on the outer side of hash joins.")},
+
+	{EopttraceEnablePredicatePushdown, &gp_enable_predicate_pushdown,
+	 false,	 // m_negate_param
+	 GPOS_WSZ_LIT(
+		 "Push quals down into scans of append-optimized tables.")},
+
+	{EopttraceEnableAOCSLateMaterialize, &gp_enable_aocs_late_materialize,
+	 false,	 // m_negate_param
+	 GPOS_WSZ_LIT("Read non-qual columns of column-oriented scans late.")},
+
+	{EopttraceEnableCardinalityFeedback, &optimizer_cardinality_feedback,
+	 false,	 // m_negate_param
+	 GPOS_WSZ_LIT("Use the cardinalities observed in earlier executions.")},
+
 	{EopttraceExpandFullJoin, &optimizer_expand_fulljoin,
 	 false,	 // m_negate_param
 	 GPOS_WSZ_LIT(
@@ -283,6 +325,14 @@ CConfigParamMapping::SConfigMappingElem CConfigParamMapping::m_elements[] = {
 	 true,	// m_negate_param
 	 GPOS_WSZ_LIT(
 		 "Penalize a hash join with a skewed redistribute as a child.")},
+	{EopttraceEnableHybridRedistribute, &optimizer_enable_hybrid_redistribute,
+	 false,	 // m_negate_param
+	 GPOS_WSZ_LIT(
+		 "Spread or broadcast the most common values of hash join keys.")},
+	{EopttraceEnableInnerOuterMergeJoin,
+	 &optimizer_enable_inner_outer_mergejoin,
+	 false,	 // m_negate_param
+	 GPOS_WSZ_LIT("Enable merge joins for inner and left outer joins.")},
 	{EopttraceAllowGeneralPredicatesforDPE,
 	 &optimizer_enable_range_predicate_dpe,
 	 false,	 // m_negate_param
@@ -438,6 +488,14 @@ CConfigParamMapping::PackConfigParamInBitset(
 			GPOPT_DISABLE_XFORM_TF(CXform::ExfPushJoinBelowRightUnionAll));
 	}
 
+	if (!optimizer_enable_window_rank_pushdown)
+	{
+		// disable the local top-K pre-filter of ranking windows if the
+		// corresponding GUC is turned off
+		traceflag_bitset->ExchangeSet(
+			GPOPT_DISABLE_XFORM_TF(CXform::ExfSplitWindowRankFilter));
+	}
+
 	if (!optimizer_enable_indexscan)
 	{
 		// disable index scan if the corresponding GUC is turned off
@@ -484,8 +542,10 @@ CConfigParamMapping::PackConfigParamInBitset(
 
 	if (!optimizer_enable_mergejoin)
 	{
-		traceflag_bitset->ExchangeSet(
-			GPOPT_DISABLE_XFORM_TF(CXform::ExfImplementFullOuterMergeJoin));
+		// disable merge joins if the corresponding GUC is turned off
+		CBitSet *merge_join_bitset = CXform::PbsMergeJoinXforms(mp);
+		traceflag_bitset->Union(merge_join_bitset);
+		merge_join_bitset->Release();
 	}
 
 	CBitSet *join_heuristic_bitset = nullptr;
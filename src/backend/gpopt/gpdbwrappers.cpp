@@ -36,8 +36,12 @@ extern "C" {
 #include "access/amapi.h"
 #include "access/external.h"
 #include "access/genam.h"
+#include "catalog/gp_matview_aux.h"
 #include "catalog/pg_inherits.h"
+#include "commands/matview.h"
+#include "executor/nodeMemoize.h"
 #include "foreign/fdwapi.h"
+#include "miscadmin.h"
 #include "nodes/nodeFuncs.h"
 #include "optimizer/clauses.h"
 #include "optimizer/optimizer.h"
@@ -47,8 +51,11 @@ extern "C" {
 #include "partitioning/partdesc.h"
 #include "storage/lmgr.h"
 #include "utils/fmgroids.h"
+#include "utils/hyperloglog/gp_hyperloglog.h"
 #include "utils/memutils.h"
+#include "utils/orcamdcache.h"
 #include "utils/partcache.h"
+#include "utils/pg_locale.h"
 }
 #define GP_WRAP_START                                            \
 	sigjmp_buf local_sigjmp_buf;                                 \
@@ -495,6 +502,101 @@ gpdb::TypeCollation(Oid type)
 	return 0;
 }
 
+bool
+gpdb::CollationIsC(Oid collation)
+{
+	GP_WRAP_START;
+	{
+		return lc_collate_is_c(collation);
+	}
+	GP_WRAP_END;
+	return false;
+}
+
+const char *
+gpdb::TextSortKey(Oid type, Datum value, int *len)
+{
+	GP_WRAP_START;
+	{
+		struct varlena *text = PG_DETOAST_DATUM_PACKED(value);
+		char *data = VARDATA_ANY(text);
+		*len = VARSIZE_ANY_EXHDR(text);
+
+		// trailing blanks of bpchar values are insignificant
+		if (BPCHAROID == type)
+		{
+			*len = bpchartruelen(data, *len);
+		}
+
+		return data;
+	}
+	GP_WRAP_END;
+	return nullptr;
+}
+
+// context of comparing the values to rank by their indexes
+struct SRankDatumsContext
+{
+	FmgrInfo *cmp_finfo;
+	Oid collation;
+	Datum *values;
+};
+
+static int
+CompareRankDatums(const void *a, const void *b, void *arg)
+{
+	SRankDatumsContext *context = (SRankDatumsContext *) arg;
+	int idx_a = *(const int *) a;
+	int idx_b = *(const int *) b;
+
+	return DatumGetInt32(FunctionCall2Coll(context->cmp_finfo,
+										   context->collation,
+										   context->values[idx_a],
+										   context->values[idx_b]));
+}
+
+bool
+gpdb::RankDatums(Oid type, Oid collation, Datum *values, int num_values,
+				 int *ranks)
+{
+	GP_WRAP_START;
+	{
+		TypeCacheEntry *typentry =
+			lookup_type_cache(type, TYPECACHE_CMP_PROC_FINFO);
+		if (!OidIsValid(typentry->cmp_proc_finfo.fn_oid))
+		{
+			return false;
+		}
+
+		SRankDatumsContext context = {&typentry->cmp_proc_finfo, collation,
+									  values};
+		int *order = (int *) palloc(num_values * sizeof(int));
+		for (int i = 0; i < num_values; i++)
+		{
+			order[i] = i;
+		}
+		qsort_arg(order, num_values, sizeof(int), CompareRankDatums,
+				  &context);
+
+		// equal values get the same rank
+		int rank = 0;
+		for (int i = 0; i < num_values; i++)
+		{
+			if (0 < i &&
+				0 != CompareRankDatums(&order[i - 1], &order[i], &context))
+			{
+				rank++;
+			}
+			ranks[order[i]] = rank;
+		}
+		pfree(order);
+
+		return true;
+	}
+	GP_WRAP_END;
+	return false;
+}
+
 
 List *
 gpdb::ExtractNodesPlan(Plan *pl, int node_tag, bool descend_into_subqueries)
@@ -714,6 +816,18 @@ gpdb::IsAggPartialCapable(Oid aggid)
 	return false;
 }
 
+bool
+gpdb::IsAggRollupCapable(Oid aggid)
+{
+	GP_WRAP_START;
+	{
+		/* catalog tables: pg_aggregate */
+		return is_agg_rollup_capable(aggid);
+	}
+	GP_WRAP_END;
+	return false;
+}
+
 Oid
 gpdb::GetAggregate(const char *agg, Oid type_oid)
 {
@@ -762,6 +876,37 @@ gpdb::GetAttStats(Oid relid, AttrNumber attnum)
 	return nullptr;
 }
 
+uint8 *
+gpdb::GetAttStatsHLLRegisters(HeapTuple statstuple, int *precision)
+{
+	GP_WRAP_START;
+	{
+		AttStatsSlot hll_slot;
+		uint8 *registers = nullptr;
+
+		/* catalog tables: pg_statistic */
+		(void) get_attstatsslot(&hll_slot, statstuple, STATISTIC_KIND_FULLHLL,
+								InvalidOid, ATTSTATSSLOT_VALUES);
+		if (0 < hll_slot.nvalues)
+		{
+			GpHLLCounter counter =
+				(GpHLLCounter) DatumGetByteaP(hll_slot.values[0]);
+
+			/* one byte per register, whatever the stored format */
+			GpHLLCounter unpacked = gp_hll_unpack(counter);
+			*precision = unpacked->b;
+			registers = (uint8 *) palloc(POW2(unpacked->b));
+			memcpy(registers, unpacked->data, POW2(unpacked->b));
+			pfree(unpacked);
+		}
+		free_attstatsslot(&hll_slot);
+
+		return registers;
+	}
+	GP_WRAP_END;
+	return nullptr;
+}
+
 List *
 gpdb::GetExtStats(Relation rel)
 {
@@ -796,6 +941,46 @@ gpdb::GetExtStatsKinds(Oid statOid)
 	return nullptr;
 }
 
+List *
+gpdb::GetExtStatsKeys(Oid statOid)
+{
+	GP_WRAP_START;
+	{
+		/* catalog tables: pg_statistic_ext */
+		return GetExtStatisticsKeys(statOid);
+	}
+	GP_WRAP_END;
+	return nullptr;
+}
+
+List *
+gpdb::GetRelationUsableMatViews(Oid relid)
+{
+	GP_WRAP_START;
+	{
+		/* catalog tables: gp_matview_tables, gp_matview_aux, pg_class */
+		return GetRelationUsableMatviews(relid);
+	}
+	GP_WRAP_END;
+	return nullptr;
+}
+
+Query *
+gpdb::GetMatViewQuery(Oid mvoid)
+{
+	GP_WRAP_START;
+	{
+		/* catalog tables: pg_class, pg_rewrite */
+		Relation rel = RelationIdGetRelation(mvoid);
+		Query *query = (Query *) copyObjectImpl(get_matview_query(rel));
+		RelationClose(rel);
+
+		return query;
+	}
+	GP_WRAP_END;
+	return nullptr;
+}
+
 Oid
 gpdb::GetCommutatorOp(Oid opno)
 {
@@ -1174,6 +1359,17 @@ gpdb::GetGPSegmentCount(void)
 	return 0;
 }
 
+Oid
+gpdb::GetCurrentUserId(void)
+{
+	GP_WRAP_START;
+	{
+		return GetUserId();
+	}
+	GP_WRAP_END;
+	return InvalidOid;
+}
+
 bool
 gpdb::HeapAttIsNull(HeapTuple tup, int attno)
 {
@@ -1510,6 +1706,28 @@ gpdb::MakeIntegerValue(long i)
 	return nullptr;
 }
 
+Value *
+gpdb::MakeFloatValue(char *str)
+{
+	GP_WRAP_START;
+	{
+		return makeFloat(str);
+	}
+	GP_WRAP_END;
+	return nullptr;
+}
+
+DefElem *
+gpdb::MakeDefElem(char *name, Node *arg)
+{
+	GP_WRAP_START;
+	{
+		return makeDefElem(name, arg, -1);
+	}
+	GP_WRAP_END;
+	return nullptr;
+}
+
 Node *
 gpdb::MakeIntConst(int32 intValue)
 {
@@ -1980,6 +2198,16 @@ gpdb::GetMVDependencies(Oid stat_oid)
 	GP_WRAP_END;
 }
 
+MCVList *
+gpdb::GetMVMCVList(Oid stat_oid)
+{
+	GP_WRAP_START;
+	{
+		return statext_mcv_load(stat_oid, true);
+	}
+	GP_WRAP_END;
+}
+
 gpdb::RelationWrapper
 gpdb::GetRelation(Oid rel_oid)
 {
@@ -2088,6 +2316,17 @@ gpdb::AppendStringInfo(StringInfo str, const char *str1, const char *str2)
 	GP_WRAP_END;
 }
 
+void
+gpdb::AppendBinaryStringInfo(StringInfo str, const char *data, int datalen)
+{
+	GP_WRAP_START;
+	{
+		appendBinaryStringInfo(str, data, datalen);
+		return;
+	}
+	GP_WRAP_END;
+}
+
 int
 gpdb::FindNodes(Node *node, List *nodeTags)
 {
@@ -2371,16 +2610,20 @@ gpdb::InjectFaultInOptTasks(const char *fault_name)
 #endif
 
 /*
- * To detect changes to catalog tables that require resetting the Metadata
- * Cache, we use the normal PostgreSQL catalog cache invalidation mechanism.
- * We register a callback to a cache on all the catalog tables that contain
- * information that's contained in the ORCA metadata cache.
-
- * There is no fine-grained mechanism in the metadata cache for invalidating
- * individual entries ATM, so we just blow the whole cache whenever anything
- * changes. The callback simply increments a counter. Whenever we start
- * planning a query, we check the counter to see if it has changed since the
- * last planned query, and reset the whole cache if it has.
+ * To detect changes to catalog tables that require invalidating entries of
+ * the Metadata Cache, we use the normal PostgreSQL catalog cache invalidation
+ * mechanism. We register a callback to a cache on all the catalog tables
+ * that contain information that's contained in the ORCA metadata cache.
+ *
+ * The callbacks record what was invalidated: the OIDs of invalidated
+ * relations, and the cache id and hash value of invalidated syscache
+ * entries. Whenever we start planning a query, the metadata cache entries
+ * matching the recorded invalidations are evicted, see
+ * MDCacheIsRelationInvalidated() and friends, and the rest of the cache is
+ * kept. If an invalidation can't be attributed to individual entries (a
+ * reset of a whole cache, a change to operator classes or families, or more
+ * invalidations than we care to record), we fall back to blowing the whole
+ * cache, which MDCacheNeedsReset() reports.
  *
  * To make sure we've covered all catalog tables that contain information
  * that's stored in the metadata cache, there are "catalog tables: xxx"
@@ -2389,26 +2632,134 @@ gpdb::InjectFaultInOptTasks(const char *fault_name)
  * anything fetched via the wrapper functions in this file can end up in the
  * metadata cache and hence need to have an invalidation callback registered.
  */
-static bool mdcache_invalidation_counter_registered = false;
-static int64 mdcache_invalidation_counter = 0;
-static int64 last_mdcache_invalidation_counter = 0;
+
+/* maximum number of invalidations recorded between two planned queries */
+#define MDCACHE_MAX_INVALIDATIONS 256
+
+typedef struct MDCacheSyscacheInvalidation
+{
+	int cacheid;
+	uint32 hashvalue;
+} MDCacheSyscacheInvalidation;
+
+static bool mdcache_invalidation_callbacks_registered = false;
+static bool mdcache_needs_reset = false;
+static int mdcache_num_invalidated_relids = 0;
+static Oid mdcache_invalidated_relids[MDCACHE_MAX_INVALIDATIONS];
+static int mdcache_num_syscache_invalidations = 0;
+static MDCacheSyscacheInvalidation
+	mdcache_syscache_invalidations[MDCACHE_MAX_INVALIDATIONS];
+
+/*
+ * The materialized views usable by a query depend on the privileges of the
+ * user, so they are invalidated whenever the user changes.
+ */
+static Oid mdcache_userid = InvalidOid;
+
+// has a syscache entry with given hash value been invalidated?
+static bool
+is_syscache_entry_invalidated(int cacheid, uint32 hashvalue)
+{
+	for (int i = 0; i < mdcache_num_syscache_invalidations; i++)
+	{
+		if (mdcache_syscache_invalidations[i].cacheid == cacheid &&
+			mdcache_syscache_invalidations[i].hashvalue == hashvalue)
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+// has any entry of the given syscache been invalidated?
+static bool
+is_syscache_invalidated(int cacheid)
+{
+	for (int i = 0; i < mdcache_num_syscache_invalidations; i++)
+	{
+		if (mdcache_syscache_invalidations[i].cacheid == cacheid)
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
 
 static void
-mdsyscache_invalidation_counter_callback(Datum /*arg*/, int /*cacheid*/,
-										 uint32 /*hashvalue*/)
+mdsyscache_invalidation_callback(Datum /*arg*/, int cacheid, uint32 hashvalue)
 {
-	mdcache_invalidation_counter++;
+	if (mdcache_needs_reset)
+	{
+		return;
+	}
+
+	/*
+	 * A zero hash value means that the whole cache was reset. Operator
+	 * classes and families are baked into types, operators and indexes, and
+	 * the entries they end up in can't be derived from the hash value.
+	 */
+	if (0 == hashvalue || AMOPOPID == cacheid || OPFAMILYOID == cacheid)
+	{
+		mdcache_needs_reset = true;
+		return;
+	}
+
+	if (is_syscache_entry_invalidated(cacheid, hashvalue))
+	{
+		return;
+	}
+
+	if (MDCACHE_MAX_INVALIDATIONS == mdcache_num_syscache_invalidations)
+	{
+		mdcache_needs_reset = true;
+		return;
+	}
+
+	MDCacheSyscacheInvalidation *inval =
+		&mdcache_syscache_invalidations[mdcache_num_syscache_invalidations++];
+	inval->cacheid = cacheid;
+	inval->hashvalue = hashvalue;
 }
 
 static void
-mdrelcache_invalidation_counter_callback(Datum /*arg*/, Oid /*relid*/)
+mdrelcache_invalidation_callback(Datum /*arg*/, Oid relid)
 {
-	mdcache_invalidation_counter++;
+	if (mdcache_needs_reset)
+	{
+		return;
+	}
+
+	/* InvalidOid means that all relations were invalidated */
+	if (!OidIsValid(relid))
+	{
+		mdcache_needs_reset = true;
+		return;
+	}
+
+	if (gpdb::MDCacheIsRelationInvalidated(relid))
+	{
+		return;
+	}
+
+	if (MDCACHE_MAX_INVALIDATIONS == mdcache_num_invalidated_relids)
+	{
+		mdcache_needs_reset = true;
+		return;
+	}
+
+	mdcache_invalidated_relids[mdcache_num_invalidated_relids++] = relid;
 }
 
 static void
 register_mdcache_invalidation_callbacks(void)
 {
+	if (mdcache_invalidation_callbacks_registered)
+	{
+		return;
+	}
+
 	/* These are all the catalog tables that we care about. */
 	int metadata_caches[] = {
 		AGGFNOID,		  /* pg_aggregate */
@@ -2420,7 +2771,8 @@ register_mdcache_invalidation_callbacks(void)
 		STATRELATTINH,	  /* pg_statistics */
 		TYPEOID,		  /* pg_type */
 		PROCOID,		  /* pg_proc */
-
+		MVAUXOID,		  /* gp_matview_aux */
+		MVTABLESMVRELOID, /* gp_matview_tables */
 		/*
 		 * lookup_type_cache() will also access pg_opclass, via GetDefaultOpClass(),
 		 * but there is no syscache for it. Postgres doesn't seem to worry about
@@ -2462,41 +2814,245 @@ register_mdcache_invalidation_callbacks(void)
 	for (i = 0; i < lengthof(metadata_caches); i++)
 	{
 		CacheRegisterSyscacheCallback(metadata_caches[i],
-									  &mdsyscache_invalidation_counter_callback,
+									  &mdsyscache_invalidation_callback,
 									  (Datum) 0);
 	}
 
 	/* also register the relcache callback */
-	CacheRegisterRelcacheCallback(&mdrelcache_invalidation_counter_callback,
+	CacheRegisterRelcacheCallback(&mdrelcache_invalidation_callback,
 								  (Datum) 0);
+
+	mdcache_invalidation_callbacks_registered = true;
+}
+
+// forget the recorded invalidations
+static void
+clear_mdcache_invalidations(void)
+{
+	mdcache_needs_reset = false;
+	mdcache_num_invalidated_relids = 0;
+	mdcache_num_syscache_invalidations = 0;
+	mdcache_userid = GetUserId();
 }
 
-// Has there been any catalog changes since last call?
+// Has there been any catalog change since last call that requires the
+// whole metadata cache to be reset? If so, the recorded invalidations are
+// discarded along with the cache.
 bool
 gpdb::MDCacheNeedsReset(void)
 {
 	GP_WRAP_START;
 	{
-		if (!mdcache_invalidation_counter_registered)
-		{
-			register_mdcache_invalidation_callbacks();
-			mdcache_invalidation_counter_registered = true;
-		}
-		if (last_mdcache_invalidation_counter == mdcache_invalidation_counter)
+		register_mdcache_invalidation_callbacks();
+
+		if (!mdcache_needs_reset)
 		{
 			return false;
 		}
 		else
 		{
-			last_mdcache_invalidation_counter = mdcache_invalidation_counter;
+			clear_mdcache_invalidations();
+			return true;
+		}
+	}
+	GP_WRAP_END;
+
+	return true;
+}
+
+// Have any metadata cache entries been invalidated since the last call to
+// MDCacheClearInvalidations(), or has the user changed?
+bool
+gpdb::MDCacheHasInvalidations(void)
+{
+	return 0 < mdcache_num_invalidated_relids ||
+		   0 < mdcache_num_syscache_invalidations ||
+		   mdcache_userid != GetUserId();
+}
+
+// forget the invalidations, once the affected entries have been evicted
+void
+gpdb::MDCacheClearInvalidations(void)
+{
+	clear_mdcache_invalidations();
+}
+
+// has the relation (or index) with the given OID been invalidated?
+bool
+gpdb::MDCacheIsRelationInvalidated(Oid relid)
+{
+	for (int i = 0; i < mdcache_num_invalidated_relids; i++)
+	{
+		if (mdcache_invalidated_relids[i] == relid)
+		{
 			return true;
 		}
 	}
+
+	return false;
+}
+
+// Has any relation been invalidated? Objects such as extended statistics
+// are not tied to a relation OID in the metadata cache.
+bool
+gpdb::MDCacheIsAnyRelationInvalidated(void)
+{
+	return 0 < mdcache_num_invalidated_relids;
+}
+
+// Have the materialized views over any relation changed? They are cached by
+// the OID of their base relation, but a change to a view or to the status of
+// its data invalidates the view, and which views are usable depends on the
+// user.
+bool
+gpdb::MDCacheIsMatViewInvalidated(void)
+{
+	return is_syscache_invalidated(MVAUXOID) ||
+		   is_syscache_invalidated(MVTABLESMVRELOID) ||
+		   MDCacheIsAnyRelationInvalidated() || mdcache_userid != GetUserId();
+}
+
+// Has the type, operator, function, aggregate or constraint with the given
+// OID been invalidated? Hash collisions only lead to spurious evictions.
+bool
+gpdb::MDCacheIsObjectInvalidated(Oid oid)
+{
+	/* catalogs whose objects are cached by OID */
+	int object_caches[] = {TYPEOID, OPEROID, PROCOID, AGGFNOID, CONSTROID};
+
+	GP_WRAP_START;
+	{
+		for (unsigned int i = 0; i < lengthof(object_caches); i++)
+		{
+			if (is_syscache_invalidated(object_caches[i]) &&
+				is_syscache_entry_invalidated(
+					object_caches[i],
+					GetSysCacheHashValue1(object_caches[i],
+										  ObjectIdGetDatum(oid))))
+			{
+				return true;
+			}
+		}
+		return false;
+	}
 	GP_WRAP_END;
 
 	return true;
 }
 
+// has the cast between the given types been invalidated?
+bool
+gpdb::MDCacheIsCastInvalidated(Oid src_type, Oid dest_type)
+{
+	GP_WRAP_START;
+	{
+		if (!is_syscache_invalidated(CASTSOURCETARGET))
+		{
+			return false;
+		}
+		return is_syscache_entry_invalidated(
+			CASTSOURCETARGET,
+			GetSysCacheHashValue2(CASTSOURCETARGET,
+								  ObjectIdGetDatum(src_type),
+								  ObjectIdGetDatum(dest_type)));
+	}
+	GP_WRAP_END;
+
+	return true;
+}
+
+// Have any column statistics been invalidated? pg_statistic is keyed by
+// attribute number, which the metadata cache does not record.
+bool
+gpdb::MDCacheIsColumnStatsInvalidated(void)
+{
+	return is_syscache_invalidated(STATRELATTINH);
+}
+
+// Have any operators been invalidated? Scalar comparisons are cached by the
+// types they compare, not by the operator implementing them.
+bool
+gpdb::MDCacheIsOperatorInvalidated(void)
+{
+	return is_syscache_invalidated(OPEROID);
+}
+
+// Is the shared snapshot of the metadata cache configured?
+bool
+gpdb::MDCacheSnapshotEnabled(void)
+{
+	return OrcaMDCacheSnapshotEnabled();
+}
+
+// Process pending catalog invalidation messages, and return the catalog
+// version the metadata cache is consistent with once the recorded
+// invalidations have been applied to it. Metadata cache snapshots are
+// compared against this version.
+uint64
+gpdb::MDCacheProcessInvalidations(void)
+{
+	GP_WRAP_START;
+	{
+		// register the callbacks first, so that no message counted by the
+		// version goes unrecorded
+		register_mdcache_invalidation_callbacks();
+
+		uint64 version = OrcaMDCacheGetVersion();
+		AcceptInvalidationMessages();
+		return version;
+	}
+	GP_WRAP_END;
+	return 0;
+}
+
+// fetch the shared metadata cache snapshot, if it matches the given version
+char *
+gpdb::FetchMDCacheSnapshot(uint64 version, Size *size)
+{
+	GP_WRAP_START;
+	{
+		return OrcaMDCacheFetchSnapshot(version, size);
+	}
+	GP_WRAP_END;
+	return nullptr;
+}
+
+// publish a metadata cache snapshot consistent with the given version
+bool
+gpdb::StoreMDCacheSnapshot(uint64 version, const char *data, Size size)
+{
+	GP_WRAP_START;
+	{
+		return OrcaMDCacheStoreSnapshot(version, data, size);
+	}
+	GP_WRAP_END;
+	return false;
+}
+
+// maximum amount of memory a hash table of the executor may use
+Size
+gpdb::GetHashMemoryLimit(void)
+{
+	GP_WRAP_START;
+	{
+		return get_hash_memory_limit();
+	}
+	GP_WRAP_END;
+	return 0;
+}
+
+// memory overhead of a memoize cache entry holding the given number of tuples
+double
+gpdb::EstimateMemoizeEntryOverheadBytes(double ntuples)
+{
+	GP_WRAP_START;
+	{
+		return ExecEstimateCacheEntryOverheadBytes(ntuples);
+	}
+	GP_WRAP_END;
+	return 0;
+}
+
 // returns true if a query cancel is requested in GPDB
 bool
 gpdb::IsAbortRequested(void)
@@ -2821,4 +3377,15 @@ gpdb::TestexprIsHashable(Node *testexpr, List *param_ids)
 	return false;
 }
 
+char
+gpdb::MaxParallelHazard(Query *query)
+{
+	GP_WRAP_START;
+	{
+		return max_parallel_hazard(query);
+	}
+	GP_WRAP_END;
+	return PROPARALLEL_UNSAFE;
+}
+
 // EOF
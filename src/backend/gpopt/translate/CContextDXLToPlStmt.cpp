@@ -57,11 +57,14 @@ CContextDXLToPlStmt::CContextDXLToPlStmt(
 	  m_result_relation_index(0),
 	  m_into_clause(nullptr),
 	  m_distribution_policy(nullptr),
-	  m_part_selector_to_param_map(nullptr)
+	  m_part_selector_to_param_map(nullptr),
+	  m_parallel_scan_workers(nullptr),
+	  m_num_parallel_aware_scans(0)
 {
 	m_cte_consumer_info = GPOS_NEW(m_mp) HMUlCTEConsumerInfo(m_mp);
 	m_part_selector_to_param_map = GPOS_NEW(m_mp) UlongToUlongMap(m_mp);
 	m_used_rte_indexes = GPOS_NEW(m_mp) HMUlIndex(m_mp);
+	m_parallel_scan_workers = GPOS_NEW(m_mp) UlongToUlongMap(m_mp);
 }
 
 //---------------------------------------------------------------------------
@@ -77,6 +80,7 @@ CContextDXLToPlStmt::~CContextDXLToPlStmt()
 	m_cte_consumer_info->Release();
 	m_part_selector_to_param_map->Release();
 	m_used_rte_indexes->Release();
+	m_parallel_scan_workers->Release();
 }
 
 //---------------------------------------------------------------------------
@@ -596,4 +600,74 @@ CContextDXLToPlStmt::GetRTEIndexByAssignedQueryId(
 	return gpdb::ListLength(m_rtable_entries_list) + 1;
 }
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CContextDXLToPlStmt::AddParallelScan
+//
+//	@doc:
+//		Record a seq scan that may run with the given number of workers on
+//		each segment, once its whole slice turns out to be parallel safe
+//
+//---------------------------------------------------------------------------
+void
+CContextDXLToPlStmt::AddParallelScan(ULONG plan_id, ULONG parallel_workers)
+{
+	GPOS_ASSERT(1 < parallel_workers);
+
+	BOOL result GPOS_ASSERTS_ONLY = m_parallel_scan_workers->Insert(
+		GPOS_NEW(m_mp) ULONG(plan_id), GPOS_NEW(m_mp) ULONG(parallel_workers));
+	GPOS_ASSERT(result);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CContextDXLToPlStmt::GetParallelScanWorkers
+//
+//	@doc:
+//		Number of workers of a seq scan, 0 if it must run serially
+//
+//---------------------------------------------------------------------------
+ULONG
+CContextDXLToPlStmt::GetParallelScanWorkers(ULONG plan_id) const
+{
+	const ULONG *parallel_workers = m_parallel_scan_workers->Find(&plan_id);
+	if (nullptr == parallel_workers)
+	{
+		return 0;
+	}
+
+	return *parallel_workers;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CContextDXLToPlStmt::AddParallelAwareScans
+//
+//	@doc:
+//		Record seq scans that were made parallel aware along with their slice
+//
+//---------------------------------------------------------------------------
+void
+CContextDXLToPlStmt::AddParallelAwareScans(ULONG num_scans)
+{
+	m_num_parallel_aware_scans += num_scans;
+	GPOS_ASSERT(m_num_parallel_aware_scans <= m_parallel_scan_workers->Size());
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CContextDXLToPlStmt::HasSerialParallelScans
+//
+//	@doc:
+//		Does any seq scan that ORCA costed with several workers run serially,
+//		because its slice is not safe to run in parallel. Such a plan still
+//		has the motions ORCA added for the random distribution of the scan.
+//
+//---------------------------------------------------------------------------
+BOOL
+CContextDXLToPlStmt::HasSerialParallelScans() const
+{
+	return m_num_parallel_aware_scans < m_parallel_scan_workers->Size();
+}
+
 // EOF
@@ -73,6 +73,7 @@ extern "C" {
 #include "naucrates/dxl/operators/CDXLPhysicalIndexOnlyScan.h"
 #include "naucrates/dxl/operators/CDXLPhysicalLimit.h"
 #include "naucrates/dxl/operators/CDXLPhysicalMaterialize.h"
+#include "naucrates/dxl/operators/CDXLPhysicalMemoize.h"
 #include "naucrates/dxl/operators/CDXLPhysicalMergeJoin.h"
 #include "naucrates/dxl/operators/CDXLPhysicalNLJoin.h"
 #include "naucrates/dxl/operators/CDXLPhysicalPartitionSelector.h"
@@ -439,6 +440,12 @@ CTranslatorDXLToPlStmt::TranslateDXLOperatorToPlan(
 										   ctxt_translation_prev_siblings);
 			break;
 		}
+		case EdxlopPhysicalMemoize:
+		{
+			plan = TranslateDXLMemoize(dxlnode, output_context,
+									   ctxt_translation_prev_siblings);
+			break;
+		}
 		case EdxlopPhysicalSequence:
 		{
 			plan = TranslateDXLSequence(dxlnode, output_context,
@@ -702,6 +709,15 @@ CTranslatorDXLToPlStmt::TranslateDXLTblScan(
 
 	plan->plan_node_id = m_dxl_to_plstmt_context->GetNextPlanId();
 
+	// the scan becomes parallel aware only if its whole slice can run with
+	// several workers, which is known once the slice is complete
+	if (IsA(plan_return, SeqScan) &&
+		1 < phy_tbl_scan_dxlop->GetParallelWorkers())
+	{
+		m_dxl_to_plstmt_context->AddParallelScan(
+			plan->plan_node_id, phy_tbl_scan_dxlop->GetParallelWorkers());
+	}
+
 	// translate operator costs
 	TranslatePlanCosts(tbl_scan_dxlnode, plan);
 
@@ -1620,6 +1636,14 @@ CTranslatorDXLToPlStmt::TranslateDXLHashJoin(
 	hashjoin->hashkeys = outer_hashkeys;
 	hash->hashkeys = inner_hashkeys;
 
+	// filter the outer tuples by a bloom filter of the inner hash keys; the
+	// executor builds the filter along with the hash table, so it has to be
+	// the outer child of the join
+	if (hashjoin_dxlop->HasRuntimeFilter())
+	{
+		left_plan = (Plan *) TranslateRuntimeFilter(left_plan);
+	}
+
 	plan->lefttree = left_plan;
 	plan->righttree = right_plan;
 	SetParamIds(plan);
@@ -1632,6 +1656,38 @@ CTranslatorDXLToPlStmt::TranslateDXLHashJoin(
 	return (Plan *) hashjoin;
 }
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CTranslatorDXLToPlStmt::TranslateRuntimeFilter
+//
+//	@doc:
+//		Create a GPDB RuntimeFilter plan node on top of the given outer child
+//		of a hash join. Like Material, it does not project and passes the
+//		tuples of its child through.
+//
+//---------------------------------------------------------------------------
+RuntimeFilter *
+CTranslatorDXLToPlStmt::TranslateRuntimeFilter(Plan *child_plan)
+{
+	RuntimeFilter *runtime_filter = MakeNode(RuntimeFilter);
+
+	Plan *plan = &(runtime_filter->plan);
+	plan->plan_node_id = m_dxl_to_plstmt_context->GetNextPlanId();
+
+	plan->startup_cost = child_plan->startup_cost;
+	plan->total_cost = child_plan->total_cost;
+	plan->plan_rows = child_plan->plan_rows;
+	plan->plan_width = child_plan->plan_width;
+
+	plan->targetlist = child_plan->targetlist;
+	plan->qual = NIL;
+	plan->lefttree = child_plan;
+
+	SetParamIds(plan);
+
+	return runtime_filter;
+}
+
 //---------------------------------------------------------------------------
 //	@function:
 //		CTranslatorDXLToPlStmt::TranslateDXLTvf
@@ -2242,7 +2298,7 @@ CTranslatorDXLToPlStmt::TranslateDXLMergeJoin(
 				gpdb::ExprCollation((Node *) leftarg);
 
 			// Make sure that the following properties match
-			// those in CPhysicalFullMergeJoin::PosRequired().
+			// those in CPhysicalMergeJoin::PosRequired().
 			merge_join->mergeStrategies[ul] = BTLessStrategyNumber;
 			merge_join->mergeNullsFirst[ul] = false;
 			++ul;
@@ -2526,6 +2582,36 @@ CTranslatorDXLToPlStmt::TranslateDXLMotion(
 
 		motion->hashExprs = hash_expr_list;
 		motion->hashFuncs = hashFuncs;
+
+		// translate the skew values of a hybrid redistribute motion
+		if (EdxlopPhysicalMotionRedistribute ==
+				motion_dxlop->GetDXLOperator() &&
+			CDXLPhysicalRedistributeMotion::Cast(motion_dxlop)->HasSkewValues())
+		{
+			GPOS_ASSERT(1 == numHashExprs);
+
+			CDXLNode *skew_values_dxlnode =
+				(*motion_dxlnode)[EdxlrmIndexSkewValuesList];
+			CMappingColIdVarPlStmt colid_var_mapping(
+				m_mp, nullptr, child_contexts, output_context,
+				m_dxl_to_plstmt_context);
+
+			List *skew_values = NIL;
+			const ULONG num_skew_values = skew_values_dxlnode->Arity();
+			for (ULONG ul = 0; ul < num_skew_values; ul++)
+			{
+				Expr *skew_value =
+					m_translator_dxl_to_scalar->TranslateDXLToScalar(
+						(*skew_values_dxlnode)[ul], &colid_var_mapping);
+				GPOS_ASSERT(IsA(skew_value, Const));
+				skew_values = gpdb::LAppend(skew_values, skew_value);
+			}
+
+			motion->hashSkewValues = skew_values;
+			motion->hashSkewBroadcast =
+				CDXLPhysicalRedistributeMotion::Cast(motion_dxlop)
+					->IsSkewBroadcast();
+		}
 	}
 
 	// cleanup
@@ -2575,11 +2661,391 @@ CTranslatorDXLToPlStmt::TranslateDXLMotion(
 			return nullptr;
 	}
 
+	SetSliceParallelWorkers(motion, sendslice);
+
 	SetParamIds(plan);
 
 	return (Plan *) motion;
 }
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CTranslatorDXLToPlStmt::SetSliceParallelWorkers
+//
+//	@doc:
+//		Let the slice sending to the given motion run with several workers
+//		on each segment. ORCA marks a table scan that may be split among
+//		workers, and only once the slice is complete can we tell whether
+//		all of its other nodes give the same result when every worker runs
+//		them on its share of the rows. The motion then gathers or
+//		redistributes the rows of all workers, so no Gather node is needed.
+//		A slice that stays serial is reported through the context, and the
+//		query is then optimized again with serial scans.
+//
+//---------------------------------------------------------------------------
+void
+CTranslatorDXLToPlStmt::SetSliceParallelWorkers(Motion *motion,
+												PlanSlice *sendslice)
+{
+	if (GANGTYPE_PRIMARY_READER != sendslice->gangType ||
+		(MOTIONTYPE_GATHER != motion->motionType &&
+		 MOTIONTYPE_HASH != motion->motionType &&
+		 MOTIONTYPE_BROADCAST != motion->motionType))
+	{
+		return;
+	}
+
+	Plan *child_plan = motion->plan.lefttree;
+
+	// subplans may need to be rescanned or evaluated by a single process
+	if (NIL != gpdb::ExtractNodesPlan(child_plan, T_SubPlan,
+									  false /* descend_into_subqueries */))
+	{
+		return;
+	}
+
+	SContextParallelSlice ctxt_parallel;
+	EParallelLocus locus = DeriveParallelLocus(child_plan, &ctxt_parallel);
+
+	// a slice producing all rows of a segment in every worker would
+	// produce duplicates
+	if ((EplStrewn != locus && EplHashed != locus) ||
+		1 >= ctxt_parallel.m_parallel_workers)
+	{
+		return;
+	}
+
+	ListCell *lc = nullptr;
+	ForEach(lc, ctxt_parallel.m_parallel_scans)
+	{
+		Plan *scan = (Plan *) lfirst(lc);
+		scan->parallel_aware = true;
+	}
+	m_dxl_to_plstmt_context->AddParallelAwareScans(
+		gpdb::ListLength(ctxt_parallel.m_parallel_scans));
+
+	// the build side of a shared hash table is broadcast to a single worker
+	// of each segment, and the workers build the table together
+	ForEach(lc, ctxt_parallel.m_shared_hash_joins)
+	{
+		HashJoin *hash_join = (HashJoin *) lfirst(lc);
+		Hash *hash = (Hash *) hash_join->join.plan.righttree;
+		Motion *broadcast_motion = (Motion *) hash->plan.lefttree;
+
+		hash_join->join.plan.parallel_aware = true;
+		hash->plan.parallel_aware = true;
+		hash->rows_total = broadcast_motion->plan.plan_rows;
+		broadcast_motion->motionType = MOTIONTYPE_BROADCAST_WORKERS;
+	}
+
+	// the workers wait for each other before probing when the probe side
+	// sends to other slices or builds a shared hash table of its own
+	ForEach(lc, ctxt_parallel.m_shared_hash_joins)
+	{
+		HashJoin *hash_join = (HashJoin *) lfirst(lc);
+		Plan *outer_plan = hash_join->join.plan.lefttree;
+
+		hash_join->outer_motionhazard = SliceContainsNode(
+			outer_plan, T_Motion, false /* parallel_aware_only */);
+		hash_join->batch0_barrier = SliceContainsNode(
+			outer_plan, T_HashJoin, true /* parallel_aware_only */);
+	}
+
+	SetSliceParallel(child_plan, ctxt_parallel.m_parallel_workers);
+	sendslice->parallel_workers = (int) ctxt_parallel.m_parallel_workers;
+
+	gpdb::ListFree(ctxt_parallel.m_parallel_scans);
+	gpdb::ListFree(ctxt_parallel.m_shared_hash_joins);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CTranslatorDXLToPlStmt::DeriveParallelLocus
+//
+//	@doc:
+//		Derive how the rows of a plan subtree of a slice are spread over its
+//		workers, and collect the parallel scans and shared hash tables the
+//		subtree would use. Receiving motions are leaves of the slice.
+//
+//---------------------------------------------------------------------------
+CTranslatorDXLToPlStmt::EParallelLocus
+CTranslatorDXLToPlStmt::DeriveParallelLocus(
+	Plan *plan, SContextParallelSlice *ctxt_parallel)
+{
+	GPOS_ASSERT(nullptr != plan);
+
+	switch (nodeTag(plan))
+	{
+		case T_SeqScan:
+		{
+			ULONG parallel_workers =
+				m_dxl_to_plstmt_context->GetParallelScanWorkers(
+					plan->plan_node_id);
+			if (1 >= parallel_workers)
+			{
+				return EplFull;
+			}
+
+			ctxt_parallel->m_parallel_workers =
+				std::max(ctxt_parallel->m_parallel_workers, parallel_workers);
+			ctxt_parallel->m_parallel_scans =
+				gpdb::LAppend(ctxt_parallel->m_parallel_scans, plan);
+			return EplStrewn;
+		}
+		case T_DynamicSeqScan:
+		case T_IndexScan:
+		case T_DynamicIndexScan:
+		case T_IndexOnlyScan:
+		case T_DynamicIndexOnlyScan:
+		case T_BitmapHeapScan:
+		case T_DynamicBitmapHeapScan:
+		case T_FunctionScan:
+		case T_ValuesScan:
+		{
+			return EplFull;
+		}
+		case T_Motion:
+		{
+			Motion *motion = (Motion *) plan;
+
+			// every worker receives all broadcast rows, and a redistribute
+			// motion hashes its rows to a single worker
+			if (MOTIONTYPE_BROADCAST == motion->motionType)
+			{
+				return EplFull;
+			}
+			if (MOTIONTYPE_HASH == motion->motionType &&
+				NIL == motion->hashSkewValues)
+			{
+				return (NIL == motion->hashExprs) ? EplStrewn : EplHashed;
+			}
+			return EplInvalid;
+		}
+		case T_HashJoin:
+		case T_NestLoop:
+		case T_MergeJoin:
+		{
+			return DeriveParallelLocusJoin((Join *) plan, ctxt_parallel);
+		}
+		case T_Result:
+		case T_ProjectSet:
+		case T_Sort:
+		case T_Agg:
+		case T_WindowAgg:
+		case T_Limit:
+		case T_Unique:
+		case T_Material:
+		case T_Hash:
+		{
+			// aggregates and limits below a motion are local to each worker
+			// and completed above the motion
+			if (nullptr == plan->lefttree)
+			{
+				return EplFull;
+			}
+			return DeriveParallelLocus(plan->lefttree, ctxt_parallel);
+		}
+		case T_Append:
+		{
+			Append *append = (Append *) plan;
+			EParallelLocus locus = EplInvalid;
+
+			ListCell *lc = nullptr;
+			ForEach(lc, append->appendplans)
+			{
+				EParallelLocus child_locus =
+					DeriveParallelLocus((Plan *) lfirst(lc), ctxt_parallel);
+				if (EplInvalid == child_locus ||
+					(EplInvalid != locus &&
+					 (EplFull == locus) != (EplFull == child_locus)))
+				{
+					return EplInvalid;
+				}
+
+				// a mix of hashed and strewn children is only strewn
+				locus = (EplInvalid == locus || locus == child_locus)
+							? child_locus
+							: EplStrewn;
+			}
+			return locus;
+		}
+		default:
+		{
+			return EplInvalid;
+		}
+	}
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CTranslatorDXLToPlStmt::DeriveParallelLocusJoin
+//
+//	@doc:
+//		Derive the parallel locus of a join. Every worker joins its share
+//		of the outer rows with all inner rows of the segment, or its share
+//		of the outer rows with the inner rows hashed to the same worker.
+//
+//---------------------------------------------------------------------------
+CTranslatorDXLToPlStmt::EParallelLocus
+CTranslatorDXLToPlStmt::DeriveParallelLocusJoin(
+	Join *join, SContextParallelSlice *ctxt_parallel)
+{
+	Plan *plan = &join->plan;
+	const ULONG num_shared_hash_joins =
+		gpdb::ListLength(ctxt_parallel->m_shared_hash_joins);
+
+	EParallelLocus outer_locus =
+		DeriveParallelLocus(plan->lefttree, ctxt_parallel);
+	BOOL outer_has_shared_hash_join =
+		num_shared_hash_joins <
+		(ULONG) gpdb::ListLength(ctxt_parallel->m_shared_hash_joins);
+
+	const ULONG num_parallel_scans =
+		gpdb::ListLength(ctxt_parallel->m_parallel_scans);
+	EParallelLocus inner_locus =
+		DeriveParallelLocus(plan->righttree, ctxt_parallel);
+
+	// a parallel scan cannot be rescanned by a single worker
+	if (!IsA(join, HashJoin) &&
+		num_parallel_scans <
+			(ULONG) gpdb::ListLength(ctxt_parallel->m_parallel_scans))
+	{
+		return EplInvalid;
+	}
+
+	if (EplInvalid == outer_locus || EplInvalid == inner_locus)
+	{
+		return EplInvalid;
+	}
+
+	if (EplFull == outer_locus && EplFull == inner_locus)
+	{
+		return EplFull;
+	}
+
+	// both sides are hashed to the workers on the join keys
+	if (EplHashed == outer_locus && EplHashed == inner_locus)
+	{
+		return EplHashed;
+	}
+
+	// unmatched inner rows would be emitted by every worker
+	if (EplFull == inner_locus &&
+		(JOIN_INNER == join->jointype || JOIN_LEFT == join->jointype ||
+		 JOIN_SEMI == join->jointype || JOIN_ANTI == join->jointype ||
+		 JOIN_LASJ_NOTIN == join->jointype))
+	{
+		BOOL is_shared_hash_join = false;
+		if (IsA(join, HashJoin) && JOIN_LASJ_NOTIN != join->jointype)
+		{
+			Plan *build_plan = plan->righttree->lefttree;
+			is_shared_hash_join =
+				IsA(build_plan, Motion) &&
+				MOTIONTYPE_BROADCAST == ((Motion *) build_plan)->motionType;
+		}
+
+		// a worker must not wait on a shared hash table of its probe side
+		// while its siblings wait on a hash table of its own
+		if (outer_has_shared_hash_join && !is_shared_hash_join)
+		{
+			return EplInvalid;
+		}
+
+		if (is_shared_hash_join)
+		{
+			ctxt_parallel->m_shared_hash_joins =
+				gpdb::LAppend(ctxt_parallel->m_shared_hash_joins, join);
+		}
+		return outer_locus;
+	}
+
+	if (EplFull == outer_locus && JOIN_INNER == join->jointype)
+	{
+		return EplStrewn;
+	}
+
+	return EplInvalid;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CTranslatorDXLToPlStmt::SliceContainsNode
+//
+//	@doc:
+//		Check if a plan subtree of a slice contains a node of the given
+//		type, without looking past receiving motions
+//
+//---------------------------------------------------------------------------
+BOOL
+CTranslatorDXLToPlStmt::SliceContainsNode(Plan *plan, NodeTag tag,
+										  BOOL parallel_aware_only)
+{
+	if (nullptr == plan)
+	{
+		return false;
+	}
+
+	if (tag == nodeTag(plan) && (!parallel_aware_only || plan->parallel_aware))
+	{
+		return true;
+	}
+
+	if (IsA(plan, Motion))
+	{
+		return false;
+	}
+
+	if (IsA(plan, Append))
+	{
+		ListCell *lc = nullptr;
+		ForEach(lc, ((Append *) plan)->appendplans)
+		{
+			if (SliceContainsNode((Plan *) lfirst(lc), tag,
+								  parallel_aware_only))
+			{
+				return true;
+			}
+		}
+		return false;
+	}
+
+	return SliceContainsNode(plan->lefttree, tag, parallel_aware_only) ||
+		   SliceContainsNode(plan->righttree, tag, parallel_aware_only);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CTranslatorDXLToPlStmt::SetSliceParallel
+//
+//	@doc:
+//		Set the number of workers of the plan nodes of a slice, without
+//		looking past receiving motions
+//
+//---------------------------------------------------------------------------
+void
+CTranslatorDXLToPlStmt::SetSliceParallel(Plan *plan, ULONG parallel_workers)
+{
+	if (nullptr == plan || IsA(plan, Motion))
+	{
+		return;
+	}
+
+	plan->parallel = (int) parallel_workers;
+
+	if (IsA(plan, Append))
+	{
+		ListCell *lc = nullptr;
+		ForEach(lc, ((Append *) plan)->appendplans)
+		{
+			SetSliceParallel((Plan *) lfirst(lc), parallel_workers);
+		}
+		return;
+	}
+
+	SetSliceParallel(plan->lefttree, parallel_workers);
+	SetSliceParallel(plan->righttree, parallel_workers);
+}
+
 //---------------------------------------------------------------------------
 //	@function:
 //		CTranslatorDXLToPlStmt::TranslateDXLRedistributeMotionToResultHashFilters
@@ -3240,7 +3706,9 @@ CTranslatorDXLToPlStmt::TranslateDXLWindow(
 //		CTranslatorDXLToPlStmt::TranslateDXLSort
 //
 //	@doc:
-//		Translate DXL sort node into GPDB Sort plan node
+//		Translate DXL sort node into GPDB Sort plan node, or into an
+//		IncrementalSort plan node if its input is sorted on a prefix of the
+//		sort columns
 //
 //---------------------------------------------------------------------------
 Plan *
@@ -3253,8 +3721,22 @@ CTranslatorDXLToPlStmt::TranslateDXLSort(
 	GPOS_ASSERT(EdxlopPhysicalSort ==
 				sort_dxlnode->GetOperator()->GetDXLOperator());
 
+	CDXLPhysicalSort *dxl_sort =
+		CDXLPhysicalSort::Cast(sort_dxlnode->GetOperator());
+	const ULONG num_presorted_keys = dxl_sort->GetNumPresortedKeys();
+
 	// create sort plan node
-	Sort *sort = MakeNode(Sort);
+	Sort *sort = nullptr;
+	if (0 < num_presorted_keys)
+	{
+		IncrementalSort *incremental_sort = MakeNode(IncrementalSort);
+		incremental_sort->nPresortedCols = num_presorted_keys;
+		sort = &(incremental_sort->sort);
+	}
+	else
+	{
+		sort = MakeNode(Sort);
+	}
 
 	Plan *plan = &(sort->plan);
 	plan->plan_node_id = m_dxl_to_plstmt_context->GetNextPlanId();
@@ -4059,6 +4541,131 @@ CTranslatorDXLToPlStmt::TranslateDXLMaterialize(
 	return (Plan *) materialize;
 }
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CTranslatorDXLToPlStmt::TranslateDXLMemoize
+//
+//	@doc:
+//		Translate DXL memoize node into GPDB Memoize plan node. The cache
+//		keys are the params the enclosing nested loop join binds the outer
+//		references to. If any of them can not be hashed, the child plan is
+//		returned without a cache on top of it.
+//
+//---------------------------------------------------------------------------
+Plan *
+CTranslatorDXLToPlStmt::TranslateDXLMemoize(
+	const CDXLNode *memoize_dxlnode, CDXLTranslateContext *output_context,
+	CDXLTranslationContextArray *ctxt_translation_prev_siblings)
+{
+	CDXLPhysicalMemoize *memoize_dxlop =
+		CDXLPhysicalMemoize::Cast(memoize_dxlnode->GetOperator());
+
+	CDXLNode *child_dxlnode = (*memoize_dxlnode)[EdxlmemoizeIndexChild];
+	CDXLNode *project_list_dxlnode =
+		(*memoize_dxlnode)[EdxlmemoizeIndexProjList];
+	CDXLNode *filter_dxlnode = (*memoize_dxlnode)[EdxlmemoizeIndexFilter];
+
+	// translate the cache keys into the params bound by the nested loop join
+	ULongPtrArray *cache_key_colids = memoize_dxlop->GetCacheKeyColIds();
+	const ULONG num_keys = cache_key_colids->Size();
+	Oid *hash_operators = (Oid *) gpdb::GPDBAlloc(num_keys * sizeof(Oid));
+	Oid *collations = (Oid *) gpdb::GPDBAlloc(num_keys * sizeof(Oid));
+	List *param_exprs = NIL;
+	Bitmapset *keyparamids = nullptr;
+	BOOL is_hashable = true;
+	for (ULONG ul = 0; is_hashable && ul < num_keys; ul++)
+	{
+		const CMappingElementColIdParamId *colid_param_mapping =
+			output_context->GetParamIdMappingElement(*(*cache_key_colids)[ul]);
+		if (nullptr == colid_param_mapping)
+		{
+			is_hashable = false;
+			break;
+		}
+
+		Param *param = MakeNode(Param);
+		param->paramkind = PARAM_EXEC;
+		param->paramid = colid_param_mapping->ParamId();
+		param->paramtype =
+			CMDIdGPDB::CastMdid(colid_param_mapping->MdidType())->Oid();
+		param->paramtypmod = colid_param_mapping->TypeModifier();
+		param->paramcollid = gpdb::TypeCollation(param->paramtype);
+		param->location = -1;
+
+		TypeCacheEntry *typentry = gpdb::LookupTypeCache(
+			param->paramtype, TYPECACHE_HASH_PROC | TYPECACHE_EQ_OPR);
+		is_hashable =
+			OidIsValid(typentry->hash_proc) && OidIsValid(typentry->eq_opr);
+
+		hash_operators[ul] = typentry->eq_opr;
+		collations[ul] = param->paramcollid;
+		param_exprs = gpdb::LAppend(param_exprs, param);
+		keyparamids = gpdb::BmsAddMember(keyparamids, param->paramid);
+	}
+
+	if (!is_hashable)
+	{
+		// the child produces the same columns as the memoize node
+		gpdb::GPDBFree(hash_operators);
+		gpdb::GPDBFree(collations);
+		return TranslateDXLOperatorToPlan(child_dxlnode, output_context,
+										  ctxt_translation_prev_siblings);
+	}
+
+	CDXLTranslateContext child_context(m_mp, false,
+									   output_context->GetColIdToParamIdMap());
+
+	Plan *child_plan = TranslateDXLOperatorToPlan(
+		child_dxlnode, &child_context, ctxt_translation_prev_siblings);
+
+	// create memoize plan node
+	Memoize *memoize = MakeNode(Memoize);
+
+	Plan *plan = &(memoize->plan);
+	plan->plan_node_id = m_dxl_to_plstmt_context->GetNextPlanId();
+
+	// translate operator costs
+	TranslatePlanCosts(memoize_dxlnode, plan);
+
+	memoize->numKeys = num_keys;
+	memoize->hashOperators = hash_operators;
+	memoize->collations = collations;
+	memoize->param_exprs = param_exprs;
+	memoize->singlerow = false;
+	memoize->binary_mode = false;
+	memoize->keyparamids = keyparamids;
+
+	// size the cache for the distinct keys that fit into hash memory, like
+	// the planner does
+	double entry_bytes =
+		plan->plan_rows * plan->plan_width +
+		gpdb::EstimateMemoizeEntryOverheadBytes(plan->plan_rows);
+	double est_entries =
+		std::min(memoize_dxlop->GetNumDistinct().Get(),
+				 gpdb::GetHashMemoryLimit() / std::max(entry_bytes, 1.0));
+	memoize->est_entries =
+		(uint32) std::max(1.0, std::min(est_entries, (double) PG_UINT32_MAX));
+
+	CDXLTranslationContextArray *child_contexts =
+		GPOS_NEW(m_mp) CDXLTranslationContextArray(m_mp);
+	child_contexts->Append(&child_context);
+
+	// translate proj list and filter
+	TranslateProjListAndFilter(project_list_dxlnode, filter_dxlnode,
+							   nullptr,	 // translate context for the base table
+							   child_contexts, &plan->targetlist, &plan->qual,
+							   output_context);
+
+	plan->lefttree = child_plan;
+
+	SetParamIds(plan);
+
+	// cleanup
+	child_contexts->Release();
+
+	return (Plan *) memoize;
+}
+
 //---------------------------------------------------------------------------
 //	@function:
 //		CTranslatorDXLToPlStmt::TranslateDXLCTEProducerToSharedScan
@@ -5762,6 +6369,8 @@ CTranslatorDXLToPlStmt::TranslatePlanCosts(const CDXLNode *dxlnode, Plan *plan)
 	plan->plan_rows =
 		ceil(CostFromStr(costs->GetRowsOutStr()) /
 			 m_dxl_to_plstmt_context->GetCurrentSlice()->numsegments);
+
+	plan->cardinality_fingerprint = costs->GetCardinalityFingerprint();
 }
 
 //---------------------------------------------------------------------------
@@ -19,6 +19,7 @@ extern "C" {
 #include "access/heapam.h"
 #include "catalog/heap.h"
 #include "catalog/namespace.h"
+#include "catalog/pg_aggregate.h"
 #include "catalog/pg_am.h"
 #include "catalog/pg_proc.h"
 #include "catalog/pg_statistic.h"
@@ -55,6 +56,7 @@ extern "C" {
 #include "naucrates/md/CDXLColStats.h"
 #include "naucrates/md/CDXLExtStats.h"
 #include "naucrates/md/CDXLExtStatsInfo.h"
+#include "naucrates/md/CDXLMatViewInfo.h"
 #include "naucrates/md/CDXLRelStats.h"
 #include "naucrates/md/CMDArrayCoerceCastGPDB.h"
 #include "naucrates/md/CMDCastGPDB.h"
@@ -142,6 +144,10 @@ CTranslatorRelcacheToDXL::RetrieveObject(CMemoryPool *mp,
 			md_obj = RetrieveExtStatsInfo(mp, mdid);
 			break;
 
+		case IMDId::EmdidMatViewInfo:
+			md_obj = RetrieveMatViewInfo(mp, md_accessor, mdid);
+			break;
+
 		default:
 			break;
 	}
@@ -383,13 +389,90 @@ CTranslatorRelcacheToDXL::RetrieveExtStats(CMemoryPool *mp, IMDId *mdid)
 		}
 	}
 
+	CMDMCVList *md_mcv_list = nullptr;
+	if (list_member_int(kinds, STATS_EXT_MCV))
+	{
+		md_mcv_list = RetrieveExtStatsMCVList(mp, stat_oid);
+	}
+
 	const CWStringConst *statname =
 		GPOS_NEW(mp) CWStringConst(CDXLUtils::CreateDynamicStringFromCharArray(
 									   mp, gpdb::GetExtStatsName(stat_oid))
 									   ->GetBuffer());
 	CMDName *mdname = GPOS_NEW(mp) CMDName(mp, statname);
 
-	return GPOS_NEW(mp) CDXLExtStats(mp, mdid, mdname, deps, md_ndistincts);
+	return GPOS_NEW(mp)
+		CDXLExtStats(mp, mdid, mdname, deps, md_ndistincts, md_mcv_list);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CTranslatorRelcacheToDXL::RetrieveExtStatsMCVList
+//
+//	@doc:
+//		Retrieve the MCV list of an extended statistic object from relcache.
+//		Returns null if the list is not built, or if the object is defined
+//		on expressions.
+//
+//---------------------------------------------------------------------------
+CMDMCVList *
+CTranslatorRelcacheToDXL::RetrieveExtStatsMCVList(CMemoryPool *mp,
+												  OID stat_oid)
+{
+	List *keys = gpdb::GetExtStatsKeys(stat_oid);
+	if (NIL == keys)
+	{
+		return nullptr;
+	}
+
+	MCVList *mcv_list = gpdb::GetMVMCVList(stat_oid);
+	if (nullptr == mcv_list ||
+		mcv_list->ndimensions != (AttrNumber) gpdb::ListLength(keys))
+	{
+		return nullptr;
+	}
+
+	// the dimensions are in the order of the sorted attnos
+	CBitSet *attnos = GPOS_NEW(mp) CBitSet(mp);
+	ListCell *lc = nullptr;
+	ForEach(lc, keys)
+	{
+		attnos->ExchangeSet(lfirst_int(lc));
+	}
+
+	IMDType *md_types[STATS_MAX_DIMENSIONS];
+	for (AttrNumber dim = 0; dim < mcv_list->ndimensions; dim++)
+	{
+		CMDIdGPDB *mdid_type =
+			GPOS_NEW(mp) CMDIdGPDB(IMDId::EmdidGeneral, mcv_list->types[dim]);
+		md_types[dim] = RetrieveType(mp, mdid_type);
+		mdid_type->Release();
+	}
+
+	CMDMCVItemArray *items = GPOS_NEW(mp) CMDMCVItemArray(mp);
+	for (ULONG ul = 0; ul < mcv_list->nitems; ul++)
+	{
+		MCVItem *item = &mcv_list->items[ul];
+
+		CDXLDatumArray *values = GPOS_NEW(mp) CDXLDatumArray(mp);
+		for (AttrNumber dim = 0; dim < mcv_list->ndimensions; dim++)
+		{
+			IDatum *datum = CTranslatorScalarToDXL::CreateIDatumFromGpdbDatum(
+				mp, md_types[dim], item->isnull[dim], item->values[dim]);
+			values->Append(md_types[dim]->GetDatumVal(mp, datum));
+			datum->Release();
+		}
+
+		items->Append(GPOS_NEW(mp) CMDMCVItem(
+			CDouble(item->frequency), CDouble(item->base_frequency), values));
+	}
+
+	for (AttrNumber dim = 0; dim < mcv_list->ndimensions; dim++)
+	{
+		md_types[dim]->Release();
+	}
+
+	return GPOS_NEW(mp) CMDMCVList(mp, attnos, items);
 }
 
 //---------------------------------------------------------------------------
@@ -472,6 +555,277 @@ CTranslatorRelcacheToDXL::RetrieveExtStatsInfo(CMemoryPool *mp, IMDId *mdid)
 										 extstats_info_array);
 }
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CTranslatorRelcacheToDXL::RetrieveMatViewInfo
+//
+//	@doc:
+//		Retrieve the materialized views over a relation that are up to date
+//		and readable by the current user, and that ORCA can match queries
+//		against
+//
+//---------------------------------------------------------------------------
+IMDCacheObject *
+CTranslatorRelcacheToDXL::RetrieveMatViewInfo(CMemoryPool *mp,
+											  CMDAccessor *md_accessor,
+											  IMDId *mdid)
+{
+	OID rel_oid = CMDIdGPDB::CastMdid(mdid)->Oid();
+
+	CMDMatViewArray *matview_array = GPOS_NEW(mp) CMDMatViewArray(mp);
+
+	gpdb::RelationWrapper rel = gpdb::GetRelation(rel_oid);
+	List *mv_oids = gpdb::GetRelationUsableMatViews(rel_oid);
+
+	ListCell *lc = nullptr;
+	ForEach(lc, mv_oids)
+	{
+		CMDMatView *matview =
+			RetrieveMatView(mp, md_accessor, rel_oid, lfirst_oid(lc));
+		if (nullptr != matview)
+		{
+			matview_array->Append(matview);
+		}
+	}
+
+	mdid->AddRef();
+	return GPOS_NEW(mp) CDXLMatViewInfo(mp, mdid, GetRelName(mp, rel.get()),
+										matview_array);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CTranslatorRelcacheToDXL::RetrieveMatView
+//
+//	@doc:
+//		Describe a materialized view by the columns, grouping columns and
+//		filter of its base relation it is derived from. Only views scanning
+//		the relation, optionally filtering it and grouping it with simple
+//		aggregates, are described.
+//
+//---------------------------------------------------------------------------
+CMDMatView *
+CTranslatorRelcacheToDXL::RetrieveMatView(CMemoryPool *mp,
+										  CMDAccessor *md_accessor,
+										  OID rel_oid, OID mv_oid)
+{
+	Query *query = gpdb::GetMatViewQuery(mv_oid);
+
+	if (CMD_SELECT != query->commandType || query->hasWindowFuncs ||
+		query->hasDistinctOn || query->hasSubLinks || query->hasTargetSRFs ||
+		query->hasModifyingCTE || nullptr != query->distinctClause ||
+		nullptr != query->groupingSets || nullptr != query->havingQual ||
+		nullptr != query->limitCount || nullptr != query->limitOffset ||
+		nullptr != query->cteList || nullptr != query->setOperations ||
+		nullptr != query->rowMarks || nullptr != query->scatterClause ||
+		1 != gpdb::ListLength(query->jointree->fromlist))
+	{
+		return nullptr;
+	}
+
+	// the rule action of the view may also list the OLD and NEW relations
+	Node *jtnode = (Node *) gpdb::ListNth(query->jointree->fromlist, 0);
+	if (!IsA(jtnode, RangeTblRef))
+	{
+		return nullptr;
+	}
+	Index rtindex = ((RangeTblRef *) jtnode)->rtindex;
+	RangeTblEntry *rte =
+		(RangeTblEntry *) gpdb::ListNth(query->rtable, rtindex - 1);
+	if (RTE_RELATION != rte->rtekind || rel_oid != rte->relid)
+	{
+		return nullptr;
+	}
+
+	if (nullptr != query->jointree->quals &&
+		HasUnsupportedMatViewFilterNode(query->jointree->quals, &rtindex))
+	{
+		return nullptr;
+	}
+
+	// grouping columns must be plain columns of the relation
+	ULongPtrArray *grouping_attnos = nullptr;
+	if (query->hasAggs || nullptr != query->groupClause)
+	{
+		grouping_attnos = GPOS_NEW(mp) ULongPtrArray(mp);
+	}
+
+	ListCell *lc = nullptr;
+	ForEach(lc, query->groupClause)
+	{
+		SortGroupClause *group_clause = (SortGroupClause *) lfirst(lc);
+		TargetEntry *target_entry = nullptr;
+
+		ListCell *lc_te = nullptr;
+		ForEach(lc_te, query->targetList)
+		{
+			TargetEntry *te = (TargetEntry *) lfirst(lc_te);
+			if (te->ressortgroupref == group_clause->tleSortGroupRef)
+			{
+				target_entry = te;
+				break;
+			}
+		}
+
+		Var *var = (Var *) (nullptr != target_entry ? target_entry->expr
+													 : nullptr);
+		if (nullptr == var || !IsA(var, Var) || rtindex != var->varno ||
+			0 != var->varlevelsup || 0 >= var->varattno)
+		{
+			grouping_attnos->Release();
+			return nullptr;
+		}
+		grouping_attnos->Append(GPOS_NEW(mp) ULONG(var->varattno));
+	}
+
+	// describe the derivation of each column of the view, columns that can
+	// not be derived from the relation are never matched
+	CMDMatViewColumnArray *columns = GPOS_NEW(mp) CMDMatViewColumnArray(mp);
+	ForEach(lc, query->targetList)
+	{
+		TargetEntry *te = (TargetEntry *) lfirst(lc);
+		if (te->resjunk)
+		{
+			continue;
+		}
+
+		INT attno = 0;
+		IMDId *agg_mdid = nullptr;
+		BOOL is_combinable = false;
+		Node *expr = (Node *) te->expr;
+		if (IsA(expr, Var))
+		{
+			Var *var = (Var *) expr;
+			if (rtindex == var->varno && 0 == var->varlevelsup &&
+				0 < var->varattno)
+			{
+				attno = var->varattno;
+			}
+		}
+		else if (IsA(expr, Aggref))
+		{
+			Aggref *aggref = (Aggref *) expr;
+			Var *arg = nullptr;
+			if (1 == gpdb::ListLength(aggref->args))
+			{
+				arg = (Var *) ((TargetEntry *) gpdb::ListNth(aggref->args, 0))
+						  ->expr;
+			}
+
+			BOOL is_simple_agg =
+				nullptr == aggref->aggfilter && nullptr == aggref->aggorder &&
+				nullptr == aggref->aggdistinct &&
+				nullptr == aggref->aggdirectargs &&
+				AGGKIND_NORMAL == aggref->aggkind && 0 == aggref->agglevelsup;
+			BOOL is_simple_arg =
+				nullptr == aggref->args ||
+				(nullptr != arg && IsA(arg, Var) && rtindex == arg->varno &&
+				 0 == arg->varlevelsup && 0 < arg->varattno);
+			if (is_simple_agg && is_simple_arg)
+			{
+				attno = (nullptr != arg) ? arg->varattno : 0;
+				agg_mdid = GPOS_NEW(mp)
+					CMDIdGPDB(IMDId::EmdidGeneral, aggref->aggfnoid);
+				is_combinable = gpdb::IsAggRollupCapable(aggref->aggfnoid);
+			}
+		}
+
+		columns->Append(GPOS_NEW(mp)
+							CMDMatViewColumn(attno, agg_mdid, is_combinable));
+	}
+
+	// translate the filter over the columns of the relation, using the same
+	// column ids as check constraints
+	CDXLNode *filter_dxlnode = nullptr;
+	if (nullptr != query->jointree->quals)
+	{
+		CMappingVarColId *var_colid_mapping =
+			GPOS_NEW(mp) CMappingVarColId(mp);
+		CDXLColDescrArray *dxl_col_descr_array =
+			GPOS_NEW(mp) CDXLColDescrArray(mp);
+		CMDIdGPDB *rel_mdid = GPOS_NEW(mp) CMDIdGPDB(IMDId::EmdidRel, rel_oid);
+		const IMDRelation *md_rel = md_accessor->RetrieveRel(rel_mdid);
+		rel_mdid->Release();
+		const ULONG length = md_rel->ColumnCount();
+		for (ULONG ul = 0; ul < length; ul++)
+		{
+			const IMDColumn *md_col = md_rel->GetMdCol(ul);
+
+			if (md_col->IsDropped())
+			{
+				continue;
+			}
+
+			CMDName *md_colname =
+				GPOS_NEW(mp) CMDName(mp, md_col->Mdname().GetMDName());
+			CMDIdGPDB *mdid_col_type = CMDIdGPDB::CastMdid(md_col->MdidType());
+			mdid_col_type->AddRef();
+
+			CDXLColDescr *dxl_col_descr = GPOS_NEW(mp) CDXLColDescr(
+				md_colname, ul + 1 /*colid*/, md_col->AttrNum(), mdid_col_type,
+				md_col->TypeModifier(), false /* fColDropped */
+			);
+			dxl_col_descr_array->Append(dxl_col_descr);
+		}
+		var_colid_mapping->LoadColumns(0 /*query_level */, rtindex,
+									   dxl_col_descr_array);
+
+		filter_dxlnode = CTranslatorScalarToDXL::TranslateStandaloneExprToDXL(
+			mp, md_accessor, var_colid_mapping,
+			(Expr *) query->jointree->quals);
+
+		dxl_col_descr_array->Release();
+		GPOS_DELETE(var_colid_mapping);
+	}
+
+	gpdb::RelationWrapper mv_rel = gpdb::GetRelation(mv_oid);
+
+	return GPOS_NEW(mp) CMDMatView(
+		mp, GPOS_NEW(mp) CMDIdGPDB(IMDId::EmdidRel, mv_oid),
+		GetRelName(mp, mv_rel.get()), grouping_attnos, columns, filter_dxlnode);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CTranslatorRelcacheToDXL::HasUnsupportedMatViewFilterNode
+//
+//	@doc:
+//		Does the filter of a materialized view contain anything but
+//		comparisons and boolean combinations of the columns of its relation
+//		and constants? Such filters are left to the Postgres planner.
+//
+//---------------------------------------------------------------------------
+BOOL
+CTranslatorRelcacheToDXL::HasUnsupportedMatViewFilterNode(Node *node,
+														  void *context)
+{
+	if (nullptr == node)
+	{
+		return false;
+	}
+
+	if (IsA(node, Var))
+	{
+		Var *var = (Var *) node;
+		return *(Index *) context != var->varno || 0 != var->varlevelsup ||
+			   0 >= var->varattno;
+	}
+
+	if (!IsA(node, Const) && !IsA(node, OpExpr) && !IsA(node, BoolExpr) &&
+		!IsA(node, NullTest) && !IsA(node, BooleanTest) &&
+		!IsA(node, ScalarArrayOpExpr) && !IsA(node, RelabelType) &&
+		!IsA(node, FuncExpr) && !IsA(node, List))
+	{
+		return true;
+	}
+
+	return gpdb::WalkExpressionTree(
+		node,
+		(bool (*)(Node *, void *))
+			CTranslatorRelcacheToDXL::HasUnsupportedMatViewFilterNode,
+		context);
+}
+
 //---------------------------------------------------------------------------
 //	@function:
 //		CTranslatorRelcacheToDXL::RetrieveRel
@@ -2047,14 +2401,25 @@ CTranslatorRelcacheToDXL::RetrieveColStats(CMemoryPool *mp,
 	gpdb::FreeAttrStatsSlot(&mcv_slot);
 	gpdb::FreeAttrStatsSlot(&hist_slot);
 
+	// sketch of the distinct values, kept by ANALYZE FULLSCAN
+	CHyperLogLog *hll = nullptr;
+	int precision = 0;
+	uint8 *registers = gpdb::GetAttStatsHLLRegisters(stats_tup, &precision);
+	if (nullptr != registers)
+	{
+		hll = CHyperLogLog::Make(mp, (ULONG) precision, registers,
+								 (ULONG) 1 << precision);
+		gpdb::GPDBFree(registers);
+	}
+
 	gpdb::FreeHeapTuple(stats_tup);
 
 	// create col stats object
 	mdid_col_stats->AddRef();
 	CDXLColStats *dxl_col_stats = GPOS_NEW(mp) CDXLColStats(
 		mp, mdid_col_stats, md_colname, width, null_freq, distinct_remaining,
-		freq_remaining, dxl_stats_bucket_array, false /* is_col_stats_missing */
-	);
+		freq_remaining, dxl_stats_bucket_array,
+		false /* is_col_stats_missing */, hll);
 
 	return dxl_col_stats;
 }
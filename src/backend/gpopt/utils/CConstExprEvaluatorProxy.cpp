@@ -17,12 +17,14 @@
 extern "C" {
 #include "postgres.h"
 
+#include "catalog/pg_type.h"
 #include "executor/executor.h"
 }
 
 #include "gpopt/gpdbwrappers.h"
 #include "gpopt/translate/CTranslatorScalarToDXL.h"
 #include "gpopt/utils/CConstExprEvaluatorProxy.h"
+#include "naucrates/base/IDatumGeneric.h"
 #include "naucrates/dxl/operators/CDXLNode.h"
 #include "naucrates/exception.h"
 
@@ -30,6 +32,7 @@ using namespace gpdxl;
 using namespace gpmd;
 using namespace gpos;
 
+ULONG CConstExprEvaluatorProxy::m_ulSortKeyBatch = 0;
 
 //---------------------------------------------------------------------------
 //	@function:
@@ -94,4 +97,95 @@ CConstExprEvaluatorProxy::EvaluateExpr(const CDXLNode *dxl_expr)
 	return dxl_result;
 }
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CConstExprEvaluatorProxy::FComputeSortKeys
+//
+//	@doc:
+//		Compute the sort keys of the given non-null datums of the same type and
+//		cache them on the datums. Character values under the C collation sort
+//		bytewise, so their keys are their bytes, which compare with any other
+//		such keys. Otherwise, the values are sorted once with the comparison
+//		function of their type and the keys are their ranks, which only
+//		compare with keys from the same call.
+//
+//---------------------------------------------------------------------------
+BOOL
+CConstExprEvaluatorProxy::FComputeSortKeys(const IDatumArray *pdrgpdatum)
+{
+	const ULONG size = pdrgpdatum->Size();
+	if (0 == size)
+	{
+		return false;
+	}
+
+	IMDId *mdid = (*pdrgpdatum)[0]->MDId();
+	for (ULONG ul = 0; ul < size; ul++)
+	{
+		IDatum *datum = (*pdrgpdatum)[ul];
+		if (datum->IsNull() || IMDType::EtiGeneric != datum->GetDatumType() ||
+			!mdid->Equals(datum->MDId()))
+		{
+			return false;
+		}
+	}
+
+	const IMDType *md_type = m_md_accessor->RetrieveType(mdid);
+	Oid type = CMDIdGPDB::CastMdid(mdid)->Oid();
+	Oid collation = gpdb::TypeCollation(type);
+
+	Datum *values = GPOS_NEW_ARRAY(m_mp, Datum, size);
+	for (ULONG ul = 0; ul < size; ul++)
+	{
+		IDatum *datum = (*pdrgpdatum)[ul];
+		if (md_type->IsPassedByValue())
+		{
+			values[ul] = (Datum) 0;
+			memcpy(&values[ul], datum->GetByteArrayValue(),
+				   std::min((ULONG) sizeof(Datum), datum->Size()));
+		}
+		else
+		{
+			values[ul] = gpdb::DatumFromPointer(datum->GetByteArrayValue());
+		}
+	}
+
+	BOOL result = true;
+	if ((TEXTOID == type || VARCHAROID == type || BPCHAROID == type) &&
+		gpdb::CollationIsC(collation))
+	{
+		for (ULONG ul = 0; ul < size; ul++)
+		{
+			int len = 0;
+			const char *key = gpdb::TextSortKey(type, values[ul], &len);
+			dynamic_cast<IDatumGeneric *>((*pdrgpdatum)[ul])
+				->SetSortKey((const BYTE *) key, len, 0 /*batch*/);
+		}
+	}
+	else
+	{
+		int *ranks = GPOS_NEW_ARRAY(m_mp, int, size);
+		result = gpdb::RankDatums(type, collation, values, size, ranks);
+		if (result)
+		{
+			const ULONG batch = ++m_ulSortKeyBatch;
+			for (ULONG ul = 0; ul < size; ul++)
+			{
+				// big-endian, so that the keys compare bytewise
+				BYTE key[4];
+				key[0] = (BYTE)(ranks[ul] >> 24);
+				key[1] = (BYTE)(ranks[ul] >> 16);
+				key[2] = (BYTE)(ranks[ul] >> 8);
+				key[3] = (BYTE) ranks[ul];
+				dynamic_cast<IDatumGeneric *>((*pdrgpdatum)[ul])
+					->SetSortKey(key, sizeof(key), batch);
+			}
+		}
+		GPOS_DELETE_ARRAY(ranks);
+	}
+	GPOS_DELETE_ARRAY(values);
+
+	return result;
+}
+
 // EOF
@@ -0,0 +1,202 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (c) 2023 VMware, Inc. or its affiliates. All Rights Reserved.
+//
+//	@filename:
+//		CMDCacheSnapshot.cpp
+//
+//	@doc:
+//		Loading and publishing the shared snapshot of the metadata cache
+//
+//---------------------------------------------------------------------------
+
+extern "C" {
+#include "postgres.h"
+
+#include "lib/stringinfo.h"
+}
+
+#include "gpopt/utils/CMDCacheSnapshot.h"
+
+#include "gpos/common/CAutoP.h"
+#include "gpos/common/clibwrapper.h"
+#include "gpos/error/CException.h"
+#include "gpos/memory/CCacheAccessor.h"
+
+#include "gpopt/gpdbwrappers.h"
+#include "gpopt/mdcache/CMDCache.h"
+#include "gpopt/translate/CTranslatorUtils.h"
+#include "naucrates/dxl/CDXLUtils.h"
+#include "naucrates/exception.h"
+
+using namespace gpos;
+using namespace gpmd;
+using namespace gpdxl;
+using namespace gpopt;
+
+// number of cached objects when the snapshot was last loaded or published
+ULONG_PTR CMDCacheSnapshot::m_ulpObjects = 0;
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CMDCacheSnapshot::SerializeObject
+//
+//	@doc:
+//		Append the null-terminated DXL document of a cached object to the
+//		buffer of the given context
+//
+//---------------------------------------------------------------------------
+void
+CMDCacheSnapshot::SerializeObject(IMDCacheObject *mdobj, void *ctxt)
+{
+	GPOS_ASSERT(nullptr != mdobj);
+
+	// the materialized views usable by a query depend on the privileges of
+	// the user, they are not shared with other sessions
+	if (IMDCacheObject::EmdtMatViewInfo == mdobj->MDType())
+	{
+		return;
+	}
+
+	SSerializeCtxt *serialize_ctxt = static_cast<SSerializeCtxt *>(ctxt);
+
+	CAutoP<CWStringDynamic> dxl(CDXLUtils::SerializeMDObj(
+		serialize_ctxt->m_mp, mdobj, true /*serialize_header_footer*/,
+		false /*indentation*/));
+	CHAR *sz = CTranslatorUtils::CreateMultiByteCharStringFromWCString(
+		dxl.Value()->GetBuffer());
+
+	gpdb::AppendBinaryStringInfo(serialize_ctxt->m_str, sz,
+								 clib::Strlen(sz) + 1);
+	gpdb::GPDBFree(sz);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CMDCacheSnapshot::Load
+//
+//	@doc:
+//		Load the snapshot into the metadata cache, if it is consistent with
+//		the given catalog version. A snapshot that can not be loaded is not
+//		an error, the cache is left empty instead.
+//
+//---------------------------------------------------------------------------
+ULONG
+CMDCacheSnapshot::Load(ULLONG version)
+{
+	GPOS_ASSERT(CMDCache::FInitialized());
+	GPOS_ASSERT(0 == CMDCache::Pcache()->Size());
+
+	Size size = 0;
+	CHAR *data = gpdb::FetchMDCacheSnapshot(version, &size);
+	if (nullptr == data)
+	{
+		return 0;
+	}
+
+	ULONG num_loaded = 0;
+
+	GPOS_TRY
+	{
+		const CHAR *end = data + size;
+		for (const CHAR *doc = data; doc < end; doc += clib::Strlen(doc) + 1)
+		{
+			GPOS_CHECK_ABORT;
+
+			// like objects retrieved from the MD provider, each object is
+			// allocated in the memory pool of its cache entry
+			CCacheAccessor<IMDCacheObject *, CMDKey *> acc(CMDCache::Pcache());
+			CMemoryPool *entry_mp = acc.Pmp();
+
+			IMDCacheObjectArray *mdobjs =
+				CDXLUtils::ParseDXLToIMDObjectArray(entry_mp, doc, nullptr);
+			if (0 == mdobjs->Size())
+			{
+				mdobjs->Release();
+				continue;
+			}
+			IMDCacheObject *mdobj = (*mdobjs)[0];
+			mdobj->AddRef();
+			mdobjs->Release();
+
+			CAutoP<CMDKey> a_pmdkey;
+			a_pmdkey = GPOS_NEW(entry_mp) CMDKey(mdobj->MDId());
+
+			if (mdobj == acc.Insert(a_pmdkey.Value(), mdobj))
+			{
+				// the cache entry owns the object and key now
+				(void) a_pmdkey.Reset();
+				mdobj->Release();
+				num_loaded++;
+			}
+		}
+	}
+	GPOS_CATCH_EX(ex)
+	{
+		if (GPOS_MATCH_EX(ex, gpdxl::ExmaGPDB, gpdxl::ExmiGPDBError))
+		{
+			gpdb::GPDBFree(data);
+			GPOS_RETHROW(ex);
+		}
+		elog(DEBUG1, "[OPT]: Could not load metadata cache snapshot");
+		GPOS_RESET_EX;
+
+		ULLONG cache_quota = CMDCache::ULLGetCacheQuota();
+		CMDCache::Reset();
+		CMDCache::SetCacheQuota(cache_quota);
+		num_loaded = 0;
+	}
+	GPOS_CATCH_END;
+
+	gpdb::GPDBFree(data);
+	m_ulpObjects = CMDCache::Pcache()->Size();
+
+	return num_loaded;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CMDCacheSnapshot::Publish
+//
+//	@doc:
+//		Publish the metadata cache as consistent with the given catalog
+//		version, if it has changed size since it was last loaded or
+//		published by this backend
+//
+//---------------------------------------------------------------------------
+void
+CMDCacheSnapshot::Publish(CMemoryPool *mp, ULLONG version)
+{
+	GPOS_ASSERT(CMDCache::FInitialized());
+
+	ULONG_PTR num_objects = CMDCache::Pcache()->Size();
+	if (0 == num_objects || m_ulpObjects == num_objects)
+	{
+		return;
+	}
+
+	StringInfo str = gpdb::MakeStringInfo();
+	SSerializeCtxt ctxt = {mp, str};
+
+	GPOS_TRY
+	{
+		CMDCache::Pcache()->VisitEntries(SerializeObject, &ctxt);
+		(void) gpdb::StoreMDCacheSnapshot(version, str->data, str->len);
+		m_ulpObjects = num_objects;
+	}
+	GPOS_CATCH_EX(ex)
+	{
+		if (GPOS_MATCH_EX(ex, gpdxl::ExmaGPDB, gpdxl::ExmiGPDBError))
+		{
+			GPOS_RETHROW(ex);
+		}
+		elog(DEBUG1, "[OPT]: Could not publish metadata cache snapshot");
+		GPOS_RESET_EX;
+	}
+	GPOS_CATCH_END;
+
+	gpdb::GPDBFree(str->data);
+	gpdb::GPDBFree(str);
+}
+
+// EOF
@@ -17,6 +17,7 @@
 
 extern "C" {
 #include "cdb/cdbvars.h"
+#include "optimizer/cost.h"
 #include "optimizer/hints.h"
 #include "optimizer/orca.h"
 #include "utils/fmgroids.h"
@@ -26,6 +27,7 @@ extern "C" {
 #include "gpos/_api.h"
 #include "gpos/base.h"
 #include "gpos/common/CAutoP.h"
+#include "gpos/common/CAutoRef.h"
 #include "gpos/error/CException.h"
 #include "gpos/io/COstreamString.h"
 #include "gpos/memory/CAutoMemoryPool.h"
@@ -46,6 +48,7 @@ extern "C" {
 #include "gpopt/mdcache/CAutoMDAccessor.h"
 #include "gpopt/mdcache/CMDCache.h"
 #include "gpopt/minidump/CMinidumperUtils.h"
+#include "gpopt/optimizer/COptimizationProfile.h"
 #include "gpopt/optimizer/COptimizer.h"
 #include "gpopt/optimizer/COptimizerConfig.h"
 #include "gpopt/relcache/CMDProviderRelcache.h"
@@ -57,6 +60,8 @@ extern "C" {
 #include "gpopt/translate/CTranslatorRelcacheToDXL.h"
 #include "gpopt/translate/CTranslatorUtils.h"
 #include "gpopt/utils/CConstExprEvaluatorProxy.h"
+#include "gpopt/utils/CMDCacheSnapshot.h"
+#include "gpopt/utils/CPlanCache.h"
 #include "gpopt/utils/gpdbdefs.h"
 #include "gpopt/xforms/CXformFactory.h"
 #include "naucrates/base/CQueryToDXLResult.h"
@@ -72,6 +77,7 @@ extern "C" {
 #include "naucrates/md/CSystemId.h"
 #include "naucrates/md/IMDId.h"
 #include "naucrates/md/IMDRelStats.h"
+#include "naucrates/statistics/CCardinalityFeedback.h"
 #include "naucrates/traceflags/traceflags.h"
 
 using namespace gpos;
@@ -82,9 +88,6 @@ using namespace gpdbcost;
 // size of error buffer
 #define GPOPT_ERROR_BUFFER_SIZE 10 * 1024 * 1024
 
-// definition of default AutoMemoryPool
-#define AUTO_MEM_POOL(amp) CAutoMemoryPool amp(CAutoMemoryPool::ElcExc)
-
 // default id for the source system
 const CSystemId default_sysid(IMDId::EmdidGeneral, GPOS_WSZ_STR_LENGTH("GPDB"));
 
@@ -284,7 +287,8 @@ PlannedStmt *
 COptTasks::ConvertToPlanStmtFromDXL(
 	CMemoryPool *mp, CMDAccessor *md_accessor, const Query *orig_query,
 	const CDXLNode *dxlnode, bool can_set_tag,
-	DistributionHashOpsKind distribution_hashops)
+	DistributionHashOpsKind distribution_hashops,
+	BOOL *has_serial_parallel_scans)
 {
 	GPOS_ASSERT(nullptr != md_accessor);
 	GPOS_ASSERT(nullptr != dxlnode);
@@ -304,8 +308,11 @@ COptTasks::ConvertToPlanStmtFromDXL(
 	// translate DXL -> PlannedStmt
 	CTranslatorDXLToPlStmt dxl_to_plan_stmt_translator(
 		mp, md_accessor, &dxl_to_plan_stmt_ctxt, gpdb::GetGPSegmentCount());
-	return dxl_to_plan_stmt_translator.GetPlannedStmtFromDXL(
+	PlannedStmt *plan_stmt = dxl_to_plan_stmt_translator.GetPlannedStmtFromDXL(
 		dxlnode, orig_query, can_set_tag);
+	*has_serial_parallel_scans = dxl_to_plan_stmt_ctxt.HasSerialParallelScans();
+
+	return plan_stmt;
 }
 
 
@@ -386,6 +393,7 @@ COptTasks::CreateOptimizerConfig(CMemoryPool *mp, ICostModel *cost_model,
 		(ULONG) optimizer_push_group_by_below_setop_threshold;
 	ULONG xform_bind_threshold = (ULONG) optimizer_xform_bind_threshold;
 	ULONG skew_factor = (ULONG) optimizer_skew_factor;
+	ULONG time_budget = (ULONG) optimizer_time_budget;
 
 	return GPOS_NEW(mp) COptimizerConfig(
 		GPOS_NEW(mp)
@@ -401,7 +409,7 @@ COptTasks::CreateOptimizerConfig(CMemoryPool *mp, ICostModel *cost_model,
 				  false, /* don't create Assert nodes for constraints, we'll
 								      * enforce them ourselves in the executor */
 				  push_group_by_below_setop_threshold, xform_bind_threshold,
-				  skew_factor),
+				  skew_factor, time_budget),
 		plan_hints,
 		GPOS_NEW(mp) CWindowOids(OID(F_ROW_NUMBER), OID(F_RANK_)));
 }
@@ -477,6 +485,67 @@ COptTasks::GetCostModel(CMemoryPool *mp, ULONG num_segments)
 }
 
 
+//---------------------------------------------------------------------------
+//      @function:
+//			COptTasks::SetParallelWorkers
+//
+//      @doc:
+//			Let table scans use max_parallel_workers_per_gather workers on
+//			each segment, under the same conditions the planner uses to
+//			decide whether a query may run in parallel mode
+//
+//---------------------------------------------------------------------------
+void
+COptTasks::SetParallelWorkers(ICostModel *cost_model, Query *query)
+{
+	GPOS_ASSERT(nullptr != cost_model);
+	GPOS_ASSERT(nullptr != query);
+
+	if (!enable_parallel || IS_SINGLENODE() ||
+		max_parallel_workers_per_gather <= 1 ||
+		CMD_SELECT != query->commandType || query->hasModifyingCTE ||
+		nullptr != query->rowMarks)
+	{
+		return;
+	}
+
+	// a parallel restricted function may only run in the leader, and ORCA
+	// does not track which part of the plan that would be
+	if (PROPARALLEL_SAFE != gpdb::MaxParallelHazard(query))
+	{
+		return;
+	}
+
+	ICostModelParams::SCostParam *cost_param =
+		cost_model->GetCostModelParams()->PcpLookup(
+			CCostModelParamsGPDB::EcpParallelWorkers);
+	CDouble parallel_workers(max_parallel_workers_per_gather);
+	cost_model->GetCostModelParams()->SetParam(
+		cost_param->Id(), parallel_workers, parallel_workers - 0.0,
+		parallel_workers + 0.0);
+}
+
+//---------------------------------------------------------------------------
+//      @function:
+//			COptTasks::ResetParallelWorkers
+//
+//      @doc:
+//			Let every table scan run serially again
+//
+//---------------------------------------------------------------------------
+void
+COptTasks::ResetParallelWorkers(ICostModel *cost_model)
+{
+	GPOS_ASSERT(nullptr != cost_model);
+
+	ICostModelParams::SCostParam *cost_param =
+		cost_model->GetCostModelParams()->PcpLookup(
+			CCostModelParamsGPDB::EcpParallelWorkers);
+	cost_model->GetCostModelParams()->SetParam(
+		cost_param->Id(), CDouble(1.0), CDouble(1.0), CDouble(1.0));
+}
+
+
 //---------------------------------------------------------------------------
 //	@function:
 //		GenerateJoinNodes
@@ -850,6 +919,210 @@ COptTasks::GetPlanHints(CMemoryPool *mp, Query *query)
 	return plan_hints;
 }
 
+//---------------------------------------------------------------------------
+//	@function:
+//		COptTasks::IsMDCacheEntryInvalidated
+//
+//	@doc:
+//		Check if the metadata cache entry with the given mdid is affected by
+//		the catalog changes recorded since the last optimization
+//
+//---------------------------------------------------------------------------
+BOOL
+COptTasks::IsMDCacheEntryInvalidated(const IMDId *mdid, void *	 // arg
+)
+{
+	switch (mdid->MdidType())
+	{
+		case IMDId::EmdidRel:
+		case IMDId::EmdidInd:
+		case IMDId::EmdidExtStatsInfo:
+			return gpdb::MDCacheIsRelationInvalidated(
+				CMDIdGPDB::CastMdid(mdid)->Oid());
+
+		case IMDId::EmdidRelStats:
+			return gpdb::MDCacheIsRelationInvalidated(
+				CMDIdGPDB::CastMdid(
+					CMDIdRelStats::CastMdid(mdid)->GetRelMdId())
+					->Oid());
+
+		case IMDId::EmdidColStats:
+			return gpdb::MDCacheIsColumnStatsInvalidated() ||
+				   gpdb::MDCacheIsRelationInvalidated(
+					   CMDIdGPDB::CastMdid(
+						   CMDIdColStats::CastMdid(mdid)->GetRelMdId())
+						   ->Oid());
+
+		case IMDId::EmdidExtStats:
+			// extended statistics are cached by the OID of the statistics
+			// object, changes to them invalidate the owning relation
+			return gpdb::MDCacheIsAnyRelationInvalidated();
+
+		case IMDId::EmdidMatViewInfo:
+			return gpdb::MDCacheIsMatViewInvalidated();
+
+		case IMDId::EmdidCastFunc:
+		{
+			const CMDIdCast *mdid_cast = CMDIdCast::CastMdid(mdid);
+			return gpdb::MDCacheIsCastInvalidated(
+				CMDIdGPDB::CastMdid(mdid_cast->MdidSrc())->Oid(),
+				CMDIdGPDB::CastMdid(mdid_cast->MdidDest())->Oid());
+		}
+
+		case IMDId::EmdidScCmp:
+			return gpdb::MDCacheIsOperatorInvalidated();
+
+		case IMDId::EmdidGeneral:
+		case IMDId::EmdidCheckConstraint:
+			return gpdb::MDCacheIsObjectInvalidated(
+				CMDIdGPDB::CastMdid(mdid)->Oid());
+
+		default:
+			// be conservative about anything else
+			return true;
+	}
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		COptTasks::MakeProfileEntry
+//
+//	@doc:
+//		Create an entry of the optimizer profile with the given counters,
+//		a time in microseconds is shown in milliseconds
+//
+//---------------------------------------------------------------------------
+DefElem *
+COptTasks::MakeProfileEntry(const CHAR *name, ULLONG calls, ULLONG time_us,
+							const CHAR *calls_name)
+{
+	CHAR time_ms[32];
+	snprintf(time_ms, sizeof(time_ms), "%.3f",
+			 (double) time_us / GPOS_USEC_IN_MSEC);
+
+	List *counters = NIL;
+	counters = gpdb::LAppend(
+		counters, gpdb::MakeDefElem(PStrDup(calls_name),
+									(Node *) gpdb::MakeIntegerValue(calls)));
+	counters = gpdb::LAppend(
+		counters,
+		gpdb::MakeDefElem(PStrDup("Time"),
+						  (Node *) gpdb::MakeFloatValue(PStrDup(time_ms))));
+
+	return gpdb::MakeDefElem(PStrDup(name), (Node *) counters);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		COptTasks::CreateOptimizerProfile
+//
+//	@doc:
+//		Convert the counters of an optimization into a tree of DefElems
+//		that is kept in the planned statement and shown by EXPLAIN VERBOSE.
+//		Each node is named; inner nodes hold a list of nodes, leaves an
+//		Integer count or a Float time in milliseconds.
+//
+//---------------------------------------------------------------------------
+List *
+COptTasks::CreateOptimizerProfile(const COptimizationProfile *profile)
+{
+	GPOS_ASSERT(nullptr != profile);
+
+	List *memo = NIL;
+	memo = gpdb::LAppend(
+		memo, gpdb::MakeDefElem(PStrDup("Groups"),
+								(Node *) gpdb::MakeIntegerValue(
+									profile->UlGroups())));
+	memo = gpdb::LAppend(
+		memo, gpdb::MakeDefElem(PStrDup("Group Expressions"),
+								(Node *) gpdb::MakeIntegerValue(
+									profile->UlGroupExprs())));
+	memo = gpdb::LAppend(
+		memo, gpdb::MakeDefElem(PStrDup("Duplicate Groups"),
+								(Node *) gpdb::MakeIntegerValue(
+									profile->UlDuplicateGroups())));
+
+	List *phases = NIL;
+	for (ULONG ul = 0; ul < COptimizationProfile::EphSentinel; ul++)
+	{
+		COptimizationProfile::EPhase eph = (COptimizationProfile::EPhase) ul;
+		phases = gpdb::LAppend(
+			phases, MakeProfileEntry(COptimizationProfile::SzPhase(eph),
+									 profile->UllPhaseCalls(eph),
+									 profile->UllPhaseTimeUS(eph), "Calls"));
+	}
+
+	List *jobs = NIL;
+	for (ULONG ul = 0; ul < CJob::EjtSentinel; ul++)
+	{
+		CJob::EJobType ejt = (CJob::EJobType) ul;
+		if (0 == profile->UllJobCalls(ejt))
+		{
+			continue;
+		}
+
+		jobs = gpdb::LAppend(
+			jobs, MakeProfileEntry(COptimizationProfile::SzJobType(ejt),
+								   profile->UllJobCalls(ejt),
+								   profile->UllJobTimeUS(ejt), "Calls"));
+	}
+
+	// only the xforms that were applied
+	List *xforms = NIL;
+	for (ULONG ul = 0; ul < CXform::ExfSentinel; ul++)
+	{
+		CXform::EXformId exfid = (CXform::EXformId) ul;
+		if (0 == profile->UllXformCalls(exfid))
+		{
+			continue;
+		}
+
+		DefElem *xform = MakeProfileEntry(
+			CXformFactory::Pxff()->Pxf(exfid)->SzId(),
+			profile->UllXformCalls(exfid), profile->UllXformTimeUS(exfid),
+			"Calls");
+		xform->arg = (Node *) gpdb::LAppend(
+			(List *) xform->arg,
+			gpdb::MakeDefElem(PStrDup("Bindings"),
+							  (Node *) gpdb::MakeIntegerValue(
+								  profile->UllXformBindings(exfid))));
+		xform->arg = (Node *) gpdb::LAppend(
+			(List *) xform->arg,
+			gpdb::MakeDefElem(PStrDup("Results"),
+							  (Node *) gpdb::MakeIntegerValue(
+								  profile->UllXformResults(exfid))));
+		xforms = gpdb::LAppend(xforms, xform);
+	}
+
+	List *groups = NIL;
+	for (ULONG ul = 0; ul < profile->UlTopGroups(); ul++)
+	{
+		const COptimizationProfile::SGroupEntry &grpentry =
+			profile->TopGroup(ul);
+
+		CHAR name[32];
+		snprintf(name, sizeof(name), "Group %u", grpentry.m_ulId);
+		groups = gpdb::LAppend(
+			groups, MakeProfileEntry(name, grpentry.m_ullJobs,
+									 grpentry.m_ullTimeUS, "Jobs"));
+	}
+
+	List *result = NIL;
+	result = gpdb::LAppend(
+		result, gpdb::MakeDefElem(PStrDup("Memo"), (Node *) memo));
+	result = gpdb::LAppend(
+		result, gpdb::MakeDefElem(PStrDup("Phases"), (Node *) phases));
+	result = gpdb::LAppend(
+		result, gpdb::MakeDefElem(PStrDup("Jobs"), (Node *) jobs));
+	result = gpdb::LAppend(
+		result,
+		gpdb::MakeDefElem(PStrDup("Transformations"), (Node *) xforms));
+	result = gpdb::LAppend(
+		result, gpdb::MakeDefElem(PStrDup("Top Groups"), (Node *) groups));
+
+	return result;
+}
+
 //---------------------------------------------------------------------------
 //	@function:
 //		COptTasks::OptimizeTask
@@ -868,7 +1141,12 @@ COptTasks::OptimizeTask(void *ptr)
 	GPOS_ASSERT(nullptr == opt_ctxt->m_plan_dxl);
 	GPOS_ASSERT(nullptr == opt_ctxt->m_plan_stmt);
 
-	AUTO_MEM_POOL(amp);
+	// everything allocated during the optimization is released together
+	// with the pool, so it may be carved out of an arena
+	CAutoMemoryPool amp(CAutoMemoryPool::ElcExc,
+						optimizer_use_arena_memory_pool
+							? CAutoMemoryPool::EptArena
+							: CAutoMemoryPool::EptDefault);
 	CMemoryPool *mp = amp.Pmp();
 
 	// Does the metadatacache need to be reset?
@@ -877,7 +1155,19 @@ COptTasks::OptimizeTask(void *ptr)
 	// don't care about the return value of MDCacheNeedsReset(). But
 	// we need to call it anyway, to give it a chance to initialize
 	// the invalidation mechanism.
+	//
+	// With a shared snapshot of the metadata cache, first pick up the catalog
+	// changes made by other sessions, so that the cache can be compared
+	// against, and published as consistent with, the current catalog version.
+	bool use_mdcache_snapshot =
+		optimizer_metadata_caching && gpdb::MDCacheSnapshotEnabled();
+	ULLONG mdcache_version = 0;
+	if (use_mdcache_snapshot)
+	{
+		mdcache_version = gpdb::MDCacheProcessInvalidations();
+	}
 	bool reset_mdcache = gpdb::MDCacheNeedsReset();
+	bool empty_mdcache = !CMDCache::FInitialized() || reset_mdcache;
 
 	// initialize metadata cache, or purge if needed, or change size if requested
 	if (!CMDCache::FInitialized())
@@ -890,10 +1180,81 @@ COptTasks::OptimizeTask(void *ptr)
 		CMDCache::Reset();
 		CMDCache::SetCacheQuota(optimizer_mdcache_size * 1024L);
 	}
-	else if (CMDCache::ULLGetCacheQuota() !=
-			 (ULLONG) optimizer_mdcache_size * 1024L)
+	else
+	{
+		// evict only the entries affected by catalog changes
+		if (gpdb::MDCacheHasInvalidations())
+		{
+			CMDCache::Invalidate(IsMDCacheEntryInvalidated, nullptr);
+		}
+
+		if (CMDCache::ULLGetCacheQuota() !=
+			(ULLONG) optimizer_mdcache_size * 1024L)
+		{
+			CMDCache::SetCacheQuota(optimizer_mdcache_size * 1024L);
+		}
+	}
+
+	// cached plans depend on the metadata they were optimized against, so
+	// they are invalidated along with it
+	if (!optimizer_plan_caching)
 	{
-		CMDCache::SetCacheQuota(optimizer_mdcache_size * 1024L);
+		CPlanCache::Shutdown();
+	}
+	else if (!CPlanCache::FInitialized())
+	{
+		CPlanCache::Init();
+		CPlanCache::SetCacheQuota(optimizer_plan_cache_size * 1024L);
+	}
+	else if (reset_mdcache)
+	{
+		CPlanCache::Reset();
+		CPlanCache::SetCacheQuota(optimizer_plan_cache_size * 1024L);
+	}
+	else
+	{
+		if (gpdb::MDCacheHasInvalidations())
+		{
+			CPlanCache::Invalidate(IsMDCacheEntryInvalidated, nullptr);
+		}
+
+		if (CPlanCache::ULLGetCacheQuota() !=
+			(ULLONG) optimizer_plan_cache_size * 1024L)
+		{
+			CPlanCache::SetCacheQuota(optimizer_plan_cache_size * 1024L);
+		}
+	}
+	gpdb::MDCacheClearInvalidations();
+
+	// cardinalities observed by executed plans; cached plans were optimized
+	// without the feedback recorded since, so they are dropped when it
+	// changes
+	if (!optimizer_cardinality_feedback)
+	{
+		CCardinalityFeedback::Shutdown();
+	}
+	else
+	{
+		CCardinalityFeedback::Configure(
+			(ULONG) optimizer_cardinality_feedback_entries,
+			(ULONG) optimizer_cardinality_feedback_max_age);
+
+		static ULLONG feedback_version = 0;
+		if (feedback_version != CCardinalityFeedback::UllVersion())
+		{
+			feedback_version = CCardinalityFeedback::UllVersion();
+			if (CPlanCache::FInitialized())
+			{
+				CPlanCache::Reset();
+				CPlanCache::SetCacheQuota(optimizer_plan_cache_size * 1024L);
+			}
+		}
+	}
+
+	// start with a warm cache, if another session published one
+	if (use_mdcache_snapshot && empty_mdcache)
+	{
+		CMDCacheSnapshot::Load(mdcache_version);
 	}
 
 
@@ -938,6 +1299,7 @@ COptTasks::OptimizeTask(void *ptr)
 				mp, &mda, (Query *) opt_ctxt->m_query);
 
 			ICostModel *cost_model = GetCostModel(mp, num_segments_for_costing);
+			SetParallelWorkers(cost_model, opt_ctxt->m_query);
 			CPlanHint *plan_hints = GetPlanHints(mp, opt_ctxt->m_query);
 			COptimizerConfig *optimizer_config =
 				CreateOptimizerConfig(mp, cost_model, plan_hints);
@@ -964,36 +1326,142 @@ COptTasks::OptimizeTask(void *ptr)
 			CAutoTraceFlag atf1(EopttraceDisableMotions, is_master_only);
 			CAutoTraceFlag atf2(EopttraceUseLegacyOpfamilies,
 								use_legacy_opfamilies);
+			// like the Postgres planner, views only answer plain queries,
+			// never ones that modify or lock rows or populate relations
+			Query *query = (Query *) opt_ctxt->m_query;
+			CAutoTraceFlag atf3(
+				EopttraceEnableMatViewRewrite,
+				GPOS_FTRACE(EopttraceEnableMatViewRewrite) &&
+					CMD_SELECT == query->commandType &&
+					nullptr == query->rowMarks &&
+					PARENTSTMTTYPE_NONE == query->parentStmtType);
+
+			// a custom search strategy is not part of the plan cache key,
+			// and a minidump is only taken when the query is optimized
+			BOOL use_plan_cache =
+				optimizer_plan_caching && nullptr == search_strategy_arr &&
+				OPTIMIZER_MINIDUMP_ALWAYS != optimizer_minidump;
+
+			// the accessor pins the cached plan until it is translated
+			CAutoP<CWStringDynamic> plan_cache_key;
+			CAutoP<CPlanCache::PlanCacheAccessor> plan_cache_acc;
+			CAutoRef<CCachedPlan> cached_plan;
+			if (use_plan_cache)
+			{
+				plan_cache_key = CPlanCache::CreateKeyString(
+					mp, query_dxl, query_output_dxlnode_array,
+					cte_dxlnode_array, optimizer_config, num_segments);
+				plan_cache_acc = GPOS_NEW(mp)
+					CPlanCache::PlanCacheAccessor(CPlanCache::Pcache());
+				cached_plan = CPlanCache::Lookup(plan_cache_acc.Value(),
+												 plan_cache_key.Value());
+			}
+
+			// the profile is only shown with the plan, and a cached plan
+			// is not optimized again
+			CAutoP<COptimizationProfile> profile;
+			if (optimizer_collect_profile &&
+				opt_ctxt->m_should_generate_plan_stmt)
+			{
+				profile = GPOS_NEW(mp) COptimizationProfile();
+			}
+
+			ULLONG plan_id = 0;
+			ULLONG plan_space_size = 0;
+			BOOL is_optimized = false;
+			if (nullptr != cached_plan.Value())
+			{
+				plan_dxl = cached_plan->GetPlanDXL();
+				plan_dxl->AddRef();
+				plan_id = cached_plan->GetPlanId();
+				plan_space_size = cached_plan->GetPlanSpaceSize();
+			}
+			else
+			{
+				plan_dxl = COptimizer::PdxlnOptimize(
+					mp, &mda, query_dxl, query_output_dxlnode_array,
+					cte_dxlnode_array, expr_evaluator, num_segments,
+					gp_session_id, gp_command_count, search_strategy_arr,
+					optimizer_config, nullptr /*szMinidumpFileName*/,
+					profile.Value());
+				plan_id = optimizer_config->GetEnumeratorCfg()->GetPlanId();
+				plan_space_size =
+					optimizer_config->GetEnumeratorCfg()->GetPlanSpaceSize();
+				is_optimized = true;
+			}
+
+			// translate DXL->PlStmt only when needed
+			PlannedStmt *plan_stmt = nullptr;
+			if (opt_ctxt->m_should_generate_plan_stmt)
+			{
+				// always use opt_ctxt->m_query->can_set_tag as the query_to_dxl_translator->Pquery() is a mutated Query object
+				// that may not have the correct can_set_tag
+				BOOL has_serial_parallel_scans = false;
+				plan_stmt = ConvertToPlanStmtFromDXL(
+					mp, &mda, opt_ctxt->m_query, plan_dxl,
+					opt_ctxt->m_query->canSetTag,
+					query_to_dxl_translator->GetDistributionHashOpsKind(),
+					&has_serial_parallel_scans);
+
+				// the plan was costed with parallel scans and the motions
+				// redistributing their rows, but some slice cannot run in
+				// parallel, so optimize the query again with serial scans
+				if (has_serial_parallel_scans)
+				{
+					ResetParallelWorkers(cost_model);
+					plan_dxl->Release();
+					plan_dxl = COptimizer::PdxlnOptimize(
+						mp, &mda, query_dxl, query_output_dxlnode_array,
+						cte_dxlnode_array, expr_evaluator, num_segments,
+						gp_session_id, gp_command_count, search_strategy_arr,
+						optimizer_config, nullptr /*szMinidumpFileName*/,
+						profile.Value());
+					plan_id = optimizer_config->GetEnumeratorCfg()->GetPlanId();
+					plan_space_size =
+						optimizer_config->GetEnumeratorCfg()->GetPlanSpaceSize();
+					is_optimized = true;
+
+					plan_stmt = ConvertToPlanStmtFromDXL(
+						mp, &mda, opt_ctxt->m_query, plan_dxl,
+						opt_ctxt->m_query->canSetTag,
+						query_to_dxl_translator->GetDistributionHashOpsKind(),
+						&has_serial_parallel_scans);
+					GPOS_ASSERT(!has_serial_parallel_scans);
+				}
+			}
 
-			plan_dxl = COptimizer::PdxlnOptimize(
-				mp, &mda, query_dxl, query_output_dxlnode_array,
-				cte_dxlnode_array, expr_evaluator, num_segments, gp_session_id,
-				gp_command_count, search_strategy_arr, optimizer_config);
+			// a plan found under an expired time budget is only the best one
+			// found so far, optimize the query again next time
+			if (use_plan_cache && is_optimized &&
+				!optimizer_config->GetEnumeratorCfg()->FTimeBudgetExpired())
+			{
+				CPlanCache::Insert(mp, &mda, plan_cache_key.Value(), plan_dxl,
+								   plan_id, plan_space_size);
+			}
 
 			if (opt_ctxt->m_should_serialize_plan_dxl)
 			{
 				// serialize DXL to xml
 				CWStringDynamic plan_str(mp);
 				COstreamString oss(&plan_str);
-				CDXLUtils::SerializePlan(
-					mp, oss, plan_dxl,
-					optimizer_config->GetEnumeratorCfg()->GetPlanId(),
-					optimizer_config->GetEnumeratorCfg()->GetPlanSpaceSize(),
-					true /*serialize_header_footer*/, true /*indentation*/);
+				CDXLUtils::SerializePlan(mp, oss, plan_dxl, plan_id,
+										 plan_space_size,
+										 true /*serialize_header_footer*/,
+										 true /*indentation*/);
 				opt_ctxt->m_plan_dxl =
 					CreateMultiByteCharStringFromWCString(plan_str.GetBuffer());
 			}
 
-			// translate DXL->PlStmt only when needed
-			if (opt_ctxt->m_should_generate_plan_stmt)
+			if (nullptr != plan_stmt)
 			{
-				// always use opt_ctxt->m_query->can_set_tag as the query_to_dxl_translator->Pquery() is a mutated Query object
-				// that may not have the correct can_set_tag
 				opt_ctxt->m_plan_stmt =
-					(PlannedStmt *) gpdb::CopyObject(ConvertToPlanStmtFromDXL(
-						mp, &mda, opt_ctxt->m_query, plan_dxl,
-						opt_ctxt->m_query->canSetTag,
-						query_to_dxl_translator->GetDistributionHashOpsKind()));
+					(PlannedStmt *) gpdb::CopyObject(plan_stmt);
+
+				if (nullptr != profile.Value())
+				{
+					opt_ctxt->m_plan_stmt->optimizerProfile =
+						CreateOptimizerProfile(profile.Value());
+				}
 			}
 
 			CStatisticsConfig *stats_conf = optimizer_config->GetStatsConf();
@@ -1040,6 +1508,10 @@ COptTasks::OptimizeTask(void *ptr)
 	CRefCount::SafeRelease(enabled_trace_flags);
 	CRefCount::SafeRelease(disabled_trace_flags);
 	CRefCount::SafeRelease(trace_flags);
+	if (use_mdcache_snapshot)
+	{
+		CMDCacheSnapshot::Publish(mp, mdcache_version);
+	}
 	if (!optimizer_metadata_caching)
 	{
 		CMDCache::Shutdown();
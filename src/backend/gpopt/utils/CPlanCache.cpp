@@ -0,0 +1,406 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (c) 2023 VMware, Inc. or its affiliates. All Rights Reserved.
+//
+//	@filename:
+//		CPlanCache.cpp
+//
+//	@doc:
+//		Implementation of the cache of the plans produced by the optimizer
+//
+//---------------------------------------------------------------------------
+
+extern "C" {
+#include "postgres.h"
+}
+
+#include "gpopt/utils/CPlanCache.h"
+
+#include "gpos/common/CAutoP.h"
+#include "gpos/common/CAutoRef.h"
+#include "gpos/error/CException.h"
+#include "gpos/io/COstreamString.h"
+#include "gpos/memory/CCacheFactory.h"
+#include "gpos/task/CTask.h"
+#include "gpos/utils.h"
+
+#include "gpopt/gpdbwrappers.h"
+#include "gpopt/mdcache/CMDAccessor.h"
+#include "gpopt/optimizer/COptimizerConfig.h"
+#include "gpopt/translate/CTranslatorUtils.h"
+#include "naucrates/dxl/CDXLUtils.h"
+#include "naucrates/dxl/xml/CXMLSerializer.h"
+#include "naucrates/exception.h"
+
+using namespace gpos;
+using namespace gpmd;
+using namespace gpdxl;
+using namespace gpopt;
+
+// global instance of plan cache
+CPlanCache::PlanCache *CPlanCache::m_pcache = nullptr;
+
+// maximum size of the cache
+ULLONG CPlanCache::m_ullCacheQuota = UNLIMITED_CACHE_QUOTA;
+
+// lookup counters
+ULLONG CPlanCache::m_ullHits = 0;
+ULLONG CPlanCache::m_ullMisses = 0;
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CPlanCacheKey::CPlanCacheKey
+//
+//	@doc:
+//		Ctor
+//
+//---------------------------------------------------------------------------
+CPlanCacheKey::CPlanCacheKey(const CWStringBase *str, IMdIdArray *mdids)
+	: m_str(str), m_mdids(mdids)
+{
+	GPOS_ASSERT(nullptr != str);
+
+	m_hash = gpos::HashByteArray((const BYTE *) str->GetBuffer(),
+								 str->Length() * GPOS_SIZEOF(WCHAR));
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CPlanCacheKey::FEqualPlanCacheKey
+//
+//	@doc:
+//		Equality function for using plan cache keys in a cache
+//
+//---------------------------------------------------------------------------
+BOOL
+CPlanCacheKey::FEqualPlanCacheKey(CPlanCacheKey *const &pvLeft,
+								  CPlanCacheKey *const &pvRight)
+{
+	if (nullptr == pvLeft && nullptr == pvRight)
+	{
+		return true;
+	}
+
+	if (nullptr == pvLeft || nullptr == pvRight)
+	{
+		return false;
+	}
+
+	return pvLeft->m_hash == pvRight->m_hash &&
+		   pvLeft->m_str->Equals(pvRight->m_str);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CPlanCacheKey::UlHashPlanCacheKey
+//
+//	@doc:
+//		Hash function for using plan cache keys in a cache
+//
+//---------------------------------------------------------------------------
+ULONG
+CPlanCacheKey::UlHashPlanCacheKey(CPlanCacheKey *const &pv)
+{
+	return pv->m_hash;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CPlanCache::Init
+//
+//	@doc:
+//		Initializes global instance
+//
+//---------------------------------------------------------------------------
+void
+CPlanCache::Init()
+{
+	GPOS_ASSERT(nullptr == m_pcache && "Plan cache was already created");
+
+	m_pcache = CCacheFactory::CreateCache<CCachedPlan *, CPlanCacheKey *>(
+		true /*fUnique*/, m_ullCacheQuota, CPlanCacheKey::UlHashPlanCacheKey,
+		CPlanCacheKey::FEqualPlanCacheKey);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CPlanCache::Shutdown
+//
+//	@doc:
+//		Cleans up the underlying cache
+//
+//---------------------------------------------------------------------------
+void
+CPlanCache::Shutdown()
+{
+	GPOS_DELETE(m_pcache);
+	m_pcache = nullptr;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CPlanCache::SetCacheQuota
+//
+//	@doc:
+//		Set the maximum size of the cache
+//
+//---------------------------------------------------------------------------
+void
+CPlanCache::SetCacheQuota(ULLONG ullCacheQuota)
+{
+	GPOS_ASSERT(nullptr != m_pcache && "Plan cache was not created");
+	m_ullCacheQuota = ullCacheQuota;
+	m_pcache->SetCacheQuota(ullCacheQuota);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CPlanCache::ULLGetCacheQuota
+//
+//	@doc:
+//		Get the maximum size of the cache
+//
+//---------------------------------------------------------------------------
+ULLONG
+CPlanCache::ULLGetCacheQuota()
+{
+	GPOS_ASSERT_IMP(nullptr != m_pcache,
+					m_pcache->GetCacheQuota() == m_ullCacheQuota);
+	return m_ullCacheQuota;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CPlanCache::Reset
+//
+//	@doc:
+//		Reset plan cache
+//
+//---------------------------------------------------------------------------
+void
+CPlanCache::Reset()
+{
+	Shutdown();
+	Init();
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CPlanCache::FFilterKey
+//
+//	@doc:
+//		Check if any of the mdids a plan depends on satisfies an mdid filter
+//
+//---------------------------------------------------------------------------
+BOOL
+CPlanCache::FFilterKey(CPlanCacheKey *const &pkey, void *pv)
+{
+	GPOS_ASSERT(nullptr != pkey);
+	GPOS_ASSERT(nullptr != pkey->GetMdIds());
+
+	SInvalidationFilter *filter = static_cast<SInvalidationFilter *>(pv);
+	IMdIdArray *mdids = pkey->GetMdIds();
+
+	const ULONG size = mdids->Size();
+	for (ULONG ul = 0; ul < size; ul++)
+	{
+		if (filter->m_filter_func((*mdids)[ul], filter->m_arg))
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CPlanCache::Invalidate
+//
+//	@doc:
+//		Invalidate the plans that depend on an mdid satisfying the given
+//		filter. Returns the number of invalidated plans.
+//
+//---------------------------------------------------------------------------
+ULONG
+CPlanCache::Invalidate(MDIdFilterFuncPtr filter_func, void *arg)
+{
+	GPOS_ASSERT(nullptr != m_pcache && "Plan cache was not created");
+	GPOS_ASSERT(nullptr != filter_func);
+
+	SInvalidationFilter filter = {filter_func, arg};
+
+	return m_pcache->InvalidateEntries(FFilterKey, &filter);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CPlanCache::CreateKeyString
+//
+//	@doc:
+//		Build the string identifying an optimization: the serialized query,
+//		optimizer configuration and trace flags, the number of segments and
+//		the current user. Constants are part of the query, since the plan
+//		depends on their values. The user is part of the key since the
+//		materialized views a plan may read depend on the user's privileges.
+//
+//---------------------------------------------------------------------------
+CWStringDynamic *
+CPlanCache::CreateKeyString(CMemoryPool *mp, const CDXLNode *query_dxl,
+							const CDXLNodeArray *query_output_dxlnode_array,
+							const CDXLNodeArray *cte_dxlnode_array,
+							const COptimizerConfig *optimizer_config,
+							ULONG num_segments)
+{
+	CWStringDynamic *str = GPOS_NEW(mp) CWStringDynamic(mp);
+	COstreamString oss(str);
+
+	CDXLUtils::SerializeQuery(mp, oss, query_dxl, query_output_dxlnode_array,
+							  cte_dxlnode_array,
+							  false /*serialize_document_header_footer*/,
+							  false /*indentation*/);
+
+	{
+		CAutoRef<CBitSet> trace_flags;
+		trace_flags = CTask::Self()->GetTaskCtxt()->copy_trace_flags(mp);
+
+		CXMLSerializer xml_serializer(mp, oss, false /*indentation*/);
+		optimizer_config->Serialize(mp, &xml_serializer, trace_flags.Value());
+	}
+
+	str->AppendFormat(GPOS_WSZ_LIT("%d;%u"), num_segments,
+					  gpdb::GetCurrentUserId());
+
+	return str;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CPlanCache::Lookup
+//
+//	@doc:
+//		Look up the plan cached under the given key string, and count the
+//		lookup as a hit or a miss
+//
+//---------------------------------------------------------------------------
+CCachedPlan *
+CPlanCache::Lookup(PlanCacheAccessor *acc, const CWStringBase *key_str)
+{
+	GPOS_ASSERT(nullptr != m_pcache && "Plan cache was not created");
+	GPOS_ASSERT(nullptr != acc);
+
+	CPlanCacheKey key(key_str, nullptr /*mdids*/);
+	acc->Lookup(&key);
+
+	CCachedPlan *cached_plan = acc->Val();
+	if (nullptr == cached_plan)
+	{
+		m_ullMisses++;
+	}
+	else
+	{
+		m_ullHits++;
+	}
+
+	return cached_plan;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CPlanCache::Insert
+//
+//	@doc:
+//		Cache a plan under the given key string. The plan is copied into the
+//		memory pool of its cache entry by serializing and parsing it, and it
+//		is only cached if the copy serializes back to the same document.
+//		Plans of CTAS queries are not cached, as the metadata of their target
+//		table is not cached either. Failing to cache a plan is not an error.
+//
+//---------------------------------------------------------------------------
+BOOL
+CPlanCache::Insert(CMemoryPool *mp, CMDAccessor *md_accessor,
+				   const CWStringBase *key_str, const CDXLNode *plan_dxl,
+				   ULLONG plan_id, ULLONG plan_space_size)
+{
+	GPOS_ASSERT(nullptr != m_pcache && "Plan cache was not created");
+	GPOS_ASSERT(nullptr != md_accessor);
+	GPOS_ASSERT(nullptr != plan_dxl);
+
+	BOOL inserted = false;
+
+	GPOS_TRY
+	{
+		CWStringDynamic plan_str(mp);
+		{
+			COstreamString oss(&plan_str);
+			CDXLUtils::SerializePlan(mp, oss, plan_dxl, plan_id,
+									 plan_space_size,
+									 true /*serialize_header_footer*/,
+									 false /*indentation*/);
+		}
+		CHAR *sz = CTranslatorUtils::CreateMultiByteCharStringFromWCString(
+			plan_str.GetBuffer());
+
+		PlanCacheAccessor acc(m_pcache);
+		CMemoryPool *entry_mp = acc.Pmp();
+
+		IMdIdArray *mdids = md_accessor->GetAccessedMdIds(entry_mp);
+		BOOL is_cacheable = true;
+		for (ULONG ul = 0; is_cacheable && ul < mdids->Size(); ul++)
+		{
+			is_cacheable = IMDId::EmdidGPDBCtas != (*mdids)[ul]->MdidType();
+		}
+
+		CDXLNode *cached_dxl = nullptr;
+		if (is_cacheable)
+		{
+			ULLONG cached_plan_id = 0;
+			ULLONG cached_plan_space_size = 0;
+			cached_dxl = CDXLUtils::GetPlanDXLNode(entry_mp, sz, nullptr,
+												   &cached_plan_id,
+												   &cached_plan_space_size);
+
+			CWStringDynamic cached_plan_str(mp);
+			COstreamString oss(&cached_plan_str);
+			CDXLUtils::SerializePlan(mp, oss, cached_dxl, cached_plan_id,
+									 cached_plan_space_size,
+									 true /*serialize_header_footer*/,
+									 false /*indentation*/);
+			is_cacheable = plan_str.Equals(&cached_plan_str);
+		}
+		gpdb::GPDBFree(sz);
+
+		if (is_cacheable)
+		{
+			const CWStringConst *entry_key_str = GPOS_NEW(entry_mp)
+				CWStringConst(entry_mp, key_str->GetBuffer());
+
+			CAutoP<CPlanCacheKey> a_pkey;
+			a_pkey = GPOS_NEW(entry_mp) CPlanCacheKey(entry_key_str, mdids);
+			CCachedPlan *cached_plan = GPOS_NEW(entry_mp)
+				CCachedPlan(cached_dxl, plan_id, plan_space_size);
+
+			if (cached_plan == acc.Insert(a_pkey.Value(), cached_plan))
+			{
+				// the cache entry owns the plan and key now
+				(void) a_pkey.Reset();
+				cached_plan->Release();
+				inserted = true;
+			}
+		}
+	}
+	GPOS_CATCH_EX(ex)
+	{
+		if (GPOS_MATCH_EX(ex, gpdxl::ExmaGPDB, gpdxl::ExmiGPDBError))
+		{
+			GPOS_RETHROW(ex);
+		}
+		elog(DEBUG1, "[OPT]: Could not cache plan");
+		GPOS_RESET_EX;
+	}
+	GPOS_CATCH_END;
+
+	return inserted;
+}
+
+// EOF
@@ -27,6 +27,7 @@ extern "C" {
 
 #include "gpopt/gpdbwrappers.h"
 #include "gpopt/utils/COptTasks.h"
+#include "gpopt/utils/CPlanCache.h"
 #include "gpopt/utils/funcs.h"
 
 #include "xercesc/util/XercesVersion.hpp"
@@ -117,3 +118,29 @@ LibraryVersion()
 	PG_RETURN_TEXT_P(result);
 }
 }
+
+//---------------------------------------------------------------------------
+//	@function:
+//		PlanCacheStats
+//
+//	@doc:
+//		Returns the lookup counters and the size of the plan cache of the
+//		current session
+//
+//---------------------------------------------------------------------------
+extern "C" {
+void
+PlanCacheStats(int64 *hits, int64 *misses, int64 *entries, int64 *size)
+{
+	*hits = (int64) CPlanCache::ULLGetHits();
+	*misses = (int64) CPlanCache::ULLGetMisses();
+	*entries = 0;
+	*size = 0;
+
+	if (CPlanCache::FInitialized())
+	{
+		*entries = (int64) CPlanCache::Pcache()->Size();
+		*size = (int64) CPlanCache::Pcache()->TotalAllocatedSize();
+	}
+}
+}
@@ -19,6 +19,7 @@
 #include "gpopt/cost/ICostModel.h"
 #include "gpopt/cost/ICostModelParams.h"
 #include "gpopt/operators/COperator.h"
+#include "gpopt/operators/CPhysicalNLJoin.h"
 
 
 namespace gpdbcost
@@ -75,6 +76,14 @@ private:
 	// check if given operator is unary
 	static BOOL FUnary(COperator::EOperatorId op_id);
 
+	// average width of a column of a table scan
+	static CDouble DColWidth(CMemoryPool *mp, IStatistics *stats,
+							 CColRef *colref);
+
+	// width of the data read per row by a table scan
+	static CDouble DScanWidth(CMemoryPool *mp, COperator *pop,
+							  const SCostingInfo *pci);
+
 	// cost of scan
 	static CCost CostScan(CMemoryPool *mp, CExpressionHandle &exprhdl,
 						  const CCostModelGPDB *pcmgpdb,
@@ -85,6 +94,12 @@ private:
 							const CCostModelGPDB *pcmgpdb,
 							const SCostingInfo *pci);
 
+	// scan cost saved by late materialization of a filtered scan
+	static CDouble DLateMaterializationSaving(CMemoryPool *mp,
+											  CExpressionHandle &exprhdl,
+											  const CCostModelGPDB *pcmgpdb,
+											  const SCostingInfo *pci);
+
 	// cost of index scan
 	static CCost CostIndexScan(CMemoryPool *mp, CExpressionHandle &exprhdl,
 							   const CCostModelGPDB *pcmgpdb,
@@ -182,6 +197,12 @@ private:
 								 const CCostModelGPDB *pcmgpdb,
 								 const SCostingInfo *pci);
 
+	// cost of the children of index-nljoin caching its inner child results
+	static CCost CostMemoizedChildren(CPhysicalNLJoin *popNLJoin,
+									  const CCostModelGPDB *pcmgpdb,
+									  const SCostingInfo *pci,
+									  CCost costChildren);
+
 	// cost of motion
 	static CCost CostMotion(CMemoryPool *mp, CExpressionHandle &exprhdl,
 							const CCostModelGPDB *pcmgpdb,
@@ -237,6 +258,9 @@ public:
 	// return number of rows per host
 	CDouble DRowsPerHost(CDouble dRowsTotal) const override;
 
+	// return number of workers a parallel table scan uses on each segment
+	ULONG UlParallelWorkers() const override;
+
 	// return cost model parameters
 	ICostModelParams *
 	GetCostModelParams() const override
@@ -108,6 +108,8 @@ public:
 		EcpIndexOnlyScanTupCostUnit,  // index only scan cost per tuple retrieving
 
 		EcpIndexCostConversionFactor,  // Cost conversion factor for Index & Index only scans
+
+		EcpParallelWorkers,	 // number of parallel workers of a table scan per segment
 		EcpSentinel
 	};
 
@@ -287,6 +289,9 @@ private:
 	// Cost conversion factor for Index & Index only scan
 	static const CDouble DIndexCostConversionFactor;
 
+	// default number of parallel workers of a table scan per segment
+	static const CDouble DParallelWorkers;
+
 public:
 	CCostModelParamsGPDB(CCostModelParamsGPDB &) = delete;
 
@@ -14,6 +14,7 @@
 #include <limits>
 
 #include "gpopt/base/CColRefSetIter.h"
+#include "gpopt/base/CDistributionSpecHashedSkew.h"
 #include "gpopt/base/COptCtxt.h"
 #include "gpopt/base/COrderSpec.h"
 #include "gpopt/base/CWindowFrame.h"
@@ -25,13 +26,16 @@
 #include "gpopt/operators/CPhysicalDynamicIndexOnlyScan.h"
 #include "gpopt/operators/CPhysicalDynamicIndexScan.h"
 #include "gpopt/operators/CPhysicalHashAgg.h"
+#include "gpopt/operators/CPhysicalHashJoin.h"
 #include "gpopt/operators/CPhysicalIndexOnlyScan.h"
 #include "gpopt/operators/CPhysicalIndexScan.h"
 #include "gpopt/operators/CPhysicalMotion.h"
 #include "gpopt/operators/CPhysicalMotionBroadcast.h"
 #include "gpopt/operators/CPhysicalPartitionSelector.h"
 #include "gpopt/operators/CPhysicalSequenceProject.h"
+#include "gpopt/operators/CPhysicalSort.h"
 #include "gpopt/operators/CPhysicalStreamAgg.h"
+#include "gpopt/operators/CPhysicalTableScan.h"
 #include "gpopt/operators/CPhysicalUnionAll.h"
 #include "gpopt/operators/CPredicateUtils.h"
 #include "gpopt/operators/CScalarBitmapIndexProbe.h"
@@ -85,6 +89,27 @@ CCostModelGPDB::DRowsPerHost(CDouble dRowsTotal) const
 }
 
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CCostModelGPDB::UlParallelWorkers
+//
+//	@doc:
+//		Return number of workers a parallel table scan uses on each segment;
+//		a value of 1 means that table scans are not parallel
+//
+//---------------------------------------------------------------------------
+ULONG
+CCostModelGPDB::UlParallelWorkers() const
+{
+	CDouble dWorkers =
+		m_cost_model_params
+			->PcpLookup(CCostModelParamsGPDB::EcpParallelWorkers)
+			->Get();
+
+	return std::max((ULONG) 1, (ULONG) dWorkers.Get());
+}
+
+
 //---------------------------------------------------------------------------
 //	@function:
 //		CCostModelGPDB::~CCostModelGPDB
@@ -711,8 +736,29 @@ CCostModelGPDB::CostSort(CMemoryPool *mp, CExpressionHandle &exprhdl,
 	GPOS_ASSERT(0 < dSortTupWidthCost);
 
 	// sort cost is correlated with the number of rows and width of input tuples. We use n*log(n) for sorting complexity.
-	CCost costLocal =
-		CCost(num_rebinds * (rows * rows.Log2() * width * dSortTupWidthCost));
+	CDouble dRowsPerSort = rows;
+	CPhysicalSort *popSort = CPhysicalSort::PopConvert(exprhdl.Pop());
+	if (popSort->FIncremental())
+	{
+		// incremental sort sorts each group of tuples with equal presorted
+		// keys separately, i.e. n*log(n/g) for g groups; the child has no
+		// statistics when only a lower bound on the cost of a partial plan
+		// is computed, a group per row keeps it a lower bound
+		CDouble dGroups(rows);
+		if (nullptr != pci->Pcstats(0))
+		{
+			IStatistics *stats = pci->Pcstats(0)->Pstats();
+			dGroups = CDouble(1.0);
+			for (ULONG ul = 0; ul < popSort->UlPresortedKeys(); ul++)
+			{
+				dGroups = dGroups * stats->GetNDVs(popSort->Pos()->Pcr(ul));
+			}
+		}
+		dGroups = std::max(CDouble(1.0), std::min(dGroups, rows));
+		dRowsPerSort = CDouble(std::max(2.0, (rows / dGroups).Get()));
+	}
+	CCost costLocal = CCost(num_rebinds * (rows * dRowsPerSort.Log2() * width *
+										   dSortTupWidthCost));
 	CCost costChild =
 		CostChildren(mp, exprhdl, pci, pcmgpdb->GetCostModelParams());
 
@@ -975,6 +1021,19 @@ CCostModelGPDB::CostHashJoin(CMemoryPool *mp, CExpressionHandle &exprhdl,
 	CColRefSet *pcrsUsed = pexprJoinCond->DeriveUsedColumns();
 	const ULONG ulColsUsed = pcrsUsed->Size();
 
+	// outer tuples dropped by a runtime filter built from the inner tuples
+	// are not fed to the join, at the cost of probing the filter, which is
+	// cheaper than probing the hash table
+	DOUBLE num_rows_outer_fed = num_rows_outer;
+	DOUBLE dRuntimeFilterCost = 0;
+	if (CPhysicalHashJoin::PopConvert(exprhdl.Pop())
+			->FRuntimeFilter(num_rows_outer, dRowsInner, pci->Rows(),
+							 &num_rows_outer_fed))
+	{
+		dRuntimeFilterCost = 0.5 * ulColsUsed * num_rows_outer *
+							 dJoinFeedingTupColumnCostUnit.Get();
+	}
+
 	// TODO 2014-03-14
 	// currently, we hard coded a spilling memory threshold for judging whether hash join spills or not
 	// In the future, we should calculate it based on the number of memory-intensive operators and statement memory available
@@ -996,9 +1055,13 @@ CCostModelGPDB::CostHashJoin(CMemoryPool *mp, CExpressionHandle &exprhdl,
 				// cost of building hash table
 				dRowsInner * (ulColsUsed * dHJHashTableColumnCostUnit +
 							  dWidthInner * dHJHashTableWidthCostUnit) +
+				// cost of filtering outer tuples
+				dRuntimeFilterCost +
 				// cost of feeding outer tuples
-				ulColsUsed * num_rows_outer * dJoinFeedingTupColumnCostUnit +
-				dWidthOuter * num_rows_outer * dJoinFeedingTupWidthCostUnit +
+				ulColsUsed * num_rows_outer_fed *
+					dJoinFeedingTupColumnCostUnit +
+				dWidthOuter * num_rows_outer_fed *
+					dJoinFeedingTupWidthCostUnit +
 				// cost of matching inner tuples
 				dWidthInner * dRowsInner * dHJHashingTupWidthCostUnit +
 				// cost of output tuples
@@ -1015,8 +1078,11 @@ CCostModelGPDB::CostHashJoin(CMemoryPool *mp, CExpressionHandle &exprhdl,
 			(dHJHashTableInitCostFactor +
 			 dRowsInner * (ulColsUsed * dHJHashTableColumnCostUnit +
 						   dWidthInner * dHJHashTableWidthCostUnit) +
-			 ulColsUsed * num_rows_outer * dHJFeedingTupColumnSpillingCostUnit +
-			 dWidthOuter * num_rows_outer * dHJFeedingTupWidthSpillingCostUnit +
+			 dRuntimeFilterCost +
+			 ulColsUsed * num_rows_outer_fed *
+				 dHJFeedingTupColumnSpillingCostUnit +
+			 dWidthOuter * num_rows_outer_fed *
+				 dHJFeedingTupWidthSpillingCostUnit +
 			 dWidthInner * dRowsInner * dHJHashingTupWidthSpillingCostUnit +
 			 pci->Rows() * pci->Width() * dJoinOutputTupCostUnit));
 	}
@@ -1062,6 +1128,12 @@ CCostModelGPDB::CostHashJoin(CMemoryPool *mp, CExpressionHandle &exprhdl,
 			}
 
 			CPhysicalMotion *motion = CPhysicalMotion::PopConvert(popChild);
+			if (CDistributionSpec::EdtHashedSkew == motion->Pds()->Edt())
+			{
+				// the heavy hitters are not hashed by a hybrid redistribute
+				continue;
+			}
+
 			CColRefSet *columns = motion->Pds()->PcrsUsed(mp);
 			GPOS_ASSERT(columns->Size() > 0);
 
@@ -1173,7 +1245,9 @@ CCostModelGPDB::CostMergeJoin(CMemoryPool *mp, CExpressionHandle &exprhdl,
 	GPOS_ASSERT(nullptr != pci);
 #ifdef GPOS_DEBUG
 	COperator::EOperatorId op_id = exprhdl.Pop()->Eopid();
-	GPOS_ASSERT(COperator::EopPhysicalFullMergeJoin == op_id);
+	GPOS_ASSERT(COperator::EopPhysicalFullMergeJoin == op_id ||
+				COperator::EopPhysicalInnerMergeJoin == op_id ||
+				COperator::EopPhysicalLeftOuterMergeJoin == op_id);
 #endif	// GPOS_DEBUG
 
 	const DOUBLE num_rows_outer = pci->PdRows()[0];
@@ -1295,6 +1369,12 @@ CCostModelGPDB::CostIndexNLJoin(CMemoryPool *mp, CExpressionHandle &exprhdl,
 	CCost costChild =
 		CostChildren(mp, exprhdl, pci, pcmgpdb->GetCostModelParams());
 
+	CPhysicalNLJoin *popNLJoin = CPhysicalNLJoin::PopConvert(exprhdl.Pop());
+	if (popNLJoin->FMemoizeInner())
+	{
+		costChild = CostMemoizedChildren(popNLJoin, pcmgpdb, pci, costChild);
+	}
+
 	ULONG risk = pci->Pcstats()->StatsEstimationRisk();
 	ULONG ulPenalizationFactor = 1;
 	const CDouble dIndexJoinAllowedRiskThreshold =
@@ -1316,6 +1396,67 @@ CCostModelGPDB::CostIndexNLJoin(CMemoryPool *mp, CExpressionHandle &exprhdl,
 }
 
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CCostModelGPDB::CostMemoizedChildren
+//
+//	@doc:
+//		Cost of the children of an index-nljoin whose inner child results
+//		are cached by the values of the outer references. The inner child is
+//		only executed for the outer tuples that miss the cache, at most once
+//		per distinct value of the outer references, while every outer tuple
+//		pays for hashing its outer references and every miss pays for
+//		storing the inner tuples in the cache.
+//
+//---------------------------------------------------------------------------
+CCost
+CCostModelGPDB::CostMemoizedChildren(CPhysicalNLJoin *popNLJoin,
+									 const CCostModelGPDB *pcmgpdb,
+									 const SCostingInfo *pci,
+									 CCost costChildren)
+{
+	GPOS_ASSERT(popNLJoin->FMemoizeInner());
+
+	const CDouble dHashTupColumnCostUnit =
+		pcmgpdb->GetCostModelParams()
+			->PcpLookup(CCostModelParamsGPDB::EcpHashAggInputTupColumnCostUnit)
+			->Get();
+	const CDouble dMaterializeCostUnit =
+		pcmgpdb->GetCostModelParams()
+			->PcpLookup(CCostModelParamsGPDB::EcpMaterializeCostUnit)
+			->Get();
+	GPOS_ASSERT(0 < dHashTupColumnCostUnit);
+	GPOS_ASSERT(0 < dMaterializeCostUnit);
+
+	const DOUBLE dOuterRows = std::max(1.0, pci->PdRows()[0]);
+
+	// the outer child has no statistics when only a lower bound on the cost
+	// of a partial plan is computed, a single cache miss keeps it a lower
+	// bound
+	CDouble dOuterRefsNDV(1.0);
+	if (nullptr != pci->Pcstats(0))
+	{
+		dOuterRefsNDV = popNLJoin->DOuterRefsNDV(pci->Pcstats(0)->Pstats());
+	}
+	const DOUBLE dMisses =
+		std::max(1.0, std::min(dOuterRows, dOuterRefsNDV.Get()));
+	const ULONG ulKeys = popNLJoin->PdrgPcrOuterRefs()->Size();
+
+	// cost of the inner child executions served from the cache
+	const DOUBLE dSavedCost =
+		pci->PdCost()[1] * (1.0 - dMisses / dOuterRows);
+
+	const DOUBLE dCacheCost =
+		// cost of probing the cache
+		ulKeys * dOuterRows * dHashTupColumnCostUnit.Get() +
+		// cost of storing the inner tuples in the cache
+		dMisses * pci->PdRows()[1] * pci->GetWidth()[1] *
+			dMaterializeCostUnit.Get();
+
+	return CCost(costChildren.Get() - dSavedCost + dCacheCost);
+}
+
+
 //---------------------------------------------------------------------------
 //	@function:
 //		CCostModelGPDB::CostNLJoin
@@ -1523,6 +1664,21 @@ CCostModelGPDB::CostMotion(CMemoryPool *mp, CExpressionHandle &exprhdl,
 		}
 
 		recvCost = pci->Rows() * pci->Width() * dRecvCostUnit;
+
+		if (CDistributionSpec::EdtHashedSkew == pds->Edt() &&
+			CDistributionSpecHashedSkew::PdsConvert(pds)->FBroadcast())
+		{
+			// rows with a skew value are received by every segment
+			CDouble dSkewFreq =
+				CDistributionSpecHashedSkew::PdsConvert(pds)->DSkewFreq();
+			CDouble dBroadcastRecvCostUnit =
+				pcmgpdb->GetCostModelParams()
+					->PcpLookup(CCostModelParamsGPDB::EcpBroadcastRecvCostUnit)
+					->Get();
+			recvCost = recvCost + pci->Rows() * dSkewFreq.Get() * pci->Width() *
+									  (pcmgpdb->UlHosts() - 1) *
+									  dBroadcastRecvCostUnit;
+		}
 	}
 	else if (COperator::EopPhysicalMotionGather == op_id)
 	{
@@ -2292,6 +2448,95 @@ CCostModelGPDB::CostBitmapLargeNDV(const CCostModelGPDB *pcmgpdb,
 				 (dBitmapIO * dSize + dBitmapPageCost * dNDV));
 }
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CCostModelGPDB::DColWidth
+//
+//	@doc:
+//		Average width of a column of a table scan
+//
+//---------------------------------------------------------------------------
+CDouble
+CCostModelGPDB::DColWidth(CMemoryPool *mp, IStatistics *stats, CColRef *colref)
+{
+	ULongPtrArray *colids = GPOS_NEW(mp) ULongPtrArray(mp);
+	colids->Append(GPOS_NEW(mp) ULONG(colref->Id()));
+	CDouble dColWidth = stats->Width(colids);
+	colids->Release();
+
+	return dColWidth;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CCostModelGPDB::DScanWidth
+//
+//	@doc:
+//		Width of the data a table scan reads per row. Row-oriented tables
+//		are read as a whole, column-oriented tables only read the columns
+//		required from the scan.
+//
+//---------------------------------------------------------------------------
+CDouble
+CCostModelGPDB::DScanWidth(CMemoryPool *mp, COperator *pop,
+						   const SCostingInfo *pci)
+{
+	CPhysicalScan *popScan = CPhysicalScan::PopConvert(pop);
+	IStatistics *stats = popScan->PstatsBaseTable();
+	CTableDescriptor *ptabdesc = popScan->Ptabdesc();
+	IMDRelation::Erelstoragetype rel_storage_type =
+		ptabdesc->RetrieveRelStorageType();
+
+	if ((IMDRelation::ErelstorageAppendOnlyCols != rel_storage_type &&
+		 IMDRelation::ErelstoragePAX != rel_storage_type) ||
+		nullptr == pci->PcrsRequired())
+	{
+		// row-oriented tables are read as a whole
+		return stats->Width();
+	}
+
+	CDouble dWidth(0.0);
+	CDouble dWidthMin(0.0);
+	BOOL fFirst = true;
+	CColRefArray *pdrgpcrOutput = popScan->PdrgpcrOutput();
+	const ULONG ulCols = pdrgpcrOutput->Size();
+	for (ULONG ul = 0; ul < ulCols; ul++)
+	{
+		CColRef *colref = (*pdrgpcrOutput)[ul];
+		if (colref->IsSystemCol())
+		{
+			continue;
+		}
+
+		CDouble dColWidth = DColWidth(mp, stats, colref);
+
+		if (pci->PcrsRequired()->FMember(colref))
+		{
+			dWidth = dWidth + dColWidth;
+		}
+
+		if (fFirst || dColWidth < dWidthMin)
+		{
+			dWidthMin = dColWidth;
+			fFirst = false;
+		}
+	}
+
+	if (fFirst)
+	{
+		return stats->Width();
+	}
+
+	// even if no column is required, e.g. for count(*), the narrowest
+	// column is read to find the number of rows
+	if (CDouble(0.0) == dWidth)
+	{
+		return dWidthMin;
+	}
+
+	return dWidth;
+}
+
 //---------------------------------------------------------------------------
 //	@function:
 //		CCostModelGPDB::CostScan
@@ -2301,8 +2546,7 @@ CCostModelGPDB::CostBitmapLargeNDV(const CCostModelGPDB *pcmgpdb,
 //
 //---------------------------------------------------------------------------
 CCost
-CCostModelGPDB::CostScan(CMemoryPool *,	 // mp
-						 CExpressionHandle &exprhdl,
+CCostModelGPDB::CostScan(CMemoryPool *mp, CExpressionHandle &exprhdl,
 						 const CCostModelGPDB *pcmgpdb, const SCostingInfo *pci)
 {
 	GPOS_ASSERT(nullptr != pcmgpdb);
@@ -2319,8 +2563,7 @@ CCostModelGPDB::CostScan(CMemoryPool *,	 // mp
 		pcmgpdb->GetCostModelParams()
 			->PcpLookup(CCostModelParamsGPDB::EcpInitScanFactor)
 			->Get();
-	const CDouble dTableWidth =
-		CPhysicalScan::PopConvert(pop)->PstatsBaseTable()->Width();
+	const CDouble dTableWidth = DScanWidth(mp, pop, pci);
 
 	// Get total rows for each host to scan
 	const CDouble dTableScanCostUnit =
@@ -2329,6 +2572,15 @@ CCostModelGPDB::CostScan(CMemoryPool *,	 // mp
 			->Get();
 	GPOS_ASSERT(0 < dTableScanCostUnit);
 
+	// the workers of a parallel table scan each initialize a scan and
+	// retrieve their share of the tuples of the segment
+	ULONG ulWorkers = 1;
+	if (COperator::EopPhysicalTableScan == op_id)
+	{
+		CPhysicalTableScan *popScan = CPhysicalTableScan::PopConvert(pop);
+		ulWorkers = std::max(ulWorkers, popScan->UlParallelWorkers());
+	}
+
 	switch (op_id)
 	{
 		case COperator::EopPhysicalTableScan:
@@ -2341,7 +2593,8 @@ CCostModelGPDB::CostScan(CMemoryPool *,	 // mp
 			// we add Scan output tuple cost in the parent operator and not here
 			return CCost(
 				pci->NumRebinds() *
-				(dInitScan + pci->Rows() * dTableWidth * dTableScanCostUnit));
+				(dInitScan * ulWorkers +
+				 pci->Rows() * dTableWidth * dTableScanCostUnit / ulWorkers));
 		default:
 			GPOS_ASSERT(!"invalid index scan");
 			return CCost(0);
@@ -2349,6 +2602,94 @@ CCostModelGPDB::CostScan(CMemoryPool *,	 // mp
 }
 
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CCostModelGPDB::DLateMaterializationSaving
+//
+//	@doc:
+//		Scan cost a filter saves by being pushed down into its child scan
+//		of an append-optimized column-oriented table. Such a scan evaluates
+//		the filter first and only reads the other required columns for the
+//		rows passing it, so these columns are not read for the rejected rows
+//		as costed by CostScan.
+//
+//---------------------------------------------------------------------------
+CDouble
+CCostModelGPDB::DLateMaterializationSaving(CMemoryPool *mp,
+											CExpressionHandle &exprhdl,
+											const CCostModelGPDB *pcmgpdb,
+											const SCostingInfo *pci)
+{
+	if (!GPOS_FTRACE(EopttraceEnablePredicatePushdown) ||
+		!GPOS_FTRACE(EopttraceEnableAOCSLateMaterialize) ||
+		nullptr == pci->PcrsRequired())
+	{
+		return CDouble(0.0);
+	}
+
+	// child operator is not known when computing cost bound
+	COperator *popChild = exprhdl.Pop(0 /*child_index*/);
+	if (nullptr == popChild ||
+		(COperator::EopPhysicalTableScan != popChild->Eopid() &&
+		 COperator::EopPhysicalDynamicTableScan != popChild->Eopid()))
+	{
+		return CDouble(0.0);
+	}
+
+	CPhysicalScan *popScan = CPhysicalScan::PopConvert(popChild);
+	CTableDescriptor *ptabdesc = popScan->Ptabdesc();
+	if (IMDRelation::ErelstorageAppendOnlyCols !=
+		ptabdesc->RetrieveRelStorageType())
+	{
+		return CDouble(0.0);
+	}
+
+	const CDouble dRejected = pci->PdRows()[0] - pci->Rows();
+	if (CDouble(0.0) >= dRejected)
+	{
+		return CDouble(0.0);
+	}
+
+	IStatistics *stats = popScan->PstatsBaseTable();
+	CColRefSet *pcrsUsed = exprhdl.DeriveUsedColumns(1);
+
+	CDouble dWidth(0.0);
+	CColRefSetIter crsi(*pci->PcrsRequired());
+	while (crsi.Advance())
+	{
+		CColRef *colref = crsi.Pcr();
+		if (colref->IsSystemCol() || pcrsUsed->FMember(colref) ||
+			CColRef::EcrtTable != colref->Ecrt())
+		{
+			continue;
+		}
+
+		dWidth = dWidth + DColWidth(mp, stats, colref);
+	}
+
+	// late materialization is not done if the filter uses all the columns
+	if (CDouble(0.0) == dWidth || 0 == pcrsUsed->Size())
+	{
+		return CDouble(0.0);
+	}
+
+	const CDouble dTableScanCostUnit =
+		pcmgpdb->GetCostModelParams()
+			->PcpLookup(CCostModelParamsGPDB::EcpTableScanCostUnit)
+			->Get();
+
+	// the workers of a parallel scan share the rejected rows
+	ULONG ulWorkers = 1;
+	if (COperator::EopPhysicalTableScan == popChild->Eopid())
+	{
+		CPhysicalTableScan *popScan = CPhysicalTableScan::PopConvert(popChild);
+		ulWorkers = std::max(ulWorkers, popScan->UlParallelWorkers());
+	}
+
+	return pci->NumRebinds() * dRejected * dWidth * dTableScanCostUnit /
+		   ulWorkers;
+}
+
 //---------------------------------------------------------------------------
 //	@function:
 //		CCostModelGPDB::CostFilter
@@ -2382,6 +2723,16 @@ CCostModelGPDB::CostFilter(CMemoryPool *mp, CExpressionHandle &exprhdl,
 	CCost costChild =
 		CostChildren(mp, exprhdl, pci, pcmgpdb->GetCostModelParams());
 
+	// the filter is pushed down into a scan of a column-oriented table, which
+	// reads the columns the filter does not use for the qualifying rows only
+	const CDouble dLateMaterializationSaving =
+		DLateMaterializationSaving(mp, exprhdl, pcmgpdb, pci);
+	if (dLateMaterializationSaving < costChild.Get())
+	{
+		costChild =
+			CCost(costChild.Get() - dLateMaterializationSaving.Get());
+	}
+
 	return costLocal + costChild;
 }
 
@@ -2552,6 +2903,8 @@ CCostModelGPDB::Cost(
 		}
 
 		case COperator::EopPhysicalFullMergeJoin:
+		case COperator::EopPhysicalInnerMergeJoin:
+		case COperator::EopPhysicalLeftOuterMergeJoin:
 		{
 			return CostMergeJoin(m_mp, exprhdl, this, pci);
 		}
@@ -200,6 +200,9 @@ const CDouble CCostModelParamsGPDB::DScalarFuncCost(1.0e-04);
 // 'Initial cost' mapped to DInitScanFacorVal (431.0). It is not present in the
 // "Index scan costing".
 const CDouble CCostModelParamsGPDB::DIndexCostConversionFactor = 1.0e-04;
+
+// table scans are not parallel unless the database enables parallel plans
+const CDouble CCostModelParamsGPDB::DParallelWorkers(1.0);
 #define GPOPT_COSTPARAM_NAME_MAX_LENGTH 80
 
 // parameter names in the same order of param enumeration
@@ -254,8 +257,14 @@ const CHAR rgszCostParamNames[CCostModelParamsGPDB::EcpSentinel]
 								 "BitmapIOSmallerNDV",
 								 "BitmapPageCostLargerNDV",
 								 "BitmapPageCostSmallerNDV",
+								 "BitmapPageCost",
 								 "BitmapNDVThreshold",
+								 "BitmapScanRebindCost",
+								 "PenalizeHJSkewUpperLimit",
 								 "ScalarFuncCostUnit",
+								 "IndexOnlyScanTupCostUnit",
+								 "IndexCostConversionFactor",
+								 "ParallelWorkers",
 };
 
 //---------------------------------------------------------------------------
@@ -457,6 +466,10 @@ CCostModelParamsGPDB::CCostModelParamsGPDB(CMemoryPool *mp) : m_mp(mp)
 	m_rgpcp[EcpIndexCostConversionFactor] = GPOS_NEW(mp) SCostParam(
 		EcpIndexCostConversionFactor, DIndexCostConversionFactor,
 		DIndexCostConversionFactor - 0.0, DIndexCostConversionFactor + 0.0);
+
+	m_rgpcp[EcpParallelWorkers] =
+		GPOS_NEW(mp) SCostParam(EcpParallelWorkers, DParallelWorkers,
+								DParallelWorkers - 0.0, DParallelWorkers + 0.0);
 }
 
 
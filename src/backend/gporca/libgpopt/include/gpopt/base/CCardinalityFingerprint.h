@@ -0,0 +1,87 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (c) 2023 VMware, Inc. or its affiliates. All Rights Reserved.
+//
+//	@filename:
+//		CCardinalityFingerprint.h
+//
+//	@doc:
+//		Fingerprints of logical subexpressions that are stable across
+//		optimizations, used as keys of cardinality feedback
+//---------------------------------------------------------------------------
+#ifndef GPOPT_CCardinalityFingerprint_H
+#define GPOPT_CCardinalityFingerprint_H
+
+#include "gpos/base.h"
+
+#include "gpopt/base/CColRef.h"
+
+namespace gpopt
+{
+using namespace gpos;
+
+// fwd declarations
+class CExpression;
+class CExpressionHandle;
+class CGroup;
+class COperator;
+
+//---------------------------------------------------------------------------
+//	@class:
+//		CCardinalityFingerprint
+//
+//	@doc:
+//		Computes 64-bit fingerprints of logical subexpressions. Unlike hash
+//		values of expressions, fingerprints do not depend on column ids, so
+//		the same subexpression gets the same fingerprint in every
+//		optimization: columns of tables are identified by table and
+//		attribute number, and computed columns by name.
+//
+//		The fingerprint of inner joins and selects is the sum of the
+//		fingerprints of their children, and the fingerprint of a conjunction
+//		is the sum of the fingerprints of its conjuncts. Hence all join
+//		orders over the same tables and predicates share a fingerprint, as
+//		they have the same cardinality. Operators that do not change the
+//		cardinality of their child, like projects, share the fingerprint of
+//		their child. The fingerprint of any other operator mixes its
+//		operator id and the fingerprints of its children in order.
+//
+//---------------------------------------------------------------------------
+class CCardinalityFingerprint
+{
+private:
+	// mix the bits of a value
+	static ULLONG UllMix(ULLONG ull);
+
+	// mix a value into a fingerprint, in order
+	static ULLONG UllCombine(ULLONG ullFingerprint, ULLONG ull);
+
+	// fingerprint of a column
+	static ULLONG UllColRef(const CColRef *colref);
+
+	// fingerprint of a scalar expression
+	static ULLONG UllScalar(CExpression *pexprScalar);
+
+	// fingerprint of a logical operator given the fingerprints of its
+	// children
+	static ULLONG UllLogical(COperator *pop, const ULLONG *rgullChildren,
+							 ULONG arity);
+
+public:
+	CCardinalityFingerprint(const CCardinalityFingerprint &) = delete;
+
+	// fingerprint of the logical operator the handle is attached to
+	static ULLONG UllFingerprint(CExpressionHandle &exprhdl);
+
+	// fingerprint of a logical expression
+	static ULLONG UllFingerprint(CExpression *pexpr);
+
+	// fingerprint of a logical group
+	static ULLONG UllFingerprint(CGroup *pgroup);
+};
+
+}  // namespace gpopt
+
+#endif	// !GPOPT_CCardinalityFingerprint_H
+
+// EOF
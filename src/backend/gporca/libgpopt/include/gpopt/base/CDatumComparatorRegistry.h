@@ -0,0 +1,88 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (c) 2023 VMware, Inc. or its affiliates. All Rights Reserved.
+//
+//	@filename:
+//		CDatumComparatorRegistry.h
+//
+//	@doc:
+//		Registry of the ways datums of a type can be compared inside the
+//		optimizer, without evaluating comparison expressions
+//---------------------------------------------------------------------------
+#ifndef GPOPT_CDatumComparatorRegistry_H
+#define GPOPT_CDatumComparatorRegistry_H
+
+#include "gpos/base.h"
+
+#include "naucrates/base/IDatum.h"
+#include "naucrates/md/CMDIdGPDB.h"
+
+namespace gpopt
+{
+using namespace gpos;
+using namespace gpmd;
+using gpnaucrates::IDatum;
+
+//---------------------------------------------------------------------------
+//	@class:
+//		CDatumComparatorRegistry
+//
+//	@doc:
+//		Lists the types whose datums the optimizer compares natively, and
+//		how. Datums of some types compare precisely by their statistics
+//		mapping. Datums of other types compare by sort keys cached on the
+//		datums, which the constant expression evaluator computes for a
+//		whole array of datums at once. Datums of any other type, or
+//		without sort keys, have to be compared by the evaluator one
+//		comparison at a time.
+//
+//---------------------------------------------------------------------------
+class CDatumComparatorRegistry
+{
+public:
+	// result of a native comparison
+	enum ECmpResult
+	{
+		EcmprLess = 0,
+		EcmprEqual,
+		EcmprGreater,
+		EcmprUnknown
+	};
+
+private:
+	// registry entry
+	struct SEntry
+	{
+		// type
+		const CMDIdGPDB *m_mdid;
+
+		// do datums of the type compare precisely by their stats mapping
+		BOOL m_fStats;
+
+		// can the evaluator compute sort keys for datums of the type
+		BOOL m_fSortKeys;
+	};
+
+	// registered types
+	static const SEntry m_rgentries[];
+
+	// find the entry of the given type, or null if it is not registered
+	static const SEntry *Pentry(const IMDId *mdid);
+
+public:
+	// do datums of the given type compare precisely by their stats mapping
+	static BOOL FStatsComparable(const IMDId *mdid);
+
+	// can datums of the given type be compared by sort keys
+	static BOOL FSortKeyComparable(const IMDId *mdid);
+
+	// compare two non-null datums by their cached sort keys
+	static ECmpResult EcmprSortKeys(const IDatum *datum1,
+									const IDatum *datum2);
+};
+
+}  // namespace gpopt
+
+#endif	// !GPOPT_CDatumComparatorRegistry_H
+
+// EOF
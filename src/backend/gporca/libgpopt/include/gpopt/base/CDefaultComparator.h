@@ -20,6 +20,7 @@
 
 #include "gpos/base.h"
 
+#include "gpopt/base/CDatumComparatorRegistry.h"
 #include "gpopt/base/IComparator.h"
 #include "naucrates/md/IMDType.h"
 #include "naucrates/traceflags/traceflags.h"
@@ -70,6 +71,10 @@ private:
 									  const IDatum *datum2,
 									  BOOL *can_use_external_evaluator);
 
+	// compare two datums by their cached sort keys, if they have any
+	static CDatumComparatorRegistry::ECmpResult EcmprSortKeys(
+		const IDatum *datum1, const IDatum *datum2);
+
 public:
 	CDefaultComparator(const CDefaultComparator &) = delete;
 
@@ -97,6 +102,12 @@ public:
 	BOOL IsGreaterThanOrEqual(const IDatum *datum1,
 							  const IDatum *datum2) const override;
 
+	// three-way comparison of the two arguments
+	INT Compare(const IDatum *datum1, const IDatum *datum2) const override;
+
+	// compute the sort keys of the given datums in a single evaluator call
+	void PrepareComparisons(const IDatumArray *pdrgpdatum) const override;
+
 };	// CDefaultComparator
 }  // namespace gpopt
 
@@ -63,6 +63,7 @@ public:
 		EdtHashed,		// data is hashed across all segments
 		EdtHashedNoOp,	// same as hashed, used to force multiple slices for parallel union all. The motions always mirror the underlying distributions.
 		EdtStrictHashed,  // same as hashed, used to force multiple slices for parallel union all. The motions mirror the distribution of the output columns.
+		EdtHashedSkew,  // same as hashed, except for the most common values of the key, which are broadcast or spread randomly (hash join children only)
 		EdtStrictReplicated,  // data is strictly replicated across all segments
 		EdtReplicated,	// data is strict or tainted replicated (required only)
 		EdtTaintedReplicated,  // data once-replicated, after being processed by an input-order-sensitive operator or volatile function (derived only)
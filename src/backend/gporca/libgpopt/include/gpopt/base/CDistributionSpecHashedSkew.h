@@ -0,0 +1,163 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (c) 2023 VMware, Inc. or its affiliates. All Rights Reserved.
+//
+//	@filename:
+//		CDistributionSpecHashedSkew.h
+//
+//	@doc:
+//		Description of a hashed distribution that treats the most common
+//		values of its key separately
+//---------------------------------------------------------------------------
+#ifndef GPOPT_CDistributionSpecHashedSkew_H
+#define GPOPT_CDistributionSpecHashedSkew_H
+
+#include "gpos/base.h"
+
+#include "gpopt/base/CDistributionSpecHashed.h"
+
+namespace gpopt
+{
+using namespace gpos;
+
+//---------------------------------------------------------------------------
+//	@class:
+//		CDistributionSpecHashedSkew
+//
+//	@doc:
+//		Hashed distribution of the children of a hash join whose key has a
+//		few heavy hitters. Rows with one of the given skew values are
+//		broadcast on the build side and sent to a random segment on the probe
+//		side, all other rows are hashed on the key. Both sides of the join
+//		must agree on the skew values, so the spec is only satisfied by an
+//		exact match.
+//
+//---------------------------------------------------------------------------
+class CDistributionSpecHashedSkew : public CDistributionSpecHashed
+{
+private:
+	// constant expressions of the skew values
+	CExpressionArray *m_pdrgpexprSkew;
+
+	// are rows with a skew value broadcast (build side) or spread (probe side)
+	BOOL m_fBroadcast;
+
+	// fraction of the rows having one of the skew values
+	CDouble m_dSkewFreq;
+
+public:
+	CDistributionSpecHashedSkew(const CDistributionSpecHashedSkew &) = delete;
+
+	// ctor
+	CDistributionSpecHashedSkew(CExpressionArray *pdrgpexpr,
+								CExpressionArray *pdrgpexprSkew,
+								BOOL fBroadcast, CDouble dSkewFreq,
+								IMdIdArray *opfamilies = nullptr);
+
+	// dtor
+	~CDistributionSpecHashedSkew() override;
+
+	// distribution type accessor
+	EDistributionType
+	Edt() const override
+	{
+		return CDistributionSpec::EdtHashedSkew;
+	}
+
+	const CHAR *
+	SzId() const override
+	{
+		return "HASHED SKEW";
+	}
+
+	// skew values accessor
+	CExpressionArray *
+	PdrgpexprSkew() const
+	{
+		return m_pdrgpexprSkew;
+	}
+
+	// are rows with a skew value broadcast
+	BOOL
+	FBroadcast() const
+	{
+		return m_fBroadcast;
+	}
+
+	// fraction of the rows having one of the skew values
+	CDouble
+	DSkewFreq() const
+	{
+		return m_dSkewFreq;
+	}
+
+	// does this distribution match the given one
+	BOOL Matches(const CDistributionSpec *pds) const override;
+
+	// does this distribution satisfy the given one
+	BOOL FSatisfies(const CDistributionSpec *pds) const override;
+
+	// equality function
+	BOOL Equals(const CDistributionSpec *pds) const override;
+
+	// hash function
+	ULONG HashValue() const override;
+
+	// return a copy of the distribution spec with remapped columns
+	CDistributionSpec *PdsCopyWithRemappedColumns(
+		CMemoryPool *mp, UlongToColRefMap *colref_mapping,
+		BOOL must_exist) override;
+
+	// return a copy of the distribution spec after excluding the given
+	// columns, skew values only make sense for the full key
+	CDistributionSpecHashed *
+	PdshashedExcludeColumns(CMemoryPool *,	// mp
+							CColRefSet *	// pcrs
+							) override
+	{
+		return nullptr;
+	}
+
+	// strip off any equivalent columns embedded in the distribution spec
+	CDistributionSpec *
+	StripEquivColumns(CMemoryPool *) override
+	{
+		this->AddRef();
+		return this;
+	}
+
+	// append enforcers to dynamic array for the given plan properties
+	void AppendEnforcers(CMemoryPool *mp, CExpressionHandle &exprhdl,
+						 CReqdPropPlan *prpp, CExpressionArray *pdrgpexpr,
+						 CExpression *pexpr) override;
+
+	// print
+	IOstream &OsPrint(IOstream &os) const override;
+
+	// conversion function
+	static CDistributionSpecHashedSkew *
+	PdsConvert(CDistributionSpec *pds)
+	{
+		GPOS_ASSERT(nullptr != pds);
+		GPOS_ASSERT(EdtHashedSkew == pds->Edt());
+
+		return dynamic_cast<CDistributionSpecHashedSkew *>(pds);
+	}
+
+	// conversion function: const argument
+	static const CDistributionSpecHashedSkew *
+	PdsConvert(const CDistributionSpec *pds)
+	{
+		GPOS_ASSERT(nullptr != pds);
+		GPOS_ASSERT(EdtHashedSkew == pds->Edt());
+
+		return dynamic_cast<const CDistributionSpecHashedSkew *>(pds);
+	}
+
+};	// class CDistributionSpecHashedSkew
+
+}  // namespace gpopt
+
+#endif	// !GPOPT_CDistributionSpecHashedSkew_H
+
+// EOF
@@ -70,6 +70,10 @@ public:
 	// order specification of this object for the specified matching type
 	BOOL FCompatible(COrderSpec *pos) const;
 
+	// number of leading keys of the required order specification that the
+	// given order specification already delivers
+	ULONG UlPresortedKeys(COrderSpec *pos) const;
+
 	// required order accessor
 	COrderSpec *
 	PosRequired() const
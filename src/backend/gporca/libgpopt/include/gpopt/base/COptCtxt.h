@@ -32,6 +32,7 @@ using UlongToBitSetMap =
 
 // forward declarations
 class CColRefSet;
+class COptimizationProfile;
 class COptimizerConfig;
 class ICostModel;
 class IConstExprEvaluator;
@@ -123,6 +124,10 @@ private:
 	// (required by CDynamicPhysicalScan for recomputing statistics for DPE)
 	SPartSelectorInfo *m_part_selector_info;
 
+	// profile collecting search counters, not owned; null unless the
+	// caller of the optimizer asked for a profile
+	COptimizationProfile *m_profile{nullptr};
+
 public:
 	COptCtxt(COptCtxt &) = delete;
 
@@ -307,6 +312,20 @@ public:
 		m_pdrgpcrSystemCols = pdrgpcrSystemCols;
 	}
 
+	// optimization profile, null if none was requested
+	COptimizationProfile *
+	Pprofile() const
+	{
+		return m_profile;
+	}
+
+	// set the optimization profile
+	void
+	SetProfile(COptimizationProfile *profile)
+	{
+		m_profile = profile;
+	}
+
 	// factory method
 	static COptCtxt *PoctxtCreate(CMemoryPool *mp, CMDAccessor *md_accessor,
 								  IConstExprEvaluator *pceeval,
@@ -198,6 +198,12 @@ public:
 	// check if order specs satisfies req'd spec
 	BOOL FSatisfies(const COrderSpec *pos) const;
 
+	// number of leading components of req'd spec satisfied by order spec
+	ULONG UlSatisfiedPrefix(const COrderSpec *pos) const;
+
+	// return a copy of the first components of the order spec
+	COrderSpec *PosPrefix(CMemoryPool *mp, ULONG ulLength) const;
+
 	// append enforcers to dynamic array for the given plan properties
 	void AppendEnforcers(CMemoryPool *mp, CExpressionHandle &exprhdl,
 						 CReqdPropPlan *prpp, CExpressionArray *pdrgpexpr,
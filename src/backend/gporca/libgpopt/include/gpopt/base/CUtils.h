@@ -589,6 +589,9 @@ public:
 	// check if a given operator is a nested loops join
 	static BOOL FNLJoin(COperator *pop);
 
+	// check if a given operator is a merge join
+	static BOOL FMergeJoin(COperator *pop);
+
 	// check if a given operator is an Apply
 	static BOOL FApply(COperator *pop);
 
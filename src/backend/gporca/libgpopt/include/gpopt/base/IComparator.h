@@ -20,15 +20,12 @@
 
 #include "gpos/base.h"
 
-namespace gpnaucrates
-{
-// fwd declarations
-class IDatum;
-}  // namespace gpnaucrates
+#include "naucrates/base/IDatum.h"
 
 namespace gpopt
 {
 using gpnaucrates::IDatum;
+using gpnaucrates::IDatumArray;
 
 //---------------------------------------------------------------------------
 //	@class:
@@ -62,6 +59,27 @@ public:
 	// tests if the first argument is greater or equal to the second
 	virtual gpos::BOOL IsGreaterThanOrEqual(const IDatum *datum1,
 											const IDatum *datum2) const = 0;
+
+	// three-way comparison of the two arguments, returns a negative value,
+	// zero or a positive value if the first one is less than, equal to or
+	// greater than the second one
+	virtual gpos::INT
+	Compare(const IDatum *datum1, const IDatum *datum2) const
+	{
+		if (Equals(datum1, datum2))
+		{
+			return 0;
+		}
+
+		return IsLessThan(datum1, datum2) ? -1 : 1;
+	}
+
+	// prepare for comparing the given datums among each other, e.g. by
+	// computing what the comparisons need for all datums at once
+	virtual void
+	PrepareComparisons(const IDatumArray *) const
+	{
+	}
 };
 }  // namespace gpopt
 
@@ -29,6 +29,7 @@
 namespace gpopt
 {
 // fwd declarations
+class CColRefSet;
 class CExpressionHandle;
 
 using namespace gpos;
@@ -137,6 +138,9 @@ public:
 		// width estimate of root
 		DOUBLE m_width;
 
+		// columns required from root, not owned
+		CColRefSet *m_pcrsRequired;
+
 		// number of rebinds of root
 		DOUBLE m_num_rebinds;
 
@@ -162,6 +166,7 @@ public:
 			  m_pcstats(pcstats),
 			  m_rows(0),
 			  m_width(0),
+			  m_pcrsRequired(nullptr),
 			  m_num_rebinds(GPOPT_DEFAULT_REBINDS),
 			  m_pdRowsChildren(nullptr),
 			  m_pdWidthChildren(nullptr),
@@ -242,6 +247,20 @@ public:
 			m_width = width;
 		}
 
+		// required columns accessor
+		CColRefSet *
+		PcrsRequired() const
+		{
+			return m_pcrsRequired;
+		}
+
+		// required columns setter
+		void
+		SetRequiredColumns(CColRefSet *pcrsRequired)
+		{
+			m_pcrsRequired = pcrsRequired;
+		}
+
 		// rebinds accessor
 		DOUBLE
 		NumRebinds() const
@@ -355,6 +374,9 @@ public:
 	// return number of rows per host
 	virtual CDouble DRowsPerHost(CDouble dRowsTotal) const = 0;
 
+	// return number of workers a parallel table scan uses on each segment
+	virtual ULONG UlParallelWorkers() const = 0;
+
 	// return cost model parameters
 	virtual ICostModelParams *GetCostModelParams() const = 0;
 
@@ -12,6 +12,7 @@
 #define GPOPT_CEngine_H
 
 #include "gpos/base.h"
+#include "gpos/common/CWallClock.h"
 
 #include "gpopt/search/CMemo.h"
 #include "gpopt/search/CSearchStage.h"
@@ -80,6 +81,16 @@ private:
 	// number of alternatives generated by each xform
 	UlongPtrArray *m_pdrgpulpXformResults;
 
+	// search time in milliseconds after which the best plan found so far
+	// is returned, 0 if unlimited
+	ULONG m_ulTimeBudget;
+
+	// clock started when the search begins
+	CWallClock m_clockSearch;
+
+	// has the time budget expired after a complete plan was found
+	BOOL m_fTimeBudgetExpired;
+
 #ifdef GPOS_DEBUG
 
 	// a set of internal debugging function used for recursive
@@ -160,8 +171,10 @@ private:
 	BOOL
 	FSearchTerminated() const
 	{
-		// at least one stage has completed and achieved required cost
-		return (nullptr != PssPrevious() && PssPrevious()->FAchievedReqdCost());
+		// the time budget has expired, or at least one stage has completed
+		// and achieved required cost
+		return m_fTimeBudgetExpired || (nullptr != PssPrevious() &&
+										PssPrevious()->FAchievedReqdCost());
 	}
 
 	// generate random plan id
@@ -201,6 +214,13 @@ private:
 	BOOL FSafeToPruneWithDPEStats(CGroupExpression *pgexpr, CReqdPropPlan *prpp,
 								  CCostContext *pccChild, ULONG child_index);
 
+	// cost of the best complete plan found so far, if any
+	CCost CostUpperBound();
+
+	// check if a plan rooted by given group expression can be pruned based
+	// on the cost of the best complete plan found so far
+	BOOL FSafeToPruneGlobally(CGroupExpression *pgexpr);
+
 	// print current memory consumption
 	IOstream &OsPrintMemoryConsumption(IOstream &os,
 									   const CHAR *szHeader) const;
@@ -368,6 +388,17 @@ public:
 						CGroupExpression *pgexprChild,
 						COptimizationContext *pocChild, EOptimizationLevel eol);
 
+	// stop the search if the time budget has expired and a complete plan
+	// was found
+	void CheckTimeBudget();
+
+	// is the search being stopped because the time budget has expired
+	BOOL
+	FTimeBudgetExpired() const
+	{
+		return m_fTimeBudgetExpired;
+	}
+
 	// determine if a plan, rooted by given group expression, can be safely pruned based on cost bounds
 	BOOL FSafeToPrune(CGroupExpression *pgexpr, CReqdPropPlan *prpp,
 					  CCostContext *pccChild, ULONG child_index,
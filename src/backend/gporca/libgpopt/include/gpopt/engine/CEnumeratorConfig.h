@@ -101,6 +101,9 @@ private:
 	// size of plan space
 	ULLONG m_ullSpaceSize;
 
+	// did the search stop early because the time budget expired
+	BOOL m_fTimeBudgetExpired;
+
 	// number of required samples
 	ULLONG m_ullInputSamples;
 
@@ -171,6 +174,20 @@ public:
 		m_ullSpaceSize = ullSpaceSize;
 	}
 
+	// did the search stop early because the time budget expired
+	BOOL
+	FTimeBudgetExpired() const
+	{
+		return m_fTimeBudgetExpired;
+	}
+
+	// record that the search stopped early because of the time budget
+	void
+	SetTimeBudgetExpired(BOOL fTimeBudgetExpired)
+	{
+		m_fTimeBudgetExpired = fTimeBudgetExpired;
+	}
+
 	// return number of required samples
 	ULLONG
 	UllInputSamples() const
@@ -20,6 +20,7 @@
 #define PUSH_GROUP_BY_BELOW_SETOP_THRESHOLD ULONG(10)
 #define XFORM_BIND_THRESHOLD ULONG(0)
 #define SKEW_FACTOR ULONG(0)
+#define TIME_BUDGET ULONG(0)
 
 
 namespace gpopt
@@ -53,6 +54,10 @@ private:
 
 	ULONG m_ulSkewFactor;
 
+	// search time in milliseconds after which the best plan found so far
+	// is returned, 0 if unlimited
+	ULONG m_ulTimeBudget;
+
 public:
 	CHint(const CHint &) = delete;
 
@@ -61,7 +66,7 @@ public:
 		  ULONG array_expansion_threshold, ULONG ulJoinOrderDPLimit,
 		  ULONG broadcast_threshold, BOOL enforce_constraint_on_dml,
 		  ULONG push_group_by_below_setop_threshold, ULONG xform_bind_threshold,
-		  ULONG skew_factor)
+		  ULONG skew_factor, ULONG time_budget)
 		: m_ulJoinArityForAssociativityCommutativity(
 			  join_arity_for_associativity_commutativity),
 		  m_ulArrayExpansionThreshold(array_expansion_threshold),
@@ -71,7 +76,8 @@ public:
 		  m_ulPushGroupByBelowSetopThreshold(
 			  push_group_by_below_setop_threshold),
 		  m_ulXform_bind_threshold(xform_bind_threshold),
-		  m_ulSkewFactor(skew_factor)
+		  m_ulSkewFactor(skew_factor),
+		  m_ulTimeBudget(time_budget)
 	{
 	}
 
@@ -143,6 +149,14 @@ public:
 		return m_ulSkewFactor;
 	}
 
+	// Search time in milliseconds after which the engine stops and returns
+	// the best complete plan found so far; 0 if unlimited
+	ULONG
+	UlTimeBudget() const
+	{
+		return m_ulTimeBudget;
+	}
+
 	// generate default hint configurations, which disables sort during insert on
 	// append only row-oriented partitioned tables by default
 	static CHint *
@@ -156,7 +170,8 @@ public:
 			true,								 /* enforce_constraint_on_dml */
 			PUSH_GROUP_BY_BELOW_SETOP_THRESHOLD, /* push_group_by_below_setop_threshold */
 			XFORM_BIND_THRESHOLD,				 /* xform_bind_threshold */
-			SKEW_FACTOR							 /* skew_factor */
+			SKEW_FACTOR,						 /* skew_factor */
+			TIME_BUDGET							 /* time_budget */
 		);
 	}
 
@@ -75,6 +75,9 @@ public:
 
 	// Returns true iff the evaluator can evaluate expressions
 	BOOL FCanEvalExpressions() override;
+
+	// compute the sort keys of the given datums through the DXL evaluator
+	BOOL FComputeSortKeys(const IDatumArray *pdrgpdatum) override;
 };
 }  // namespace gpopt
 
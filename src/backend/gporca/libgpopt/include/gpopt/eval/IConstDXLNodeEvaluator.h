@@ -20,6 +20,8 @@
 
 #include "gpos/base.h"
 
+#include "naucrates/base/IDatum.h"
+
 // forward declaration
 namespace gpdxl
 {
@@ -49,6 +51,14 @@ public:
 	// returns true iff the evaluator can evaluate constant expressions without
 	// subqueries
 	virtual gpos::BOOL FCanEvalExpressions() = 0;
+
+	// compute the sort keys of the given non-null datums of the same type
+	// and cache them on the datums, returns false if no keys were computed
+	virtual gpos::BOOL
+	FComputeSortKeys(const gpnaucrates::IDatumArray *)
+	{
+		return false;
+	}
 };
 }  // namespace gpopt
 
@@ -21,9 +21,12 @@
 #include "gpos/base.h"
 #include "gpos/common/CRefCount.h"
 
+#include "naucrates/base/IDatum.h"
+
 namespace gpopt
 {
 using namespace gpos;
+using gpnaucrates::IDatumArray;
 
 class CExpression;	// forward declaration
 
@@ -50,6 +53,14 @@ public:
 	// returns true iff the evaluator can evaluate constant expressions without
 	// subqueries
 	virtual BOOL FCanEvalExpressions() = 0;
+
+	// compute the sort keys of the given non-null datums of the same type
+	// and cache them on the datums, returns false if no keys were computed
+	virtual BOOL
+	FComputeSortKeys(const IDatumArray *)
+	{
+		return false;
+	}
 };
 }  // namespace gpopt
 
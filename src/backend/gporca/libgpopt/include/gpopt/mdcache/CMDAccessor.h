@@ -23,6 +23,7 @@
 #include "naucrates/md/CSystemId.h"
 #include "naucrates/md/IMDExtStats.h"
 #include "naucrates/md/IMDExtStatsInfo.h"
+#include "naucrates/md/IMDMatViewInfo.h"
 #include "naucrates/md/IMDFunction.h"
 #include "naucrates/md/IMDId.h"
 #include "naucrates/md/IMDProvider.h"
@@ -301,6 +302,9 @@ public:
 	// interface to an extended stats metadata object from the MD cache
 	const IMDExtStatsInfo *RetrieveExtStatsInfo(IMDId *mdid);
 
+	// interface to the materialized views of a relation
+	const IMDMatViewInfo *RetrieveMatViewInfo(IMDId *mdid);
+
 	// interface to a relation object from the MD cache
 	const IMDRelation *RetrieveRel(IMDId *mdid);
 
@@ -372,6 +376,10 @@ public:
 
 	// serialize system ids to passed stream
 	void SerializeSysid(COstream &oos);
+
+	// copies, allocated in the given pool, of the mdids of all the objects
+	// accessed so far
+	IMdIdArray *GetAccessedMdIds(CMemoryPool *mp);
 };
 }  // namespace gpopt
 
@@ -37,6 +37,10 @@ using namespace gpmd;
 //---------------------------------------------------------------------------
 class CMDCache
 {
+public:
+	// type definition of function selecting the mdids of entries to invalidate
+	using MDIdFilterFuncPtr = BOOL (*)(const IMDId *, void *);
+
 private:
 	// pointer to the underlying cache
 	static CMDAccessor::MDCache *m_pcache;
@@ -44,6 +48,17 @@ private:
 	// the maximum size of the cache
 	static ULLONG m_ullCacheQuota;
 
+	// filter function and argument passed through to the underlying cache
+	struct SInvalidationFilter
+	{
+		MDIdFilterFuncPtr m_filter_func;
+
+		void *m_arg;
+	};
+
+	// adapt a filter on mdids to a filter on cache keys
+	static BOOL FFilterKey(CMDKey *const &pmdkey, void *pv);
+
 	// private ctor
 	CMDCache() = default;
 
@@ -78,6 +93,9 @@ public:
 	// reset global instance
 	static void Reset();
 
+	// invalidate the entries whose mdid satisfies the given filter
+	static ULONG Invalidate(MDIdFilterFuncPtr filter_func, void *arg);
+
 	// global accessor
 	static CMDAccessor::MDCache *
 	Pcache()
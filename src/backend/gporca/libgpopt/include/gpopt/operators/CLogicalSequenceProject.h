@@ -48,19 +48,27 @@ private:
 	// flag indicating if current operator has any non-empty frame specs
 	BOOL m_fHasFrameSpecs;
 
+	// is the window computed on each segment separately, as a pre-filter
+	// below the motion feeding a window on the same partition keys
+	BOOL m_fLocal;
+
 	// set the flag indicating that SeqPrj has specified order specs
 	void SetHasOrderSpecs(CMemoryPool *mp);
 
 	// set the flag indicating that SeqPrj has specified frame specs
 	void SetHasFrameSpecs(CMemoryPool *mp);
 
+	// stats of a local window with a histogram on its ranking columns
+	IStatistics *PstatsRanked(CMemoryPool *mp, CExpressionHandle &exprhdl,
+							  IStatistics *stats) const;
+
 public:
 	CLogicalSequenceProject(const CLogicalSequenceProject &) = delete;
 
 	// ctor
 	CLogicalSequenceProject(CMemoryPool *mp, CDistributionSpec *pds,
 							COrderSpecArray *pdrgpos,
-							CWindowFrameArray *pdrgpwf);
+							CWindowFrameArray *pdrgpwf, BOOL fLocal = false);
 
 	// ctor for pattern
 	explicit CLogicalSequenceProject(CMemoryPool *mp);
@@ -117,6 +125,13 @@ public:
 		return m_fHasFrameSpecs;
 	}
 
+	// is the window computed on each segment separately
+	BOOL
+	FLocal() const
+	{
+		return m_fLocal;
+	}
+
 	// return a copy of the operator with remapped columns
 	COperator *PopCopyWithRemappedColumns(CMemoryPool *mp,
 										  UlongToColRefMap *colref_mapping,
@@ -168,6 +183,11 @@ public:
 	//-------------------------------------------------------------------------------------
 	//-------------------------------------------------------------------------------------
 
+	// compute required stat columns of the n-th child
+	CColRefSet *PcrsStat(CMemoryPool *mp, CExpressionHandle &exprhdl,
+						 CColRefSet *pcrsInput,
+						 ULONG child_index) const override;
+
 	// derive statistics
 	IStatistics *PstatsDerive(CMemoryPool *mp, CExpressionHandle &exprhdl,
 							  IStatisticsArray *stats_ctxt) const override;
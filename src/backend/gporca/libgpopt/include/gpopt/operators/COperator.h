@@ -207,6 +207,8 @@ public:
 		EopPhysicalLeftAntiSemiNLJoinNotIn,
 		EopPhysicalCorrelatedNotInLeftAntiSemiNLJoin,
 		EopPhysicalFullMergeJoin,
+		EopPhysicalInnerMergeJoin,
+		EopPhysicalLeftOuterMergeJoin,
 		EopPhysicalDynamicTableScan,
 		EopPhysicalSequence,
 		EopPhysicalTVF,
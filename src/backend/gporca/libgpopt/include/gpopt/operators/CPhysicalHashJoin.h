@@ -93,10 +93,26 @@ private:
 		CDistributionSpecHashed *pdshashedInput, ULONG child_index,
 		CDrvdPropArray *pdrgpdpCtxt, ULONG ulOptReq);
 
+	// heavy hitters of the outer hash join key, nullptr if there are none
+	CExpressionArray *PdrgpexprSkewValues(CMemoryPool *mp,
+										  CExpressionHandle &exprhdl,
+										  CDouble *pdSkewFreq) const;
+
+	// create (hybrid redistribute, hybrid redistribute) optimization request
+	CDistributionSpec *PdsRequiredHashedSkew(CMemoryPool *mp,
+											 CExpressionHandle &exprhdl,
+											 CDistributionSpec *pdsInput,
+											 ULONG child_index,
+											 CDrvdPropArray *pdrgpdpCtxt) const;
+
 	// check whether a hash key is nullable
 	BOOL FNullableHashKey(ULONG ulKey, CColRefSet *pcrsNotNullInner,
 						  BOOL fInner) const;
 
+	// estimated false positive rate of a runtime filter built from the
+	// given number of inner tuples
+	static DOUBLE DRuntimeFilterFPRate(DOUBLE dRowsInner);
+
 protected:
 	// helper for computing a hashed distribution matching the given distribution
 	CDistributionSpecHashed *PdshashedMatching(
@@ -164,6 +180,11 @@ public:
 		return m_pdrgpexprOuterKeys;
 	}
 
+	// check whether the outer tuples are worth filtering by a runtime filter
+	// built from the inner tuples, and estimate how many of them pass it
+	BOOL FRuntimeFilter(DOUBLE dRowsOuter, DOUBLE dRowsInner, DOUBLE dRowsJoin,
+						DOUBLE *pdRowsFiltered) const;
+
 	//-------------------------------------------------------------------------------------
 	// Required Plan Properties
 	//-------------------------------------------------------------------------------------
@@ -34,12 +34,16 @@ private:
 	// a copy of the original join predicate that has been pushed down to the inner side
 	CExpression *m_origJoinPred;
 
+	// cache the inner child results by the values of the outer references
+	BOOL m_fMemoizeInner;
+
 public:
 	CPhysicalInnerIndexNLJoin(const CPhysicalInnerIndexNLJoin &) = delete;
 
 	// ctor
 	CPhysicalInnerIndexNLJoin(CMemoryPool *mp, CColRefArray *colref_array,
-							  CExpression *origJoinPred);
+							  CExpression *origJoinPred,
+							  BOOL fMemoizeInner = false);
 
 	// dtor
 	~CPhysicalInnerIndexNLJoin() override;
@@ -63,11 +67,18 @@ public:
 
 	// outer column references accessor
 	CColRefArray *
-	PdrgPcrOuterRefs() const
+	PdrgPcrOuterRefs() const override
 	{
 		return m_pdrgpcrOuterRefs;
 	}
 
+	// are the results of the inner child cached
+	BOOL
+	FMemoizeInner() const override
+	{
+		return m_fMemoizeInner;
+	}
+
 	// compute required distribution of the n-th child
 	CDistributionSpec *PdsRequired(CMemoryPool *mp, CExpressionHandle &exprhdl,
 								   CDistributionSpec *pdsRequired,
@@ -103,6 +114,9 @@ public:
 		return m_origJoinPred;
 	}
 
+	// debug print
+	IOstream &OsPrint(IOstream &os) const override;
+
 };	// class CPhysicalInnerIndexNLJoin
 
 }  // namespace gpopt
@@ -22,13 +22,17 @@ private:
 	// a copy of the original join predicate that has been pushed down to the inner side
 	CExpression *m_origJoinPred;
 
+	// cache the inner child results by the values of the outer references
+	BOOL m_fMemoizeInner;
+
 public:
 	CPhysicalLeftOuterIndexNLJoin(const CPhysicalLeftOuterIndexNLJoin &) =
 		delete;
 
 	// ctor
 	CPhysicalLeftOuterIndexNLJoin(CMemoryPool *mp, CColRefArray *colref_array,
-								  CExpression *origJoinPred);
+								  CExpression *origJoinPred,
+								  BOOL fMemoizeInner = false);
 
 	// dtor
 	~CPhysicalLeftOuterIndexNLJoin() override;
@@ -56,11 +60,18 @@ public:
 
 	// outer column references accessor
 	CColRefArray *
-	PdrgPcrOuterRefs() const
+	PdrgPcrOuterRefs() const override
 	{
 		return m_pdrgpcrOuterRefs;
 	}
 
+	// are the results of the inner child cached
+	BOOL
+	FMemoizeInner() const override
+	{
+		return m_fMemoizeInner;
+	}
+
 	// compute required distribution of the n-th child
 	CDistributionSpec *PdsRequired(CMemoryPool *mp, CExpressionHandle &exprhdl,
 								   CDistributionSpec *pdsRequired,
@@ -96,6 +107,9 @@ public:
 		return m_origJoinPred;
 	}
 
+	// debug print
+	IOstream &OsPrint(IOstream &os) const override;
+
 };	// class CPhysicalLeftOuterIndexNLJoin
 
 }  // namespace gpopt
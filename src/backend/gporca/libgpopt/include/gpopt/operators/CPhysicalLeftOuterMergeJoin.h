@@ -0,0 +1,73 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (c) 2023 VMware, Inc. or its affiliates. All Rights Reserved.
+//
+//	@filename:
+//		CPhysicalLeftOuterMergeJoin.h
+//
+//	@doc:
+//		Left outer merge join operator
+//---------------------------------------------------------------------------
+#ifndef GPOPT_CPhysicalLeftOuterMergeJoin_H
+#define GPOPT_CPhysicalLeftOuterMergeJoin_H
+
+#include "gpos/base.h"
+
+#include "gpopt/operators/CPhysicalMergeJoin.h"
+
+namespace gpopt
+{
+//---------------------------------------------------------------------------
+//	@class:
+//		CPhysicalLeftOuterMergeJoin
+//
+//	@doc:
+//		Left outer merge join operator
+//
+//---------------------------------------------------------------------------
+class CPhysicalLeftOuterMergeJoin : public CPhysicalMergeJoin
+{
+public:
+	CPhysicalLeftOuterMergeJoin(const CPhysicalLeftOuterMergeJoin &) = delete;
+
+	// ctor
+	CPhysicalLeftOuterMergeJoin(
+		CMemoryPool *mp, CExpressionArray *outer_merge_clauses,
+		CExpressionArray *inner_merge_clauses, IMdIdArray *hash_opfamilies,
+		BOOL is_null_aware = true,
+		CXform::EXformId origin_xform = CXform::ExfSentinel);
+
+	// dtor
+	~CPhysicalLeftOuterMergeJoin() override = default;
+
+	// ident accessors
+	EOperatorId
+	Eopid() const override
+	{
+		return EopPhysicalLeftOuterMergeJoin;
+	}
+
+	// return a string for operator name
+	const CHAR *
+	SzId() const override
+	{
+		return "CPhysicalLeftOuterMergeJoin";
+	}
+
+	// conversion function
+	static CPhysicalLeftOuterMergeJoin *
+	PopConvert(COperator *pop)
+	{
+		GPOS_ASSERT(nullptr != pop);
+		GPOS_ASSERT(EopPhysicalLeftOuterMergeJoin == pop->Eopid());
+
+		return dynamic_cast<CPhysicalLeftOuterMergeJoin *>(pop);
+	}
+
+};	// class CPhysicalLeftOuterMergeJoin
+
+}  // namespace gpopt
+
+#endif	// !GPOPT_CPhysicalLeftOuterMergeJoin_H
+
+// EOF
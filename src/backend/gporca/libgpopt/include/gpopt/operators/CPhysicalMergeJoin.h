@@ -0,0 +1,92 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (c) 2023 VMware, Inc. or its affiliates. All Rights Reserved.
+//
+//	@filename:
+//		CPhysicalMergeJoin.h
+//
+//	@doc:
+//		Base merge join operator
+//---------------------------------------------------------------------------
+#ifndef GPOPT_CPhysicalMergeJoin_H
+#define GPOPT_CPhysicalMergeJoin_H
+
+#include "gpos/base.h"
+
+#include "gpopt/operators/CPhysicalJoin.h"
+
+namespace gpopt
+{
+//---------------------------------------------------------------------------
+//	@class:
+//		CPhysicalMergeJoin
+//
+//	@doc:
+//		Base merge join operator. Both children are sorted on the merge
+//		clauses and co-located on (a subset of) them.
+//
+//---------------------------------------------------------------------------
+class CPhysicalMergeJoin : public CPhysicalJoin
+{
+private:
+	CExpressionArray *m_outer_merge_clauses;
+
+	CExpressionArray *m_inner_merge_clauses;
+
+public:
+	CPhysicalMergeJoin(const CPhysicalMergeJoin &) = delete;
+
+	// ctor
+	explicit CPhysicalMergeJoin(
+		CMemoryPool *mp, CExpressionArray *outer_merge_clauses,
+		CExpressionArray *inner_merge_clauses, IMdIdArray *hash_opfamilies,
+		BOOL is_null_aware = true,
+		CXform::EXformId origin_xform = CXform::ExfSentinel);
+
+	// dtor
+	~CPhysicalMergeJoin() override;
+
+	CDistributionSpec *PdsRequired(CMemoryPool *mp, CExpressionHandle &exprhdl,
+								   CDistributionSpec *pdsRequired,
+								   ULONG child_index,
+								   CDrvdPropArray *pdrgpdpCtxt,
+								   ULONG ulOptReq) const override;
+
+	CEnfdDistribution *Ped(CMemoryPool *mp, CExpressionHandle &exprhdl,
+						   CReqdPropPlan *prppInput, ULONG child_index,
+						   CDrvdPropArray *pdrgpdpCtxt,
+						   ULONG ulDistrReq) override;
+
+	COrderSpec *PosRequired(CMemoryPool *mp, CExpressionHandle &exprhdl,
+							COrderSpec *posInput, ULONG child_index,
+							CDrvdPropArray *pdrgpdpCtxt,
+							ULONG ulOptReq) const override;
+
+	// compute required rewindability of the n-th child
+	CRewindabilitySpec *PrsRequired(CMemoryPool *mp, CExpressionHandle &exprhdl,
+									CRewindabilitySpec *prsRequired,
+									ULONG child_index,
+									CDrvdPropArray *pdrgpdpCtxt,
+									ULONG ulOptReq) const override;
+
+	// return order property enforcing type for this operator
+	CEnfdProp::EPropEnforcingType EpetOrder(
+		CExpressionHandle &exprhdl, const CEnfdOrder *peo) const override;
+
+	CEnfdDistribution::EDistributionMatching Edm(
+		CReqdPropPlan *,   // prppInput
+		ULONG,			   //child_index,
+		CDrvdPropArray *,  // pdrgpdpCtxt,
+		ULONG			   // ulOptReq
+		) override;
+
+	CDistributionSpec *PdsDerive(CMemoryPool *mp,
+								 CExpressionHandle &exprhdl) const override;
+
+};	// class CPhysicalMergeJoin
+
+}  // namespace gpopt
+
+#endif	// !GPOPT_CPhysicalMergeJoin_H
+
+// EOF
@@ -15,6 +15,7 @@
 
 #include "gpopt/base/CUtils.h"
 #include "gpopt/operators/CPhysicalJoin.h"
+#include "naucrates/statistics/IStatistics.h"
 
 namespace gpopt
 {
@@ -88,6 +89,26 @@ public:
 		return nullptr;
 	}
 
+	// return the outer child columns the inner child is parameterized by --
+	// overloaded by index NL joins
+	virtual CColRefArray *
+	PdrgPcrOuterRefs() const
+	{
+		return nullptr;
+	}
+
+	// return true if the results of the inner child are cached by the values
+	// of the outer references -- overloaded by index NL joins
+	virtual BOOL
+	FMemoizeInner() const
+	{
+		return false;
+	}
+
+	// estimate the number of distinct values of the outer references in the
+	// given statistics of the outer child
+	CDouble DOuterRefsNDV(IStatistics *outer_stats) const;
+
 	// conversion function
 	static CPhysicalNLJoin *
 	PopConvert(COperator *pop)
@@ -47,6 +47,9 @@ private:
 	// required columns in order/frame specs
 	CColRefSet *m_pcrsRequiredLocal;
 
+	// is the window computed on each segment separately
+	BOOL m_fLocal;
+
 	// create local order spec
 	void CreateOrderSpec(CMemoryPool *mp);
 
@@ -59,7 +62,7 @@ public:
 	// ctor
 	CPhysicalSequenceProject(CMemoryPool *mp, CDistributionSpec *pds,
 							 COrderSpecArray *pdrgpos,
-							 CWindowFrameArray *pdrgpwf);
+							 CWindowFrameArray *pdrgpwf, BOOL fLocal = false);
 
 	// dtor
 	~CPhysicalSequenceProject() override;
@@ -99,6 +102,13 @@ public:
 		return m_pdrgpwf;
 	}
 
+	// is the window computed on each segment separately
+	BOOL
+	FLocal() const
+	{
+		return m_fLocal;
+	}
+
 	// match function
 	BOOL Matches(COperator *pop) const override;
 
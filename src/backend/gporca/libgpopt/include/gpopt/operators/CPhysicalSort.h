@@ -24,7 +24,10 @@ namespace gpopt
 //		CPhysicalSort
 //
 //	@doc:
-//		Sort operator
+//		Sort operator. An incremental sort has a number of presorted keys,
+//		it requires its child to deliver the order on that prefix of the sort
+//		keys and only sorts the tuples within each group of equal prefix
+//		values.
 //
 //---------------------------------------------------------------------------
 class CPhysicalSort : public CPhysical
@@ -36,11 +39,15 @@ private:
 	// columns used by order spec
 	CColRefSet *m_pcrsSort;
 
+	// number of leading sort keys the child is sorted on, zero for a full
+	// sort
+	ULONG m_ulPresortedKeys;
+
 public:
 	CPhysicalSort(const CPhysicalSort &) = delete;
 
 	// ctor
-	CPhysicalSort(CMemoryPool *mp, COrderSpec *pos);
+	CPhysicalSort(CMemoryPool *mp, COrderSpec *pos, ULONG ulPresortedKeys = 0);
 
 	// dtor
 	~CPhysicalSort() override;
@@ -59,6 +66,20 @@ public:
 		return m_pos;
 	}
 
+	// number of presorted keys
+	ULONG
+	UlPresortedKeys() const
+	{
+		return m_ulPresortedKeys;
+	}
+
+	// is this an incremental sort
+	BOOL
+	FIncremental() const
+	{
+		return 0 < m_ulPresortedKeys;
+	}
+
 	// return a string for operator name
 	const CHAR *
 	SzId() const override
@@ -69,6 +90,9 @@ public:
 	// match function
 	BOOL Matches(COperator *pop) const override;
 
+	// hash function
+	ULONG HashValue() const override;
+
 	// sensitivity to order of inputs
 	BOOL
 	FInputOrderSensitive() const override
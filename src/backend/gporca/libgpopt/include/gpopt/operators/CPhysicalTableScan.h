@@ -28,6 +28,9 @@ namespace gpopt
 class CPhysicalTableScan : public CPhysicalScan
 {
 private:
+	// number of workers sharing the scan on each segment, 0 if not parallel
+	ULONG m_ulParallelWorkers;
+
 	// private copy ctor
 	CPhysicalTableScan(const CPhysicalTableScan &);
 
@@ -35,7 +38,7 @@ public:
 	// ctors
 	explicit CPhysicalTableScan(CMemoryPool *mp);
 	CPhysicalTableScan(CMemoryPool *, const CName *, CTableDescriptor *,
-					   CColRefArray *);
+					   CColRefArray *, ULONG ulParallelWorkers = 0);
 
 	// ident accessors
 	EOperatorId
@@ -57,6 +60,13 @@ public:
 	// match function
 	BOOL Matches(COperator *) const override;
 
+	// number of workers sharing the scan on each segment
+	ULONG
+	UlParallelWorkers() const
+	{
+		return m_ulParallelWorkers;
+	}
+
 	//-------------------------------------------------------------------------------------
 	//-------------------------------------------------------------------------------------
 	//-------------------------------------------------------------------------------------
@@ -0,0 +1,301 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (c) 2023 VMware, Inc. or its affiliates. All Rights Reserved.
+//
+//	@filename:
+//		COptimizationProfile.h
+//
+//	@doc:
+//		Counters collected while optimizing a single query
+//---------------------------------------------------------------------------
+#ifndef GPOPT_COptimizationProfile_H
+#define GPOPT_COptimizationProfile_H
+
+#include "gpos/base.h"
+#include "gpos/common/CWallClock.h"
+
+#include "gpopt/search/CJob.h"
+#include "gpopt/xforms/CXform.h"
+
+// number of groups with the highest job time kept by a profile
+#define GPOPT_PROFILE_TOP_GROUPS 10
+
+namespace gpopt
+{
+using namespace gpos;
+
+//---------------------------------------------------------------------------
+//	@class:
+//		COptimizationProfile
+//
+//	@doc:
+//		Counters describing the search of one optimization. A caller that
+//		wants a profile passes one to COptimizer::PdxlnOptimize, which makes
+//		it visible through the optimizer context; components that collect
+//		counters only do so when a profile is present, or when optimization
+//		statistics are printed. The profile is owned by the caller and
+//		accumulates over optimizations until it is reset.
+//
+//		Besides the per-xform counters, the profile keeps the time spent
+//		executing each type of job, the groups whose jobs took the longest,
+//		and the time spent in phases that are entered from many places,
+//		such as statistics derivation and metadata lookups.
+//
+//---------------------------------------------------------------------------
+class COptimizationProfile
+{
+public:
+	// phases timed as a whole; nested entries into a phase are not
+	// counted again
+	enum EPhase
+	{
+		EphStatsDerivation = 0,
+		EphMDLookup,
+		EphMDFetch,
+
+		EphSentinel
+	};
+
+	// job counters of a group
+	struct SGroupEntry
+	{
+		// group id
+		ULONG m_ulId;
+
+		// number of jobs executed on the group
+		ULLONG m_ullJobs;
+
+		// time spent executing the jobs, in microseconds
+		ULLONG m_ullTimeUS;
+	};
+
+private:
+	// number of groups in the memo
+	ULONG m_ulGroups{0};
+
+	// number of group expressions in the memo
+	ULONG m_ulGroupExprs{0};
+
+	// number of groups that were found to duplicate other groups
+	ULONG m_ulDuplicateGroups{0};
+
+	// number of times each xform was applied
+	ULLONG m_rgullXformCalls[CXform::ExfSentinel];
+
+	// time spent in each xform, in microseconds
+	ULLONG m_rgullXformTimes[CXform::ExfSentinel];
+
+	// number of bindings each xform was applied to
+	ULLONG m_rgullXformBindings[CXform::ExfSentinel];
+
+	// number of alternatives each xform generated
+	ULLONG m_rgullXformResults[CXform::ExfSentinel];
+
+	// number of jobs executed of each type
+	ULLONG m_rgullJobCalls[CJob::EjtSentinel];
+
+	// time spent executing jobs of each type, in microseconds
+	ULLONG m_rgullJobTimes[CJob::EjtSentinel];
+
+	// groups with the highest job time, by decreasing time
+	SGroupEntry m_rggrpentry[GPOPT_PROFILE_TOP_GROUPS];
+
+	// number of valid entries in m_rggrpentry
+	ULONG m_ulTopGroups{0};
+
+	// time spent in each phase, in microseconds
+	ULLONG m_rgullPhaseTimes[EphSentinel];
+
+	// number of times each phase was entered, not counting nested entries
+	ULLONG m_rgullPhaseCalls[EphSentinel];
+
+	// nesting depth of each phase
+	ULONG m_rgulPhaseDepth[EphSentinel];
+
+	// clocks of the outermost entries into the phases
+	CWallClock m_rgclockPhase[EphSentinel];
+
+public:
+	COptimizationProfile(const COptimizationProfile &) = delete;
+
+	// ctor
+	COptimizationProfile();
+
+	// dtor
+	~COptimizationProfile() = default;
+
+	// reset all counters
+	void Reset();
+
+	// record an application of an xform
+	void RecordXform(CXform::EXformId exfid, ULONG ulTimeUS, ULONG ulBindings,
+					 ULONG ulResults);
+
+	// record the execution of a job
+	void RecordJob(CJob::EJobType ejt, ULONG ulTimeUS);
+
+	// record the job counters of a group, keeping the top groups only
+	void RecordGroup(ULONG ulId, ULLONG ullJobs, ULLONG ullTimeUS);
+
+	// record the size of the memo at the end of optimization
+	void RecordMemo(ULONG ulGroups, ULONG ulGroupExprs,
+					ULONG ulDuplicateGroups);
+
+	// enter a phase
+	void StartPhase(EPhase eph);
+
+	// leave a phase
+	void EndPhase(EPhase eph);
+
+	// profile of the current optimization, null if none was requested or
+	// no optimization is running
+	static COptimizationProfile *PprofileFromTLS();
+
+	// name of a job type
+	static const CHAR *SzJobType(CJob::EJobType ejt);
+
+	// name of a phase
+	static const CHAR *SzPhase(EPhase eph);
+
+	// number of groups in the memo
+	ULONG
+	UlGroups() const
+	{
+		return m_ulGroups;
+	}
+
+	// number of group expressions in the memo
+	ULONG
+	UlGroupExprs() const
+	{
+		return m_ulGroupExprs;
+	}
+
+	// number of duplicate groups in the memo
+	ULONG
+	UlDuplicateGroups() const
+	{
+		return m_ulDuplicateGroups;
+	}
+
+	// number of times the given xform was applied
+	ULLONG
+	UllXformCalls(CXform::EXformId exfid) const
+	{
+		return m_rgullXformCalls[exfid];
+	}
+
+	// time spent in the given xform, in microseconds
+	ULLONG
+	UllXformTimeUS(CXform::EXformId exfid) const
+	{
+		return m_rgullXformTimes[exfid];
+	}
+
+	// number of bindings the given xform was applied to
+	ULLONG
+	UllXformBindings(CXform::EXformId exfid) const
+	{
+		return m_rgullXformBindings[exfid];
+	}
+
+	// number of alternatives the given xform generated
+	ULLONG
+	UllXformResults(CXform::EXformId exfid) const
+	{
+		return m_rgullXformResults[exfid];
+	}
+
+	// number of jobs executed of the given type
+	ULLONG
+	UllJobCalls(CJob::EJobType ejt) const
+	{
+		return m_rgullJobCalls[ejt];
+	}
+
+	// time spent executing jobs of the given type, in microseconds
+	ULLONG
+	UllJobTimeUS(CJob::EJobType ejt) const
+	{
+		return m_rgullJobTimes[ejt];
+	}
+
+	// number of top groups recorded
+	ULONG
+	UlTopGroups() const
+	{
+		return m_ulTopGroups;
+	}
+
+	// top group at the given position, by decreasing job time
+	const SGroupEntry &
+	TopGroup(ULONG ulPos) const
+	{
+		GPOS_ASSERT(ulPos < m_ulTopGroups);
+
+		return m_rggrpentry[ulPos];
+	}
+
+	// number of times the given phase was entered
+	ULLONG
+	UllPhaseCalls(EPhase eph) const
+	{
+		return m_rgullPhaseCalls[eph];
+	}
+
+	// time spent in the given phase, in microseconds
+	ULLONG
+	UllPhaseTimeUS(EPhase eph) const
+	{
+		return m_rgullPhaseTimes[eph];
+	}
+
+};	// class COptimizationProfile
+
+//---------------------------------------------------------------------------
+//	@class:
+//		CAutoProfilePhase
+//
+//	@doc:
+//		Times a phase in the profile of the current optimization, if any,
+//		for the lifetime of the object
+//
+//---------------------------------------------------------------------------
+class CAutoProfilePhase
+{
+private:
+	// profile, null if none was requested
+	COptimizationProfile *m_profile;
+
+	// phase
+	COptimizationProfile::EPhase m_eph;
+
+public:
+	CAutoProfilePhase(const CAutoProfilePhase &) = delete;
+
+	// ctor
+	explicit CAutoProfilePhase(COptimizationProfile::EPhase eph)
+		: m_profile(COptimizationProfile::PprofileFromTLS()), m_eph(eph)
+	{
+		if (nullptr != m_profile)
+		{
+			m_profile->StartPhase(m_eph);
+		}
+	}
+
+	// dtor
+	~CAutoProfilePhase()
+	{
+		if (nullptr != m_profile)
+		{
+			m_profile->EndPhase(m_eph);
+		}
+	}
+
+};	// class CAutoProfilePhase
+
+}  // namespace gpopt
+
+#endif	// !GPOPT_COptimizationProfile_H
+
+// EOF
@@ -35,6 +35,7 @@ namespace gpopt
 {
 // forward declarations
 class ICostModel;
+class COptimizationProfile;
 class COptimizerConfig;
 class CQueryContext;
 class CEnumeratorConfig;
@@ -97,7 +98,9 @@ public:
 		CSearchStageArray *search_stage_array,	// search strategy
 		COptimizerConfig *optimizer_config,		// optimizer configurations
 		const CHAR *szMinidumpFileName =
-			nullptr	 // name of minidump file to be created
+			nullptr,  // name of minidump file to be created
+		COptimizationProfile *profile =
+			nullptr	 // profile to collect counters into, if any
 	);
 };	// class COptimizer
 }  // namespace gpopt
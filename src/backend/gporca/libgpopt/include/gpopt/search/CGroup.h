@@ -239,6 +239,13 @@ private:
 	// implementation job queue
 	CJobQueue m_jqImplementation;
 
+	// number of jobs executed on the group, only counted when the
+	// optimization is profiled
+	ULLONG m_ullJobs{0};
+
+	// time spent executing jobs on the group, in microseconds
+	ULLONG m_ullJobTimeUS{0};
+
 	// cleanup optimization contexts on destruction
 	void CleanupContexts();
 
@@ -338,6 +345,28 @@ public:
 		return m_id;
 	}
 
+	// record the execution of a job on the group
+	void
+	RecordJob(ULONG ulTimeUS)
+	{
+		m_ullJobs++;
+		m_ullJobTimeUS += ulTimeUS;
+	}
+
+	// number of jobs executed on the group
+	ULLONG
+	UllJobs() const
+	{
+		return m_ullJobs;
+	}
+
+	// time spent executing jobs on the group, in microseconds
+	ULLONG
+	UllJobTimeUS() const
+	{
+		return m_ullJobTimeUS;
+	}
+
 	// group properties accessor
 	CDrvdProp *
 	Pdp() const
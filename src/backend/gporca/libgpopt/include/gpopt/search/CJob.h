@@ -21,6 +21,7 @@ namespace gpopt
 using namespace gpos;
 
 // prototypes
+class CGroup;
 class CJobQueue;
 class CScheduler;
 class CSchedulerContext;
@@ -269,6 +270,13 @@ public:
 		return m_ejt;
 	}
 
+	// group the job works on, if any
+	virtual CGroup *
+	Pgroup() const
+	{
+		return nullptr;
+	}
+
 	// job queue accessor
 	CJobQueue *
 	Pjq() const
@@ -74,6 +74,13 @@ protected:
 public:
 	CJobGroup(const CJobGroup &) = delete;
 
+	// group the job works on
+	CGroup *
+	Pgroup() const override
+	{
+		return m_pgroup;
+	}
+
 };	// class CJobGroup
 
 }  // namespace gpopt
@@ -104,6 +104,9 @@ protected:
 public:
 	CJobGroupExpression(const CJobGroupExpression &) = delete;
 
+	// group of the target group expression
+	CGroup *Pgroup() const override;
+
 };	// class CJobGroupExpression
 
 }  // namespace gpopt
@@ -87,6 +87,9 @@ public:
 	// job's main function
 	BOOL FExecute(CSchedulerContext *psc) override;
 
+	// group of the target group expression
+	CGroup *Pgroup() const override;
+
 #ifdef GPOS_DEBUG
 
 	// print function
@@ -26,6 +26,7 @@ class CDrvdProp;
 class CDrvdPropCtxtPlan;
 class CMemoProxy;
 class COptimizationContext;
+class COptimizationProfile;
 
 // memo tree map definition
 using MemoTreeMap = CTreeMap<CCostContext, CExpression, CDrvdPropCtxtPlan,
@@ -170,6 +171,9 @@ public:
 	// get group by id
 	CGroup *Pgroup(ULONG id);
 
+	// record the size of the memo and its costliest groups in a profile
+	void RecordProfile(COptimizationProfile *profile);
+
 };	// class CMemo
 
 }  // namespace gpopt
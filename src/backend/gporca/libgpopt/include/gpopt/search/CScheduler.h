@@ -32,7 +32,7 @@ class CSchedulerContext;
 //		CScheduler
 //
 //	@doc:
-//		MT-scheduler for optimization jobs
+//		Scheduler for optimization jobs
 //
 //		Maintaining job dependencies and controlling the order of job execution
 //		are the main responsibilities of job scheduler.
@@ -51,6 +51,13 @@ class CSchedulerContext;
 //		complete. At this point, a queued job can be terminated if it does not
 //		have any further dependencies.
 //
+//		All jobs run on the thread that optimizes the query. The job lists
+//		and counters are not synchronized, and neither are the memo, the job
+//		factory and the memory pools. Jobs also retrieve metadata on demand,
+//		which in the server calls into the backend's catalog caches. Running
+//		jobs on several threads would require prefetching all metadata and
+//		making the memo thread-safe first.
+//
 //---------------------------------------------------------------------------
 class CScheduler
 {
@@ -69,7 +76,7 @@ public:
 	};
 
 private:
-	// job wrapper; used for inserting job to waiting list (lock-free)
+	// job wrapper; used for inserting job to waiting list
 	struct SJobLink
 	{
 		// link id, set by sync set
@@ -139,6 +146,9 @@ private:
 	// execute job
 	static BOOL FExecute(CJob *pj, CSchedulerContext *psc);
 
+	// run the job's function, profiling it if requested
+	static BOOL FRun(CJob *pj, CSchedulerContext *psc);
+
 	// process job execution outcome
 	EJobResult EjrPostExecute(CJob *pj, BOOL fCompleted);
 
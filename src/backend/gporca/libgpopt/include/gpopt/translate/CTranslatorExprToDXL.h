@@ -546,6 +546,9 @@ private:
 	// compute physical properties like operator cost from the expression
 	CDXLPhysicalProperties *GetProperties(const CExpression *pexpr);
 
+	// number of rows the expression produces per segment, as costed
+	static DOUBLE DRowsPerSegment(const CExpression *pexpr);
+
 	// translate a colref set of output col into a dxl proj list
 	CDXLNode *PdxlnProjList(const CColRefSet *pcrsOutput,
 							CColRefArray *colref_array);
@@ -627,6 +630,11 @@ private:
 	// add a materialize node
 	CDXLNode *PdxlnMaterialize(CDXLNode *dxlnode);
 
+	// add a memoize node caching the results of the given node by the
+	// values of the given outer references
+	CDXLNode *PdxlnMemoize(CDXLNode *dxlnode, CColRefArray *outer_refs,
+						   CDouble num_distinct);
+
 	// add result node if necessary
 	CDXLNode *PdxlnRemapOutputColumns(CExpression *pexpr, CDXLNode *dxlnode,
 									  CColRefArray *pdrgpcrRequired,
@@ -428,6 +428,9 @@ private:
 	// for each non-inner join (entry in m_on_pred_conjuncts), the required atoms on the left
 	CBitSetArray *m_non_inner_join_dependencies;
 
+	// for each atom, the atoms it shares an inner join predicate with
+	CBitSetArray *m_inner_join_neighbors;
+
 	// top K expressions at the top level
 	CKHeap<SExpressionInfoArray, SExpressionInfo> *m_top_k_expressions;
 
@@ -449,6 +452,9 @@ private:
 		return (*m_join_levels)[l];
 	}
 
+	// atoms sharing an inner join predicate with any of the given atoms
+	CBitSet *GetInnerJoinNeighbors(CBitSet *atoms);
+
 	// build expression linking given groups
 	CExpression *PexprBuildInnerJoinPred(CBitSet *pbsFst, CBitSet *pbsSnd);
 
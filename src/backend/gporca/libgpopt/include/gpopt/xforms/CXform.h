@@ -236,6 +236,12 @@ public:
 		ExfLimit2IndexOnlyGet,
 		ExfFullOuterJoin2HashJoin,
 		ExfFullJoinCommutativity,
+		ExfInnerJoin2MergeJoin,
+		ExfLeftOuterJoin2MergeJoin,
+		ExfSelect2MatView,
+		ExfGbAgg2MatView,
+		ExfGbAggWithSelect2MatView,
+		ExfSplitWindowRankFilter,
 		ExfInvalid,
 		ExfSentinel = ExfInvalid
 	};
@@ -338,6 +344,10 @@ public:
 	// caller takes ownership of the returned set
 	static CBitSet *PbsHashJoinXforms(CMemoryPool *mp);
 
+	// returns a set containing all xforms that generate a merge join plan
+	// caller takes ownership of the returned set
+	static CBitSet *PbsMergeJoinXforms(CMemoryPool *mp);
+
 	// returns a set containing xforms to use only the join order as available
 	// in the query
 	static CBitSet *PbsJoinOrderInQueryXforms(CMemoryPool *mp);
@@ -0,0 +1,69 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (c) 2023 VMware, Inc. or its affiliates. All Rights Reserved.
+//
+//	@filename:
+//		CXformGbAgg2MatView.h
+//
+//	@doc:
+//		Answer an aggregate over a table from a materialized view
+//---------------------------------------------------------------------------
+#ifndef GPOPT_CXformGbAgg2MatView_H
+#define GPOPT_CXformGbAgg2MatView_H
+
+#include "gpos/base.h"
+
+#include "gpopt/xforms/CXformMatViewRewrite.h"
+
+namespace gpopt
+{
+using namespace gpos;
+
+//---------------------------------------------------------------------------
+//	@class:
+//		CXformGbAgg2MatView
+//
+//	@doc:
+//		Answer an aggregate over a table from an unfiltered aggregate
+//		materialized view over the table
+//
+//---------------------------------------------------------------------------
+class CXformGbAgg2MatView : public CXformMatViewRewrite
+{
+public:
+	CXformGbAgg2MatView(const CXformGbAgg2MatView &) = delete;
+
+	// ctor
+	explicit CXformGbAgg2MatView(CMemoryPool *mp);
+
+	// dtor
+	~CXformGbAgg2MatView() override = default;
+
+	// ident accessors
+	EXformId
+	Exfid() const override
+	{
+		return ExfGbAgg2MatView;
+	}
+
+	// xform name
+	const CHAR *
+	SzId() const override
+	{
+		return "CXformGbAgg2MatView";
+	}
+
+	// compute xform promise for a given expression handle
+	EXformPromise Exfp(CExpressionHandle &exprhdl) const override;
+
+	// actual transform
+	void Transform(CXformContext *pxfctxt, CXformResult *pxfres,
+				   CExpression *pexpr) const override;
+
+};	// class CXformGbAgg2MatView
+
+}  // namespace gpopt
+
+#endif	// !GPOPT_CXformGbAgg2MatView_H
+
+// EOF
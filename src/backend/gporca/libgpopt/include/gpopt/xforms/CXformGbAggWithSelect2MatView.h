@@ -0,0 +1,71 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (c) 2023 VMware, Inc. or its affiliates. All Rights Reserved.
+//
+//	@filename:
+//		CXformGbAggWithSelect2MatView.h
+//
+//	@doc:
+//		Answer an aggregate over a select from a materialized view
+//---------------------------------------------------------------------------
+#ifndef GPOPT_CXformGbAggWithSelect2MatView_H
+#define GPOPT_CXformGbAggWithSelect2MatView_H
+
+#include "gpos/base.h"
+
+#include "gpopt/xforms/CXformMatViewRewrite.h"
+
+namespace gpopt
+{
+using namespace gpos;
+
+//---------------------------------------------------------------------------
+//	@class:
+//		CXformGbAggWithSelect2MatView
+//
+//	@doc:
+//		Answer an aggregate over a select over a table from an aggregate
+//		materialized view over the table, filtered by a predicate implied by
+//		the select predicate
+//
+//---------------------------------------------------------------------------
+class CXformGbAggWithSelect2MatView : public CXformMatViewRewrite
+{
+public:
+	CXformGbAggWithSelect2MatView(const CXformGbAggWithSelect2MatView &) =
+		delete;
+
+	// ctor
+	explicit CXformGbAggWithSelect2MatView(CMemoryPool *mp);
+
+	// dtor
+	~CXformGbAggWithSelect2MatView() override = default;
+
+	// ident accessors
+	EXformId
+	Exfid() const override
+	{
+		return ExfGbAggWithSelect2MatView;
+	}
+
+	// xform name
+	const CHAR *
+	SzId() const override
+	{
+		return "CXformGbAggWithSelect2MatView";
+	}
+
+	// compute xform promise for a given expression handle
+	EXformPromise Exfp(CExpressionHandle &exprhdl) const override;
+
+	// actual transform
+	void Transform(CXformContext *pxfctxt, CXformResult *pxfres,
+				   CExpression *pexpr) const override;
+
+};	// class CXformGbAggWithSelect2MatView
+
+}  // namespace gpopt
+
+#endif	// !GPOPT_CXformGbAggWithSelect2MatView_H
+
+// EOF
@@ -17,6 +17,9 @@
 #include "gpopt/operators/CPhysicalNLJoin.h"
 #include "gpopt/optimizer/COptimizerConfig.h"
 #include "gpopt/xforms/CXformImplementation.h"
+#include "naucrates/md/IMDFunction.h"
+#include "naucrates/md/IMDType.h"
+#include "naucrates/traceflags/traceflags.h"
 
 namespace gpopt
 {
@@ -79,6 +82,60 @@ public:
 		GPOS_ASSERT(FCheckPattern(pexpr));
 
 		CMemoryPool *mp = pxfctxt->Pmp();
+
+		AddIndexNLJoin(mp, pexpr, false /*fMemoizeInner*/, pxfres);
+
+		// also consider caching the results of the inner child by the values
+		// of the outer references, the cost model decides if the expected
+		// cache hits are worth it; the cache is keyed by the nest params, so
+		// the outer references must be passed as params
+		if (GPOS_FTRACE(EopttraceEnableMemoize) &&
+			GPOS_FTRACE(EopttraceIndexedNLJOuterRefAsParams) &&
+			FMemoizable(pexpr))
+		{
+			AddIndexNLJoin(mp, pexpr, true /*fMemoizeInner*/, pxfres);
+		}
+	}
+
+private:
+	// can the results of the inner child of the given index apply be cached
+	static BOOL
+	FMemoizable(CExpression *pexpr)
+	{
+		CColRefArray *colref_array =
+			CLogicalIndexApply::PopConvert(pexpr->Pop())->PdrgPcrOuterRefs();
+		if (0 == colref_array->Size())
+		{
+			return false;
+		}
+
+		// rescans of a volatile inner child may produce different results
+		// for the same outer reference values
+		if (IMDFunction::EfsVolatile ==
+			(*pexpr)[1]->DeriveFunctionProperties()->Efs())
+		{
+			return false;
+		}
+
+		// the cache is a hash table keyed by the outer references
+		for (ULONG ul = 0; ul < colref_array->Size(); ul++)
+		{
+			const IMDType *pmdtype = (*colref_array)[ul]->RetrieveType();
+			if (!pmdtype->IsHashable() ||
+				!IMDId::IsValid(pmdtype->GetMdidForCmpType(IMDType::EcmptEq)))
+			{
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	// assemble an index nested-loops join implementing the given index apply
+	static void
+	AddIndexNLJoin(CMemoryPool *mp, CExpression *pexpr, BOOL fMemoizeInner,
+				   CXformResult *pxfres)
+	{
 		CLogicalIndexApply *indexApply =
 			CLogicalIndexApply::PopConvert(pexpr->Pop());
 
@@ -97,15 +154,15 @@ public:
 		// assemble physical operator
 		CPhysicalNLJoin *pop = nullptr;
 
-		if (CLogicalIndexApply::PopConvert(pexpr->Pop())->FouterJoin())
+		if (indexApply->FouterJoin())
 		{
 			pop = GPOS_NEW(mp) CPhysicalLeftOuterIndexNLJoin(
-				mp, colref_array, indexApply->OrigJoinPred());
+				mp, colref_array, indexApply->OrigJoinPred(), fMemoizeInner);
 		}
 		else
 		{
 			pop = GPOS_NEW(mp) CPhysicalInnerIndexNLJoin(
-				mp, colref_array, indexApply->OrigJoinPred());
+				mp, colref_array, indexApply->OrigJoinPred(), fMemoizeInner);
 		}
 
 		CExpression *pexprResult = GPOS_NEW(mp)
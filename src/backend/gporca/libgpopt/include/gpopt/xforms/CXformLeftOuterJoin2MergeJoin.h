@@ -0,0 +1,71 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (c) 2023 VMware, Inc. or its affiliates. All Rights Reserved.
+//
+//	@filename:
+//		CXformLeftOuterJoin2MergeJoin.h
+//
+//	@doc:
+//		Transform left outer join to left outer merge join
+//---------------------------------------------------------------------------
+#ifndef GPOPT_CXformLeftOuterJoin2MergeJoin_H
+#define GPOPT_CXformLeftOuterJoin2MergeJoin_H
+
+#include "gpos/base.h"
+
+#include "gpopt/xforms/CXformImplementation.h"
+
+namespace gpopt
+{
+using namespace gpos;
+
+//---------------------------------------------------------------------------
+//	@class:
+//		CXformLeftOuterJoin2MergeJoin
+//
+//	@doc:
+//		Transform left outer join to left outer merge join
+//
+//---------------------------------------------------------------------------
+class CXformLeftOuterJoin2MergeJoin : public CXformImplementation
+{
+private:
+public:
+	CXformLeftOuterJoin2MergeJoin(const CXformLeftOuterJoin2MergeJoin &) =
+		delete;
+
+	// ctor
+	explicit CXformLeftOuterJoin2MergeJoin(CMemoryPool *mp);
+
+	// dtor
+	~CXformLeftOuterJoin2MergeJoin() override = default;
+
+	// ident accessors
+	EXformId
+	Exfid() const override
+	{
+		return ExfLeftOuterJoin2MergeJoin;
+	}
+
+	// return a string for xform name
+	const CHAR *
+	SzId() const override
+	{
+		return "CXformLeftOuterJoin2MergeJoin";
+	}
+
+	// compute xform promise for a given expression handle
+	EXformPromise Exfp(CExpressionHandle &exprhdl) const override;
+
+	// actual transform
+	void Transform(CXformContext *pxfctxt, CXformResult *pxfres,
+				   CExpression *pexpr) const override;
+
+};	// class CXformLeftOuterJoin2MergeJoin
+
+}  // namespace gpopt
+
+
+#endif	// !GPOPT_CXformLeftOuterJoin2MergeJoin_H
+
+// EOF
@@ -0,0 +1,122 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (c) 2023 VMware, Inc. or its affiliates. All Rights Reserved.
+//
+//	@filename:
+//		CXformMatViewRewrite.h
+//
+//	@doc:
+//		Base class for transformations answering a query over a single
+//		relation from a materialized view defined over the same relation
+//---------------------------------------------------------------------------
+#ifndef GPOPT_CXformMatViewRewrite_H
+#define GPOPT_CXformMatViewRewrite_H
+
+#include "gpos/base.h"
+
+#include "gpopt/xforms/CXformExploration.h"
+#include "naucrates/md/CMDMatView.h"
+
+namespace gpopt
+{
+using namespace gpos;
+using namespace gpmd;
+
+// fwd declarations
+class CLogicalGet;
+class CTableDescriptor;
+
+//---------------------------------------------------------------------------
+//	@class:
+//		CXformMatViewRewrite
+//
+//	@doc:
+//		Match a Get of a relation, optionally filtered and aggregated, against
+//		the materialized views over that relation. A view matches when each
+//		of its filter conjuncts is implied by the query predicate, the rest
+//		of the predicate only uses columns of the view, and every column the
+//		query aggregates or groups by is available in the view, either as is
+//		or by rolling up finer groups of the view.
+//
+//---------------------------------------------------------------------------
+class CXformMatViewRewrite : public CXformExploration
+{
+private:
+	// attno of a column produced by the given Get, 0 if not found
+	static INT GetAttno(const CLogicalGet *popGet, const CColRef *colref);
+
+	// column produced by the given Get for an attno, nullptr if not found
+	static CColRef *PcrFromAttno(const CLogicalGet *popGet, INT attno);
+
+	// position of the view column derived from the given base column and
+	// aggregate, gpos::ulong_max if there is none
+	static ULONG UlMatViewColumn(const CMDMatView *mv, INT attno,
+								 IMDId *agg_mdid);
+
+	// can the given base column be read from the view
+	static BOOL FColumnAvailable(const CMDMatView *mv,
+								 const CLogicalGet *popGet,
+								 const CColRef *colref);
+
+	// is the given view filter conjunct implied by the query predicate
+	static BOOL FImplied(CMemoryPool *mp, CExpression *pexprViewConjunct,
+						 CExpressionArray *pdrgpexprQuery,
+						 CExpression *pexprPred);
+
+	// position of the view column matching a query aggregate,
+	// gpos::ulong_max if there is none
+	static ULONG UlMatchAggregate(const CMDMatView *mv,
+								  const CLogicalGet *popGet,
+								  CExpression *pexprAggFunc, BOOL fRollup);
+
+	// aggregate combining the partial results of a query aggregate stored
+	// in the given view column
+	static CExpression *PexprRollupAgg(CMemoryPool *mp,
+									   CExpression *pexprAggFunc,
+									   CColRef *colref);
+
+	// table descriptor of the view, accessed as the base relation is
+	static CTableDescriptor *PtabdescMatView(CMemoryPool *mp,
+											 CMDAccessor *md_accessor,
+											 IMDId *mdid,
+											 const CTableDescriptor *ptabdesc);
+
+	// rewrite the query over the given view, nullptr if it does not match
+	static CExpression *PexprRewrite(CMemoryPool *mp, CMDAccessor *md_accessor,
+									 const CMDMatView *mv,
+									 CExpression *pexprGbAgg,
+									 CExpression *pexprGet,
+									 CExpression *pexprPred);
+
+protected:
+	// add an alternative for each view matching the given aggregate (if
+	// any) over the given Get, filtered by the given predicate (if any)
+	static void Rewrite(CMemoryPool *mp, CXformResult *pxfres,
+						CExpression *pexprGbAgg, CExpression *pexprGet,
+						CExpression *pexprPred);
+
+public:
+	CXformMatViewRewrite(const CXformMatViewRewrite &) = delete;
+
+	// ctor
+	explicit CXformMatViewRewrite(CExpression *pexprPattern);
+
+	// dtor
+	~CXformMatViewRewrite() override = default;
+
+	// views are never matched against the alternatives they produce
+	BOOL
+	FCompatible(CXform::EXformId exfid) override
+	{
+		return (CXform::ExfSelect2MatView != exfid) &&
+			   (CXform::ExfGbAgg2MatView != exfid) &&
+			   (CXform::ExfGbAggWithSelect2MatView != exfid);
+	}
+
+};	// class CXformMatViewRewrite
+
+}  // namespace gpopt
+
+#endif	// !GPOPT_CXformMatViewRewrite_H
+
+// EOF
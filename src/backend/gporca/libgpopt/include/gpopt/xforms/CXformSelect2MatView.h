@@ -0,0 +1,69 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (c) 2023 VMware, Inc. or its affiliates. All Rights Reserved.
+//
+//	@filename:
+//		CXformSelect2MatView.h
+//
+//	@doc:
+//		Answer a select over a table from a materialized view
+//---------------------------------------------------------------------------
+#ifndef GPOPT_CXformSelect2MatView_H
+#define GPOPT_CXformSelect2MatView_H
+
+#include "gpos/base.h"
+
+#include "gpopt/xforms/CXformMatViewRewrite.h"
+
+namespace gpopt
+{
+using namespace gpos;
+
+//---------------------------------------------------------------------------
+//	@class:
+//		CXformSelect2MatView
+//
+//	@doc:
+//		Answer a select over a table from a materialized view over the table,
+//		filtered by a predicate implied by the select predicate
+//
+//---------------------------------------------------------------------------
+class CXformSelect2MatView : public CXformMatViewRewrite
+{
+public:
+	CXformSelect2MatView(const CXformSelect2MatView &) = delete;
+
+	// ctor
+	explicit CXformSelect2MatView(CMemoryPool *mp);
+
+	// dtor
+	~CXformSelect2MatView() override = default;
+
+	// ident accessors
+	EXformId
+	Exfid() const override
+	{
+		return ExfSelect2MatView;
+	}
+
+	// xform name
+	const CHAR *
+	SzId() const override
+	{
+		return "CXformSelect2MatView";
+	}
+
+	// compute xform promise for a given expression handle
+	EXformPromise Exfp(CExpressionHandle &exprhdl) const override;
+
+	// actual transform
+	void Transform(CXformContext *pxfctxt, CXformResult *pxfres,
+				   CExpression *pexpr) const override;
+
+};	// class CXformSelect2MatView
+
+}  // namespace gpopt
+
+#endif	// !GPOPT_CXformSelect2MatView_H
+
+// EOF
@@ -78,7 +78,9 @@ public:
 	{
 		return ((CXform::ExfSplitDQA != exfid) &&
 				(CXform::ExfSplitGbAgg != exfid) &&
-				(CXform::ExfEagerAgg != exfid));
+				(CXform::ExfEagerAgg != exfid) &&
+				(CXform::ExfGbAgg2MatView != exfid) &&
+				(CXform::ExfGbAggWithSelect2MatView != exfid));
 	}
 
 	// compute xform promise for a given expression handle
@@ -0,0 +1,107 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (c) 2023 VMware, Inc. or its affiliates. All Rights Reserved.
+//
+//	@filename:
+//		CXformSplitWindowRankFilter.h
+//
+//	@doc:
+//		Add a local top-K pre-filter below a filter on a ranking window
+//		function
+//---------------------------------------------------------------------------
+#ifndef GPOPT_CXformSplitWindowRankFilter_H
+#define GPOPT_CXformSplitWindowRankFilter_H
+
+#include "gpos/base.h"
+
+#include "gpopt/xforms/CXformExploration.h"
+
+namespace gpopt
+{
+using namespace gpos;
+
+//---------------------------------------------------------------------------
+//	@class:
+//		CXformSplitWindowRankFilter
+//
+//	@doc:
+//		Transform
+//
+//			Select (rn <= N)
+//			  SequenceProject (rn := row_number())
+//			    child
+//
+//		into
+//
+//			Select (rn <= N)
+//			  SequenceProject (rn := row_number())
+//			    Select (rn' <= N)
+//			      SequenceProject[local] (rn' := row_number())
+//			        child
+//
+//		where both sequence projects have the same partition by and order by
+//		clauses. The local sequence project computes the ranking on each segment
+//		without redistributing its input, so that only the top N rows of each
+//		partition on each segment are moved and sorted for the global one. A
+//		row ranked N or better among all rows of its partition is ranked N or
+//		better among the rows of its segment, for both row_number and rank.
+//
+//---------------------------------------------------------------------------
+class CXformSplitWindowRankFilter : public CXformExploration
+{
+private:
+	// is the given project list made of ranking window functions only
+	static BOOL FRankingProjectList(CExpression *pexprPrjList);
+
+	// find a conjunct bounding one of the ranking columns from above, and
+	// return the bounding comparison on a new ranking column
+	static CExpression *PexprLocalBound(CMemoryPool *mp,
+										CExpression *pexprPrjList,
+										CExpression *pexprPred,
+										CExpression **ppexprWinFunc,
+										CColRef **ppcrLocal);
+
+public:
+	CXformSplitWindowRankFilter(const CXformSplitWindowRankFilter &) = delete;
+
+	// ctor
+	explicit CXformSplitWindowRankFilter(CMemoryPool *mp);
+
+	// dtor
+	~CXformSplitWindowRankFilter() override = default;
+
+	// ident accessors
+	EXformId
+	Exfid() const override
+	{
+		return ExfSplitWindowRankFilter;
+	}
+
+	// return a string for xform name
+	const CHAR *
+	SzId() const override
+	{
+		return "CXformSplitWindowRankFilter";
+	}
+
+	// the global filter produced by this xform is not split again
+	BOOL
+	FCompatible(CXform::EXformId exfid) override
+	{
+		return (CXform::ExfSplitWindowRankFilter != exfid);
+	}
+
+	// compute xform promise for a given expression handle
+	EXformPromise Exfp(CExpressionHandle &exprhdl) const override;
+
+	// actual transform
+	void Transform(CXformContext *pxfctxt, CXformResult *pxfres,
+				   CExpression *pexpr) const override;
+
+};	// class CXformSplitWindowRankFilter
+
+}  // namespace gpopt
+
+#endif	// !GPOPT_CXformSplitWindowRankFilter_H
+
+// EOF
@@ -268,10 +268,12 @@ public:
 	static void ImplementHashJoin(CXformContext *pxfctxt, CXformResult *pxfres,
 								  CExpression *pexpr);
 
-	// helper function for implementation of merge joins
+	// helper function for implementation of merge joins; unless a join
+	// filter is allowed, all the join predicates must be merge clauses
 	template <class T>
 	static void ImplementMergeJoin(CXformContext *pxfctxt, CXformResult *pxfres,
-								   CExpression *pexpr);
+								   CExpression *pexpr,
+								   BOOL allow_join_filter = false);
 
 	// helper function for implementation of nested loops joins
 	template <class T>
@@ -815,7 +817,7 @@ CXformUtils::ImplementHashJoin(CXformContext *pxfctxt, CXformResult *pxfres,
 template <class T>
 void
 CXformUtils::ImplementMergeJoin(CXformContext *pxfctxt, CXformResult *pxfres,
-								CExpression *pexpr)
+								CExpression *pexpr, BOOL allow_join_filter)
 {
 	GPOS_ASSERT(nullptr != pxfctxt);
 
@@ -830,9 +832,15 @@ CXformUtils::ImplementMergeJoin(CXformContext *pxfctxt, CXformResult *pxfres,
 	CExpressionArray *pdrgpexprInner = nullptr;
 	IMdIdArray *join_opfamilies = nullptr;
 
-	// check if we have already computed join keys for the scalar child
-	LookupJoinKeys(mp, pexpr, &pdrgpexprOuter, &pdrgpexprInner,
-				   &join_opfamilies);
+	// check if we have already computed join keys for the scalar child; the
+	// keys cached on the scalar child of an inner or outer join are those of
+	// the hash join, which may use predicates that can't be merge clauses,
+	// so merge joins with a join filter always compute their own keys
+	if (!allow_join_filter)
+	{
+		LookupJoinKeys(mp, pexpr, &pdrgpexprOuter, &pdrgpexprInner,
+					   &join_opfamilies);
+	}
 	if (nullptr != pdrgpexprOuter)
 	{
 		GPOS_ASSERT(nullptr != pdrgpexprInner);
@@ -905,7 +913,7 @@ CXformUtils::ImplementMergeJoin(CXformContext *pxfctxt, CXformResult *pxfres,
 				join_opfamilies->Append(hash_opfamily);
 			}
 		}
-		else
+		else if (!allow_join_filter)
 		{
 			// In case of FULL merge joins, all the merge clauses must be merge
 			// compatible or we cannot create a merge join.
@@ -929,7 +937,11 @@ CXformUtils::ImplementMergeJoin(CXformContext *pxfctxt, CXformResult *pxfres,
 					CPredicateUtils::PexprConjunction(mp, pdrgpexpr));
 
 	// cache hash join keys on scalar child group
-	CacheJoinKeys(pexprResult, pdrgpexprOuter, pdrgpexprInner, join_opfamilies);
+	if (!allow_join_filter)
+	{
+		CacheJoinKeys(pexprResult, pdrgpexprOuter, pdrgpexprInner,
+					  join_opfamilies);
+	}
 
 	// Add an alternative only if we found at least one merge-joinable predicate
 	if (0 != pdrgpexprOuter->Size())
@@ -46,11 +46,13 @@
 #include "gpopt/xforms/CXformFullOuterJoin2HashJoin.h"
 #include "gpopt/xforms/CXformGbAgg2Apply.h"
 #include "gpopt/xforms/CXformGbAgg2HashAgg.h"
+#include "gpopt/xforms/CXformGbAgg2MatView.h"
 #include "gpopt/xforms/CXformGbAgg2ScalarAgg.h"
 #include "gpopt/xforms/CXformGbAgg2StreamAgg.h"
 #include "gpopt/xforms/CXformGbAggDedup2HashAggDedup.h"
 #include "gpopt/xforms/CXformGbAggDedup2StreamAggDedup.h"
 #include "gpopt/xforms/CXformGbAggWithMDQA2Join.h"
+#include "gpopt/xforms/CXformGbAggWithSelect2MatView.h"
 #include "gpopt/xforms/CXformGet2TableScan.h"
 #include "gpopt/xforms/CXformImplementAssert.h"
 #include "gpopt/xforms/CXformImplementBitmapTableGet.h"
@@ -82,6 +84,7 @@
 #include "gpopt/xforms/CXformInnerApply2InnerJoin.h"
 #include "gpopt/xforms/CXformInnerApply2InnerJoinNoCorrelations.h"
 #include "gpopt/xforms/CXformInnerApplyWithOuterKey2InnerJoin.h"
+#include "gpopt/xforms/CXformInnerJoin2MergeJoin.h"
 #include "gpopt/xforms/CXformInnerJoinAntiSemiJoinNotInSwap.h"
 #include "gpopt/xforms/CXformInnerJoinAntiSemiJoinSwap.h"
 #include "gpopt/xforms/CXformInnerJoinCommutativity.h"
@@ -108,6 +111,7 @@
 #include "gpopt/xforms/CXformLeftOuterApply2LeftOuterJoin.h"
 #include "gpopt/xforms/CXformLeftOuterApply2LeftOuterJoinNoCorrelations.h"
 #include "gpopt/xforms/CXformLeftOuterJoin2HashJoin.h"
+#include "gpopt/xforms/CXformLeftOuterJoin2MergeJoin.h"
 #include "gpopt/xforms/CXformLeftOuterJoin2NLJoin.h"
 #include "gpopt/xforms/CXformLeftSemiApply2LeftSemiJoin.h"
 #include "gpopt/xforms/CXformLeftSemiApply2LeftSemiJoinNoCorrelations.h"
@@ -147,6 +151,7 @@
 #include "gpopt/xforms/CXformSelect2Filter.h"
 #include "gpopt/xforms/CXformSelect2IndexGet.h"
 #include "gpopt/xforms/CXformSelect2IndexOnlyGet.h"
+#include "gpopt/xforms/CXformSelect2MatView.h"
 #include "gpopt/xforms/CXformSemiJoinAntiSemiJoinNotInSwap.h"
 #include "gpopt/xforms/CXformSemiJoinAntiSemiJoinSwap.h"
 #include "gpopt/xforms/CXformSemiJoinInnerJoinSwap.h"
@@ -160,6 +165,7 @@
 #include "gpopt/xforms/CXformSplitGbAgg.h"
 #include "gpopt/xforms/CXformSplitGbAggDedup.h"
 #include "gpopt/xforms/CXformSplitLimit.h"
+#include "gpopt/xforms/CXformSplitWindowRankFilter.h"
 #include "gpopt/xforms/CXformSubqJoin2Apply.h"
 #include "gpopt/xforms/CXformSubqNAryJoin2Apply.h"
 #include "gpopt/xforms/CXformUnion2UnionAll.h"
@@ -0,0 +1,382 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (c) 2023 VMware, Inc. or its affiliates. All Rights Reserved.
+//
+//	@filename:
+//		CCardinalityFingerprint.cpp
+//
+//	@doc:
+//		Implementation of fingerprints of logical subexpressions
+//---------------------------------------------------------------------------
+
+#include "gpopt/base/CCardinalityFingerprint.h"
+
+#include "gpopt/base/CColRefTable.h"
+#include "gpopt/base/COptCtxt.h"
+#include "gpopt/base/CUtils.h"
+#include "gpopt/metadata/CTableDescriptor.h"
+#include "gpopt/operators/CExpression.h"
+#include "gpopt/operators/CExpressionHandle.h"
+#include "gpopt/operators/CLogicalGbAgg.h"
+#include "gpopt/operators/CLogicalNAryJoin.h"
+#include "gpopt/operators/CScalarBoolOp.h"
+#include "gpopt/operators/CScalarIdent.h"
+#include "gpopt/operators/CScalarProjectElement.h"
+#include "gpopt/operators/CScalarSubquery.h"
+#include "gpopt/operators/CScalarSubqueryQuantified.h"
+#include "gpopt/search/CGroup.h"
+#include "gpopt/search/CGroupExpression.h"
+#include "gpopt/search/CGroupProxy.h"
+
+using namespace gpopt;
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CCardinalityFingerprint::UllMix
+//
+//	@doc:
+//		Mix the bits of a value, using the finalizer of splitmix64
+//
+//---------------------------------------------------------------------------
+ULLONG
+CCardinalityFingerprint::UllMix(ULLONG ull)
+{
+	ull += 0x9e3779b97f4a7c15ULL;
+	ull = (ull ^ (ull >> 30)) * 0xbf58476d1ce4e5b9ULL;
+	ull = (ull ^ (ull >> 27)) * 0x94d049bb133111ebULL;
+
+	return ull ^ (ull >> 31);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CCardinalityFingerprint::UllCombine
+//
+//	@doc:
+//		Mix a value into a fingerprint. The result depends on the order in
+//		which values are combined.
+//
+//---------------------------------------------------------------------------
+ULLONG
+CCardinalityFingerprint::UllCombine(ULLONG ullFingerprint, ULLONG ull)
+{
+	return UllMix(ullFingerprint ^ UllMix(ull));
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CCardinalityFingerprint::UllColRef
+//
+//	@doc:
+//		Fingerprint of a column; table columns are identified by table and
+//		attribute number, other columns by name
+//
+//---------------------------------------------------------------------------
+ULLONG
+CCardinalityFingerprint::UllColRef(const CColRef *colref)
+{
+	if (CColRef::EcrtTable == colref->Ecrt() &&
+		nullptr != colref->GetMdidTable())
+	{
+		const CColRefTable *colref_table =
+			CColRefTable::PcrConvert(const_cast<CColRef *>(colref));
+
+		return UllCombine(UllMix(colref->GetMdidTable()->HashValue()),
+						  (ULLONG)(LINT) colref_table->AttrNum());
+	}
+
+	return UllMix(CWStringConst::HashValue(colref->Name().Pstr()));
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CCardinalityFingerprint::UllScalar
+//
+//	@doc:
+//		Fingerprint of a scalar expression. Operators whose hash values
+//		depend on column ids contribute the fingerprints of their columns
+//		instead.
+//
+//---------------------------------------------------------------------------
+ULLONG
+CCardinalityFingerprint::UllScalar(CExpression *pexprScalar)
+{
+	GPOS_CHECK_STACK_SIZE;
+
+	if (nullptr == pexprScalar || CUtils::FScalarConstTrue(pexprScalar))
+	{
+		// an absent or trivial predicate does not change the cardinality
+		return 0;
+	}
+
+	COperator *pop = pexprScalar->Pop();
+	const ULONG arity = pexprScalar->Arity();
+
+	if (COperator::EopScalarBoolOp == pop->Eopid() &&
+		CScalarBoolOp::EboolopAnd ==
+			CScalarBoolOp::PopConvert(pop)->Eboolop())
+	{
+		// conjunctions are order-independent
+		ULLONG ull = 0;
+		for (ULONG ul = 0; ul < arity; ul++)
+		{
+			ull += UllScalar((*pexprScalar)[ul]);
+		}
+
+		return ull;
+	}
+
+	ULLONG ull = UllMix(pop->Eopid());
+	switch (pop->Eopid())
+	{
+		case COperator::EopScalarIdent:
+			return UllColRef(CScalarIdent::PopConvert(pop)->Pcr());
+
+		case COperator::EopScalarProjectElement:
+			ull = UllCombine(
+				ull, UllColRef(CScalarProjectElement::PopConvert(pop)->Pcr()));
+			break;
+
+		case COperator::EopScalarSubquery:
+		{
+			CScalarSubquery *popSubquery = CScalarSubquery::PopConvert(pop);
+			ull = UllCombine(ull, UllColRef(popSubquery->Pcr()));
+			break;
+		}
+
+		case COperator::EopScalarSubqueryAny:
+		case COperator::EopScalarSubqueryAll:
+		{
+			CScalarSubqueryQuantified *popSubquery =
+				CScalarSubqueryQuantified::PopConvert(pop);
+			ull = UllCombine(ull, UllColRef(popSubquery->Pcr()));
+			break;
+		}
+
+		case COperator::EopScalarParam:
+			// param ids are not stable across optimizations
+			break;
+
+		default:
+			ull = UllCombine(ull, pop->HashValue());
+			break;
+	}
+
+	for (ULONG ul = 0; ul < arity; ul++)
+	{
+		CExpression *pexprChild = (*pexprScalar)[ul];
+		ull = UllCombine(ull, pexprChild->Pop()->FScalar()
+								  ? UllScalar(pexprChild)
+								  : UllFingerprint(pexprChild));
+	}
+
+	return ull;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CCardinalityFingerprint::UllLogical
+//
+//	@doc:
+//		Fingerprint of a logical operator given the fingerprints of its
+//		children, relational and scalar
+//
+//---------------------------------------------------------------------------
+ULLONG
+CCardinalityFingerprint::UllLogical(COperator *pop,
+									const ULLONG *rgullChildren, ULONG arity)
+{
+	GPOS_ASSERT(pop->FLogical());
+
+	CTableDescriptor *ptabdesc = nullptr;
+	if (COperator::EopLogicalSelect != pop->Eopid())
+	{
+		ptabdesc = CLogical::PtabdescFromTableGet(pop);
+	}
+
+	if (nullptr != ptabdesc)
+	{
+		ULLONG ull = UllCombine(UllMix(pop->Eopid()),
+								ptabdesc->MDId()->HashValue());
+		for (ULONG ul = 0; ul < arity; ul++)
+		{
+			ull += rgullChildren[ul];
+		}
+
+		return ull;
+	}
+
+	switch (pop->Eopid())
+	{
+		case COperator::EopLogicalNAryJoin:
+			if (CLogicalNAryJoin::PopConvert(pop)->HasOuterJoinChildren())
+			{
+				break;
+			}
+			// fall through
+		case COperator::EopLogicalInnerJoin:
+		case COperator::EopLogicalSelect:
+		{
+			// all join orders and placements of the predicates have the
+			// same cardinality
+			ULLONG ull = 0;
+			for (ULONG ul = 0; ul < arity; ul++)
+			{
+				ull += rgullChildren[ul];
+			}
+
+			return ull;
+		}
+
+		case COperator::EopLogicalProject:
+		case COperator::EopLogicalSequenceProject:
+			// project lists do not change the cardinality
+			return rgullChildren[0];
+
+		case COperator::EopLogicalGbAgg:
+		{
+			// the cardinality depends on the grouping columns only, not on
+			// the aggregates
+			CColRefArray *colref_array =
+				CLogicalGbAgg::PopConvert(pop)->Pdrgpcr();
+			ULLONG ullGrpCols = 0;
+			for (ULONG ul = 0; ul < colref_array->Size(); ul++)
+			{
+				ullGrpCols += UllColRef((*colref_array)[ul]);
+			}
+
+			// local and global aggregates have different cardinalities
+			ULLONG ull = UllCombine(
+				UllMix(pop->Eopid()),
+				CLogicalGbAgg::PopConvert(pop)->Egbaggtype());
+			ull = UllCombine(ull, rgullChildren[0]);
+
+			return UllCombine(ull, ullGrpCols);
+		}
+
+		default:
+			break;
+	}
+
+	ULLONG ull = UllMix(pop->Eopid());
+	for (ULONG ul = 0; ul < arity; ul++)
+	{
+		ull = UllCombine(ull, rgullChildren[ul]);
+	}
+
+	return ull;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CCardinalityFingerprint::UllFingerprint
+//
+//	@doc:
+//		Fingerprint of the logical operator the handle is attached to
+//
+//---------------------------------------------------------------------------
+ULLONG
+CCardinalityFingerprint::UllFingerprint(CExpressionHandle &exprhdl)
+{
+	if (nullptr != exprhdl.Pgexpr())
+	{
+		return UllFingerprint(exprhdl.Pgexpr()->Pgroup());
+	}
+
+	GPOS_ASSERT(nullptr != exprhdl.Pexpr());
+
+	return UllFingerprint(exprhdl.Pexpr());
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CCardinalityFingerprint::UllFingerprint
+//
+//	@doc:
+//		Fingerprint of a logical expression
+//
+//---------------------------------------------------------------------------
+ULLONG
+CCardinalityFingerprint::UllFingerprint(CExpression *pexpr)
+{
+	GPOS_CHECK_STACK_SIZE;
+	GPOS_ASSERT(nullptr != pexpr);
+
+	if (nullptr != pexpr->Pgexpr())
+	{
+		return UllFingerprint(pexpr->Pgexpr()->Pgroup());
+	}
+
+	if (pexpr->Pop()->FScalar())
+	{
+		return UllScalar(pexpr);
+	}
+
+	CMemoryPool *mp = COptCtxt::PoctxtFromTLS()->Pmp();
+	const ULONG arity = pexpr->Arity();
+	ULLONG *rgull = GPOS_NEW_ARRAY(mp, ULLONG, arity + 1);
+	for (ULONG ul = 0; ul < arity; ul++)
+	{
+		rgull[ul] = UllFingerprint((*pexpr)[ul]);
+	}
+
+	ULLONG ull = UllLogical(pexpr->Pop(), rgull, arity);
+	GPOS_DELETE_ARRAY(rgull);
+
+	return ull;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CCardinalityFingerprint::UllFingerprint
+//
+//	@doc:
+//		Fingerprint of a group, computed from its first logical expression.
+//		All logical expressions of a group are equivalent, and the first one
+//		is the one that was copied in or generated first, which does not
+//		depend on the order in which jobs are scheduled.
+//
+//---------------------------------------------------------------------------
+ULLONG
+CCardinalityFingerprint::UllFingerprint(CGroup *pgroup)
+{
+	GPOS_CHECK_STACK_SIZE;
+	GPOS_ASSERT(nullptr != pgroup);
+
+	if (pgroup->FDuplicateGroup())
+	{
+		pgroup = pgroup->PgroupDuplicate();
+	}
+
+	if (pgroup->FScalar())
+	{
+		return UllScalar(pgroup->PexprScalarRep());
+	}
+
+	CGroupProxy gp(pgroup);
+	CGroupExpression *pgexpr = gp.PgexprFirst();
+	if (nullptr != pgexpr && !pgexpr->Pop()->FLogical())
+	{
+		pgexpr = gp.PgexprNextLogical(pgexpr);
+	}
+
+	if (nullptr == pgexpr)
+	{
+		return 0;
+	}
+
+	CMemoryPool *mp = COptCtxt::PoctxtFromTLS()->Pmp();
+	const ULONG arity = pgexpr->Arity();
+	ULLONG *rgull = GPOS_NEW_ARRAY(mp, ULLONG, arity + 1);
+	for (ULONG ul = 0; ul < arity; ul++)
+	{
+		rgull[ul] = UllFingerprint((*pgexpr)[ul]);
+	}
+
+	ULLONG ull = UllLogical(pgexpr->Pop(), rgull, arity);
+	GPOS_DELETE_ARRAY(rgull);
+
+	return ull;
+}
+
+// EOF
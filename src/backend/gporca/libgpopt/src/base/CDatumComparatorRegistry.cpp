@@ -0,0 +1,153 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (c) 2023 VMware, Inc. or its affiliates. All Rights Reserved.
+//
+//	@filename:
+//		CDatumComparatorRegistry.cpp
+//
+//	@doc:
+//		Implementation of the registry of native datum comparisons
+//---------------------------------------------------------------------------
+
+#include "gpopt/base/CDatumComparatorRegistry.h"
+
+#include "gpos/common/clibwrapper.h"
+
+#include "naucrates/base/IDatumGeneric.h"
+
+using namespace gpopt;
+using namespace gpnaucrates;
+
+// registered types
+const CDatumComparatorRegistry::SEntry
+	CDatumComparatorRegistry::m_rgentries[] = {
+		// date and time types map to the number of microseconds since
+		// Jan 1, 2000, float types map naturally to a double value
+		{&CMDIdGPDB::m_mdid_date, true /*m_fStats*/, false /*m_fSortKeys*/},
+		{&CMDIdGPDB::m_mdid_bool, true /*m_fStats*/, false /*m_fSortKeys*/},
+		{&CMDIdGPDB::m_mdid_time, true /*m_fStats*/, false /*m_fSortKeys*/},
+		{&CMDIdGPDB::m_mdid_timestamp, true /*m_fStats*/,
+		 false /*m_fSortKeys*/},
+		{&CMDIdGPDB::m_mdid_float4, true /*m_fStats*/, false /*m_fSortKeys*/},
+		{&CMDIdGPDB::m_mdid_float8, true /*m_fStats*/, false /*m_fSortKeys*/},
+
+		// numeric maps to a double value too, which loses precision, so its
+		// sort keys are preferred when they are available
+		{&CMDIdGPDB::m_mdid_numeric, true /*m_fStats*/, true /*m_fSortKeys*/},
+
+		// character types only compare by sort keys, which follow the
+		// collation of the type
+		{&CMDIdGPDB::m_mdid_text, false /*m_fStats*/, true /*m_fSortKeys*/},
+		{&CMDIdGPDB::m_mdid_varchar, false /*m_fStats*/,
+		 true /*m_fSortKeys*/},
+		{&CMDIdGPDB::m_mdid_bpchar, false /*m_fStats*/, true /*m_fSortKeys*/},
+};
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDatumComparatorRegistry::Pentry
+//
+//	@doc:
+//		Find the registry entry of the given type
+//
+//---------------------------------------------------------------------------
+const CDatumComparatorRegistry::SEntry *
+CDatumComparatorRegistry::Pentry(const IMDId *mdid)
+{
+	for (ULONG ul = 0; ul < GPOS_ARRAY_SIZE(m_rgentries); ul++)
+	{
+		if (m_rgentries[ul].m_mdid->Equals(mdid))
+		{
+			return &m_rgentries[ul];
+		}
+	}
+
+	return nullptr;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDatumComparatorRegistry::FStatsComparable
+//
+//	@doc:
+//		Do datums of the given type compare precisely by their stats mapping
+//
+//---------------------------------------------------------------------------
+BOOL
+CDatumComparatorRegistry::FStatsComparable(const IMDId *mdid)
+{
+	const SEntry *pentry = Pentry(mdid);
+
+	return nullptr != pentry && pentry->m_fStats;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDatumComparatorRegistry::FSortKeyComparable
+//
+//	@doc:
+//		Can datums of the given type be compared by sort keys
+//
+//---------------------------------------------------------------------------
+BOOL
+CDatumComparatorRegistry::FSortKeyComparable(const IMDId *mdid)
+{
+	const SEntry *pentry = Pentry(mdid);
+
+	return nullptr != pentry && pentry->m_fSortKeys;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDatumComparatorRegistry::EcmprSortKeys
+//
+//	@doc:
+//		Compare two non-null datums of the same type by their cached sort
+//		keys. The result is unknown unless both datums have sort keys from
+//		the same batch, or both from batch zero.
+//
+//---------------------------------------------------------------------------
+CDatumComparatorRegistry::ECmpResult
+CDatumComparatorRegistry::EcmprSortKeys(const IDatum *datum1,
+										const IDatum *datum2)
+{
+	GPOS_ASSERT(!datum1->IsNull() && !datum2->IsNull());
+
+	IDatum *pdatum1 = const_cast<IDatum *>(datum1);
+	IDatum *pdatum2 = const_cast<IDatum *>(datum2);
+	if (IMDType::EtiGeneric != pdatum1->GetDatumType() ||
+		IMDType::EtiGeneric != pdatum2->GetDatumType() ||
+		!datum1->MDId()->Equals(datum2->MDId()) ||
+		!FSortKeyComparable(datum1->MDId()))
+	{
+		return EcmprUnknown;
+	}
+
+	ULONG len1 = 0;
+	ULONG batch1 = 0;
+	const BYTE *key1 =
+		dynamic_cast<IDatumGeneric *>(pdatum1)->GetSortKey(&len1, &batch1);
+	ULONG len2 = 0;
+	ULONG batch2 = 0;
+	const BYTE *key2 =
+		dynamic_cast<IDatumGeneric *>(pdatum2)->GetSortKey(&len2, &batch2);
+	if (nullptr == key1 || nullptr == key2 || batch1 != batch2)
+	{
+		return EcmprUnknown;
+	}
+
+	INT result = clib::Memcmp(key1, key2, std::min(len1, len2));
+	if (0 == result)
+	{
+		result = (INT) len1 - (INT) len2;
+	}
+
+	if (0 > result)
+	{
+		return EcmprLess;
+	}
+
+	return (0 == result) ? EcmprEqual : EcmprGreater;
+}
+
+// EOF
@@ -42,6 +42,10 @@ CDatumSortedSet::CDatumSortedSet(CMemoryPool *mp, CExpression *pexprArray,
 	{
 		return;
 	}
+
+	// let the comparator prepare for sorting, e.g. by computing the sort
+	// keys of all datums at once rather than comparing them one by one
+	pcomp->PrepareComparisons(aprngdatum.Value());
 	aprngdatum->Sort(&CUtils::IDatumCmp);
 
 	// de-duplicate
@@ -108,19 +108,10 @@ CDefaultComparator::FUseInternalEvaluator(const IDatum *datum1,
 		return true;
 	}
 
-	// For now, specifically target date and timestamp columns, since they
-	// are mappable to a double value that represents the number of microseconds
-	// since Jan 1, 2000 and therefore those can be compared precisely, just like
-	// integer types. Same goes for float types, since they map naturally to a
-	// double value
+	// the registry lists the types whose stats mapping can be compared
+	// precisely, just like integer types
 	if (mdid1->Equals(datum2->MDId()) && datum1->StatsAreComparable(datum2) &&
-		(CMDIdGPDB::m_mdid_date.Equals(mdid1) ||
-		 CMDIdGPDB::m_mdid_bool.Equals(mdid1) ||
-		 CMDIdGPDB::m_mdid_time.Equals(mdid1) ||
-		 CMDIdGPDB::m_mdid_timestamp.Equals(mdid1) ||
-		 CMDIdGPDB::m_mdid_float4.Equals(mdid1) ||
-		 CMDIdGPDB::m_mdid_float8.Equals(mdid1) ||
-		 CMDIdGPDB::m_mdid_numeric.Equals(mdid1)))
+		CDatumComparatorRegistry::FStatsComparable(mdid1))
 	{
 		return true;
 	}
@@ -134,6 +125,25 @@ CDefaultComparator::FUseInternalEvaluator(const IDatum *datum1,
 	return false;
 }
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CDefaultComparator::EcmprSortKeys
+//
+//	@doc:
+//		Compare two datums by the sort keys cached on them. The result is
+//		unknown if either datum is NULL or does not have a comparable key.
+//
+//---------------------------------------------------------------------------
+CDatumComparatorRegistry::ECmpResult
+CDefaultComparator::EcmprSortKeys(const IDatum *datum1, const IDatum *datum2)
+{
+	if (datum1->IsNull() || datum2->IsNull())
+	{
+		return CDatumComparatorRegistry::EcmprUnknown;
+	}
+
+	return CDatumComparatorRegistry::EcmprSortKeys(datum1, datum2);
+}
 
 //---------------------------------------------------------------------------
 //	@function:
@@ -146,6 +156,13 @@ CDefaultComparator::FUseInternalEvaluator(const IDatum *datum1,
 BOOL
 CDefaultComparator::Equals(const IDatum *datum1, const IDatum *datum2) const
 {
+	CDatumComparatorRegistry::ECmpResult ecmpr =
+		EcmprSortKeys(datum1, datum2);
+	if (CDatumComparatorRegistry::EcmprUnknown != ecmpr)
+	{
+		return CDatumComparatorRegistry::EcmprEqual == ecmpr;
+	}
+
 	BOOL can_use_external_evaluator = false;
 
 	if (FUseInternalEvaluator(datum1, datum2, &can_use_external_evaluator))
@@ -183,6 +200,13 @@ CDefaultComparator::Equals(const IDatum *datum1, const IDatum *datum2) const
 BOOL
 CDefaultComparator::IsLessThan(const IDatum *datum1, const IDatum *datum2) const
 {
+	CDatumComparatorRegistry::ECmpResult ecmpr =
+		EcmprSortKeys(datum1, datum2);
+	if (CDatumComparatorRegistry::EcmprUnknown != ecmpr)
+	{
+		return CDatumComparatorRegistry::EcmprLess == ecmpr;
+	}
+
 	BOOL can_use_external_evaluator = false;
 
 	if (FUseInternalEvaluator(datum1, datum2, &can_use_external_evaluator))
@@ -221,6 +245,13 @@ BOOL
 CDefaultComparator::IsLessThanOrEqual(const IDatum *datum1,
 									  const IDatum *datum2) const
 {
+	CDatumComparatorRegistry::ECmpResult ecmpr =
+		EcmprSortKeys(datum1, datum2);
+	if (CDatumComparatorRegistry::EcmprUnknown != ecmpr)
+	{
+		return CDatumComparatorRegistry::EcmprGreater != ecmpr;
+	}
+
 	BOOL can_use_external_evaluator = false;
 
 	if (FUseInternalEvaluator(datum1, datum2, &can_use_external_evaluator))
@@ -267,6 +298,13 @@ BOOL
 CDefaultComparator::IsGreaterThan(const IDatum *datum1,
 								  const IDatum *datum2) const
 {
+	CDatumComparatorRegistry::ECmpResult ecmpr =
+		EcmprSortKeys(datum1, datum2);
+	if (CDatumComparatorRegistry::EcmprUnknown != ecmpr)
+	{
+		return CDatumComparatorRegistry::EcmprGreater == ecmpr;
+	}
+
 	BOOL can_use_external_evaluator = false;
 
 	if (FUseInternalEvaluator(datum1, datum2, &can_use_external_evaluator))
@@ -305,6 +343,13 @@ BOOL
 CDefaultComparator::IsGreaterThanOrEqual(const IDatum *datum1,
 										 const IDatum *datum2) const
 {
+	CDatumComparatorRegistry::ECmpResult ecmpr =
+		EcmprSortKeys(datum1, datum2);
+	if (CDatumComparatorRegistry::EcmprUnknown != ecmpr)
+	{
+		return CDatumComparatorRegistry::EcmprLess != ecmpr;
+	}
+
 	BOOL can_use_external_evaluator = false;
 
 	if (FUseInternalEvaluator(datum1, datum2, &can_use_external_evaluator))
@@ -337,4 +382,53 @@ CDefaultComparator::IsGreaterThanOrEqual(const IDatum *datum1,
 	return FEvalComparison(amp.Pmp(), datum1, datum2, IMDType::EcmptGEq);
 }
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CDefaultComparator::Compare
+//
+//	@doc:
+//		Three-way comparison of the two arguments. Uses the sort keys of the
+//		datums if possible, and otherwise falls back to the separate tests.
+//
+//---------------------------------------------------------------------------
+INT
+CDefaultComparator::Compare(const IDatum *datum1, const IDatum *datum2) const
+{
+	switch (EcmprSortKeys(datum1, datum2))
+	{
+		case CDatumComparatorRegistry::EcmprLess:
+			return -1;
+		case CDatumComparatorRegistry::EcmprEqual:
+			return 0;
+		case CDatumComparatorRegistry::EcmprGreater:
+			return 1;
+		default:
+			return IComparator::Compare(datum1, datum2);
+	}
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDefaultComparator::PrepareComparisons
+//
+//	@doc:
+//		Ask the evaluator for the sort keys of all given datums at once, so
+//		that comparing them among each other does not need an evaluator
+//		call per comparison
+//
+//---------------------------------------------------------------------------
+void
+CDefaultComparator::PrepareComparisons(const IDatumArray *pdrgpdatum) const
+{
+	if (nullptr == pdrgpdatum || 2 > pdrgpdatum->Size() ||
+		!CDatumComparatorRegistry::FSortKeyComparable(
+			(*pdrgpdatum)[0]->MDId()) ||
+		!m_pceeval->FCanEvalExpressions())
+	{
+		return;
+	}
+
+	(void) m_pceeval->FComputeSortKeys(pdrgpdatum);
+}
+
 // EOF
@@ -0,0 +1,271 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (c) 2023 VMware, Inc. or its affiliates. All Rights Reserved.
+//
+//	@filename:
+//		CDistributionSpecHashedSkew.cpp
+//
+//	@doc:
+//		Implementation of the hashed distribution with skew values
+//---------------------------------------------------------------------------
+
+#include "gpopt/base/CDistributionSpecHashedSkew.h"
+
+#include "gpopt/base/CDrvdPropPlan.h"
+#include "gpopt/base/CUtils.h"
+#include "gpopt/operators/CExpressionHandle.h"
+#include "gpopt/operators/CPhysicalMotionHashDistribute.h"
+#include "naucrates/traceflags/traceflags.h"
+
+using namespace gpopt;
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDistributionSpecHashedSkew::CDistributionSpecHashedSkew
+//
+//	@doc:
+//		Ctor; nulls are always colocated, as rows are routed by the hash
+//		of their key
+//
+//---------------------------------------------------------------------------
+CDistributionSpecHashedSkew::CDistributionSpecHashedSkew(
+	CExpressionArray *pdrgpexpr, CExpressionArray *pdrgpexprSkew,
+	BOOL fBroadcast, CDouble dSkewFreq, IMdIdArray *opfamilies)
+	: CDistributionSpecHashed(pdrgpexpr, true /* fNullsColocated */,
+							  opfamilies),
+	  m_pdrgpexprSkew(pdrgpexprSkew),
+	  m_fBroadcast(fBroadcast),
+	  m_dSkewFreq(dSkewFreq)
+{
+	GPOS_ASSERT(nullptr != pdrgpexprSkew);
+	GPOS_ASSERT(0 < pdrgpexprSkew->Size());
+	GPOS_ASSERT(1 == pdrgpexpr->Size());
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDistributionSpecHashedSkew::~CDistributionSpecHashedSkew
+//
+//	@doc:
+//		Dtor
+//
+//---------------------------------------------------------------------------
+CDistributionSpecHashedSkew::~CDistributionSpecHashedSkew()
+{
+	m_pdrgpexprSkew->Release();
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDistributionSpecHashedSkew::Matches
+//
+//	@doc:
+//		Match function
+//
+//---------------------------------------------------------------------------
+BOOL
+CDistributionSpecHashedSkew::Matches(const CDistributionSpec *pds) const
+{
+	if (Edt() != pds->Edt())
+	{
+		return false;
+	}
+
+	const CDistributionSpecHashedSkew *pdsSkew =
+		CDistributionSpecHashedSkew::PdsConvert(pds);
+
+	return m_fBroadcast == pdsSkew->FBroadcast() &&
+		   CUtils::Equals(m_pdrgpexprSkew, pdsSkew->PdrgpexprSkew()) &&
+		   FMatchHashedDistribution(pdsSkew);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDistributionSpecHashedSkew::FSatisfies
+//
+//	@doc:
+//		Check if this distribution spec satisfies the given one; the build
+//		side has duplicates of the skew values, so it only satisfies an
+//		exact match, the probe side does not hash all of its rows, so it
+//		only satisfies requests not caring about the placement of rows
+//
+//---------------------------------------------------------------------------
+BOOL
+CDistributionSpecHashedSkew::FSatisfies(const CDistributionSpec *pds) const
+{
+	if (Matches(pds))
+	{
+		return true;
+	}
+
+	if (m_fBroadcast)
+	{
+		return false;
+	}
+
+	return EdtAny == pds->Edt() || EdtNonSingleton == pds->Edt() ||
+		   EdtNonReplicated == pds->Edt();
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDistributionSpecHashedSkew::Equals
+//
+//	@doc:
+//		Equality function
+//
+//---------------------------------------------------------------------------
+BOOL
+CDistributionSpecHashedSkew::Equals(const CDistributionSpec *pds) const
+{
+	if (!CDistributionSpecHashed::Equals(pds))
+	{
+		return false;
+	}
+
+	const CDistributionSpecHashedSkew *pdsSkew =
+		CDistributionSpecHashedSkew::PdsConvert(pds);
+
+	return m_fBroadcast == pdsSkew->FBroadcast() &&
+		   CUtils::Equals(m_pdrgpexprSkew, pdsSkew->PdrgpexprSkew());
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDistributionSpecHashedSkew::HashValue
+//
+//	@doc:
+//		Hash function
+//
+//---------------------------------------------------------------------------
+ULONG
+CDistributionSpecHashedSkew::HashValue() const
+{
+	ULONG ulHash = gpos::CombineHashes(CDistributionSpecHashed::HashValue(),
+									   gpos::HashValue<BOOL>(&m_fBroadcast));
+
+	const ULONG size = m_pdrgpexprSkew->Size();
+	for (ULONG ul = 0; ul < size; ul++)
+	{
+		ulHash = gpos::CombineHashes(
+			ulHash, CExpression::HashValue((*m_pdrgpexprSkew)[ul]));
+	}
+
+	return ulHash;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDistributionSpecHashedSkew::PdsCopyWithRemappedColumns
+//
+//	@doc:
+//		Return a copy of the distribution spec with remapped columns
+//
+//---------------------------------------------------------------------------
+CDistributionSpec *
+CDistributionSpecHashedSkew::PdsCopyWithRemappedColumns(
+	CMemoryPool *mp, UlongToColRefMap *colref_mapping, BOOL must_exist)
+{
+	CExpressionArray *pdrgpexpr = GPOS_NEW(mp) CExpressionArray(mp);
+	pdrgpexpr->Append((*Pdrgpexpr())[0]->PexprCopyWithRemappedColumns(
+		mp, colref_mapping, must_exist));
+
+	IMdIdArray *opfamilies = Opfamilies();
+	if (nullptr != opfamilies)
+	{
+		opfamilies->AddRef();
+	}
+	m_pdrgpexprSkew->AddRef();
+
+	return GPOS_NEW(mp) CDistributionSpecHashedSkew(
+		pdrgpexpr, m_pdrgpexprSkew, m_fBroadcast, m_dSkewFreq, opfamilies);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDistributionSpecHashedSkew::AppendEnforcers
+//
+//	@doc:
+//		Add required enforcers to dynamic array
+//
+//---------------------------------------------------------------------------
+void
+CDistributionSpecHashedSkew::AppendEnforcers(CMemoryPool *mp,
+											 CExpressionHandle &exprhdl,
+											 CReqdPropPlan *
+#ifdef GPOS_DEBUG
+												 prpp
+#endif	// GPOS_DEBUG
+											 ,
+											 CExpressionArray *pdrgpexpr,
+											 CExpression *pexpr)
+{
+	GPOS_ASSERT(nullptr != mp);
+	GPOS_ASSERT(nullptr != prpp);
+	GPOS_ASSERT(nullptr != pdrgpexpr);
+	GPOS_ASSERT(nullptr != pexpr);
+	GPOS_ASSERT(!GPOS_FTRACE(EopttraceDisableMotions));
+	GPOS_ASSERT(
+		this == prpp->Ped()->PdsRequired() &&
+		"required plan properties don't match enforced distribution spec");
+
+	if (GPOS_FTRACE(EopttraceDisableMotionHashDistribute))
+	{
+		// hash-distribute Motion is disabled
+		return;
+	}
+
+	// a motion on top of a replicated or universal child is turned into a
+	// hash filter, which cannot route the skew values
+	CDistributionSpec *expr_dist_spec =
+		CDrvdPropPlan::Pdpplan(exprhdl.Pdp())->Pds();
+	if (CUtils::FDuplicateHazardDistributionSpec(expr_dist_spec))
+	{
+		return;
+	}
+
+	this->AddRef();
+	pexpr->AddRef();
+	CExpression *pexprMotion = GPOS_NEW(mp) CExpression(
+		mp, GPOS_NEW(mp) CPhysicalMotionHashDistribute(mp, this), pexpr);
+	pdrgpexpr->Append(pexprMotion);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDistributionSpecHashedSkew::OsPrint
+//
+//	@doc:
+//		Print function
+//
+//---------------------------------------------------------------------------
+IOstream &
+CDistributionSpecHashedSkew::OsPrint(IOstream &os) const
+{
+	CDistributionSpecHashed::OsPrint(os);
+
+	os << ", skew values: [";
+	const ULONG size = m_pdrgpexprSkew->Size();
+	for (ULONG ul = 0; ul < size; ul++)
+	{
+		if (0 < ul)
+		{
+			os << ", ";
+		}
+		(*m_pdrgpexprSkew)[ul]->Pop()->OsPrint(os);
+	}
+	os << "]";
+
+	if (m_fBroadcast)
+	{
+		os << " broadcast";
+	}
+	else
+	{
+		os << " spread";
+	}
+
+	return os;
+}
+
+// EOF
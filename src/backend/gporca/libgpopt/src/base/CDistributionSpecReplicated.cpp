@@ -97,6 +97,12 @@ CDistributionSpecReplicated::FSatisfies(const CDistributionSpec *pdss) const
 			return true;
 		}
 
+		// skew values have to be routed by a motion on both join sides
+		if (EdtHashedSkew == pdss->Edt())
+		{
+			return false;
+		}
+
 		if (CDistributionSpec::EdtRandom == pdss->Edt() &&
 			(CDistributionSpecRandom::PdsConvert(pdss))->IsDuplicateSensitive())
 		{
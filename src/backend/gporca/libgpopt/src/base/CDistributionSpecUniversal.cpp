@@ -38,6 +38,12 @@ CDistributionSpecUniversal::FSatisfies(const CDistributionSpec *pds) const
 		return false;
 	}
 
+	if (CDistributionSpec::EdtHashedSkew == pds->Edt())
+	{
+		// skew values have to be routed by a motion on both join sides
+		return false;
+	}
+
 	return true;
 }
 
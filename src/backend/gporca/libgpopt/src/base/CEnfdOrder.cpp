@@ -81,6 +81,34 @@ CEnfdOrder::FCompatible(COrderSpec *pos) const
 }
 
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CEnfdOrder::UlPresortedKeys
+//
+//	@doc:
+//		Return the number of leading keys of the required order
+//		specification that the given order specification delivers, an
+//		incremental sort only needs to sort within groups of those keys
+//
+//---------------------------------------------------------------------------
+ULONG
+CEnfdOrder::UlPresortedKeys(COrderSpec *pos) const
+{
+	GPOS_ASSERT(nullptr != pos);
+
+	switch (m_eom)
+	{
+		case EomSatisfy:
+			return pos->UlSatisfiedPrefix(m_pos);
+
+		case EomSentinel:
+			GPOS_ASSERT("invalid matching type");
+	}
+
+	return 0;
+}
+
+
 //---------------------------------------------------------------------------
 //	@function:
 //		CEnfdOrder::HashValue
@@ -12,8 +12,12 @@
 #include "gpopt/base/COrderSpec.h"
 
 #include "gpopt/base/CColRefSet.h"
+#include "gpopt/base/CDrvdPropPlan.h"
 #include "gpopt/base/COptCtxt.h"
+#include "gpopt/base/CReqdPropPlan.h"
+#include "gpopt/operators/CExpressionHandle.h"
 #include "gpopt/operators/CPhysicalSort.h"
+#include "naucrates/traceflags/traceflags.h"
 
 #ifdef GPOS_DEBUG
 #include "gpos/error/CAutoTrace.h"
@@ -185,23 +189,70 @@ COrderSpec::FSatisfies(const COrderSpec *pos) const
 }
 
 
+//---------------------------------------------------------------------------
+//	@function:
+//		COrderSpec::UlSatisfiedPrefix
+//
+//	@doc:
+//		Return the length of the longest prefix of the given order spec
+//		that this order spec satisfies
+//
+//---------------------------------------------------------------------------
+ULONG
+COrderSpec::UlSatisfiedPrefix(const COrderSpec *pos) const
+{
+	const ULONG arity = std::min(m_pdrgpoe->Size(), pos->m_pdrgpoe->Size());
+
+	ULONG ul = 0;
+	while (ul < arity && (*m_pdrgpoe)[ul]->Matches((*(pos->m_pdrgpoe))[ul]))
+	{
+		ul++;
+	}
+
+	return ul;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		COrderSpec::PosPrefix
+//
+//	@doc:
+//		Return a copy of the given number of leading components
+//
+//---------------------------------------------------------------------------
+COrderSpec *
+COrderSpec::PosPrefix(CMemoryPool *mp, ULONG ulLength) const
+{
+	GPOS_ASSERT(ulLength <= m_pdrgpoe->Size());
+
+	COrderSpec *pos = GPOS_NEW(mp) COrderSpec(mp);
+	for (ULONG ul = 0; ul < ulLength; ul++)
+	{
+		COrderExpression *poe = (*m_pdrgpoe)[ul];
+		IMDId *mdid = poe->GetMdIdSortOp();
+		mdid->AddRef();
+		pos->Append(mdid, poe->Pcr(), poe->Ent());
+	}
+
+	return pos;
+}
+
+
 //---------------------------------------------------------------------------
 //	@function:
 //		COrderSpec::AppendEnforcers
 //
 //	@doc:
-//		Add required enforcers enforcers to dynamic array
+//		Add required enforcers enforcers to dynamic array. Besides a full
+//		sort, an incremental sort is added if the expression delivers the
+//		order on a prefix of this order spec.
 //
 //---------------------------------------------------------------------------
 void
-COrderSpec::AppendEnforcers(CMemoryPool *mp,
-							CExpressionHandle &,  // exprhdl
-							CReqdPropPlan *
-#ifdef GPOS_DEBUG
-								prpp
-#endif	// GPOS_DEBUG
-							,
-							CExpressionArray *pdrgpexpr, CExpression *pexpr)
+COrderSpec::AppendEnforcers(CMemoryPool *mp, CExpressionHandle &exprhdl,
+							CReqdPropPlan *prpp, CExpressionArray *pdrgpexpr,
+							CExpression *pexpr)
 {
 	GPOS_ASSERT(nullptr != prpp);
 	GPOS_ASSERT(nullptr != mp);
@@ -215,6 +266,22 @@ COrderSpec::AppendEnforcers(CMemoryPool *mp,
 	CExpression *pexprSort = GPOS_NEW(mp)
 		CExpression(mp, GPOS_NEW(mp) CPhysicalSort(mp, this), pexpr);
 	pdrgpexpr->Append(pexprSort);
+
+	if (!GPOS_FTRACE(EopttraceEnableIncrementalSort))
+	{
+		return;
+	}
+
+	COrderSpec *posDerived = CDrvdPropPlan::Pdpplan(exprhdl.Pdp())->Pos();
+	const ULONG ulPresortedKeys = prpp->Peo()->UlPresortedKeys(posDerived);
+	if (0 < ulPresortedKeys && ulPresortedKeys < UlSortColumns())
+	{
+		AddRef();
+		pexpr->AddRef();
+		CExpression *pexprIncrementalSort = GPOS_NEW(mp) CExpression(
+			mp, GPOS_NEW(mp) CPhysicalSort(mp, this, ulPresortedKeys), pexpr);
+		pdrgpexpr->Append(pexprIncrementalSort);
+	}
 }
 
 
@@ -46,6 +46,7 @@
 #include "gpopt/operators/CPhysicalAgg.h"
 #include "gpopt/operators/CPhysicalCTEConsumer.h"
 #include "gpopt/operators/CPhysicalCTEProducer.h"
+#include "gpopt/operators/CPhysicalMergeJoin.h"
 #include "gpopt/operators/CPhysicalMotionRandom.h"
 #include "gpopt/operators/CPhysicalNLJoin.h"
 #include "gpopt/operators/CPredicateUtils.h"
@@ -1153,6 +1154,21 @@ CUtils::FNLJoin(COperator *pop)
 	return (nullptr != popNLJ);
 }
 
+// check if a given operator is a merge join
+BOOL
+CUtils::FMergeJoin(COperator *pop)
+{
+	GPOS_ASSERT(nullptr != pop);
+
+	CPhysicalMergeJoin *popMJ = nullptr;
+	if (pop->FPhysical())
+	{
+		popMJ = dynamic_cast<CPhysicalMergeJoin *>(pop);
+	}
+
+	return (nullptr != popMJ);
+}
+
 // check if a given operator is a logical join
 BOOL
 CUtils::FPhysicalJoin(COperator *pop)
@@ -4249,16 +4265,7 @@ CUtils::IDatumCmp(const void *val1, const void *val2)
 
 	const IComparator *pcomp = COptCtxt::PoctxtFromTLS()->Pcomp();
 
-	if (pcomp->Equals(dat1, dat2))
-	{
-		return 0;
-	}
-	else if (pcomp->IsLessThan(dat1, dat2))
-	{
-		return -1;
-	}
-
-	return 1;
+	return pcomp->Compare(dat1, dat2);
 }
 
 // compares two points. Takes pointer pointer to a CPoint.
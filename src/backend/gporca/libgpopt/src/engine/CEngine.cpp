@@ -41,6 +41,7 @@
 #include "gpopt/operators/CPhysicalMotionGather.h"
 #include "gpopt/operators/CPhysicalPartitionSelector.h"
 #include "gpopt/operators/CPhysicalSort.h"
+#include "gpopt/optimizer/COptimizationProfile.h"
 #include "gpopt/optimizer/COptimizerConfig.h"
 #include "gpopt/search/CBinding.h"
 #include "gpopt/search/CGroup.h"
@@ -87,7 +88,9 @@ CEngine::CEngine(CMemoryPool *mp)
 	  m_pdrgpulpXformCalls(nullptr),
 	  m_pdrgpulpXformTimes(nullptr),
 	  m_pdrgpulpXformBindings(nullptr),
-	  m_pdrgpulpXformResults(nullptr)
+	  m_pdrgpulpXformResults(nullptr),
+	  m_ulTimeBudget(0),
+	  m_fTimeBudgetExpired(false)
 {
 	m_pmemo = GPOS_NEW(mp) CMemo(mp);
 	m_pexprEnforcerPattern =
@@ -197,6 +200,12 @@ CEngine::Init(CQueryContext *pqc, CSearchStageArray *search_stage_array)
 		}
 	}
 
+	m_ulTimeBudget = COptCtxt::PoctxtFromTLS()
+						 ->GetOptimizerConfig()
+						 ->GetHint()
+						 ->UlTimeBudget();
+	m_clockSearch.Restart();
+
 	m_pqc = pqc;
 	InitLogicalExpression(m_pqc->Pexpr());
 
@@ -355,7 +364,7 @@ void
 CEngine::InsertXformResult(
 	CGroup *pgroupOrigin, CXformResult *pxfres, CXform::EXformId exfidOrigin,
 	CGroupExpression *pgexprOrigin,
-	ULONG ulXformTime,	// time consumed by transformation in msec
+	ULONG ulXformTime,	// time consumed by transformation in usec
 	ULONG ulNumberOfBindings)
 {
 	GPOS_ASSERT(nullptr != pxfres);
@@ -363,6 +372,13 @@ CEngine::InsertXformResult(
 	GPOS_ASSERT(CXform::ExfInvalid != exfidOrigin);
 	GPOS_ASSERT(nullptr != pgexprOrigin);
 
+	COptimizationProfile *profile = COptCtxt::PoctxtFromTLS()->Pprofile();
+	if (nullptr != profile)
+	{
+		profile->RecordXform(exfidOrigin, ulXformTime, ulNumberOfBindings,
+							 pxfres->Pdrgpexpr()->Size());
+	}
+
 	if (GPOS_FTRACE(EopttracePrintOptimizationStatistics) &&
 		0 < pxfres->Pdrgpexpr()->Size())
 	{
@@ -548,9 +564,11 @@ CEngine::FOptimizeChild(
 
 	if (nullptr != pgexprParent &&
 		COperator::EopPhysicalSort == pgexprParent->Pop()->Eopid() &&
+		!CPhysicalSort::PopConvert(pgexprParent->Pop())->FIncremental() &&
 		COperator::EopPhysicalMotionGather == popChild->Eopid())
 	{
 		// prevent (Sort --> GatherMerge), since Sort destroys order maintained by GatherMerge
+		// (an incremental sort builds on that order instead)
 		return !CPhysicalMotionGather::PopConvert(popChild)->FOrderPreserving();
 	}
 
@@ -660,10 +678,134 @@ CEngine::FSafeToPrune(
 		}
 	}
 
+	if (FSafeToPruneGlobally(pgexpr))
+	{
+		CCost costUpperBound = CostUpperBound();
+		if (GPOPT_INVALID_COST != costUpperBound)
+		{
+			if (GPOPT_INVALID_COST == *pcostLowerBound)
+			{
+				*pcostLowerBound =
+					pgexpr->CostLowerBound(m_mp, prpp, pccChild, child_index);
+			}
+
+			if (*pcostLowerBound > costUpperBound)
+			{
+				// every complete plan using the group expression is more
+				// expensive than the best complete plan found so far
+				return true;
+			}
+		}
+	}
+
 	return false;
 }
 
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CEngine::CheckTimeBudget
+//
+//	@doc:
+//		Stop the search once the time budget has expired. The search goes
+//		on until a complete plan is found, so that there is always a plan
+//		to return; the remaining jobs are then completed without running
+//		them and no further search stages are started.
+//
+//---------------------------------------------------------------------------
+void
+CEngine::CheckTimeBudget()
+{
+	if (m_fTimeBudgetExpired || 0 == m_ulTimeBudget ||
+		m_clockSearch.ElapsedMS() < m_ulTimeBudget)
+	{
+		return;
+	}
+
+	CCost costUpperBound = CostUpperBound();
+	if (GPOPT_INVALID_COST == costUpperBound)
+	{
+		return;
+	}
+
+	m_fTimeBudgetExpired = true;
+	COptCtxt::PoctxtFromTLS()
+		->GetOptimizerConfig()
+		->GetEnumeratorCfg()
+		->SetTimeBudgetExpired(true);
+
+	if (GPOS_FTRACE(EopttracePrintOptimizationStatistics))
+	{
+		CAutoTrace at(m_mp);
+		at.Os() << "[OPT]: Time budget of " << m_ulTimeBudget
+				<< "ms expired at stage " << m_ulCurrSearchStage
+				<< ", returning plan with cost " << costUpperBound;
+	}
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CEngine::CostUpperBound
+//
+//	@doc:
+//		Cost of the best complete plan found so far in any search stage;
+//		returns an invalid cost if no complete plan was found yet
+//
+//---------------------------------------------------------------------------
+CCost
+CEngine::CostUpperBound()
+{
+	COptimizationContext *poc =
+		PgroupRoot()->PocLookupBest(m_mp, UlSearchStages(), m_pqc->Prpp());
+	if (nullptr == poc || nullptr == poc->PccBest() ||
+		poc->PccBest()->FPruned())
+	{
+		return CCost(GPOPT_INVALID_COST);
+	}
+
+	return poc->PccBest()->Cost();
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CEngine::FSafeToPruneGlobally
+//
+//	@doc:
+//		Check if a plan rooted by given group expression may be compared to
+//		the best complete plan found so far. This relies on the cost of a
+//		plan being included in the cost of every plan containing it, which
+//		does not hold for scans and partition selectors, whose cost is
+//		replaced by the cost of their output below a filter, nor for the
+//		inner side of a memoized nested loop join, whose rescans cost less
+//		than the plan itself. Plans are not compared across groups either
+//		when plan choices do not follow costs.
+//
+//---------------------------------------------------------------------------
+BOOL
+CEngine::FSafeToPruneGlobally(CGroupExpression *pgexpr)
+{
+	if (!GPOS_FTRACE(EopttraceEnableGlobalSpacePruning) ||
+		GPOS_FTRACE(EopttraceEnableMemoize) ||
+		GPOS_FTRACE(EopttraceForceMultiStageAgg) ||
+		GPOS_FTRACE(EopttraceForceThreeStageScalarDQA))
+	{
+		return false;
+	}
+
+	// the root group is already bounded by its own best plan
+	if (pgexpr->Pgroup() == PgroupRoot())
+	{
+		return false;
+	}
+
+	COperator *pop = pgexpr->Pop();
+	return !CUtils::FPhysicalScan(pop) &&
+		   COperator::EopPhysicalPartitionSelector != pop->Eopid();
+}
+
+
 //---------------------------------------------------------------------------
 //	@function:
 //		CEngine::Pmemotmap
@@ -1558,8 +1700,9 @@ CEngine::PrintActivatedXforms(IOstream &os) const
 			CXform *pxform = CXformFactory::Pxff()->Pxf(xsi.TBit());
 			ULONG ulCalls = (ULONG)(
 				*m_pdrgpulpXformCalls)[m_ulCurrSearchStage][pxform->Exfid()];
-			ULONG ulTime = (ULONG)(
-				*m_pdrgpulpXformTimes)[m_ulCurrSearchStage][pxform->Exfid()];
+			ULONG_PTR ulpTimeUS =
+				(*m_pdrgpulpXformTimes)[m_ulCurrSearchStage][pxform->Exfid()];
+			ULONG ulTime = (ULONG)(ulpTimeUS / GPOS_USEC_IN_MSEC);
 			ULONG ulBindings = (ULONG)(
 				*m_pdrgpulpXformBindings)[m_ulCurrSearchStage][pxform->Exfid()];
 			ULONG ulResults = (ULONG)(
@@ -1721,6 +1864,12 @@ CEngine::Optimize()
 	}
 
 
+	COptimizationProfile *profile = COptCtxt::PoctxtFromTLS()->Pprofile();
+	if (nullptr != profile)
+	{
+		m_pmemo->RecordProfile(profile);
+	}
+
 	if (GPOS_FTRACE(EopttracePrintOptimizationStatistics))
 	{
 		CAutoTrace atSearch(m_mp);
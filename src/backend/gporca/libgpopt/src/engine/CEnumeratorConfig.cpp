@@ -39,6 +39,7 @@ CEnumeratorConfig::CEnumeratorConfig(CMemoryPool *mp, ULLONG plan_id,
 	: m_mp(mp),
 	  m_plan_id(plan_id),
 	  m_ullSpaceSize(0),
+	  m_fTimeBudgetExpired(false),
 	  m_ullInputSamples(ullSamples),
 	  m_costBest(GPOPT_INVALID_COST),
 	  m_costMax(GPOPT_INVALID_COST),
@@ -104,6 +104,20 @@ CConstExprEvaluatorDXL::FCanEvalExpressions()
 	return m_pconstdxleval->FCanEvalExpressions();
 }
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CConstExprEvaluatorDXL::FComputeSortKeys
+//
+//	@doc:
+//		Delegates computing the sort keys of the given datums to the DXL
+//		evaluator, which does it for all of them in a single call
+//
+//---------------------------------------------------------------------------
+BOOL
+CConstExprEvaluatorDXL::FComputeSortKeys(const IDatumArray *pdrgpdatum)
+{
+	return m_pconstdxleval->FComputeSortKeys(pdrgpdatum);
+}
 
 
 // EOF
@@ -39,12 +39,12 @@ CJoinTypeHint::SatisfiesOperator(COperator *op)
 		}
 		case HINT_KEYWORD_MERGEJOIN:
 		{
-			is_satisfied = op->Eopid() == COperator::EopPhysicalFullMergeJoin;
+			is_satisfied = CUtils::FMergeJoin(op);
 			break;
 		}
 		case HINT_KEYWORD_NOMERGEJOIN:
 		{
-			is_satisfied = op->Eopid() != COperator::EopPhysicalFullMergeJoin;
+			is_satisfied = !CUtils::FMergeJoin(op);
 			break;
 		}
 		case HINT_KEYWORD_HASHJOIN:
@@ -19,6 +19,7 @@
 #include "gpopt/mdcache/CMDCache.h"
 #include "gpopt/xforms/CXformFactory.h"
 #include "naucrates/init.h"
+#include "naucrates/statistics/CCardinalityFeedback.h"
 
 using namespace gpos;
 using namespace gpopt;
@@ -61,6 +62,8 @@ gpopt_terminate()
 #ifdef GPOS_DEBUG
 	CMDCache::Shutdown();
 
+	CCardinalityFeedback::Shutdown();
+
 	CMemoryPoolManager::Destroy(mp);
 
 	CXformFactory::Shutdown();
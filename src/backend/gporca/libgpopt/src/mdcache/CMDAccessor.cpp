@@ -24,6 +24,7 @@
 #include "gpopt/base/COptCtxt.h"
 #include "gpopt/exception.h"
 #include "gpopt/mdcache/CMDAccessorUtils.h"
+#include "gpopt/optimizer/COptimizationProfile.h"
 #include "naucrates/dxl/CDXLUtils.h"
 #include "naucrates/exception.h"
 #include "naucrates/md/CMDIdCast.h"
@@ -37,6 +38,7 @@
 #include "naucrates/md/IMDCheckConstraint.h"
 #include "naucrates/md/IMDColStats.h"
 #include "naucrates/md/IMDExtStatsInfo.h"
+#include "naucrates/md/IMDMatViewInfo.h"
 #include "naucrates/md/IMDFunction.h"
 #include "naucrates/md/IMDIndex.h"
 #include "naucrates/md/IMDProvider.h"
@@ -476,6 +478,8 @@ CMDAccessor::Pmdp(CSystemId sysid)
 const IMDCacheObject *
 CMDAccessor::GetImdObj(IMDId *mdid, IMDCacheObject::Emdtype mdtype)
 {
+	CAutoProfilePhase appLookup(COptimizationProfile::EphMDLookup);
+
 	BOOL fPrintOptStats = GPOS_FTRACE(EopttracePrintOptimizationStatistics);
 	CTimerUser timerLookup;	 // timer to measure lookup time
 	if (fPrintOptStats)
@@ -533,7 +537,10 @@ CMDAccessor::GetImdObj(IMDId *mdid, IMDCacheObject::Emdtype mdtype)
 				GPOS_ASSERT(mdidCopy->Equals(mdid));
 			}
 
-			pmdobjNew = pmdp->GetMDObj(mp, this, mdidCopy, mdtype);
+			{
+				CAutoProfilePhase appFetch(COptimizationProfile::EphMDFetch);
+				pmdobjNew = pmdp->GetMDObj(mp, this, mdidCopy, mdtype);
+			}
 			GPOS_ASSERT(nullptr != pmdobjNew);
 
 			if (fPrintOptStats)
@@ -641,6 +648,20 @@ CMDAccessor::RetrieveExtStatsInfo(IMDId *mdid)
 	return dynamic_cast<const IMDExtStatsInfo *>(pmdobj);
 }
 
+const IMDMatViewInfo *
+CMDAccessor::RetrieveMatViewInfo(IMDId *mdid)
+{
+	const IMDCacheObject *pmdobj =
+		GetImdObj(mdid, IMDCacheObject::EmdtMatViewInfo);
+	if (IMDCacheObject::EmdtMatViewInfo != pmdobj->MDType())
+	{
+		GPOS_RAISE(gpdxl::ExmaMD, gpdxl::ExmiMDCacheEntryNotFound,
+				   mdid->GetBuffer());
+	}
+
+	return dynamic_cast<const IMDMatViewInfo *>(pmdobj);
+}
+
 
 //---------------------------------------------------------------------------
 //	@function:
@@ -1199,6 +1220,14 @@ CMDAccessor::GetHistogram(CMemoryPool *mp, IMDId *mdid_type,
 	GPOS_ASSERT_IMP(fBoolType,
 					3 >= histogram->GetNumDistinct() - CStatistics::Epsilon);
 
+	// copy the sketch out of the metadata cache
+	const CHyperLogLog *hll = pmdcolstats->GetHyperLogLog();
+	if (nullptr != hll)
+	{
+		histogram->SetHyperLogLog(CHyperLogLog::Make(
+			mp, hll->GetPrecision(), hll->GetRegisters(), hll->Size()));
+	}
+
 	return histogram;
 }
 
@@ -1326,4 +1355,48 @@ CMDAccessor::SerializeSysid(COstream &oos)
 }
 
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CMDAccessor::GetAccessedMdIds
+//
+//	@doc:
+//		Return copies of the mdids of all the objects accessed so far,
+//		allocated in the given memory pool so that they may outlive the
+//		accessor and the metadata cache entries
+//
+//---------------------------------------------------------------------------
+IMdIdArray *
+CMDAccessor::GetAccessedMdIds(CMemoryPool *mp)
+{
+	ULONG nentries = m_shtCacheAccessors.Size();
+	IMDId **mdids;
+	CAutoRg<IMDId *> a_mdids;
+	ULONG ul;
+
+	// as in Serialize(), don't allocate while holding the lock of the
+	// hash table iterator
+	mdids = GPOS_NEW_ARRAY(m_mp, IMDId *, nentries);
+	a_mdids = mdids;
+	{
+		MDHTIter mdhtit(m_shtCacheAccessors);
+		ul = 0;
+		while (mdhtit.Advance())
+		{
+			MDHTIterAccessor mdhtitacc(mdhtit);
+			SMDAccessorElem *pmdaccelem = mdhtitacc.Value();
+			GPOS_ASSERT(nullptr != pmdaccelem);
+			mdids[ul++] = pmdaccelem->MDId();
+		}
+		GPOS_ASSERT(ul == nentries);
+	}
+
+	IMdIdArray *result = GPOS_NEW(mp) IMdIdArray(mp, nentries);
+	for (ul = 0; ul < nentries; ul++)
+	{
+		result->Append(mdids[ul]->Copy(mp));
+	}
+
+	return result;
+}
+
 // EOF
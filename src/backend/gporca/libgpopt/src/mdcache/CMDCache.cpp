@@ -124,6 +124,46 @@ CMDCache::Reset()
 	Init();
 }
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CMDCache::FFilterKey
+//
+//	@doc:
+//		Apply an mdid filter to the mdid of a cache key
+//
+//---------------------------------------------------------------------------
+BOOL
+CMDCache::FFilterKey(CMDKey *const &pmdkey, void *pv)
+{
+	GPOS_ASSERT(nullptr != pmdkey);
+
+	SInvalidationFilter *filter = static_cast<SInvalidationFilter *>(pv);
+
+	return filter->m_filter_func(pmdkey->MDId(), filter->m_arg);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CMDCache::Invalidate
+//
+//	@doc:
+//		Invalidate the metadata objects whose mdid satisfies the given
+//		filter, leaving the rest of the cache intact. Objects still in use
+//		by an accessor are removed once they are released. Returns the
+//		number of invalidated objects.
+//
+//---------------------------------------------------------------------------
+ULONG
+CMDCache::Invalidate(MDIdFilterFuncPtr filter_func, void *arg)
+{
+	GPOS_ASSERT(nullptr != m_pcache && "Metadata cache was not created");
+	GPOS_ASSERT(nullptr != filter_func);
+
+	SInvalidationFilter filter = {filter_func, arg};
+
+	return m_pcache->InvalidateEntries(FFilterKey, &filter);
+}
+
 ULLONG
 GetCacheEvictionCounter()
 {
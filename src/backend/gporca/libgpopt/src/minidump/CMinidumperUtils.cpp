@@ -65,8 +65,18 @@ CMinidumperUtils::PdxlmdLoad(CMemoryPool *mp, const CHAR *file_name)
 		at.Os() << "parsing DXL File " << file_name;
 	}
 
-	CParseHandlerDXL *parse_handler_dxl = CDXLUtils::GetParseHandlerForDXLFile(
-		mp, file_name, nullptr /*xsd_file_path*/);
+	// minidumps are written in XML or binary DXL, tell them by their header
+	CParseHandlerDXL *parse_handler_dxl = nullptr;
+	if (CDXLUtils::IsDXLBinaryFile(file_name))
+	{
+		parse_handler_dxl =
+			CDXLUtils::GetParseHandlerForDXLBinaryFile(mp, file_name);
+	}
+	else
+	{
+		parse_handler_dxl = CDXLUtils::GetParseHandlerForDXLFile(
+			mp, file_name, nullptr /*xsd_file_path*/);
+	}
 
 	CBitSet *pbs = parse_handler_dxl->Pbs();
 	COptimizerConfig *optimizer_config =
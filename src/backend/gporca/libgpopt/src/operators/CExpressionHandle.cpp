@@ -18,6 +18,7 @@
 #include "gpos/base.h"
 
 #include "gpopt/base/CCTEReq.h"
+#include "gpopt/base/CCardinalityFingerprint.h"
 #include "gpopt/base/CColRefSet.h"
 #include "gpopt/base/CCostContext.h"
 #include "gpopt/base/CDrvdPropCtxtPlan.h"
@@ -34,6 +35,7 @@
 #include "gpopt/operators/CPattern.h"
 #include "gpopt/operators/CPhysicalCTEConsumer.h"
 #include "gpopt/operators/CPhysicalScan.h"
+#include "gpopt/optimizer/COptimizationProfile.h"
 #include "naucrates/statistics/CStatisticsUtils.h"
 
 using namespace gpnaucrates;
@@ -398,6 +400,15 @@ CExpressionHandle::DeriveRootStats(IStatisticsArray *stats_ctxt)
 	{
 		// otherwise, derive stats using root operator
 		pstatsRoot = popLogical->PstatsDerive(m_mp, *this, stats_ctxt);
+
+		if (GPOS_FTRACE(EopttraceEnableCardinalityFeedback))
+		{
+			// prefer the cardinality observed when executing the same
+			// subexpression before
+			pstatsRoot = CStatisticsUtils::ApplyCardinalityFeedback(
+				m_mp, pstatsRoot,
+				CCardinalityFingerprint::UllFingerprint(*this));
+		}
 	}
 	GPOS_ASSERT(nullptr != pstatsRoot);
 
@@ -422,6 +433,8 @@ CExpressionHandle::DeriveStats(IStatisticsArray *stats_ctxt,
 	GPOS_ASSERT(nullptr == m_pstats);
 	GPOS_ASSERT(nullptr != m_pdrgprp);
 
+	CAutoProfilePhase app(COptimizationProfile::EphStatsDerivation);
+
 	// copy input context
 	IStatisticsArray *pdrgpstatCurrentCtxt =
 		GPOS_NEW(m_mp) IStatisticsArray(m_mp);
@@ -616,6 +629,8 @@ CExpressionHandle::DeriveStats(CMemoryPool *pmpLocal, CMemoryPool *pmpGlobal,
 							   CReqdPropRelational *prprel,
 							   IStatisticsArray *stats_ctxt) const
 {
+	CAutoProfilePhase app(COptimizationProfile::EphStatsDerivation);
+
 	CReqdPropRelational *prprelNew = prprel;
 	if (nullptr == prprelNew)
 	{
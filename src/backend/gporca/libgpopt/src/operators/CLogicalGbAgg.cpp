@@ -593,6 +593,8 @@ CLogicalGbAgg::PxfsCandidates(CMemoryPool *mp) const
 	if (FGlobal())
 	{
 		(void) xform_set->ExchangeSet(CXform::ExfSplitGbAgg);
+		(void) xform_set->ExchangeSet(CXform::ExfGbAgg2MatView);
+		(void) xform_set->ExchangeSet(CXform::ExfGbAggWithSelect2MatView);
 	}
 	(void) xform_set->ExchangeSet(CXform::ExfSplitDQA);
 	(void) xform_set->ExchangeSet(CXform::ExfGbAgg2Apply);
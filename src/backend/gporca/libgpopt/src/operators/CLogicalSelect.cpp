@@ -96,6 +96,8 @@ CLogicalSelect::PxfsCandidates(CMemoryPool *mp) const
 	(void) xform_set->ExchangeSet(CXform::ExfPushGbWithHavingBelowJoin);
 	(void) xform_set->ExchangeSet(CXform::ExfSelect2IndexGet);
 	(void) xform_set->ExchangeSet(CXform::ExfSelect2IndexOnlyGet);
+	(void) xform_set->ExchangeSet(CXform::ExfSelect2MatView);
+	(void) xform_set->ExchangeSet(CXform::ExfSplitWindowRankFilter);
 	(void) xform_set->ExchangeSet(CXform::ExfSelect2DynamicIndexOnlyGet);
 	(void) xform_set->ExchangeSet(CXform::ExfSelect2DynamicIndexGet);
 	(void) xform_set->ExchangeSet(CXform::ExfSelect2BitmapBoolOp);
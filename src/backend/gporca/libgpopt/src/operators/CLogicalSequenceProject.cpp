@@ -14,14 +14,21 @@
 #include "gpos/base.h"
 
 #include "gpopt/base/CColRefSet.h"
+#include "gpopt/base/CColRefSetIter.h"
 #include "gpopt/base/CDistributionSpec.h"
 #include "gpopt/base/CDistributionSpecHashed.h"
 #include "gpopt/base/CDistributionSpecSingleton.h"
 #include "gpopt/base/CKeyCollection.h"
+#include "gpopt/base/COptCtxt.h"
 #include "gpopt/operators/CExpression.h"
 #include "gpopt/operators/CExpressionHandle.h"
+#include "gpopt/operators/CScalarIdent.h"
+#include "naucrates/base/IDatumInt8.h"
+#include "naucrates/md/IMDTypeInt8.h"
+#include "naucrates/statistics/CStatistics.h"
 
 using namespace gpopt;
+using namespace gpnaucrates;
 
 //---------------------------------------------------------------------------
 //	@function:
@@ -34,13 +41,15 @@ using namespace gpopt;
 CLogicalSequenceProject::CLogicalSequenceProject(CMemoryPool *mp,
 												 CDistributionSpec *pds,
 												 COrderSpecArray *pdrgpos,
-												 CWindowFrameArray *pdrgpwf)
+												 CWindowFrameArray *pdrgpwf,
+												 BOOL fLocal)
 	: CLogicalUnary(mp),
 	  m_pds(pds),
 	  m_pdrgpos(pdrgpos),
 	  m_pdrgpwf(pdrgpwf),
 	  m_fHasOrderSpecs(false),
-	  m_fHasFrameSpecs(false)
+	  m_fHasFrameSpecs(false),
+	  m_fLocal(fLocal)
 {
 	GPOS_ASSERT(nullptr != pds);
 	GPOS_ASSERT(nullptr != pdrgpos);
@@ -90,7 +99,8 @@ CLogicalSequenceProject::CLogicalSequenceProject(CMemoryPool *mp)
 	  m_pdrgpos(nullptr),
 	  m_pdrgpwf(nullptr),
 	  m_fHasOrderSpecs(false),
-	  m_fHasFrameSpecs(false)
+	  m_fHasFrameSpecs(false),
+	  m_fLocal(false)
 {
 	m_fPattern = true;
 }
@@ -146,7 +156,8 @@ CLogicalSequenceProject::PopCopyWithRemappedColumns(
 		pdrgpwf->Append(pwf);
 	}
 
-	return GPOS_NEW(mp) CLogicalSequenceProject(mp, pds, pdrgpos, pdrgpwf);
+	return GPOS_NEW(mp)
+		CLogicalSequenceProject(mp, pds, pdrgpos, pdrgpwf, m_fLocal);
 }
 
 
@@ -317,7 +328,8 @@ CLogicalSequenceProject::Matches(COperator *pop) const
 	{
 		CLogicalSequenceProject *popLogicalSequenceProject =
 			CLogicalSequenceProject::PopConvert(pop);
-		return m_pds->Matches(popLogicalSequenceProject->Pds()) &&
+		return m_fLocal == popLogicalSequenceProject->FLocal() &&
+			   m_pds->Matches(popLogicalSequenceProject->Pds()) &&
 			   CWindowFrame::Equals(m_pdrgpwf,
 									popLogicalSequenceProject->Pdrgpwf()) &&
 			   COrderSpec::Equals(m_pdrgpos,
@@ -339,7 +351,7 @@ CLogicalSequenceProject::Matches(COperator *pop) const
 ULONG
 CLogicalSequenceProject::HashValue() const
 {
-	ULONG ulHash = 0;
+	ULONG ulHash = gpos::HashValue<BOOL>(&m_fLocal);
 	ulHash = gpos::CombineHashes(ulHash, m_pds->HashValue());
 	ulHash = gpos::CombineHashes(
 		ulHash, CWindowFrame::HashValue(m_pdrgpwf, 3 /*ulMaxSize*/));
@@ -369,6 +381,35 @@ CLogicalSequenceProject::PxfsCandidates(CMemoryPool *mp) const
 }
 
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CLogicalSequenceProject::PcrsStat
+//
+//	@doc:
+//		Compute required stat columns of the n-th child; a local window
+//		also needs the partition by keys to estimate its ranks
+//
+//---------------------------------------------------------------------------
+CColRefSet *
+CLogicalSequenceProject::PcrsStat(CMemoryPool *mp, CExpressionHandle &exprhdl,
+								  CColRefSet *pcrsInput,
+								  ULONG child_index) const
+{
+	CColRefSet *pcrsUsed = GPOS_NEW(mp) CColRefSet(mp);
+	pcrsUsed->Include(exprhdl.DeriveUsedColumns(1));
+	if (m_fLocal)
+	{
+		pcrsUsed->Include(m_pcrsLocalUsed);
+	}
+
+	CColRefSet *pcrsRequired =
+		PcrsReqdChildStats(mp, exprhdl, pcrsInput, pcrsUsed, child_index);
+	pcrsUsed->Release();
+
+	return pcrsRequired;
+}
+
+
 //---------------------------------------------------------------------------
 //	@function:
 //		CLogicalSequenceProject::PstatsDerive
@@ -383,7 +424,94 @@ CLogicalSequenceProject::PstatsDerive(CMemoryPool *mp,
 									  IStatisticsArray *  // stats_ctxt
 ) const
 {
-	return PstatsDeriveProject(mp, exprhdl);
+	IStatistics *stats = PstatsDeriveProject(mp, exprhdl);
+	if (!m_fLocal)
+	{
+		return stats;
+	}
+
+	// a local window only computes row_number() or rank(), so the filter on
+	// top of it is estimated on the ranks of the rows of each partition on
+	// each segment instead of a default selectivity
+	IStatistics *stats_ranked = PstatsRanked(mp, exprhdl, stats);
+	stats->Release();
+
+	return stats_ranked;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CLogicalSequenceProject::PstatsRanked
+//
+//	@doc:
+//		Give the ranking columns of a local window a histogram uniform over
+//		[1, n], where n is the number of rows of a partition on a segment
+//
+//---------------------------------------------------------------------------
+IStatistics *
+CLogicalSequenceProject::PstatsRanked(CMemoryPool *mp,
+									  CExpressionHandle &exprhdl,
+									  IStatistics *stats) const
+{
+	CStatistics *pstats = CStatistics::CastStats(stats);
+	CStatistics *pstatsChild = CStatistics::CastStats(exprhdl.Pstats(0));
+	const CDouble rows = pstats->Rows();
+
+	// number of partitions, the partition keys are assumed independent
+	CDouble dPartitions(1.0);
+	if (CDistributionSpec::EdtHashed == m_pds->Edt())
+	{
+		const CExpressionArray *pdrgpexpr =
+			CDistributionSpecHashed::PdsConvert(m_pds)->Pdrgpexpr();
+		for (ULONG ul = 0; ul < pdrgpexpr->Size(); ul++)
+		{
+			CExpression *pexpr = (*pdrgpexpr)[ul];
+			if (COperator::EopScalarIdent == pexpr->Pop()->Eopid())
+			{
+				CDouble dNDVs = pstatsChild->GetNDVs(
+					CScalarIdent::PopConvert(pexpr->Pop())->Pcr());
+				dPartitions = dPartitions * std::max(1.0, dNDVs.Get());
+			}
+		}
+	}
+
+	COptCtxt *poctxt = COptCtxt::PoctxtFromTLS();
+	const ULONG ulSegments = poctxt->GetCostModel()->UlHosts();
+	const CDouble dRanks = std::max(
+		1.0, std::floor((rows / (dPartitions * ulSegments)).Get()));
+
+	const IMDTypeInt8 *pmdtypeint8 =
+		poctxt->Pmda()->PtMDType<IMDTypeInt8>();
+	UlongToHistogramMap *histograms = pstats->CopyHistograms(mp);
+
+	CColRefSetIter crsi(*exprhdl.DeriveDefinedColumns(1));
+	while (crsi.Advance())
+	{
+		CColRef *colref = crsi.Pcr();
+		ULONG colid = colref->Id();
+		if (IMDType::EtiInt8 != colref->RetrieveType()->GetDatumType() ||
+			nullptr == histograms->Find(&colid))
+		{
+			continue;
+		}
+
+		CPoint *ppointLower = GPOS_NEW(mp)
+			CPoint(pmdtypeint8->CreateInt8Datum(mp, 1, false /*is_null*/));
+		CPoint *ppointUpper = GPOS_NEW(mp) CPoint(pmdtypeint8->CreateInt8Datum(
+			mp, (LINT) dRanks.Get(), false /*is_null*/));
+		CBucketArray *buckets = GPOS_NEW(mp) CBucketArray(mp);
+		buckets->Append(GPOS_NEW(mp) CBucket(
+			ppointLower, ppointUpper, true /*is_lower_closed*/,
+			true /*is_upper_closed*/, CDouble(1.0), dRanks));
+
+		(void) histograms->Replace(&colid,
+								   GPOS_NEW(mp) CHistogram(mp, buckets));
+	}
+
+	return GPOS_NEW(mp)
+		CStatistics(mp, histograms, pstats->CopyWidths(mp), rows,
+					pstats->IsEmpty(), pstats->GetNumberOfPredicates());
 }
 
 //---------------------------------------------------------------------------
@@ -406,6 +534,10 @@ CLogicalSequenceProject::OsPrint(IOstream &os) const
 	os << ", ";
 	os << "WindowFrame Spec:";
 	(void) CWindowFrame::OsPrint(os, m_pdrgpwf);
+	if (m_fLocal)
+	{
+		os << ", Local";
+	}
 
 	return os << ")";
 }
@@ -452,7 +584,8 @@ CLogicalSequenceProject::PopRemoveLocalOuterRefs(CMemoryPool *mp,
 	// we re-use the frame edges without changing here
 	m_pdrgpwf->AddRef();
 
-	return GPOS_NEW(mp) CLogicalSequenceProject(mp, pds, pdrgpos, m_pdrgpwf);
+	return GPOS_NEW(mp)
+		CLogicalSequenceProject(mp, pds, pdrgpos, m_pdrgpwf, m_fLocal);
 }
 
 // EOF
@@ -16,6 +16,7 @@
 #include "gpopt/base/CCastUtils.h"
 #include "gpopt/base/CColRefSetIter.h"
 #include "gpopt/base/CDistributionSpecHashed.h"
+#include "gpopt/base/CDistributionSpecHashedSkew.h"
 #include "gpopt/base/CDistributionSpecNonReplicated.h"
 #include "gpopt/base/CDistributionSpecNonSingleton.h"
 #include "gpopt/base/CDistributionSpecReplicated.h"
@@ -26,6 +27,9 @@
 #include "gpopt/operators/CPredicateUtils.h"
 #include "gpopt/operators/CScalarConst.h"
 #include "gpopt/operators/CScalarIdent.h"
+#include "naucrates/md/IMDType.h"
+#include "naucrates/statistics/CStatistics.h"
+#include "naucrates/traceflags/traceflags.h"
 
 using namespace gpopt;
 
@@ -35,6 +39,18 @@ using namespace gpopt;
 // maximum number of redistribute requests on single hash join keys
 #define GPOPT_MAX_HASH_DIST_REQUESTS 6
 
+// maximum number of heavy hitters routed apart by a hybrid redistribute
+#define GPOPT_MAX_SKEW_VALUES 8
+
+// a runtime filter has to drop at least 40% of the outer tuples
+#define GPOPT_RUNTIME_FILTER_RATE_THRESHOLD 0.6
+
+// minimum number of outer tuples without a match for a runtime filter
+#define GPOPT_RUNTIME_FILTER_MIN_UNMATCHED_ROWS 10000
+
+// number of bits of the largest runtime filter the executor builds
+#define GPOPT_RUNTIME_FILTER_MAX_BITS (16.0 * 1024 * 1024)
+
 //---------------------------------------------------------------------------
 //	@function:
 //		CPhysicalHashJoin::CPhysicalHashJoin
@@ -539,6 +555,13 @@ CPhysicalHashJoin::PdsDeriveForOuterJoin(CMemoryPool *mp,
 		}
 	}
 
+	if (CDistributionSpec::EdtHashedSkew == pds->Edt())
+	{
+		// rows with a skew value were spread randomly, the output is not
+		// hashed on the join keys
+		return GPOS_NEW(mp) CDistributionSpecRandom();
+	}
+
 	pds->AddRef();
 	return pds;
 }
@@ -804,6 +827,196 @@ CPhysicalHashJoin::PdsRequiredReplicate(
 }
 
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CPhysicalHashJoin::PdrgpexprSkewValues
+//
+//	@doc:
+//		Heavy hitters of the outer hash join key, taken from the singleton
+//		buckets of its histogram; a value is a heavy hitter if it alone has
+//		more rows than a segment would get under an even distribution.
+//		Return nullptr if the key has none, or if the join is not on a single
+//		column of the same type on both sides
+//
+//---------------------------------------------------------------------------
+CExpressionArray *
+CPhysicalHashJoin::PdrgpexprSkewValues(CMemoryPool *mp,
+									   CExpressionHandle &exprhdl,
+									   CDouble *pdSkewFreq) const
+{
+	GPOS_ASSERT(nullptr != pdSkewFreq);
+
+	if (1 != m_pdrgpexprOuterKeys->Size())
+	{
+		return nullptr;
+	}
+
+	CExpression *pexprOuter = (*m_pdrgpexprOuterKeys)[0];
+	CExpression *pexprInner = (*m_pdrgpexprInnerKeys)[0];
+	if (COperator::EopScalarIdent != pexprOuter->Pop()->Eopid() ||
+		COperator::EopScalarIdent != pexprInner->Pop()->Eopid())
+	{
+		return nullptr;
+	}
+
+	const CColRef *colrefOuter =
+		CScalarIdent::PopConvert(pexprOuter->Pop())->Pcr();
+	const CColRef *colrefInner =
+		CScalarIdent::PopConvert(pexprInner->Pop())->Pcr();
+	if (!colrefOuter->RetrieveType()->MDId()->Equals(
+			colrefInner->RetrieveType()->MDId()))
+	{
+		// the skew values have to hash the same way on both sides
+		return nullptr;
+	}
+
+	// distribution requests are computed on a group expression whose handle
+	// has no stats attached, take them from the outer child group instead
+	IStatistics *pstatsOuter = nullptr;
+	if (nullptr != exprhdl.Pstats())
+	{
+		pstatsOuter = exprhdl.Pstats(0);
+	}
+	else if (nullptr != exprhdl.Pgexpr())
+	{
+		pstatsOuter = (*exprhdl.Pgexpr())[0]->Pstats();
+	}
+
+	CStatistics *stats = dynamic_cast<CStatistics *>(pstatsOuter);
+	if (nullptr == stats)
+	{
+		return nullptr;
+	}
+
+	const CHistogram *histogram = stats->GetHistogram(colrefOuter->Id());
+	const ULONG ulSegments =
+		COptCtxt::PoctxtFromTLS()->GetCostModel()->UlHosts();
+	if (nullptr == histogram || 2 > ulSegments)
+	{
+		return nullptr;
+	}
+
+	const CDouble dThreshold(1.0 / ulSegments);
+	CExpressionArray *pdrgpexprSkew = GPOS_NEW(mp) CExpressionArray(mp);
+	CDouble dSkewFreq(0.0);
+
+	const CBucketArray *buckets = histogram->GetBuckets();
+	const ULONG ulBuckets = buckets->Size();
+	for (ULONG ul = 0;
+		 ul < ulBuckets && pdrgpexprSkew->Size() < GPOPT_MAX_SKEW_VALUES; ul++)
+	{
+		CBucket *bucket = (*buckets)[ul];
+		if (!bucket->IsSingleton() || bucket->GetFrequency() < dThreshold)
+		{
+			continue;
+		}
+
+		IDatum *datum = bucket->GetLowerBound()->GetDatum();
+		datum->AddRef();
+		pdrgpexprSkew->Append(
+			GPOS_NEW(mp) CExpression(mp, GPOS_NEW(mp) CScalarConst(mp, datum)));
+		dSkewFreq = dSkewFreq + bucket->GetFrequency();
+	}
+
+	// rows with a NULL key are skewed the same way
+	if (histogram->GetNullFreq() >= dThreshold &&
+		pdrgpexprSkew->Size() < GPOPT_MAX_SKEW_VALUES)
+	{
+		pdrgpexprSkew->Append(CUtils::PexprScalarConstNull(
+			mp, colrefOuter->RetrieveType(), colrefOuter->TypeModifier()));
+		dSkewFreq = dSkewFreq + histogram->GetNullFreq();
+	}
+
+	if (0 == pdrgpexprSkew->Size())
+	{
+		pdrgpexprSkew->Release();
+		return nullptr;
+	}
+
+	*pdSkewFreq = dSkewFreq;
+	return pdrgpexprSkew;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CPhysicalHashJoin::PdsRequiredHashedSkew
+//
+//	@doc:
+//		Create (hybrid redistribute, hybrid redistribute) optimization
+//		request; the inner child broadcasts the rows with a heavy hitter of
+//		the outer key, the outer child sends them to a random segment, and
+//		all other rows are hashed on the join keys. Every outer row then
+//		meets all its matching inner rows on exactly one segment.
+//		Fall back to redistributing on all the hash join keys if there are
+//		no heavy hitters.
+//
+//---------------------------------------------------------------------------
+CDistributionSpec *
+CPhysicalHashJoin::PdsRequiredHashedSkew(CMemoryPool *mp,
+										 CExpressionHandle &exprhdl,
+										 CDistributionSpec *pdsInput,
+										 ULONG child_index,
+										 CDrvdPropArray *pdrgpdpCtxt) const
+{
+	GPOS_ASSERT(EceoRightToLeft == Eceo());
+
+	const ULONG ulReqAllKeys = NumDistrReq() - 1;
+	if (FFirstChildToOptimize(child_index))
+	{
+		GPOS_ASSERT(1 == child_index);
+
+		// a not-in anti join needs to see all inner NULLs on every segment
+		CDouble dSkewFreq(0.0);
+		CExpressionArray *pdrgpexprSkew = nullptr;
+		if (EopPhysicalLeftAntiSemiHashJoinNotIn != Eopid())
+		{
+			pdrgpexprSkew = PdrgpexprSkewValues(mp, exprhdl, &dSkewFreq);
+		}
+
+		if (nullptr == pdrgpexprSkew)
+		{
+			return PdsRequiredRedistribute(mp, exprhdl, pdsInput, child_index,
+										   pdrgpdpCtxt, ulReqAllKeys);
+		}
+
+		m_pdrgpexprInnerKeys->AddRef();
+		if (nullptr != m_hash_opfamilies)
+		{
+			m_hash_opfamilies->AddRef();
+		}
+		return GPOS_NEW(mp) CDistributionSpecHashedSkew(
+			m_pdrgpexprInnerKeys, pdrgpexprSkew, true /* fBroadcast */,
+			dSkewFreq, m_hash_opfamilies);
+	}
+
+	GPOS_ASSERT(nullptr != pdrgpdpCtxt);
+	CDistributionSpec *pdsFirst =
+		CDrvdPropPlan::Pdpplan((*pdrgpdpCtxt)[0])->Pds();
+	GPOS_ASSERT(nullptr != pdsFirst);
+
+	if (CDistributionSpec::EdtHashedSkew != pdsFirst->Edt())
+	{
+		return PdsRequiredRedistribute(mp, exprhdl, pdsInput, child_index,
+									   pdrgpdpCtxt, ulReqAllKeys);
+	}
+
+	// require the outer child to spread the same skew values
+	CDistributionSpecHashedSkew *pdsSkewFirst =
+		CDistributionSpecHashedSkew::PdsConvert(pdsFirst);
+	CExpressionArray *pdrgpexprSkew = pdsSkewFirst->PdrgpexprSkew();
+	pdrgpexprSkew->AddRef();
+	m_pdrgpexprOuterKeys->AddRef();
+	if (nullptr != m_hash_opfamilies)
+	{
+		m_hash_opfamilies->AddRef();
+	}
+	return GPOS_NEW(mp) CDistributionSpecHashedSkew(
+		m_pdrgpexprOuterKeys, pdrgpexprSkew, false /* fBroadcast */,
+		pdsSkewFirst->DSkewFreq(), m_hash_opfamilies);
+}
+
+
 //---------------------------------------------------------------------------
 //	@function:
 //		CPhysicalHashJoin::PdshashedPassThru
@@ -959,6 +1172,7 @@ CPhysicalHashJoin::PdsRequiredRedistribute(CMemoryPool *mp,
 // 		Req(N + 1) (hashed, broadcast)
 // 		Req(N + 2) (non-singleton, broadcast)
 // 		Req(N + 3) (singleton, singleton)
+// 		Req(N + 4) (hybrid redistribute, hybrid redistribute), if enabled
 //
 //		we always check the distribution delivered by the first child (as
 //		given by child optimization order), and then match the delivered
@@ -1047,13 +1261,30 @@ CPhysicalHashJoin::Ped(CMemoryPool *mp, CExpressionHandle &exprhdl,
 		return GPOS_NEW(mp) CEnfdDistribution(pds, dmatch);
 	}
 
-	GPOS_ASSERT(ulOptReq == ulHashDistributeRequests + 2);
+	if (ulOptReq == ulHashDistributeRequests + 2)
+	{
+		// requests N+3 is (singleton, singleton)
 
-	// requests N+3 is (singleton, singleton)
+		return GPOS_NEW(mp) CEnfdDistribution(
+			PdsRequiredSingleton(mp, exprhdl, pdsInput, child_index,
+								 pdrgpdpCtxt),
+			dmatch);
+	}
 
-	return GPOS_NEW(mp) CEnfdDistribution(
-		PdsRequiredSingleton(mp, exprhdl, pdsInput, child_index, pdrgpdpCtxt),
-		dmatch);
+	GPOS_ASSERT(ulOptReq ==
+				ulHashDistributeRequests + GPOPT_NON_HASH_DIST_REQUESTS);
+
+	// request N+4 is (hybrid redistribute, hybrid redistribute)
+
+	CDistributionSpec *pds = PdsRequiredHashedSkew(
+		mp, exprhdl, pdsInput, child_index, pdrgpdpCtxt);
+	if (CDistributionSpec::EdtHashed == pds->Edt())
+	{
+		CDistributionSpecHashed *pdsHashed =
+			CDistributionSpecHashed::PdsConvert(pds);
+		pdsHashed->ComputeEquivHashExprs(mp, exprhdl);
+	}
+	return GPOS_NEW(mp) CEnfdDistribution(pds, dmatch);
 }
 
 //---------------------------------------------------------------------------
@@ -1240,8 +1471,13 @@ CPhysicalHashJoin::CreateOptRequests(CMemoryPool *mp)
 	// Req(N + 1) (hashed, broadcast)
 	// Req(N + 2) (non-singleton, broadcast)
 	// Req(N + 3) (singleton, singleton)
+	// Req(N + 4) (hybrid redistribute, hybrid redistribute), if enabled
 
 	ULONG ulDistrReqs = GPOPT_NON_HASH_DIST_REQUESTS + NumDistrReq();
+	if (GPOS_FTRACE(EopttraceEnableHybridRedistribute))
+	{
+		ulDistrReqs++;
+	}
 	SetDistrRequests(ulDistrReqs);
 
 	// With DP enabled, there are several (max 10 controlled by macro)
@@ -1436,4 +1672,104 @@ CPhysicalHashJoin::PppsDeriveForJoins(CMemoryPool *mp,
 
 	return pps_result;
 }
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CPhysicalHashJoin::DRuntimeFilterFPRate
+//
+//	@doc:
+//		Estimated false positive rate of a runtime filter built from the
+//		given number of inner tuples, following the empirical formula of the
+//		planner. The filter gets less selective as it fills up.
+//
+//---------------------------------------------------------------------------
+DOUBLE
+CPhysicalHashJoin::DRuntimeFilterFPRate(DOUBLE dRowsInner)
+{
+	if (dRowsInner > GPOPT_RUNTIME_FILTER_MAX_BITS / 1.6)
+	{
+		return 1.0;
+	}
+	if (dRowsInner > GPOPT_RUNTIME_FILTER_MAX_BITS / 2)
+	{
+		return 0.4;
+	}
+	if (dRowsInner > GPOPT_RUNTIME_FILTER_MAX_BITS / 2.5)
+	{
+		return 0.3;
+	}
+
+	return 0.1;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CPhysicalHashJoin::FRuntimeFilter
+//
+//	@doc:
+//		Check whether the outer tuples are worth filtering by a bloom filter
+//		of the inner hash keys before they are fed to the join. The given
+//		row counts are per segment. If a filter is worth it, the number of
+//		outer tuples passing it is returned in pdRowsFiltered.
+//
+//---------------------------------------------------------------------------
+BOOL
+CPhysicalHashJoin::FRuntimeFilter(DOUBLE dRowsOuter, DOUBLE dRowsInner,
+								  DOUBLE dRowsJoin,
+								  DOUBLE *pdRowsFiltered) const
+{
+	GPOS_ASSERT(nullptr != pdRowsFiltered);
+
+	*pdRowsFiltered = dRowsOuter;
+
+	// only inner and semi joins may drop the outer tuples without a match
+	if (!GPOS_FTRACE(EopttraceEnableRuntimeFilter) ||
+		(COperator::EopPhysicalInnerHashJoin != Eopid() &&
+		 COperator::EopPhysicalLeftSemiHashJoin != Eopid()))
+	{
+		return false;
+	}
+
+	// like the planner, only support hash keys passed by value
+	CMDAccessor *md_accessor = COptCtxt::PoctxtFromTLS()->Pmda();
+	for (ULONG ul = 0; ul < m_pdrgpexprOuterKeys->Size(); ul++)
+	{
+		CScalar *popOuterKey =
+			CScalar::PopConvert((*m_pdrgpexprOuterKeys)[ul]->Pop());
+		CScalar *popInnerKey =
+			CScalar::PopConvert((*m_pdrgpexprInnerKeys)[ul]->Pop());
+		if (!md_accessor->RetrieveType(popOuterKey->MdidType())
+				 ->IsPassedByValue() ||
+			!md_accessor->RetrieveType(popInnerKey->MdidType())
+				 ->IsPassedByValue())
+		{
+			return false;
+		}
+	}
+
+	const DOUBLE dFPRate = DRuntimeFilterFPRate(dRowsInner);
+	if (0.5 < dFPRate)
+	{
+		return false;
+	}
+
+	const DOUBLE dRowsMatched = std::min(dRowsOuter, dRowsJoin);
+	const DOUBLE dRowsUnmatched = dRowsOuter - dRowsMatched;
+	if (GPOPT_RUNTIME_FILTER_MIN_UNMATCHED_ROWS > dRowsUnmatched)
+	{
+		return false;
+	}
+
+	// the false positives of the filter pass it along with the matches
+	const DOUBLE dRowsFiltered = dRowsMatched + dRowsUnmatched * dFPRate;
+	if (dRowsOuter * GPOPT_RUNTIME_FILTER_RATE_THRESHOLD <= dRowsFiltered)
+	{
+		return false;
+	}
+
+	*pdRowsFiltered = dRowsFiltered;
+
+	return true;
+}
+
 // EOF
@@ -254,6 +254,13 @@ CPhysicalInnerHashJoin::PdsDerive(CMemoryPool *mp,
 		}
 	}
 
+	if (CDistributionSpec::EdtHashedSkew == pdsOuter->Edt())
+	{
+		// rows with a skew value were spread randomly, the output is not
+		// hashed on the join keys
+		return GPOS_NEW(mp) CDistributionSpecRandom();
+	}
+
 	// otherwise, pass through outer distribution
 	pdsOuter->AddRef();
 	return pdsOuter;
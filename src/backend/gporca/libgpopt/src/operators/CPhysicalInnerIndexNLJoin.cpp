@@ -35,10 +35,12 @@ using namespace gpopt;
 //---------------------------------------------------------------------------
 CPhysicalInnerIndexNLJoin::CPhysicalInnerIndexNLJoin(CMemoryPool *mp,
 													 CColRefArray *colref_array,
-													 CExpression *origJoinPred)
+													 CExpression *origJoinPred,
+													 BOOL fMemoizeInner)
 	: CPhysicalInnerNLJoin(mp),
 	  m_pdrgpcrOuterRefs(colref_array),
-	  m_origJoinPred(origJoinPred)
+	  m_origJoinPred(origJoinPred),
+	  m_fMemoizeInner(fMemoizeInner)
 {
 	GPOS_ASSERT(nullptr != colref_array);
 	if (nullptr != origJoinPred)
@@ -76,8 +78,11 @@ CPhysicalInnerIndexNLJoin::Matches(COperator *pop) const
 {
 	if (pop->Eopid() == Eopid())
 	{
-		return m_pdrgpcrOuterRefs->Equals(
-			CPhysicalInnerIndexNLJoin::PopConvert(pop)->PdrgPcrOuterRefs());
+		CPhysicalInnerIndexNLJoin *popIndexNLJoin =
+			CPhysicalInnerIndexNLJoin::PopConvert(pop);
+
+		return m_fMemoizeInner == popIndexNLJoin->FMemoizeInner() &&
+			   m_pdrgpcrOuterRefs->Equals(popIndexNLJoin->PdrgPcrOuterRefs());
 	}
 
 	return false;
@@ -178,4 +183,24 @@ CPhysicalInnerIndexNLJoin::Ped(CMemoryPool *mp, CExpressionHandle &exprhdl,
 }
 
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CPhysicalInnerIndexNLJoin::OsPrint
+//
+//	@doc:
+//		Debug print
+//
+//---------------------------------------------------------------------------
+IOstream &
+CPhysicalInnerIndexNLJoin::OsPrint(IOstream &os) const
+{
+	os << SzId();
+	if (m_fMemoizeInner)
+	{
+		os << " (Memoize Inner)";
+	}
+
+	return os;
+}
+
 // EOF
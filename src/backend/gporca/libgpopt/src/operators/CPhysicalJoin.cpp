@@ -456,6 +456,13 @@ CPhysicalJoin::PdsDerive(CMemoryPool *mp, CExpressionHandle &exprhdl) const
 		}
 	}
 
+	if (CDistributionSpec::EdtHashedSkew == pds->Edt())
+	{
+		// rows with a skew value were spread randomly, the output is not
+		// hashed on the join keys
+		return GPOS_NEW(mp) CDistributionSpecRandom();
+	}
+
 	pds->AddRef();
 	return pds;
 }
@@ -709,7 +716,7 @@ CPhysicalJoin::FMergeJoinCompatible(
 		// to send such requests.
 		// So, check that hash family used for distribution matches the default for
 		// its operands' types. This must match the operator using in
-		// CPhysicalFullMergeJoin::PosRequired().
+		// CPhysicalMergeJoin::PosRequired().
 		if (!CUtils::Equals(op->HashOpfamilyMdid(),
 							left_type->GetDistrOpfamilyMdid()) ||
 			!CUtils::Equals(op->HashOpfamilyMdid(),
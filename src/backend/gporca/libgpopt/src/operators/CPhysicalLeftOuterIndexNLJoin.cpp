@@ -20,10 +20,12 @@
 using namespace gpopt;
 
 CPhysicalLeftOuterIndexNLJoin::CPhysicalLeftOuterIndexNLJoin(
-	CMemoryPool *mp, CColRefArray *colref_array, CExpression *origJoinPred)
+	CMemoryPool *mp, CColRefArray *colref_array, CExpression *origJoinPred,
+	BOOL fMemoizeInner)
 	: CPhysicalLeftOuterNLJoin(mp),
 	  m_pdrgpcrOuterRefs(colref_array),
-	  m_origJoinPred(origJoinPred)
+	  m_origJoinPred(origJoinPred),
+	  m_fMemoizeInner(fMemoizeInner)
 {
 	GPOS_ASSERT(nullptr != colref_array);
 	if (nullptr != origJoinPred)
@@ -45,8 +47,11 @@ CPhysicalLeftOuterIndexNLJoin::Matches(COperator *pop) const
 {
 	if (pop->Eopid() == Eopid())
 	{
-		return m_pdrgpcrOuterRefs->Equals(
-			CPhysicalLeftOuterIndexNLJoin::PopConvert(pop)->PdrgPcrOuterRefs());
+		CPhysicalLeftOuterIndexNLJoin *popIndexNLJoin =
+			CPhysicalLeftOuterIndexNLJoin::PopConvert(pop);
+
+		return m_fMemoizeInner == popIndexNLJoin->FMemoizeInner() &&
+			   m_pdrgpcrOuterRefs->Equals(popIndexNLJoin->PdrgPcrOuterRefs());
 	}
 
 	return false;
@@ -178,5 +183,16 @@ CPhysicalLeftOuterIndexNLJoin::Ped(CMemoryPool *mp, CExpressionHandle &exprhdl,
 		CEnfdDistribution::EDistributionMatching::EdmSatisfy);
 }
 
+IOstream &
+CPhysicalLeftOuterIndexNLJoin::OsPrint(IOstream &os) const
+{
+	os << SzId();
+	if (m_fMemoizeInner)
+	{
+		os << " (Memoize Inner)";
+	}
+
+	return os;
+}
 
 // EOF
@@ -0,0 +1,36 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (c) 2023 VMware, Inc. or its affiliates. All Rights Reserved.
+//
+//	@filename:
+//		CPhysicalLeftOuterMergeJoin.cpp
+//
+//	@doc:
+//		Implementation of left outer merge join operator
+//---------------------------------------------------------------------------
+
+#include "gpopt/operators/CPhysicalLeftOuterMergeJoin.h"
+
+#include "gpos/base.h"
+
+using namespace gpopt;
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CPhysicalLeftOuterMergeJoin::CPhysicalLeftOuterMergeJoin
+//
+//	@doc:
+//		Ctor
+//
+//---------------------------------------------------------------------------
+CPhysicalLeftOuterMergeJoin::CPhysicalLeftOuterMergeJoin(
+	CMemoryPool *mp, CExpressionArray *outer_merge_clauses,
+	CExpressionArray *inner_merge_clauses, IMdIdArray *hash_opfamilies,
+	BOOL is_null_aware, CXform::EXformId origin_xform)
+	: CPhysicalMergeJoin(mp, outer_merge_clauses, inner_merge_clauses,
+						 hash_opfamilies, is_null_aware, origin_xform)
+{
+}
+
+// EOF
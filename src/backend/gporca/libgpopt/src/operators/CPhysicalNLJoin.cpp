@@ -202,5 +202,32 @@ CPhysicalNLJoin::EpetOrder(CExpressionHandle &exprhdl,
 	return CEnfdProp::EpetRequired;
 }
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CPhysicalNLJoin::DOuterRefsNDV
+//
+//	@doc:
+//		Estimate the number of distinct values of the outer references,
+//		which bounds the number of distinct parameter values the inner child
+//		is executed with
+//
+//---------------------------------------------------------------------------
+CDouble
+CPhysicalNLJoin::DOuterRefsNDV(IStatistics *outer_stats) const
+{
+	GPOS_ASSERT(nullptr != outer_stats);
+
+	CColRefArray *colref_array = PdrgPcrOuterRefs();
+	GPOS_ASSERT(nullptr != colref_array);
+
+	CDouble ndv(1.0);
+	for (ULONG ul = 0; ul < colref_array->Size(); ul++)
+	{
+		ndv = ndv * outer_stats->GetNDVs((*colref_array)[ul]);
+	}
+
+	return std::min(ndv, outer_stats->Rows());
+}
+
 
 // EOF
@@ -37,13 +37,15 @@ using namespace gpopt;
 CPhysicalSequenceProject::CPhysicalSequenceProject(CMemoryPool *mp,
 												   CDistributionSpec *pds,
 												   COrderSpecArray *pdrgpos,
-												   CWindowFrameArray *pdrgpwf)
+												   CWindowFrameArray *pdrgpwf,
+												   BOOL fLocal)
 	: CPhysical(mp),
 	  m_pds(pds),
 	  m_pdrgpos(pdrgpos),
 	  m_pdrgpwf(pdrgpwf),
 	  m_pos(nullptr),
-	  m_pcrsRequiredLocal(nullptr)
+	  m_pcrsRequiredLocal(nullptr),
+	  m_fLocal(fLocal)
 {
 	GPOS_ASSERT(nullptr != pds);
 	GPOS_ASSERT(nullptr != pdrgpos);
@@ -209,7 +211,8 @@ CPhysicalSequenceProject::Matches(COperator *pop) const
 	{
 		CPhysicalSequenceProject *popPhysicalSequenceProject =
 			CPhysicalSequenceProject::PopConvert(pop);
-		return m_pds->Matches(popPhysicalSequenceProject->Pds()) &&
+		return m_fLocal == popPhysicalSequenceProject->FLocal() &&
+			   m_pds->Matches(popPhysicalSequenceProject->Pds()) &&
 			   CWindowFrame::Equals(m_pdrgpwf,
 									popPhysicalSequenceProject->Pdrgpwf()) &&
 			   COrderSpec::Equals(m_pdrgpos,
@@ -231,7 +234,7 @@ CPhysicalSequenceProject::Matches(COperator *pop) const
 ULONG
 CPhysicalSequenceProject::HashValue() const
 {
-	ULONG ulHash = 0;
+	ULONG ulHash = gpos::HashValue<BOOL>(&m_fLocal);
 	ulHash = gpos::CombineHashes(ulHash, m_pds->HashValue());
 	ulHash = gpos::CombineHashes(
 		ulHash, CWindowFrame::HashValue(m_pdrgpwf, 3 /*ulMaxSize*/));
@@ -341,6 +344,13 @@ CPhysicalSequenceProject::PdsRequired(CMemoryPool *mp,
 			CDistributionSpecReplicated(CDistributionSpec::EdtStrictReplicated);
 	}
 
+	// a local window only pre-filters the rows of each segment, the global
+	// window above it sees all rows of a partition
+	if (m_fLocal)
+	{
+		return GPOS_NEW(mp) CDistributionSpecAny(this->Eopid());
+	}
+
 	// if the window operator has a partition by clause, then always
 	// request hashed distribution on the partition column
 	if (CDistributionSpec::EdtHashed == m_pds->Edt())
@@ -558,6 +568,10 @@ CPhysicalSequenceProject::OsPrint(IOstream &os) const
 	(void) COrderSpec::OsPrint(os, m_pdrgpos);
 	os << ", ";
 	(void) CWindowFrame::OsPrint(os, m_pdrgpwf);
+	if (m_fLocal)
+	{
+		os << ", Local";
+	}
 
 	return os << ")";
 }
@@ -14,6 +14,7 @@
 #include "gpos/base.h"
 
 #include "gpopt/base/CCTEMap.h"
+#include "gpopt/base/CDrvdPropPlan.h"
 #include "gpopt/base/COptCtxt.h"
 #include "gpopt/operators/CExpressionHandle.h"
 
@@ -28,12 +29,15 @@ using namespace gpopt;
 //		Ctor
 //
 //---------------------------------------------------------------------------
-CPhysicalSort::CPhysicalSort(CMemoryPool *mp, COrderSpec *pos)
+CPhysicalSort::CPhysicalSort(CMemoryPool *mp, COrderSpec *pos,
+							 ULONG ulPresortedKeys)
 	: CPhysical(mp),
 	  m_pos(pos),  // caller must add-ref pos
-	  m_pcrsSort(nullptr)
+	  m_pcrsSort(nullptr),
+	  m_ulPresortedKeys(ulPresortedKeys)
 {
 	GPOS_ASSERT(nullptr != pos);
+	GPOS_ASSERT(ulPresortedKeys < pos->UlSortColumns());
 
 	m_pcrsSort = Pos()->PcrsUsed(mp);
 }
@@ -71,7 +75,24 @@ CPhysicalSort::Matches(COperator *pop) const
 	}
 
 	CPhysicalSort *popSort = CPhysicalSort::PopConvert(pop);
-	return m_pos->Matches(popSort->Pos());
+	return m_ulPresortedKeys == popSort->UlPresortedKeys() &&
+		   m_pos->Matches(popSort->Pos());
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CPhysicalSort::HashValue
+//
+//	@doc:
+//		Operator specific hash function
+//
+//---------------------------------------------------------------------------
+ULONG
+CPhysicalSort::HashValue() const
+{
+	return gpos::CombineHashes(COperator::HashValue(),
+							   gpos::HashValue<ULONG>(&m_ulPresortedKeys));
 }
 
 
@@ -125,6 +146,13 @@ CPhysicalSort::PosRequired(CMemoryPool *mp,
 {
 	GPOS_ASSERT(0 == child_index);
 
+	if (FIncremental())
+	{
+		// incremental sort relies on the child to deliver the order on the
+		// presorted keys
+		return m_pos->PosPrefix(mp, m_ulPresortedKeys);
+	}
+
 	// sort operator is order-establishing and does not require child to deliver
 	// any sort order; we return an empty sort order as child requirement
 	return GPOS_NEW(mp) COrderSpec(mp);
@@ -162,7 +190,7 @@ CPhysicalSort::PdsRequired(CMemoryPool *mp, CExpressionHandle &exprhdl,
 //---------------------------------------------------------------------------
 CRewindabilitySpec *
 CPhysicalSort::PrsRequired(CMemoryPool *mp, CExpressionHandle &exprhdl,
-						   CRewindabilitySpec *,  //prsRequired,
+						   CRewindabilitySpec *prsRequired,
 						   ULONG
 #ifdef GPOS_DEBUG
 							   child_index
@@ -174,6 +202,16 @@ CPhysicalSort::PrsRequired(CMemoryPool *mp, CExpressionHandle &exprhdl,
 {
 	GPOS_ASSERT(0 == child_index);
 
+	if (FIncremental())
+	{
+		// incremental sort only holds one group of tuples at a time, so it
+		// is not blocking and has to pass on the motion hazard requirement
+		CRewindabilitySpec::ERewindabilityType ert =
+			exprhdl.HasOuterRefs(0) ? CRewindabilitySpec::ErtRescannable
+									: CRewindabilitySpec::ErtNone;
+		return GPOS_NEW(mp) CRewindabilitySpec(ert, prsRequired->Emht());
+	}
+
 	// Sort establishes rewindability on its own. It does not require motion
 	// hazard handling since it is inherently blocking. However, if it contains
 	// outer refs in its subtree, a Rescannable request should be sent, so that
@@ -280,10 +318,20 @@ CPhysicalSort::PdsDerive(CMemoryPool *,	 // mp
 //
 //---------------------------------------------------------------------------
 CRewindabilitySpec *
-CPhysicalSort::PrsDerive(CMemoryPool *mp,
-						 CExpressionHandle &  // exprhdl
-) const
+CPhysicalSort::PrsDerive(CMemoryPool *mp, CExpressionHandle &exprhdl) const
 {
+	if (FIncremental())
+	{
+		// incremental sort does not keep its output, it has to re-execute
+		// its child to be rescanned
+		CRewindabilitySpec *prsChild = PrsDerivePassThruOuter(mp, exprhdl);
+		CRewindabilitySpec *prs = GPOS_NEW(mp) CRewindabilitySpec(
+			CRewindabilitySpec::ErtRescannable, prsChild->Emht());
+		prsChild->Release();
+
+		return prs;
+	}
+
 	// rewindability of output is always true
 	return GPOS_NEW(mp) CRewindabilitySpec(CRewindabilitySpec::ErtMarkRestore,
 										   CRewindabilitySpec::EmhtNoMotion);
@@ -349,10 +397,20 @@ CPhysicalSort::EpetDistribution(CExpressionHandle & /*exprhdl*/,
 //
 //---------------------------------------------------------------------------
 CEnfdProp::EPropEnforcingType
-CPhysicalSort::EpetRewindability(CExpressionHandle &,		 // exprhdl
-								 const CEnfdRewindability *	 // per
-) const
+CPhysicalSort::EpetRewindability(CExpressionHandle &exprhdl,
+								 const CEnfdRewindability *per) const
 {
+	if (FIncremental())
+	{
+		CRewindabilitySpec *prs = CDrvdPropPlan::Pdpplan(exprhdl.Pdp())->Prs();
+		if (per->FCompatible(prs))
+		{
+			return CEnfdProp::EpetUnnecessary;
+		}
+
+		return CEnfdProp::EpetRequired;
+	}
+
 	// no need for enforcing rewindability on output
 	return CEnfdProp::EpetUnnecessary;
 }
@@ -369,6 +427,10 @@ IOstream &
 CPhysicalSort::OsPrint(IOstream &os) const
 {
 	os << SzId() << "  ";
+	if (FIncremental())
+	{
+		os << "(presorted keys: " << m_ulPresortedKeys << ") ";
+	}
 	return Pos()->OsPrint(os);
 }
 
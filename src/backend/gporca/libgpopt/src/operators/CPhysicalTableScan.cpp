@@ -34,9 +34,18 @@ using namespace gpopt;
 //---------------------------------------------------------------------------
 CPhysicalTableScan::CPhysicalTableScan(CMemoryPool *mp, const CName *pnameAlias,
 									   CTableDescriptor *ptabdesc,
-									   CColRefArray *pdrgpcrOutput)
-	: CPhysicalScan(mp, pnameAlias, ptabdesc, pdrgpcrOutput)
+									   CColRefArray *pdrgpcrOutput,
+									   ULONG ulParallelWorkers)
+	: CPhysicalScan(mp, pnameAlias, ptabdesc, pdrgpcrOutput),
+	  m_ulParallelWorkers(ulParallelWorkers)
 {
+	if (1 < m_ulParallelWorkers)
+	{
+		// the workers of a segment split its rows among them regardless of
+		// their distribution key values
+		m_pds->Release();
+		m_pds = GPOS_NEW(mp) CDistributionSpecRandom();
+	}
 }
 
 //---------------------------------------------------------------------------
@@ -54,6 +63,8 @@ CPhysicalTableScan::HashValue() const
 									   m_ptabdesc->MDId()->HashValue());
 	ulHash =
 		gpos::CombineHashes(ulHash, CUtils::UlHashColArray(m_pdrgpcrOutput));
+	ulHash = gpos::CombineHashes(
+		ulHash, gpos::HashValue<ULONG>(&m_ulParallelWorkers));
 
 	return ulHash;
 }
@@ -77,7 +88,8 @@ CPhysicalTableScan::Matches(COperator *pop) const
 
 	CPhysicalTableScan *popTableScan = CPhysicalTableScan::PopConvert(pop);
 	return m_ptabdesc->MDId()->Equals(popTableScan->Ptabdesc()->MDId()) &&
-		   m_pdrgpcrOutput->Equals(popTableScan->PdrgpcrOutput());
+		   m_pdrgpcrOutput->Equals(popTableScan->PdrgpcrOutput()) &&
+		   m_ulParallelWorkers == popTableScan->UlParallelWorkers();
 }
 
 
@@ -102,6 +114,11 @@ CPhysicalTableScan::OsPrint(IOstream &os) const
 	m_ptabdesc->Name().OsPrint(os);
 	os << ")";
 
+	if (1 < m_ulParallelWorkers)
+	{
+		os << ", Parallel Workers: " << m_ulParallelWorkers;
+	}
+
 	return os;
 }
 
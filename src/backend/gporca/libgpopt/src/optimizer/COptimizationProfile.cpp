@@ -0,0 +1,283 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (c) 2023 VMware, Inc. or its affiliates. All Rights Reserved.
+//
+//	@filename:
+//		COptimizationProfile.cpp
+//
+//	@doc:
+//		Implementation of optimization profile
+//---------------------------------------------------------------------------
+
+#include "gpopt/optimizer/COptimizationProfile.h"
+
+#include "gpopt/base/COptCtxt.h"
+
+using namespace gpopt;
+
+// names of the job types
+static const CHAR *rgszJobTypes[] = {
+	"Test",
+	"Group Optimization",
+	"Group Implementation",
+	"Group Exploration",
+	"Group Expression Optimization",
+	"Group Expression Implementation",
+	"Group Expression Exploration",
+	"Transformation",
+};
+
+GPOS_CPL_ASSERT(CJob::EjtSentinel == GPOS_ARRAY_SIZE(rgszJobTypes),
+				"job type names do not match job types");
+
+// names of the phases
+static const CHAR *rgszPhases[] = {
+	"Statistics Derivation",
+	"Metadata Lookup",
+	"Metadata Fetch",
+};
+
+GPOS_CPL_ASSERT(COptimizationProfile::EphSentinel ==
+					GPOS_ARRAY_SIZE(rgszPhases),
+				"phase names do not match phases");
+
+//---------------------------------------------------------------------------
+//	@function:
+//		COptimizationProfile::COptimizationProfile
+//
+//	@doc:
+//		Ctor
+//
+//---------------------------------------------------------------------------
+COptimizationProfile::COptimizationProfile()
+{
+	Reset();
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		COptimizationProfile::Reset
+//
+//	@doc:
+//		Reset all counters
+//
+//---------------------------------------------------------------------------
+void
+COptimizationProfile::Reset()
+{
+	m_ulGroups = 0;
+	m_ulGroupExprs = 0;
+	m_ulDuplicateGroups = 0;
+
+	for (ULONG ul = 0; ul < CXform::ExfSentinel; ul++)
+	{
+		m_rgullXformCalls[ul] = 0;
+		m_rgullXformTimes[ul] = 0;
+		m_rgullXformBindings[ul] = 0;
+		m_rgullXformResults[ul] = 0;
+	}
+
+	for (ULONG ul = 0; ul < CJob::EjtSentinel; ul++)
+	{
+		m_rgullJobCalls[ul] = 0;
+		m_rgullJobTimes[ul] = 0;
+	}
+
+	m_ulTopGroups = 0;
+
+	for (ULONG ul = 0; ul < EphSentinel; ul++)
+	{
+		m_rgullPhaseTimes[ul] = 0;
+		m_rgullPhaseCalls[ul] = 0;
+		m_rgulPhaseDepth[ul] = 0;
+	}
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		COptimizationProfile::RecordXform
+//
+//	@doc:
+//		Record an application of an xform to a group expression
+//
+//---------------------------------------------------------------------------
+void
+COptimizationProfile::RecordXform(CXform::EXformId exfid, ULONG ulTimeUS,
+								  ULONG ulBindings, ULONG ulResults)
+{
+	GPOS_ASSERT(CXform::ExfSentinel > exfid);
+
+	m_rgullXformCalls[exfid] += 1;
+	m_rgullXformTimes[exfid] += ulTimeUS;
+	m_rgullXformBindings[exfid] += ulBindings;
+	m_rgullXformResults[exfid] += ulResults;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		COptimizationProfile::RecordJob
+//
+//	@doc:
+//		Record the execution of a job, up to its completion or suspension
+//
+//---------------------------------------------------------------------------
+void
+COptimizationProfile::RecordJob(CJob::EJobType ejt, ULONG ulTimeUS)
+{
+	GPOS_ASSERT(CJob::EjtSentinel > ejt);
+
+	m_rgullJobCalls[ejt] += 1;
+	m_rgullJobTimes[ejt] += ulTimeUS;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		COptimizationProfile::RecordGroup
+//
+//	@doc:
+//		Record the job counters of a group; only the groups with the
+//		highest job time are kept
+//
+//---------------------------------------------------------------------------
+void
+COptimizationProfile::RecordGroup(ULONG ulId, ULLONG ullJobs, ULLONG ullTimeUS)
+{
+	// find the position of the group among the top groups
+	ULONG ulPos = m_ulTopGroups;
+	while (0 < ulPos && m_rggrpentry[ulPos - 1].m_ullTimeUS < ullTimeUS)
+	{
+		ulPos--;
+	}
+
+	if (GPOPT_PROFILE_TOP_GROUPS == ulPos)
+	{
+		return;
+	}
+
+	// shift the groups with less time, dropping the last one if full
+	if (GPOPT_PROFILE_TOP_GROUPS > m_ulTopGroups)
+	{
+		m_ulTopGroups++;
+	}
+
+	for (ULONG ul = m_ulTopGroups - 1; ul > ulPos; ul--)
+	{
+		m_rggrpentry[ul] = m_rggrpentry[ul - 1];
+	}
+
+	m_rggrpentry[ulPos].m_ulId = ulId;
+	m_rggrpentry[ulPos].m_ullJobs = ullJobs;
+	m_rggrpentry[ulPos].m_ullTimeUS = ullTimeUS;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		COptimizationProfile::RecordMemo
+//
+//	@doc:
+//		Record the size of the memo at the end of optimization; the sizes of
+//		the memos of consecutive optimizations add up
+//
+//---------------------------------------------------------------------------
+void
+COptimizationProfile::RecordMemo(ULONG ulGroups, ULONG ulGroupExprs,
+								 ULONG ulDuplicateGroups)
+{
+	m_ulGroups += ulGroups;
+	m_ulGroupExprs += ulGroupExprs;
+	m_ulDuplicateGroups += ulDuplicateGroups;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		COptimizationProfile::StartPhase
+//
+//	@doc:
+//		Enter a phase; the clock only starts at the outermost entry
+//
+//---------------------------------------------------------------------------
+void
+COptimizationProfile::StartPhase(EPhase eph)
+{
+	GPOS_ASSERT(EphSentinel > eph);
+
+	if (0 == m_rgulPhaseDepth[eph]++)
+	{
+		m_rgullPhaseCalls[eph] += 1;
+		m_rgclockPhase[eph].Restart();
+	}
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		COptimizationProfile::EndPhase
+//
+//	@doc:
+//		Leave a phase, adding the time since the outermost entry
+//
+//---------------------------------------------------------------------------
+void
+COptimizationProfile::EndPhase(EPhase eph)
+{
+	GPOS_ASSERT(EphSentinel > eph);
+	GPOS_ASSERT(0 < m_rgulPhaseDepth[eph]);
+
+	if (0 == --m_rgulPhaseDepth[eph])
+	{
+		m_rgullPhaseTimes[eph] += m_rgclockPhase[eph].ElapsedUS();
+	}
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		COptimizationProfile::PprofileFromTLS
+//
+//	@doc:
+//		Profile of the optimization running in the current task, if any
+//
+//---------------------------------------------------------------------------
+COptimizationProfile *
+COptimizationProfile::PprofileFromTLS()
+{
+	COptCtxt *poctxt = COptCtxt::PoctxtFromTLS();
+	if (nullptr == poctxt)
+	{
+		return nullptr;
+	}
+
+	return poctxt->Pprofile();
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		COptimizationProfile::SzJobType
+//
+//	@doc:
+//		Name of a job type
+//
+//---------------------------------------------------------------------------
+const CHAR *
+COptimizationProfile::SzJobType(CJob::EJobType ejt)
+{
+	GPOS_ASSERT(CJob::EjtSentinel > ejt);
+
+	return rgszJobTypes[ejt];
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		COptimizationProfile::SzPhase
+//
+//	@doc:
+//		Name of a phase
+//
+//---------------------------------------------------------------------------
+const CHAR *
+COptimizationProfile::SzPhase(EPhase eph)
+{
+	GPOS_ASSERT(EphSentinel > eph);
+
+	return rgszPhases[eph];
+}
+
+// EOF
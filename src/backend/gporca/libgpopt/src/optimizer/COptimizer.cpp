@@ -40,6 +40,7 @@
 #include "gpopt/translate/CTranslatorExprToDXL.h"
 #include "naucrates/base/CDatumGenericGPDB.h"
 #include "naucrates/dxl/operators/CDXLNode.h"
+#include "naucrates/dxl/xml/CDXLBinaryOstream.h"
 #include "naucrates/md/IMDProvider.h"
 #include "naucrates/traceflags/traceflags.h"
 
@@ -234,7 +235,8 @@ COptimizer::PdxlnOptimize(
 	ULONG ulHosts,	// actual number of data nodes in the system
 	ULONG ulSessionId, ULONG ulCmdId, CSearchStageArray *search_stage_array,
 	COptimizerConfig *optimizer_config,
-	const CHAR *szMinidumpFileName	// name of minidump file to be created
+	const CHAR *szMinidumpFileName,	 // name of minidump file to be created
+	COptimizationProfile *profile	 // profile to collect counters into
 )
 {
 	GPOS_ASSERT(nullptr != md_accessor);
@@ -250,6 +252,8 @@ COptimizer::PdxlnOptimize(
 	CMiniDumperDXL mdmp;
 	CAutoP<std::wofstream> wosMinidump;
 	CAutoP<COstreamBasic> osMinidump;
+	CAutoP<std::ofstream> bosMinidump;
+	CAutoP<CDXLBinaryOstream> osBinaryMinidump;
 	if (fMinidump)
 	{
 		CHAR file_name[GPOS_FILE_NAME_BUF_SIZE];
@@ -261,10 +265,24 @@ COptimizer::PdxlnOptimize(
 		// Note: std::wofstream won't throw an error on failure. The stream is merely marked as
 		// failed. We could check the state, and avoid the overhead of serializing the
 		// minidump if it failed, but it's hardly worth optimizing for an error case.
-		wosMinidump = GPOS_NEW(mp) std::wofstream(file_name);
-		osMinidump = GPOS_NEW(mp) COstreamBasic(wosMinidump.Value());
+		if (GPOS_FTRACE(EopttraceMinidumpBinary))
+		{
+			// the binary stream encodes the XML of the minidump sections
+			// as they are written
+			bosMinidump = GPOS_NEW(mp) std::ofstream(
+				file_name, std::ios_base::out | std::ios_base::binary);
+			osBinaryMinidump =
+				GPOS_NEW(mp) CDXLBinaryOstream(mp, *bosMinidump.Value());
+
+			mdmp.Init(osBinaryMinidump.Value());
+		}
+		else
+		{
+			wosMinidump = GPOS_NEW(mp) std::wofstream(file_name);
+			osMinidump = GPOS_NEW(mp) COstreamBasic(wosMinidump.Value());
 
-		mdmp.Init(osMinidump.Value());
+			mdmp.Init(osMinidump.Value());
+		}
 	}
 	CDXLNode *pdxlnPlan = nullptr;
 	CErrorHandlerStandard errhdl;
@@ -285,6 +303,7 @@ COptimizer::PdxlnOptimize(
 
 			// install opt context in TLS
 			CAutoOptCtxt aoc(mp, md_accessor, pceeval, optimizer_config);
+			COptCtxt::PoctxtFromTLS()->SetProfile(profile);
 
 			// translate DXL Tree -> Expr Tree
 			CTranslatorDXLToExpr dxltr(mp, md_accessor);
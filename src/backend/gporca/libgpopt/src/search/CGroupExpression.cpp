@@ -763,15 +763,17 @@ void
 CGroupExpression::Transform(
 	CMemoryPool *mp, CMemoryPool *pmpLocal, CXform *pxform,
 	CXformResult *pxfres,
-	ULONG *pulElapsedTime,	// output: elapsed time in millisecond
+	ULONG *pulElapsedTime,	// output: elapsed time in microseconds
 	ULONG *pulNumberOfBindings)
 {
 	GPOS_ASSERT(nullptr != pulElapsedTime);
 	GPOS_CHECK_ABORT;
 
-	BOOL fPrintOptStats = GPOS_FTRACE(EopttracePrintOptimizationStatistics);
+	// time the xform if optimization statistics are printed or profiled
+	BOOL fTimeXform = GPOS_FTRACE(EopttracePrintOptimizationStatistics) ||
+					  nullptr != COptCtxt::PoctxtFromTLS()->Pprofile();
 	CTimerUser timer;
-	if (fPrintOptStats)
+	if (fTimeXform)
 	{
 		timer.Restart();
 	}
@@ -781,9 +783,9 @@ CGroupExpression::Transform(
 	if (GPOPT_FDISABLED_XFORM(pxform->Exfid()) ||
 		!pxform->FCompatible(m_exfidOrigin))
 	{
-		if (fPrintOptStats)
+		if (fTimeXform)
 		{
-			*pulElapsedTime = timer.ElapsedMS();
+			*pulElapsedTime = timer.ElapsedUS();
 		}
 		return;
 	}
@@ -794,9 +796,9 @@ CGroupExpression::Transform(
 	exprhdl.DeriveProps(nullptr /*pdpctxt*/);
 	if (CXform::ExfpNone == pxform->Exfp(exprhdl))
 	{
-		if (GPOS_FTRACE(EopttracePrintOptimizationStatistics))
+		if (fTimeXform)
 		{
-			*pulElapsedTime = timer.ElapsedMS();
+			*pulElapsedTime = timer.ElapsedUS();
 		}
 		return;
 	}
@@ -844,9 +846,9 @@ CGroupExpression::Transform(
 	// post-prcoessing before applying xform to group expression
 	PostprocessTransform(pmpLocal, mp, pxform);
 
-	if (fPrintOptStats)
+	if (fTimeXform)
 	{
-		*pulElapsedTime = timer.ElapsedMS();
+		*pulElapsedTime = timer.ElapsedUS();
 	}
 }
 
@@ -45,6 +45,21 @@ CJobGroupExpression::Init(CGroupExpression *pgexpr)
 }
 
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CJobGroupExpression::Pgroup
+//
+//	@doc:
+//		Group of the target group expression
+//
+//---------------------------------------------------------------------------
+CGroup *
+CJobGroupExpression::Pgroup() const
+{
+	return m_pgexpr->Pgroup();
+}
+
+
 //---------------------------------------------------------------------------
 //	@function:
 //		CJobGroupExpression::ScheduleTransformations
@@ -160,6 +160,21 @@ CJobTransformation::FExecute(CSchedulerContext *psc)
 }
 
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CJobTransformation::Pgroup
+//
+//	@doc:
+//		Group of the target group expression
+//
+//---------------------------------------------------------------------------
+CGroup *
+CJobTransformation::Pgroup() const
+{
+	return m_pgexpr->Pgroup();
+}
+
+
 //---------------------------------------------------------------------------
 //	@function:
 //		CJobTransformation::ScheduleJob
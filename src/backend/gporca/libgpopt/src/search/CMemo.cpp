@@ -28,6 +28,7 @@
 #include "gpopt/exception.h"
 #include "gpopt/operators/CExpressionHandle.h"
 #include "gpopt/operators/CLogicalCTEProducer.h"
+#include "gpopt/optimizer/COptimizationProfile.h"
 #include "gpopt/search/CGroupProxy.h"
 
 using namespace gpopt;
@@ -437,6 +438,36 @@ CMemo::Pgroup(ULONG id)
 }
 
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CMemo::RecordProfile
+//
+//	@doc:
+//		Record the size of the memo and the job counters of its groups in
+//		the given profile
+//
+//---------------------------------------------------------------------------
+void
+CMemo::RecordProfile(COptimizationProfile *profile)
+{
+	GPOS_ASSERT(nullptr != profile);
+
+	profile->RecordMemo((ULONG) UlpGroups(), UlGrpExprs(),
+						UlDuplicateGroups());
+
+	CGroup *pgroup = m_listGroups.PtFirst();
+	while (nullptr != pgroup)
+	{
+		if (0 < pgroup->UllJobs())
+		{
+			profile->RecordGroup(pgroup->Id(), pgroup->UllJobs(),
+								 pgroup->UllJobTimeUS());
+		}
+		pgroup = m_listGroups.Next(pgroup);
+	}
+}
+
+
 //---------------------------------------------------------------------------
 //	@function:
 //		CMemo::MarkDuplicates
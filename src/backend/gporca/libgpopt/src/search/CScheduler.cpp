@@ -12,8 +12,12 @@
 #include "gpopt/search/CScheduler.h"
 
 #include "gpos/base.h"
+#include "gpos/common/CWallClock.h"
 #include "gpos/error/CAutoTrace.h"
 
+#include "gpopt/engine/CEngine.h"
+#include "gpopt/optimizer/COptimizationProfile.h"
+#include "gpopt/search/CGroup.h"
 #include "gpopt/search/CJobFactory.h"
 #include "gpopt/search/CSchedulerContext.h"
 #include "naucrates/traceflags/traceflags.h"
@@ -123,7 +127,7 @@ CScheduler::ExecuteJobs(CSchedulerContext *psc)
 		BOOL fCompleted = FExecute(pj, psc);
 
 #ifdef GPOS_DEBUG
-		// restrict parallelism to keep track of jobs
+		// keep track of running jobs
 		if (FTrackingJobs())
 		{
 			m_listjRunning.Remove(pj);
@@ -167,6 +171,12 @@ CScheduler::ExecuteJobs(CSchedulerContext *psc)
 		{
 			GPOS_CHECK_ABORT;
 			count = 0;
+
+			// once the time budget expires, the remaining jobs unwind
+			if (nullptr != psc->Peng())
+			{
+				psc->Peng()->CheckTimeBudget();
+			}
 		}
 	}
 }
@@ -304,7 +314,7 @@ CScheduler::FExecute(CJob *pj, CSchedulerContext *psc)
 	// check if job is associated to a job queue
 	if (nullptr == pjq)
 	{
-		fCompleted = pj->FExecute(psc);
+		fCompleted = FRun(pj, psc);
 	}
 	else
 	{
@@ -312,7 +322,7 @@ CScheduler::FExecute(CJob *pj, CSchedulerContext *psc)
 		{
 			case CJobQueue::EjqrMain:
 				// main job, runs job operation
-				fCompleted = pj->FExecute(psc);
+				fCompleted = FRun(pj, psc);
 				if (fCompleted)
 				{
 					// notify queued jobs
@@ -339,6 +349,46 @@ CScheduler::FExecute(CJob *pj, CSchedulerContext *psc)
 }
 
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CScheduler::FRun
+//
+//	@doc:
+//		Run the job's function; if the optimization is profiled, the time
+//		spent is recorded against the job type and the job's group. Once
+//		the search is stopped, the job completes without running.
+//
+//---------------------------------------------------------------------------
+BOOL
+CScheduler::FRun(CJob *pj, CSchedulerContext *psc)
+{
+	if (nullptr != psc->Peng() && psc->Peng()->FTimeBudgetExpired())
+	{
+		pj->Cleanup();
+		return true;
+	}
+
+	COptimizationProfile *profile = COptimizationProfile::PprofileFromTLS();
+	if (nullptr == profile)
+	{
+		return pj->FExecute(psc);
+	}
+
+	CWallClock clock;
+	BOOL fCompleted = pj->FExecute(psc);
+	ULONG ulTimeUS = clock.ElapsedUS();
+
+	profile->RecordJob(pj->Ejt(), ulTimeUS);
+	CGroup *pgroup = pj->Pgroup();
+	if (nullptr != pgroup)
+	{
+		pgroup->RecordJob(ulTimeUS);
+	}
+
+	return fCompleted;
+}
+
+
 //---------------------------------------------------------------------------
 //	@function:
 //		CScheduler::EjrPostExecute
@@ -21,9 +21,11 @@
 #include "gpos/common/CAutoTimer.h"
 #include "gpos/common/CHashMap.h"
 
+#include "gpopt/base/CCardinalityFingerprint.h"
 #include "gpopt/base/CCastUtils.h"
 #include "gpopt/base/CColRefSetIter.h"
 #include "gpopt/base/CConstraintInterval.h"
+#include "gpopt/base/CDistributionSpecHashedSkew.h"
 #include "gpopt/base/COptCtxt.h"
 #include "gpopt/base/CUtils.h"
 #include "gpopt/cost/ICostModel.h"
@@ -116,6 +118,7 @@
 #include "naucrates/dxl/operators/CDXLPhysicalIndexScan.h"
 #include "naucrates/dxl/operators/CDXLPhysicalLimit.h"
 #include "naucrates/dxl/operators/CDXLPhysicalMaterialize.h"
+#include "naucrates/dxl/operators/CDXLPhysicalMemoize.h"
 #include "naucrates/dxl/operators/CDXLPhysicalMergeJoin.h"
 #include "naucrates/dxl/operators/CDXLPhysicalNLJoin.h"
 #include "naucrates/dxl/operators/CDXLPhysicalPartitionSelector.h"
@@ -537,6 +540,8 @@ CTranslatorExprToDXL::CreateDXLNode(CExpression *pexpr,
 				pfDML);
 			break;
 		case COperator::EopPhysicalFullMergeJoin:
+		case COperator::EopPhysicalInnerMergeJoin:
+		case COperator::EopPhysicalLeftOuterMergeJoin:
 			dxlnode = CTranslatorExprToDXL::PdxlnMergeJoin(
 				pexpr, colref_array, pdrgpdsBaseTables, pulNonGatherMotions,
 				pfDML);
@@ -709,7 +714,8 @@ CTranslatorExprToDXL::PdxlnTblScan(CExpression *pexprTblScan,
 	COperator::EOperatorId op_id = pexprTblScan->Pop()->Eopid();
 	if (COperator::EopPhysicalTableScan == op_id)
 	{
-		pdxlopTS = GPOS_NEW(m_mp) CDXLPhysicalTableScan(m_mp, table_descr);
+		pdxlopTS = GPOS_NEW(m_mp) CDXLPhysicalTableScan(
+			m_mp, table_descr, popTblScan->UlParallelWorkers());
 	}
 	else
 	{
@@ -3138,8 +3144,8 @@ CTranslatorExprToDXL::PdxlnSort(CExpression *pexprSort,
 	CDXLNode *filter_dxlnode = PdxlnFilter(nullptr);
 
 	// construct a sort node
-	CDXLPhysicalSort *pdxlopSort =
-		GPOS_NEW(m_mp) CDXLPhysicalSort(m_mp, false /*discard_duplicates*/);
+	CDXLPhysicalSort *pdxlopSort = GPOS_NEW(m_mp) CDXLPhysicalSort(
+		m_mp, false /*discard_duplicates*/, popSort->UlPresortedKeys());
 
 	// construct sort node from its components
 	CDXLNode *pdxlnSort = GPOS_NEW(m_mp) CDXLNode(m_mp, pdxlopSort);
@@ -4399,6 +4405,16 @@ CTranslatorExprToDXL::PdxlnNLJoin(CExpression *pexprInnerNLJ,
 				md_name, col_ref->Id(), mdid, col_ref->TypeModifier());
 			col_refs->Append(colref_dxl);
 		}
+
+		// the inner child is cached by the values of the nest params
+		CPhysicalNLJoin *popNLJ = CPhysicalNLJoin::PopConvert(pop);
+		if (popNLJ->FMemoizeInner())
+		{
+			pdxlnInnerChild = PdxlnMemoize(
+				pdxlnInnerChild, outer_refs,
+				popNLJ->DOuterRefsNDV(
+					const_cast<IStatistics *>(pexprOuterChild->Pstats())));
+		}
 	}
 
 	// construct a join node
@@ -4457,6 +4473,14 @@ CTranslatorExprToDXL::PdxlnMergeJoin(CExpression *pexprMJ,
 			join_type = EdxljtFull;
 			break;
 
+		case COperator::EopPhysicalInnerMergeJoin:
+			join_type = EdxljtInner;
+			break;
+
+		case COperator::EopPhysicalLeftOuterMergeJoin:
+			join_type = EdxljtLeft;
+			break;
+
 		default:
 			GPOS_ASSERT(!"Invalid join type");
 	}
@@ -4472,15 +4496,26 @@ CTranslatorExprToDXL::PdxlnMergeJoin(CExpression *pexprMJ,
 	CDXLNode *dxlnode_merge_conds = GPOS_NEW(m_mp)
 		CDXLNode(m_mp, GPOS_NEW(m_mp) CDXLScalarMergeCondList(m_mp));
 
+	// predicates that are not merge clauses are evaluated as a join filter
+	CExpressionArray *pdrgpexprRemainingPredicates =
+		GPOS_NEW(m_mp) CExpressionArray(m_mp);
+
 	CExpressionArray *pdrgpexprPredicates =
 		CPredicateUtils::PdrgpexprConjuncts(m_mp, pexprScalar);
 	const ULONG length = pdrgpexprPredicates->Size();
 	for (ULONG ul = 0; ul < length; ul++)
 	{
 		CExpression *pexprPred = (*pdrgpexprPredicates)[ul];
-		// At this point, they all better be merge joinable
-		GPOS_ASSERT(CPhysicalJoin::FMergeJoinCompatible(
-			pexprPred, pexprOuterChild, pexprInnerChild));
+		if (!CPhysicalJoin::FMergeJoinCompatible(pexprPred, pexprOuterChild,
+												 pexprInnerChild))
+		{
+			// all the predicates of a full merge join are merge clauses
+			GPOS_ASSERT(EdxljtFull != join_type);
+			pexprPred->AddRef();
+			pdrgpexprRemainingPredicates->Append(pexprPred);
+			continue;
+		}
+
 		CExpression *pexprPredOuter = (*pexprPred)[0];
 		CExpression *pexprPredInner = (*pexprPred)[1];
 
@@ -4534,10 +4569,24 @@ CTranslatorExprToDXL::PdxlnMergeJoin(CExpression *pexprMJ,
 	CDXLPhysicalProperties *dxl_properties = GetProperties(pexprMJ);
 	pdxlnMJ->SetProperties(dxl_properties);
 
-	// construct an empty plan filter and join filter
+	// construct an empty plan filter
 	CDXLNode *filter_dxlnode = PdxlnFilter(nullptr);
+
+	// construct the join filter from the remaining predicates
 	CDXLNode *dxlnode_join_filter = GPOS_NEW(m_mp)
 		CDXLNode(m_mp, GPOS_NEW(m_mp) CDXLScalarJoinFilter(m_mp));
+	if (0 < pdrgpexprRemainingPredicates->Size())
+	{
+		CExpression *pexprJoinCond = CPredicateUtils::PexprConjunction(
+			m_mp, pdrgpexprRemainingPredicates);
+		CDXLNode *pdxlnJoinCond = PdxlnScalar(pexprJoinCond);
+		dxlnode_join_filter->AddChild(pdxlnJoinCond);
+		pexprJoinCond->Release();
+	}
+	else
+	{
+		pdrgpexprRemainingPredicates->Release();
+	}
 
 	// add children
 	pdxlnMJ->AddChild(proj_list_dxlnode);
@@ -4702,9 +4751,16 @@ CTranslatorExprToDXL::PdxlnHashJoin(CExpression *pexprHJ,
 		pdrgpexprRemainingPredicates->Release();
 	}
 
+	// filter the outer tuples by the inner hash keys if the cost model
+	// expected it to pay off
+	DOUBLE dRowsFiltered = 0;
+	BOOL runtime_filter = popHJ->FRuntimeFilter(
+		DRowsPerSegment(pexprOuterChild), DRowsPerSegment(pexprInnerChild),
+		DRowsPerSegment(pexprHJ), &dRowsFiltered);
+
 	// construct a hash join node
 	CDXLPhysicalHashJoin *pdxlopHJ =
-		GPOS_NEW(m_mp) CDXLPhysicalHashJoin(m_mp, join_type);
+		GPOS_NEW(m_mp) CDXLPhysicalHashJoin(m_mp, join_type, runtime_filter);
 
 	// construct projection list from required columns
 	GPOS_ASSERT(nullptr != pexprHJ->Prpp());
@@ -4800,6 +4856,20 @@ CTranslatorExprToDXL::PdxlnMotion(CExpression *pexprMotion,
 			// CDXLPhysicalRedistributeMotion::is_duplicate_sensitive is set to
 			// decide whether the motion should be translated into result hash
 			// filter node or redistribute motion.
+			if (CDistributionSpec::EdtHashedSkew ==
+				CPhysicalMotion::PopConvert(pexprMotion->Pop())->Pds()->Edt())
+			{
+				// hybrid redistribute, routing the skew values apart
+				GPOS_ASSERT(!fDuplicateHazardMotion);
+				CDistributionSpecHashedSkew *pdsSkew =
+					CDistributionSpecHashedSkew::PdsConvert(
+						CPhysicalMotion::PopConvert(pexprMotion->Pop())
+							->Pds());
+				motion = GPOS_NEW(m_mp) CDXLPhysicalRedistributeMotion(
+					m_mp, false /*is_duplicate_sensitive*/,
+					true /*has_skew_values*/, pdsSkew->FBroadcast());
+				break;
+			}
 			motion = GPOS_NEW(m_mp)
 				CDXLPhysicalRedistributeMotion(m_mp, fDuplicateHazardMotion);
 			break;
@@ -4874,6 +4944,27 @@ CTranslatorExprToDXL::PdxlnMotion(CExpression *pexprMotion,
 
 	pdxlnMotion->AddChild(child_dxlnode);
 
+	if (COperator::EopPhysicalMotionHashDistribute ==
+			pexprMotion->Pop()->Eopid() &&
+		CDistributionSpec::EdtHashedSkew ==
+			CPhysicalMotion::PopConvert(pexprMotion->Pop())->Pds()->Edt())
+	{
+		// construct the list of skew values
+		CExpressionArray *pdrgpexprSkew =
+			CDistributionSpecHashedSkew::PdsConvert(
+				CPhysicalMotion::PopConvert(pexprMotion->Pop())->Pds())
+				->PdrgpexprSkew();
+		CDXLNode *skew_values_list_dxlnode = GPOS_NEW(m_mp)
+			CDXLNode(m_mp, GPOS_NEW(m_mp) CDXLScalarValuesList(m_mp));
+		const ULONG size = pdrgpexprSkew->Size();
+		for (ULONG ul = 0; ul < size; ul++)
+		{
+			skew_values_list_dxlnode->AddChild(
+				PdxlnScConst((*pdrgpexprSkew)[ul]));
+		}
+		pdxlnMotion->AddChild(skew_values_list_dxlnode);
+	}
+
 #ifdef GPOS_DEBUG
 	motion->AssertValid(pdxlnMotion, false /* validate_children */);
 #endif
@@ -6931,6 +7022,36 @@ CTranslatorExprToDXL::MakeDXLTableDescr(
 	return table_descr;
 }
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CTranslatorExprToDXL::DRowsPerSegment
+//
+//	@doc:
+//		Number of rows the given expression produces per segment, scaled the
+//		same way as the rows the cost model costs it with
+//
+//---------------------------------------------------------------------------
+DOUBLE
+CTranslatorExprToDXL::DRowsPerSegment(const CExpression *pexpr)
+{
+	// stats may not be present in artificially generated physical expression
+	// trees, which are not costed either
+	const IStatistics *stats = pexpr->Pstats();
+	if (nullptr == stats)
+	{
+		return 0.0;
+	}
+
+	CDouble rows = stats->Rows();
+	if (CDistributionSpec::EdptPartitioned ==
+		pexpr->GetDrvdPropPlan()->Pds()->Edpt())
+	{
+		rows = COptCtxt::PoctxtFromTLS()->GetCostModel()->DRowsPerHost(rows);
+	}
+
+	return rows.Get();
+}
+
 //---------------------------------------------------------------------------
 //	@function:
 //		CTranslatorExprToDXL::GetProperties
@@ -6994,6 +7115,23 @@ CTranslatorExprToDXL::GetProperties(const CExpression *pexpr)
 
 	CDXLOperatorCost *cost = GPOS_NEW(m_mp) CDXLOperatorCost(
 		pstrStartupcost, pstrTotalcost, rows_out_str, width_str);
+
+	// tag the operator with the fingerprint of its group, so the executor
+	// can report the rows it produced; the rows of motions and of
+	// replicated operators do not add up to the rows of their group
+	// across segments
+	CDistributionSpec::EDistributionType edt =
+		pexpr->GetDrvdPropPlan()->Pds()->Edt();
+	if (GPOS_FTRACE(EopttraceEnableCardinalityFeedback) &&
+		nullptr != pexpr->Pgexpr() && !CUtils::FPhysicalMotion(pexpr->Pop()) &&
+		CDistributionSpec::EdtStrictReplicated != edt &&
+		CDistributionSpec::EdtTaintedReplicated != edt &&
+		CDistributionSpec::EdtUniversal != edt)
+	{
+		cost->SetCardinalityFingerprint(
+			CCardinalityFingerprint::UllFingerprint(pexpr->Pgexpr()->Pgroup()));
+	}
+
 	CDXLPhysicalProperties *dxl_properties =
 		GPOS_NEW(m_mp) CDXLPhysicalProperties(cost);
 
@@ -7730,6 +7868,40 @@ CTranslatorExprToDXL::PdxlnMaterialize(
 	return pdxlnMaterialize;
 }
 
+CDXLNode *
+CTranslatorExprToDXL::PdxlnMemoize(
+	CDXLNode *dxlnode,		   // node whose results are cached
+	CColRefArray *outer_refs,  // outer references to cache the results by
+	CDouble num_distinct	   // estimated number of distinct cache keys
+)
+{
+	GPOS_ASSERT(nullptr != dxlnode);
+	GPOS_ASSERT(nullptr != dxlnode->GetProperties());
+	GPOS_ASSERT(nullptr != outer_refs && 0 < outer_refs->Size());
+
+	CDXLPhysicalMemoize *pdxlopMemoize = GPOS_NEW(m_mp) CDXLPhysicalMemoize(
+		m_mp, CUtils::Pdrgpul(m_mp, outer_refs), num_distinct);
+	CDXLNode *pdxlnMemoize = GPOS_NEW(m_mp) CDXLNode(m_mp, pdxlopMemoize);
+	CDXLPhysicalProperties *pdxlpropChild =
+		CDXLPhysicalProperties::PdxlpropConvert(dxlnode->GetProperties());
+	pdxlpropChild->AddRef();
+	pdxlnMemoize->SetProperties(pdxlpropChild);
+
+	// construct an empty filter node
+	CDXLNode *filter_dxlnode = PdxlnFilter(nullptr /* pdxlnCond */);
+
+	CDXLNode *pdxlnProjListChild = (*dxlnode)[0];
+	CDXLNode *proj_list_dxlnode =
+		CTranslatorExprToDXLUtils::PdxlnProjListFromChildProjList(
+			m_mp, m_pcf, m_phmcrdxln, pdxlnProjListChild);
+
+	// add children
+	pdxlnMemoize->AddChild(proj_list_dxlnode);
+	pdxlnMemoize->AddChild(filter_dxlnode);
+	pdxlnMemoize->AddChild(dxlnode);
+	return pdxlnMemoize;
+}
+
 BOOL
 CTranslatorExprToDXL::FNeedsMaterializeUnderResult(CDXLNode *proj_list_dxlnode,
 												   CDXLNode *child_dxlnode)
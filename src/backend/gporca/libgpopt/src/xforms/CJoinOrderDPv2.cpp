@@ -73,6 +73,7 @@ CJoinOrderDPv2::CJoinOrderDPv2(CMemoryPool *mp,
 	  m_on_pred_conjuncts(onPredConjuncts),
 	  m_child_pred_indexes(childPredIndexes),
 	  m_non_inner_join_dependencies(nullptr),
+	  m_inner_join_neighbors(nullptr),
 	  m_cross_prod_penalty(GPOPT_DPV2_CROSS_JOIN_DEFAULT_PENALTY),
 	  m_outer_refs(outerRefs)
 {
@@ -100,6 +101,28 @@ CJoinOrderDPv2::CJoinOrderDPv2(CMemoryPool *mp,
 		);
 
 	m_mp = mp;
+
+	// record which atoms are connected by inner join predicates, this lets
+	// us rule out bushy cross products without building their predicates
+	m_inner_join_neighbors = GPOS_NEW(mp) CBitSetArray(mp, m_ulComps);
+	for (ULONG ul = 0; ul < m_ulComps; ul++)
+	{
+		m_inner_join_neighbors->Append(GPOS_NEW(mp) CBitSet(mp));
+	}
+	for (ULONG en = 0; en < m_ulEdges; en++)
+	{
+		SEdge *pedge = m_rgpedge[en];
+
+		if (0 == pedge->m_loj_num)
+		{
+			CBitSetIter iter(*pedge->m_pbs);
+			while (iter.Advance())
+			{
+				(*m_inner_join_neighbors)[iter.Bit()]->Union(pedge->m_pbs);
+			}
+		}
+	}
+
 	if (0 < m_on_pred_conjuncts->Size())
 	{
 		// we have non-inner joins, add dependency info
@@ -153,6 +176,7 @@ CJoinOrderDPv2::~CJoinOrderDPv2()
 	// we can save time in optimized build by skipping all de-allocations here,
 	// we still have all de-allocations enabled in debug-build to detect any possible leaks
 	CRefCount::SafeRelease(m_non_inner_join_dependencies);
+	CRefCount::SafeRelease(m_inner_join_neighbors);
 	CRefCount::SafeRelease(m_child_pred_indexes);
 	m_bitset_to_group_info_map->Release();
 	CRefCount::SafeRelease(m_expression_to_edge_map);
@@ -210,6 +234,31 @@ CJoinOrderDPv2::ComputeCost(SExpressionInfo *expr_info,
 }
 
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CJoinOrderDPv2::GetInnerJoinNeighbors
+//
+//	@doc:
+//		Return the atoms sharing an inner join predicate with any of the
+//		given atoms. A group whose atoms are disjoint from the result has
+//		no inner join predicate with the given atoms.
+//
+//---------------------------------------------------------------------------
+CBitSet *
+CJoinOrderDPv2::GetInnerJoinNeighbors(CBitSet *atoms)
+{
+	CBitSet *neighbors = GPOS_NEW(m_mp) CBitSet(m_mp);
+	CBitSetIter iter(*atoms);
+
+	while (iter.Advance())
+	{
+		neighbors->Union((*m_inner_join_neighbors)[iter.Bit()]);
+	}
+
+	return neighbors;
+}
+
+
 //---------------------------------------------------------------------------
 //	@function:
 //		CJoinOrderDPv2::PexprBuildInnerJoinPred
@@ -1039,6 +1088,16 @@ CJoinOrderDPv2::SearchJoinOrders(ULONG left_level, ULONG right_level)
 		CBitSet *left_bitset = left_group_info->m_atoms;
 		ULONG right_ix = 0;
 
+		// a non-atom on the right can't be the right child of an NIJ and
+		// we don't do bushy cross products, so it has to share an inner
+		// join predicate with the left side; check this up front instead
+		// of building join expressions only to discard them
+		CBitSet *left_neighbors = nullptr;
+		if (1 < right_level)
+		{
+			left_neighbors = GetInnerJoinNeighbors(left_bitset);
+		}
+
 		// if pairs from the same level, start from the next
 		// entry to avoid duplicate join combinations
 		// i.e a join b and b join a, just try one
@@ -1061,6 +1120,13 @@ CJoinOrderDPv2::SearchJoinOrders(ULONG left_level, ULONG right_level)
 				continue;
 			}
 
+			if (nullptr != left_neighbors &&
+				left_neighbors->IsDisjoint(right_bitset))
+			{
+				// not a valid join, this would be a bushy cross product
+				continue;
+			}
+
 			SExpressionProperties reqd_properties(EJoinOrderDP);
 			SExpressionInfo *join_expr_info = GetJoinExprForProperties(
 				left_group_info, right_group_info, reqd_properties);
@@ -1133,6 +1199,7 @@ CJoinOrderDPv2::SearchJoinOrders(ULONG left_level, ULONG right_level)
 				}
 			}
 		}
+		CRefCount::SafeRelease(left_neighbors);
 	}
 }
 
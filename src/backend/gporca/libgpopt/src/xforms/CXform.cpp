@@ -218,6 +218,22 @@ CXform::PbsHashJoinXforms(CMemoryPool *mp)
 	return pbs;
 }
 
+//	returns a set containing all xforms that generate a plan with merge join
+//	Caller takes ownership of the returned set
+CBitSet *
+CXform::PbsMergeJoinXforms(CMemoryPool *mp)
+{
+	CBitSet *pbs = GPOS_NEW(mp) CBitSet(mp, EopttraceSentinel);
+
+	(void) pbs->ExchangeSet(
+		GPOPT_DISABLE_XFORM_TF(CXform::ExfImplementFullOuterMergeJoin));
+	(void) pbs->ExchangeSet(
+		GPOPT_DISABLE_XFORM_TF(CXform::ExfInnerJoin2MergeJoin));
+	(void) pbs->ExchangeSet(
+		GPOPT_DISABLE_XFORM_TF(CXform::ExfLeftOuterJoin2MergeJoin));
+	return pbs;
+}
+
 CBitSet *
 CXform::PbsJoinOrderInQueryXforms(CMemoryPool *mp)
 {
@@ -302,6 +302,12 @@ CXformFactory::Instantiate()
 	Add(GPOS_NEW(m_mp) CXformLimit2IndexOnlyGet(m_mp));
 	Add(GPOS_NEW(m_mp) CXformFullOuterJoin2HashJoin(m_mp));
 	Add(GPOS_NEW(m_mp) CXformFullJoinCommutativity(m_mp));
+	Add(GPOS_NEW(m_mp) CXformInnerJoin2MergeJoin(m_mp));
+	Add(GPOS_NEW(m_mp) CXformLeftOuterJoin2MergeJoin(m_mp));
+	Add(GPOS_NEW(m_mp) CXformSelect2MatView(m_mp));
+	Add(GPOS_NEW(m_mp) CXformGbAgg2MatView(m_mp));
+	Add(GPOS_NEW(m_mp) CXformGbAggWithSelect2MatView(m_mp));
+	Add(GPOS_NEW(m_mp) CXformSplitWindowRankFilter(m_mp));
 
 	GPOS_ASSERT(nullptr != m_rgpxf[CXform::ExfSentinel - 1] &&
 				"Not all xforms have been instantiated");
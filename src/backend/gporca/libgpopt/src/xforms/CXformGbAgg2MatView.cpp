@@ -0,0 +1,89 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (c) 2023 VMware, Inc. or its affiliates. All Rights Reserved.
+//
+//	@filename:
+//		CXformGbAgg2MatView.cpp
+//
+//	@doc:
+//		Implementation of answering an aggregate over a table from a
+//		materialized view
+//---------------------------------------------------------------------------
+
+#include "gpopt/xforms/CXformGbAgg2MatView.h"
+
+#include "gpos/base.h"
+
+#include "gpopt/operators/CLogicalGbAgg.h"
+#include "gpopt/operators/CLogicalGet.h"
+#include "gpopt/operators/CPatternTree.h"
+#include "naucrates/traceflags/traceflags.h"
+
+using namespace gpopt;
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CXformGbAgg2MatView::CXformGbAgg2MatView
+//
+//	@doc:
+//		Ctor
+//
+//---------------------------------------------------------------------------
+CXformGbAgg2MatView::CXformGbAgg2MatView(CMemoryPool *mp)
+	:  // pattern
+	  CXformMatViewRewrite(GPOS_NEW(mp) CExpression(
+		  mp, GPOS_NEW(mp) CLogicalGbAgg(mp),
+		  GPOS_NEW(mp) CExpression(
+			  mp, GPOS_NEW(mp) CLogicalGet(mp)),  // relational child
+		  GPOS_NEW(mp)
+			  CExpression(mp, GPOS_NEW(mp) CPatternTree(mp))  // project list
+		  ))
+{
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CXformGbAgg2MatView::Exfp
+//
+//	@doc:
+//		Compute xform promise for a given expression handle; only global
+//		aggregates without distinct aggregates or outer references are
+//		matched
+//
+//---------------------------------------------------------------------------
+CXform::EXformPromise
+CXformGbAgg2MatView::Exfp(CExpressionHandle &exprhdl) const
+{
+	if (!GPOS_FTRACE(EopttraceEnableMatViewRewrite) ||
+		!CLogicalGbAgg::PopConvert(exprhdl.Pop())->FGlobal() ||
+		0 < exprhdl.DeriveTotalDistinctAggs(1) ||
+		0 < exprhdl.DeriveOuterReferences()->Size() ||
+		exprhdl.DeriveHasSubquery(1))
+	{
+		return CXform::ExfpNone;
+	}
+
+	return CXform::ExfpHigh;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CXformGbAgg2MatView::Transform
+//
+//	@doc:
+//		Actual transformation
+//
+//---------------------------------------------------------------------------
+void
+CXformGbAgg2MatView::Transform(CXformContext *pxfctxt, CXformResult *pxfres,
+							   CExpression *pexpr) const
+{
+	GPOS_ASSERT(nullptr != pxfctxt);
+	GPOS_ASSERT(FPromising(pxfctxt->Pmp(), this, pexpr));
+	GPOS_ASSERT(FCheckPattern(pexpr));
+
+	Rewrite(pxfctxt->Pmp(), pxfres, pexpr, (*pexpr)[0],
+			nullptr /*pexprPred*/);
+}
+
+// EOF
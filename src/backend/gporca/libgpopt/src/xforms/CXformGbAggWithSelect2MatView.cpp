@@ -0,0 +1,102 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (c) 2023 VMware, Inc. or its affiliates. All Rights Reserved.
+//
+//	@filename:
+//		CXformGbAggWithSelect2MatView.cpp
+//
+//	@doc:
+//		Implementation of answering an aggregate over a select from a
+//		materialized view
+//---------------------------------------------------------------------------
+
+#include "gpopt/xforms/CXformGbAggWithSelect2MatView.h"
+
+#include "gpos/base.h"
+
+#include "gpopt/operators/CLogicalGbAgg.h"
+#include "gpopt/operators/CLogicalGet.h"
+#include "gpopt/operators/CLogicalSelect.h"
+#include "gpopt/operators/CPatternTree.h"
+#include "naucrates/traceflags/traceflags.h"
+
+using namespace gpopt;
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CXformGbAggWithSelect2MatView::CXformGbAggWithSelect2MatView
+//
+//	@doc:
+//		Ctor
+//
+//---------------------------------------------------------------------------
+CXformGbAggWithSelect2MatView::CXformGbAggWithSelect2MatView(CMemoryPool *mp)
+	:  // pattern
+	  CXformMatViewRewrite(GPOS_NEW(mp) CExpression(
+		  mp, GPOS_NEW(mp) CLogicalGbAgg(mp),
+		  GPOS_NEW(mp) CExpression(
+			  mp, GPOS_NEW(mp) CLogicalSelect(mp),
+			  GPOS_NEW(mp) CExpression(
+				  mp, GPOS_NEW(mp) CLogicalGet(mp)),  // relational child
+			  GPOS_NEW(mp)
+				  CExpression(mp, GPOS_NEW(mp) CPatternTree(mp))  // predicate
+			  ),
+		  GPOS_NEW(mp)
+			  CExpression(mp, GPOS_NEW(mp) CPatternTree(mp))  // project list
+		  ))
+{
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CXformGbAggWithSelect2MatView::Exfp
+//
+//	@doc:
+//		Compute xform promise for a given expression handle; only global
+//		aggregates without distinct aggregates or outer references are
+//		matched
+//
+//---------------------------------------------------------------------------
+CXform::EXformPromise
+CXformGbAggWithSelect2MatView::Exfp(CExpressionHandle &exprhdl) const
+{
+	if (!GPOS_FTRACE(EopttraceEnableMatViewRewrite) ||
+		!CLogicalGbAgg::PopConvert(exprhdl.Pop())->FGlobal() ||
+		0 < exprhdl.DeriveTotalDistinctAggs(1) ||
+		0 < exprhdl.DeriveOuterReferences()->Size() ||
+		exprhdl.DeriveHasSubquery(1))
+	{
+		return CXform::ExfpNone;
+	}
+
+	return CXform::ExfpHigh;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CXformGbAggWithSelect2MatView::Transform
+//
+//	@doc:
+//		Actual transformation
+//
+//---------------------------------------------------------------------------
+void
+CXformGbAggWithSelect2MatView::Transform(CXformContext *pxfctxt,
+										 CXformResult *pxfres,
+										 CExpression *pexpr) const
+{
+	GPOS_ASSERT(nullptr != pxfctxt);
+	GPOS_ASSERT(FPromising(pxfctxt->Pmp(), this, pexpr));
+	GPOS_ASSERT(FCheckPattern(pexpr));
+
+	CExpression *pexprSelect = (*pexpr)[0];
+	CExpression *pexprPred = (*pexprSelect)[1];
+	if (pexprPred->DeriveHasSubquery())
+	{
+		return;
+	}
+
+	Rewrite(pxfctxt->Pmp(), pxfres, pexpr, (*pexprSelect)[0], pexprPred);
+}
+
+// EOF
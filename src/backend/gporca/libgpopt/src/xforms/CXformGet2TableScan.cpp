@@ -13,6 +13,7 @@
 
 #include "gpos/base.h"
 
+#include "gpopt/base/COptCtxt.h"
 #include "gpopt/hints/CHintUtils.h"
 #include "gpopt/metadata/CTableDescriptor.h"
 #include "gpopt/operators/CExpressionHandle.h"
@@ -104,6 +105,30 @@ CXformGet2TableScan::Transform(CXformContext *pxfctxt, CXformResult *pxfres,
 		GPOS_NEW(mp) CPhysicalTableScan(mp, pname, ptabdesc, pdrgpcrOutput));
 	// add alternative to transformation result
 	pxfres->Add(pexprAlt);
+
+	// the rows of a heap or append-optimized table that is distributed
+	// across the segments can also be split among several workers on each
+	// segment
+	const ULONG ulWorkers =
+		COptCtxt::PoctxtFromTLS()->GetCostModel()->UlParallelWorkers();
+	const IMDRelation::Ereldistrpolicy ereldistr =
+		ptabdesc->GetRelDistribution();
+	const IMDRelation::Erelstoragetype erelstorage =
+		ptabdesc->RetrieveRelStorageType();
+	if (1 < ulWorkers &&
+		(IMDRelation::EreldistrHash == ereldistr ||
+		 IMDRelation::EreldistrRandom == ereldistr) &&
+		(IMDRelation::ErelstorageHeap == erelstorage ||
+		 IMDRelation::ErelstorageAppendOnlyRows == erelstorage ||
+		 IMDRelation::ErelstorageAppendOnlyCols == erelstorage))
+	{
+		ptabdesc->AddRef();
+		pdrgpcrOutput->AddRef();
+		pxfres->Add(GPOS_NEW(mp) CExpression(
+			mp, GPOS_NEW(mp) CPhysicalTableScan(
+					mp, GPOS_NEW(mp) CName(mp, popGet->Name()), ptabdesc,
+					pdrgpcrOutput, ulWorkers)));
+	}
 }
 
 
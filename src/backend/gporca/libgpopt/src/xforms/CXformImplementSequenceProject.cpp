@@ -81,7 +81,10 @@ CXformImplementSequenceProject::Transform(CXformContext *pxfctxt,
 
 	// assemble physical operator
 	CExpression *pexprSequenceProject = GPOS_NEW(mp) CExpression(
-		mp, GPOS_NEW(mp) CPhysicalSequenceProject(mp, pds, pdrgpos, pdrgpwf),
+		mp,
+		GPOS_NEW(mp)
+			CPhysicalSequenceProject(mp, pds, pdrgpos, pdrgpwf,
+									 popLogicalSequenceProject->FLocal()),
 		pexprRelational, pexprScalar);
 
 	// add alternative to results
@@ -0,0 +1,90 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (c) 2023 VMware, Inc. or its affiliates. All Rights Reserved.
+//
+//	@filename:
+//		CXformLeftOuterJoin2MergeJoin.cpp
+//
+//	@doc:
+//		Implementation of transform
+//---------------------------------------------------------------------------
+
+#include "gpopt/xforms/CXformLeftOuterJoin2MergeJoin.h"
+
+#include "gpos/base.h"
+
+#include "gpopt/operators/CLogicalLeftOuterJoin.h"
+#include "gpopt/operators/CPatternLeaf.h"
+#include "gpopt/operators/CPhysicalLeftOuterMergeJoin.h"
+#include "gpopt/xforms/CXformUtils.h"
+
+using namespace gpopt;
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CXformLeftOuterJoin2MergeJoin::CXformLeftOuterJoin2MergeJoin
+//
+//	@doc:
+//		ctor
+//
+//---------------------------------------------------------------------------
+CXformLeftOuterJoin2MergeJoin::CXformLeftOuterJoin2MergeJoin(CMemoryPool *mp)
+	:  // pattern
+	  CXformImplementation(GPOS_NEW(mp) CExpression(
+		  mp, GPOS_NEW(mp) CLogicalLeftOuterJoin(mp),
+		  GPOS_NEW(mp)
+			  CExpression(mp, GPOS_NEW(mp) CPatternLeaf(mp)),  // left child
+		  GPOS_NEW(mp)
+			  CExpression(mp, GPOS_NEW(mp) CPatternLeaf(mp)),  // right child
+		  GPOS_NEW(mp)
+			  CExpression(mp, GPOS_NEW(mp) CPatternTree(mp))  // predicate
+		  ))
+{
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CXformLeftOuterJoin2MergeJoin::Exfp
+//
+//	@doc:
+//		Compute xform promise for a given expression handle;
+//
+//---------------------------------------------------------------------------
+CXform::EXformPromise
+CXformLeftOuterJoin2MergeJoin::Exfp(CExpressionHandle &exprhdl) const
+{
+	if (!GPOS_FTRACE(EopttraceEnableInnerOuterMergeJoin))
+	{
+		return CXform::ExfpNone;
+	}
+
+	return CXformUtils::ExfpLogicalJoin2PhysicalJoin(exprhdl);
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CXformLeftOuterJoin2MergeJoin::Transform
+//
+//	@doc:
+//		actual transformation
+//
+//---------------------------------------------------------------------------
+void
+CXformLeftOuterJoin2MergeJoin::Transform(CXformContext *pxfctxt,
+										 CXformResult *pxfres,
+										 CExpression *pexpr) const
+{
+	GPOS_ASSERT(nullptr != pxfctxt);
+	GPOS_ASSERT(FPromising(pxfctxt->Pmp(), this, pexpr));
+	GPOS_ASSERT(FCheckPattern(pexpr));
+
+	// predicates that can't be merge clauses are evaluated as a join filter
+	CXformUtils::ImplementMergeJoin<CPhysicalLeftOuterMergeJoin>(
+		pxfctxt, pxfres, pexpr, true /*allow_join_filter*/);
+}
+
+
+// EOF
@@ -0,0 +1,692 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (c) 2023 VMware, Inc. or its affiliates. All Rights Reserved.
+//
+//	@filename:
+//		CXformMatViewRewrite.cpp
+//
+//	@doc:
+//		Implementation of matching queries over a single relation against
+//		the materialized views over that relation
+//---------------------------------------------------------------------------
+
+#include "gpopt/xforms/CXformMatViewRewrite.h"
+
+#include "gpos/base.h"
+#include "gpos/common/CBitSet.h"
+
+#include "gpopt/base/CColRefSetIter.h"
+#include "gpopt/base/CConstraint.h"
+#include "gpopt/base/COptCtxt.h"
+#include "gpopt/base/CUtils.h"
+#include "gpopt/mdcache/CMDAccessor.h"
+#include "gpopt/metadata/CTableDescriptor.h"
+#include "gpopt/operators/CLogicalGbAgg.h"
+#include "gpopt/operators/CLogicalGet.h"
+#include "gpopt/operators/CPredicateUtils.h"
+#include "gpopt/operators/CScalarAggFunc.h"
+#include "gpopt/operators/CScalarIdent.h"
+#include "gpopt/operators/CScalarProjectElement.h"
+#include "gpopt/operators/CScalarProjectList.h"
+#include "gpopt/operators/CScalarValuesList.h"
+#include "gpopt/translate/CTranslatorDXLToExprUtils.h"
+#include "naucrates/dxl/operators/CDXLTableDescr.h"
+#include "naucrates/md/CMDIdGPDB.h"
+#include "naucrates/md/IMDMatViewInfo.h"
+#include "naucrates/md/IMDRelation.h"
+#include "naucrates/traceflags/traceflags.h"
+
+using namespace gpopt;
+using namespace gpmd;
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CXformMatViewRewrite::CXformMatViewRewrite
+//
+//	@doc:
+//		Ctor
+//
+//---------------------------------------------------------------------------
+CXformMatViewRewrite::CXformMatViewRewrite(CExpression *pexprPattern)
+	: CXformExploration(pexprPattern)
+{
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CXformMatViewRewrite::GetAttno
+//
+//	@doc:
+//		Attno of a column produced by the given Get, 0 if not found
+//
+//---------------------------------------------------------------------------
+INT
+CXformMatViewRewrite::GetAttno(const CLogicalGet *popGet, const CColRef *colref)
+{
+	CColRefArray *pdrgpcrOutput = popGet->PdrgpcrOutput();
+	CColumnDescriptorArray *pdrgpcoldesc = popGet->Ptabdesc()->Pdrgpcoldesc();
+	for (ULONG ul = 0; ul < pdrgpcrOutput->Size(); ul++)
+	{
+		if (colref == (*pdrgpcrOutput)[ul])
+		{
+			return (*pdrgpcoldesc)[ul]->AttrNum();
+		}
+	}
+
+	return 0;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CXformMatViewRewrite::PcrFromAttno
+//
+//	@doc:
+//		Column produced by the given Get for an attno, nullptr if not found
+//
+//---------------------------------------------------------------------------
+CColRef *
+CXformMatViewRewrite::PcrFromAttno(const CLogicalGet *popGet, INT attno)
+{
+	CColRefArray *pdrgpcrOutput = popGet->PdrgpcrOutput();
+	CColumnDescriptorArray *pdrgpcoldesc = popGet->Ptabdesc()->Pdrgpcoldesc();
+	for (ULONG ul = 0; ul < pdrgpcrOutput->Size(); ul++)
+	{
+		if (attno == (*pdrgpcoldesc)[ul]->AttrNum())
+		{
+			return (*pdrgpcrOutput)[ul];
+		}
+	}
+
+	return nullptr;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CXformMatViewRewrite::UlMatViewColumn
+//
+//	@doc:
+//		Position of the view column derived from the given base column and
+//		aggregate, gpos::ulong_max if there is none
+//
+//---------------------------------------------------------------------------
+ULONG
+CXformMatViewRewrite::UlMatViewColumn(const CMDMatView *mv, INT attno,
+									  IMDId *agg_mdid)
+{
+	for (ULONG ul = 0; ul < mv->ColumnCount(); ul++)
+	{
+		const CMDMatViewColumn *column = mv->GetColumn(ul);
+		if (attno != column->Attno())
+		{
+			continue;
+		}
+
+		if ((nullptr == agg_mdid && column->IsColumnRef()) ||
+			(nullptr != agg_mdid && column->IsAggregate() &&
+			 agg_mdid->Equals(column->AggMdid())))
+		{
+			return ul;
+		}
+	}
+
+	return gpos::ulong_max;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CXformMatViewRewrite::FColumnAvailable
+//
+//	@doc:
+//		Can the given base column be read from the view; the rows of an
+//		aggregate view only tell the values of its grouping columns apart
+//
+//---------------------------------------------------------------------------
+BOOL
+CXformMatViewRewrite::FColumnAvailable(const CMDMatView *mv,
+									   const CLogicalGet *popGet,
+									   const CColRef *colref)
+{
+	INT attno = GetAttno(popGet, colref);
+	if (0 >= attno || gpos::ulong_max == UlMatViewColumn(mv, attno, nullptr))
+	{
+		return false;
+	}
+
+	if (!mv->IsAggregate())
+	{
+		return true;
+	}
+
+	ULongPtrArray *grouping_attnos = mv->GetGroupingAttnos();
+	for (ULONG ul = 0; ul < grouping_attnos->Size(); ul++)
+	{
+		if (*(*grouping_attnos)[ul] == (ULONG) attno)
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CXformMatViewRewrite::FImplied
+//
+//	@doc:
+//		Is the given view filter conjunct implied by the query predicate,
+//		either by appearing in it or, for a comparison of a column to
+//		constants, by the query restricting that column further
+//
+//---------------------------------------------------------------------------
+BOOL
+CXformMatViewRewrite::FImplied(CMemoryPool *mp, CExpression *pexprViewConjunct,
+							   CExpressionArray *pdrgpexprQuery,
+							   CExpression *pexprPred)
+{
+	if (CUtils::FEqualAny(pexprViewConjunct, pdrgpexprQuery))
+	{
+		return true;
+	}
+
+	// only compare constraints that represent the view conjunct exactly
+	if (nullptr == pexprPred ||
+		!(CPredicateUtils::FIdentCompareConstIgnoreCast(
+			  pexprViewConjunct, COperator::EopScalarCmp) ||
+		  CPredicateUtils::FArrayCompareIdentToConstIgnoreCast(
+			  pexprViewConjunct)))
+	{
+		return false;
+	}
+
+	CColRefSetArray *pdrgpcrs = nullptr;
+	CConstraint *pcnstrView =
+		CConstraint::PcnstrFromScalarExpr(mp, pexprViewConjunct, &pdrgpcrs);
+	CRefCount::SafeRelease(pdrgpcrs);
+
+	pdrgpcrs = nullptr;
+	CConstraint *pcnstrQuery =
+		CConstraint::PcnstrFromScalarExpr(mp, pexprPred, &pdrgpcrs);
+	CRefCount::SafeRelease(pdrgpcrs);
+
+	BOOL fImplied = nullptr != pcnstrView && nullptr != pcnstrQuery &&
+					pcnstrView->Contains(pcnstrQuery);
+
+	CRefCount::SafeRelease(pcnstrView);
+	CRefCount::SafeRelease(pcnstrQuery);
+
+	return fImplied;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CXformMatViewRewrite::UlMatchAggregate
+//
+//	@doc:
+//		Position of the view column matching a query aggregate over at most
+//		one column of the relation, gpos::ulong_max if there is none. When
+//		rolling up the groups of the view, the column must hold a partial
+//		result the aggregate can be combined from.
+//
+//---------------------------------------------------------------------------
+ULONG
+CXformMatViewRewrite::UlMatchAggregate(const CMDMatView *mv,
+									   const CLogicalGet *popGet,
+									   CExpression *pexprAggFunc, BOOL fRollup)
+{
+	if (COperator::EopScalarAggFunc != pexprAggFunc->Pop()->Eopid())
+	{
+		return gpos::ulong_max;
+	}
+
+	CScalarAggFunc *popAggFunc =
+		CScalarAggFunc::PopConvert(pexprAggFunc->Pop());
+	if (!popAggFunc->FGlobal() || popAggFunc->FSplit() ||
+		popAggFunc->IsDistinct() ||
+		EaggfunckindNormal != popAggFunc->AggKind() ||
+		0 < (*pexprAggFunc)[EaggfuncIndexDirectArgs]->Arity() ||
+		0 < (*pexprAggFunc)[EaggfuncIndexOrder]->Arity() ||
+		0 < (*pexprAggFunc)[EaggfuncIndexDistinct]->Arity())
+	{
+		return gpos::ulong_max;
+	}
+
+	CExpression *pexprArgs = (*pexprAggFunc)[EaggfuncIndexArgs];
+	INT attno = 0;
+	if (1 == pexprArgs->Arity())
+	{
+		CExpression *pexprArg = (*pexprArgs)[0];
+		if (COperator::EopScalarIdent != pexprArg->Pop()->Eopid())
+		{
+			return gpos::ulong_max;
+		}
+
+		attno = GetAttno(popGet,
+						 CScalarIdent::PopConvert(pexprArg->Pop())->Pcr());
+		if (0 >= attno)
+		{
+			return gpos::ulong_max;
+		}
+	}
+	else if (0 < pexprArgs->Arity())
+	{
+		return gpos::ulong_max;
+	}
+
+	ULONG ulPos = UlMatViewColumn(mv, attno, popAggFunc->MDId());
+	if (gpos::ulong_max != ulPos && fRollup &&
+		!mv->GetColumn(ulPos)->IsCombinable())
+	{
+		return gpos::ulong_max;
+	}
+
+	return ulPos;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CXformMatViewRewrite::PexprRollupAgg
+//
+//	@doc:
+//		Aggregate combining the partial results of a query aggregate stored
+//		in the given view column, as the global stage of a split aggregate
+//		combines the results of its local stage
+//
+//---------------------------------------------------------------------------
+CExpression *
+CXformMatViewRewrite::PexprRollupAgg(CMemoryPool *mp, CExpression *pexprAggFunc,
+									 CColRef *colref)
+{
+	CScalarAggFunc *popAggFunc =
+		CScalarAggFunc::PopConvert(pexprAggFunc->Pop());
+
+	popAggFunc->MDId()->AddRef();
+	popAggFunc->GetArgTypes()->AddRef();
+	CScalarAggFunc *popAggFuncGlobal = CUtils::PopAggFunc(
+		mp, popAggFunc->MDId(),
+		GPOS_NEW(mp) CWStringConst(mp, popAggFunc->PstrAggFunc()->GetBuffer()),
+		false /* is_distinct */, EaggfuncstageGlobal, /* fGlobal */
+		true /* fSplit */, nullptr /* pmdidResolvedReturnType */,
+		EaggfunckindNormal, popAggFunc->GetArgTypes(), popAggFunc->FRepSafe());
+
+	CExpressionArray *pdrgpexprArgs = GPOS_NEW(mp) CExpressionArray(mp);
+	pdrgpexprArgs->Append(CUtils::PexprScalarIdent(mp, colref));
+
+	CExpressionArray *pdrgpexpr = GPOS_NEW(mp) CExpressionArray(mp);
+	pdrgpexpr->Append(GPOS_NEW(mp) CExpression(
+		mp, GPOS_NEW(mp) CScalarValuesList(mp), pdrgpexprArgs));
+
+	// no direct arguments, order or distinct specification
+	for (ULONG ul = EaggfuncIndexDirectArgs; ul < EaggfuncIndexSentinel; ul++)
+	{
+		pdrgpexpr->Append(GPOS_NEW(mp) CExpression(
+			mp, GPOS_NEW(mp) CScalarValuesList(mp),
+			GPOS_NEW(mp) CExpressionArray(mp)));
+	}
+
+	return GPOS_NEW(mp) CExpression(mp, popAggFuncGlobal, pdrgpexpr);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CXformMatViewRewrite::PtabdescMatView
+//
+//	@doc:
+//		Table descriptor of the view, accessed with the same permissions and
+//		lock mode as the base relation
+//
+//---------------------------------------------------------------------------
+CTableDescriptor *
+CXformMatViewRewrite::PtabdescMatView(CMemoryPool *mp, CMDAccessor *md_accessor,
+									  IMDId *mdid,
+									  const CTableDescriptor *ptabdesc)
+{
+	const IMDRelation *pmdrel = md_accessor->RetrieveRel(mdid);
+	IMDRelation::Ereldistrpolicy rel_distr_policy =
+		pmdrel->GetRelDistribution();
+
+	mdid->AddRef();
+	CTableDescriptor *ptabdescView = GPOS_NEW(mp) CTableDescriptor(
+		mp, mdid, CName(mp, pmdrel->Mdname().GetMDName()),
+		pmdrel->ConvertHashToRandom(), rel_distr_policy,
+		pmdrel->RetrieveRelStorageType(), ptabdesc->GetExecuteAsUserId(),
+		ptabdesc->LockMode(), ptabdesc->GetAclMode(), UNASSIGNED_QUERYID);
+
+	// map the positions of all columns to those of the non-dropped ones
+	UlongToUlongMap *phmululColMapping = GPOS_NEW(mp) UlongToUlongMap(mp);
+	ULONG ulPosNonDropped = 0;
+	for (ULONG ul = 0; ul < pmdrel->ColumnCount(); ul++)
+	{
+		const IMDColumn *pmdcol = pmdrel->GetMdCol(ul);
+		if (pmdcol->IsDropped())
+		{
+			continue;
+		}
+
+		(void) phmululColMapping->Insert(GPOS_NEW(mp) ULONG(ul),
+										 GPOS_NEW(mp) ULONG(ulPosNonDropped));
+		ulPosNonDropped++;
+
+		CColumnDescriptor *pcoldesc = GPOS_NEW(mp) CColumnDescriptor(
+			mp, md_accessor->RetrieveType(pmdcol->MdidType()),
+			pmdcol->TypeModifier(), CName(mp, pmdcol->Mdname().GetMDName()),
+			pmdcol->AttrNum(), pmdcol->IsNullable(), pmdcol->Length());
+		ptabdescView->AddColumn(pcoldesc);
+	}
+
+	if (IMDRelation::EreldistrHash == rel_distr_policy)
+	{
+		for (ULONG ul = 0; ul < pmdrel->DistrColumnCount(); ul++)
+		{
+			IMDId *opfamily = nullptr;
+			if (GPOS_FTRACE(EopttraceConsiderOpfamiliesForDistribution))
+			{
+				opfamily = pmdrel->GetDistrOpfamilyAt(ul);
+			}
+
+			ptabdescView->AddDistributionColumn(
+				ptabdescView->GetAttributePosition(
+					pmdrel->GetDistrColAt(ul)->AttrNum()),
+				opfamily);
+		}
+	}
+
+	CTranslatorDXLToExprUtils::AddKeySets(mp, ptabdescView, pmdrel,
+										  phmululColMapping);
+	phmululColMapping->Release();
+
+	if (IMDRelation::EreldistrReplicated == rel_distr_policy)
+	{
+		COptCtxt::PoctxtFromTLS()->SetHasReplicatedTables();
+	}
+
+	return ptabdescView;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CXformMatViewRewrite::PexprRewrite
+//
+//	@doc:
+//		Rewrite the query over the given view, nullptr if it does not match.
+//		The result scans the view, applies the rest of the query predicate,
+//		rolls up the groups of the view if the query groups by fewer columns
+//		and projects the columns of the query out of the columns of the view.
+//
+//---------------------------------------------------------------------------
+CExpression *
+CXformMatViewRewrite::PexprRewrite(CMemoryPool *mp, CMDAccessor *md_accessor,
+								   const CMDMatView *mv,
+								   CExpression *pexprGbAgg,
+								   CExpression *pexprGet,
+								   CExpression *pexprPred)
+{
+	CLogicalGet *popGet = CLogicalGet::PopConvert(pexprGet->Pop());
+	BOOL fAggregate = (nullptr != pexprGbAgg);
+	if (fAggregate != mv->IsAggregate())
+	{
+		return nullptr;
+	}
+
+	CExpressionArray *pdrgpexprQuery =
+		(nullptr != pexprPred)
+			? CPredicateUtils::PdrgpexprConjuncts(mp, pexprPred)
+			: GPOS_NEW(mp) CExpressionArray(mp);
+
+	// conjuncts of the filter of the view, over the columns of the query
+	CExpressionArray *pdrgpexprView = nullptr;
+	if (mv->HasFilter())
+	{
+		CColRefArray *pdrgpcrNonSystem = GPOS_NEW(mp) CColRefArray(mp);
+		CColRefArray *pdrgpcrOutput = popGet->PdrgpcrOutput();
+		CColumnDescriptorArray *pdrgpcoldesc =
+			popGet->Ptabdesc()->Pdrgpcoldesc();
+		for (ULONG ul = 0; ul < pdrgpcrOutput->Size(); ul++)
+		{
+			if (!(*pdrgpcoldesc)[ul]->IsSystemColumn())
+			{
+				pdrgpcrNonSystem->Append((*pdrgpcrOutput)[ul]);
+			}
+		}
+
+		CExpression *pexprFilter = mv->GetFilterExpr(
+			mp, md_accessor, popGet->Ptabdesc()->MDId(), pdrgpcrNonSystem);
+		pdrgpexprView = CPredicateUtils::PdrgpexprConjuncts(mp, pexprFilter);
+		pexprFilter->Release();
+		pdrgpcrNonSystem->Release();
+	}
+	else
+	{
+		pdrgpexprView = GPOS_NEW(mp) CExpressionArray(mp);
+	}
+
+	BOOL fMatch = true;
+	for (ULONG ul = 0; fMatch && ul < pdrgpexprView->Size(); ul++)
+	{
+		fMatch = FImplied(mp, (*pdrgpexprView)[ul], pdrgpexprQuery, pexprPred);
+	}
+
+	// the rest of the query predicate is applied on top of the view
+	CExpressionArray *pdrgpexprResidual = GPOS_NEW(mp) CExpressionArray(mp);
+	for (ULONG ul = 0; ul < pdrgpexprQuery->Size(); ul++)
+	{
+		CExpression *pexprConjunct = (*pdrgpexprQuery)[ul];
+		if (!CUtils::FEqualAny(pexprConjunct, pdrgpexprView))
+		{
+			pexprConjunct->AddRef();
+			pdrgpexprResidual->Append(pexprConjunct);
+		}
+	}
+	pdrgpexprQuery->Release();
+	pdrgpexprView->Release();
+
+	CExpression *pexprResidual =
+		CPredicateUtils::PexprConjunction(mp, pdrgpexprResidual);
+	CColRefSetIter crsi(*pexprResidual->DeriveUsedColumns());
+	while (fMatch && crsi.Advance())
+	{
+		fMatch = FColumnAvailable(mv, popGet, crsi.Pcr());
+	}
+
+	// the query may group by a subset of the grouping columns of the view,
+	// in which case the groups of the view are rolled up
+	CLogicalGbAgg *popGbAgg = nullptr;
+	CExpression *pexprProjList = nullptr;
+	BOOL fRollup = false;
+	if (fMatch && fAggregate)
+	{
+		popGbAgg = CLogicalGbAgg::PopConvert(pexprGbAgg->Pop());
+		pexprProjList = (*pexprGbAgg)[1];
+
+		CColRefArray *pdrgpcrGrp = popGbAgg->Pdrgpcr();
+		CBitSet *pbsQuery = GPOS_NEW(mp) CBitSet(mp);
+		for (ULONG ul = 0; fMatch && ul < pdrgpcrGrp->Size(); ul++)
+		{
+			CColRef *colref = (*pdrgpcrGrp)[ul];
+			fMatch = FColumnAvailable(mv, popGet, colref);
+			if (fMatch)
+			{
+				(void) pbsQuery->ExchangeSet((ULONG) GetAttno(popGet, colref));
+			}
+		}
+
+		CBitSet *pbsView = GPOS_NEW(mp) CBitSet(mp);
+		ULongPtrArray *grouping_attnos = mv->GetGroupingAttnos();
+		for (ULONG ul = 0; ul < grouping_attnos->Size(); ul++)
+		{
+			(void) pbsView->ExchangeSet(*(*grouping_attnos)[ul]);
+		}
+		fRollup = !pbsQuery->Equals(pbsView);
+		pbsQuery->Release();
+		pbsView->Release();
+
+		for (ULONG ul = 0; fMatch && ul < pexprProjList->Arity(); ul++)
+		{
+			fMatch = gpos::ulong_max !=
+					 UlMatchAggregate(mv, popGet, (*(*pexprProjList)[ul])[0],
+									  fRollup);
+		}
+	}
+
+	if (!fMatch)
+	{
+		pexprResidual->Release();
+		return nullptr;
+	}
+
+	CTableDescriptor *ptabdescView =
+		PtabdescMatView(mp, md_accessor, mv->MDId(), popGet->Ptabdesc());
+	CLogicalGet *popGetView = GPOS_NEW(mp)
+		CLogicalGet(mp, GPOS_NEW(mp) CName(mp, mv->Mdname().GetMDName()),
+					ptabdescView, false /* hasSecurityQuals */);
+
+	// map the columns of the relation to the columns of the view, a view
+	// column at position ul is the attribute ul + 1 of the view
+	UlongToColRefMap *colref_mapping = GPOS_NEW(mp) UlongToColRefMap(mp);
+	CColRefArray *pdrgpcrOutput = popGet->PdrgpcrOutput();
+	for (ULONG ul = 0; ul < pdrgpcrOutput->Size(); ul++)
+	{
+		CColRef *colref = (*pdrgpcrOutput)[ul];
+		if (!FColumnAvailable(mv, popGet, colref))
+		{
+			continue;
+		}
+
+		ULONG ulPos =
+			UlMatViewColumn(mv, GetAttno(popGet, colref), nullptr /*agg_mdid*/);
+		CColRef *pcrView = PcrFromAttno(popGetView, (INT) ulPos + 1);
+		GPOS_ASSERT(nullptr != pcrView);
+		(void) colref_mapping->Insert(GPOS_NEW(mp) ULONG(colref->Id()),
+									  pcrView);
+	}
+
+	CExpression *pexprView = CUtils::PexprSafeSelect(
+		mp, GPOS_NEW(mp) CExpression(mp, popGetView),
+		pexprResidual->PexprCopyWithRemappedColumns(mp, colref_mapping,
+													true /*must_exist*/));
+	pexprResidual->Release();
+
+	CExpressionArray *pdrgpexprPrEl = GPOS_NEW(mp) CExpressionArray(mp);
+	CColRefArray *pdrgpcrQuery =
+		fAggregate ? popGbAgg->Pdrgpcr() : popGet->PdrgpcrOutput();
+	if (fAggregate)
+	{
+		CExpressionArray *pdrgpexprAgg = GPOS_NEW(mp) CExpressionArray(mp);
+		for (ULONG ul = 0; ul < pexprProjList->Arity(); ul++)
+		{
+			CExpression *pexprPrEl = (*pexprProjList)[ul];
+			CColRef *colref =
+				CScalarProjectElement::PopConvert(pexprPrEl->Pop())->Pcr();
+			CExpression *pexprAggFunc = (*pexprPrEl)[0];
+			ULONG ulPos = UlMatchAggregate(mv, popGet, pexprAggFunc, fRollup);
+			CColRef *pcrView = PcrFromAttno(popGetView, (INT) ulPos + 1);
+			GPOS_ASSERT(nullptr != pcrView);
+
+			if (fRollup)
+			{
+				pdrgpexprAgg->Append(CUtils::PexprScalarProjectElement(
+					mp, colref, PexprRollupAgg(mp, pexprAggFunc, pcrView)));
+			}
+			else
+			{
+				pdrgpexprPrEl->Append(CUtils::PexprScalarProjectElement(
+					mp, colref, CUtils::PexprScalarIdent(mp, pcrView)));
+			}
+		}
+
+		if (fRollup)
+		{
+			CColRefArray *pdrgpcrGrpView = GPOS_NEW(mp) CColRefArray(mp);
+			for (ULONG ul = 0; ul < pdrgpcrQuery->Size(); ul++)
+			{
+				ULONG id = (*pdrgpcrQuery)[ul]->Id();
+				pdrgpcrGrpView->Append(colref_mapping->Find(&id));
+			}
+
+			pexprView = GPOS_NEW(mp) CExpression(
+				mp,
+				GPOS_NEW(mp) CLogicalGbAgg(mp, pdrgpcrGrpView,
+										   COperator::EgbaggtypeGlobal),
+				pexprView,
+				GPOS_NEW(mp) CExpression(
+					mp, GPOS_NEW(mp) CScalarProjectList(mp), pdrgpexprAgg));
+		}
+		else
+		{
+			pdrgpexprAgg->Release();
+		}
+	}
+
+	// project the grouping columns, or all columns of a plain view, of the
+	// query out of the view
+	for (ULONG ul = 0; ul < pdrgpcrQuery->Size(); ul++)
+	{
+		CColRef *colref = (*pdrgpcrQuery)[ul];
+		ULONG id = colref->Id();
+		CColRef *pcrView = colref_mapping->Find(&id);
+		if (nullptr != pcrView)
+		{
+			pdrgpexprPrEl->Append(CUtils::PexprScalarProjectElement(
+				mp, colref, CUtils::PexprScalarIdent(mp, pcrView)));
+		}
+	}
+	colref_mapping->Release();
+
+	if (0 == pdrgpexprPrEl->Size())
+	{
+		pdrgpexprPrEl->Release();
+		return pexprView;
+	}
+
+	return CUtils::PexprLogicalProject(
+		mp, pexprView,
+		GPOS_NEW(mp)
+			CExpression(mp, GPOS_NEW(mp) CScalarProjectList(mp), pdrgpexprPrEl),
+		false /*fNewComputedCol*/);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CXformMatViewRewrite::Rewrite
+//
+//	@doc:
+//		Add an alternative for each view matching the given aggregate (if
+//		any) over the given Get, filtered by the given predicate (if any)
+//
+//---------------------------------------------------------------------------
+void
+CXformMatViewRewrite::Rewrite(CMemoryPool *mp, CXformResult *pxfres,
+							  CExpression *pexprGbAgg, CExpression *pexprGet,
+							  CExpression *pexprPred)
+{
+	CLogicalGet *popGet = CLogicalGet::PopConvert(pexprGet->Pop());
+	CTableDescriptor *ptabdesc = popGet->Ptabdesc();
+
+	// row level security and DML targets always read the relation itself
+	if (popGet->HasSecurityQuals() ||
+		UNASSIGNED_QUERYID != ptabdesc->GetAssignedQueryIdForTargetRel())
+	{
+		return;
+	}
+
+	CMDAccessor *md_accessor = COptCtxt::PoctxtFromTLS()->Pmda();
+	CMDIdGPDB *mdid = GPOS_NEW(mp) CMDIdGPDB(
+		IMDId::EmdidMatViewInfo, CMDIdGPDB::CastMdid(ptabdesc->MDId())->Oid());
+	const IMDMatViewInfo *md_matview_info =
+		md_accessor->RetrieveMatViewInfo(mdid);
+	mdid->Release();
+
+	CMDMatViewArray *matview_array = md_matview_info->GetMatViewArray();
+	for (ULONG ul = 0; ul < matview_array->Size(); ul++)
+	{
+		CExpression *pexprAlt =
+			PexprRewrite(mp, md_accessor, (*matview_array)[ul], pexprGbAgg,
+						 pexprGet, pexprPred);
+		if (nullptr != pexprAlt)
+		{
+			pxfres->Add(pexprAlt);
+		}
+	}
+}
+
+// EOF
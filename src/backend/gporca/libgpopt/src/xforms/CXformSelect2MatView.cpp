@@ -0,0 +1,84 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (c) 2023 VMware, Inc. or its affiliates. All Rights Reserved.
+//
+//	@filename:
+//		CXformSelect2MatView.cpp
+//
+//	@doc:
+//		Implementation of answering a select over a table from a
+//		materialized view
+//---------------------------------------------------------------------------
+
+#include "gpopt/xforms/CXformSelect2MatView.h"
+
+#include "gpos/base.h"
+
+#include "gpopt/operators/CLogicalGet.h"
+#include "gpopt/operators/CLogicalSelect.h"
+#include "gpopt/operators/CPatternTree.h"
+#include "naucrates/traceflags/traceflags.h"
+
+using namespace gpopt;
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CXformSelect2MatView::CXformSelect2MatView
+//
+//	@doc:
+//		Ctor
+//
+//---------------------------------------------------------------------------
+CXformSelect2MatView::CXformSelect2MatView(CMemoryPool *mp)
+	:  // pattern
+	  CXformMatViewRewrite(GPOS_NEW(mp) CExpression(
+		  mp, GPOS_NEW(mp) CLogicalSelect(mp),
+		  GPOS_NEW(mp) CExpression(
+			  mp, GPOS_NEW(mp) CLogicalGet(mp)),  // relational child
+		  GPOS_NEW(mp)
+			  CExpression(mp, GPOS_NEW(mp) CPatternTree(mp))  // predicate tree
+		  ))
+{
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CXformSelect2MatView::Exfp
+//
+//	@doc:
+//		Compute xform promise for a given expression handle
+//
+//---------------------------------------------------------------------------
+CXform::EXformPromise
+CXformSelect2MatView::Exfp(CExpressionHandle &exprhdl) const
+{
+	if (!GPOS_FTRACE(EopttraceEnableMatViewRewrite) ||
+		exprhdl.DeriveHasSubquery(1))
+	{
+		return CXform::ExfpNone;
+	}
+
+	return CXform::ExfpHigh;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CXformSelect2MatView::Transform
+//
+//	@doc:
+//		Actual transformation
+//
+//---------------------------------------------------------------------------
+void
+CXformSelect2MatView::Transform(CXformContext *pxfctxt, CXformResult *pxfres,
+								CExpression *pexpr) const
+{
+	GPOS_ASSERT(nullptr != pxfctxt);
+	GPOS_ASSERT(FPromising(pxfctxt->Pmp(), this, pexpr));
+	GPOS_ASSERT(FCheckPattern(pexpr));
+
+	Rewrite(pxfctxt->Pmp(), pxfres, nullptr /*pexprGbAgg*/, (*pexpr)[0],
+			(*pexpr)[1]);
+}
+
+// EOF
@@ -0,0 +1,291 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (c) 2023 VMware, Inc. or its affiliates. All Rights Reserved.
+//
+//	@filename:
+//		CXformSplitWindowRankFilter.cpp
+//
+//	@doc:
+//		Implementation of the local top-K pre-filter of ranking windows
+//---------------------------------------------------------------------------
+
+#include "gpopt/xforms/CXformSplitWindowRankFilter.h"
+
+#include "gpos/base.h"
+
+#include "gpopt/base/COptCtxt.h"
+#include "gpopt/base/CUtils.h"
+#include "gpopt/mdcache/CMDAccessorUtils.h"
+#include "gpopt/operators/CExpressionHandle.h"
+#include "gpopt/operators/CLogicalSelect.h"
+#include "gpopt/operators/CLogicalSequenceProject.h"
+#include "gpopt/operators/CPatternLeaf.h"
+#include "gpopt/operators/CPatternTree.h"
+#include "gpopt/operators/CPredicateUtils.h"
+#include "gpopt/operators/CScalarProjectElement.h"
+#include "gpopt/operators/CScalarProjectList.h"
+#include "gpopt/operators/CScalarWindowFunc.h"
+#include "gpopt/optimizer/COptimizerConfig.h"
+#include "naucrates/md/CMDIdGPDB.h"
+
+using namespace gpmd;
+using namespace gpopt;
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CXformSplitWindowRankFilter::CXformSplitWindowRankFilter
+//
+//	@doc:
+//		Ctor
+//
+//---------------------------------------------------------------------------
+CXformSplitWindowRankFilter::CXformSplitWindowRankFilter(CMemoryPool *mp)
+	: CXformExploration(
+		  // pattern
+		  GPOS_NEW(mp) CExpression(
+			  mp, GPOS_NEW(mp) CLogicalSelect(mp),
+			  GPOS_NEW(mp) CExpression(
+				  mp, GPOS_NEW(mp) CLogicalSequenceProject(mp),
+				  GPOS_NEW(mp) CExpression(
+					  mp, GPOS_NEW(mp) CPatternLeaf(mp)),  // relational child
+				  GPOS_NEW(mp) CExpression(
+					  mp, GPOS_NEW(mp) CPatternTree(mp))  // project list
+				  ),
+			  GPOS_NEW(mp)
+				  CExpression(mp, GPOS_NEW(mp) CPatternTree(mp))  // predicate
+			  ))
+{
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CXformSplitWindowRankFilter::Exfp
+//
+//	@doc:
+//		Compute xform promise for a given expression handle
+//
+//---------------------------------------------------------------------------
+CXform::EXformPromise
+CXformSplitWindowRankFilter::Exfp(CExpressionHandle &exprhdl) const
+{
+	if (0 < exprhdl.DeriveOuterReferences()->Size() ||
+		exprhdl.DeriveHasSubquery(1))
+	{
+		return CXform::ExfpNone;
+	}
+
+	return CXform::ExfpHigh;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CXformSplitWindowRankFilter::FRankingProjectList
+//
+//	@doc:
+//		Is the given project list made of row_number() and rank() only; any
+//		other window function would see a partition with rows missing once
+//		the pre-filter is added below it
+//
+//---------------------------------------------------------------------------
+BOOL
+CXformSplitWindowRankFilter::FRankingProjectList(CExpression *pexprPrjList)
+{
+	CWindowOids *window_oids =
+		COptCtxt::PoctxtFromTLS()->GetOptimizerConfig()->GetWindowOids();
+
+	const ULONG arity = pexprPrjList->Arity();
+	for (ULONG ul = 0; ul < arity; ul++)
+	{
+		CExpression *pexprWinFunc = (*(*pexprPrjList)[ul])[0];
+		if (COperator::EopScalarWindowFunc != pexprWinFunc->Pop()->Eopid() ||
+			0 < pexprWinFunc->Arity())
+		{
+			return false;
+		}
+
+		CScalarWindowFunc *popWinFunc =
+			CScalarWindowFunc::PopConvert(pexprWinFunc->Pop());
+		OID oid = CMDIdGPDB::CastMdid(popWinFunc->FuncMdId())->Oid();
+		if (CScalarWindowFunc::EwsImmediate != popWinFunc->Ews() ||
+			(window_oids->OidRowNumber() != oid &&
+			 window_oids->OidRank() != oid))
+		{
+			return false;
+		}
+	}
+
+	return 0 < arity;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CXformSplitWindowRankFilter::PexprLocalBound
+//
+//	@doc:
+//		Find a conjunct of the form (rn < c), (rn <= c) or (rn = c) for a
+//		ranking column rn and a constant c, and return (rn' < c) or
+//		(rn' <= c) on a new column rn' computed by the same window function;
+//		return nullptr if there is no such conjunct
+//
+//---------------------------------------------------------------------------
+CExpression *
+CXformSplitWindowRankFilter::PexprLocalBound(CMemoryPool *mp,
+											 CExpression *pexprPrjList,
+											 CExpression *pexprPred,
+											 CExpression **ppexprWinFunc,
+											 CColRef **ppcrLocal)
+{
+	CExpression *pexprLocalBound = nullptr;
+	CExpressionArray *pdrgpexprConjuncts =
+		CPredicateUtils::PdrgpexprConjuncts(mp, pexprPred);
+
+	const ULONG ulConjuncts = pdrgpexprConjuncts->Size();
+	const ULONG ulPrjElems = pexprPrjList->Arity();
+	for (ULONG ulConj = 0;
+		 nullptr == pexprLocalBound && ulConj < ulConjuncts; ulConj++)
+	{
+		CExpression *pexprConj = (*pdrgpexprConjuncts)[ulConj];
+		if (!CPredicateUtils::FComparison(pexprConj))
+		{
+			continue;
+		}
+
+		for (ULONG ul = 0; ul < ulPrjElems; ul++)
+		{
+			CExpression *pexprPrEl = (*pexprPrjList)[ul];
+			CColRef *colref =
+				CScalarProjectElement::PopConvert(pexprPrEl->Pop())->Pcr();
+			if (!CUtils::FScalarIdent((*pexprConj)[0], colref) &&
+				!CUtils::FScalarIdent((*pexprConj)[1], colref))
+			{
+				continue;
+			}
+
+			CExpression *pexprKey = nullptr;
+			CExpression *pexprOther = nullptr;
+			IMDType::ECmpType cmp_type = IMDType::EcmptOther;
+			CPredicateUtils::ExtractComponents(pexprConj, colref, &pexprKey,
+											   &pexprOther, &cmp_type);
+
+			// a row ranked c among all rows may rank better on its segment
+			if (IMDType::EcmptEq == cmp_type)
+			{
+				cmp_type = IMDType::EcmptLEq;
+			}
+
+			if (!CUtils::FScalarConst(pexprOther) ||
+				(IMDType::EcmptL != cmp_type &&
+				 IMDType::EcmptLEq != cmp_type) ||
+				!CMDAccessorUtils::FCmpOrCastedCmpExists(
+					colref->RetrieveType()->MDId(),
+					CScalar::PopConvert(pexprOther->Pop())->MdidType(),
+					cmp_type))
+			{
+				continue;
+			}
+
+			*ppexprWinFunc = (*pexprPrEl)[0];
+			*ppcrLocal = COptCtxt::PoctxtFromTLS()->Pcf()->PcrCreate(
+				colref->RetrieveType(), colref->TypeModifier(),
+				colref->Name());
+
+			pexprOther->AddRef();
+			pexprLocalBound =
+				CUtils::PexprScalarCmp(mp, *ppcrLocal, pexprOther, cmp_type);
+			break;
+		}
+	}
+
+	pdrgpexprConjuncts->Release();
+
+	return pexprLocalBound;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CXformSplitWindowRankFilter::Transform
+//
+//	@doc:
+//		Actual transformation
+//
+//---------------------------------------------------------------------------
+void
+CXformSplitWindowRankFilter::Transform(CXformContext *pxfctxt,
+									   CXformResult *pxfres,
+									   CExpression *pexpr) const
+{
+	GPOS_ASSERT(nullptr != pxfctxt);
+	GPOS_ASSERT(FPromising(pxfctxt->Pmp(), this, pexpr));
+	GPOS_ASSERT(FCheckPattern(pexpr));
+
+	CMemoryPool *mp = pxfctxt->Pmp();
+
+	// extract components
+	CExpression *pexprSeqPrj = (*pexpr)[0];
+	CExpression *pexprPred = (*pexpr)[1];
+	CExpression *pexprRelational = (*pexprSeqPrj)[0];
+	CExpression *pexprPrjList = (*pexprSeqPrj)[1];
+	CLogicalSequenceProject *popSeqPrj =
+		CLogicalSequenceProject::PopConvert(pexprSeqPrj->Pop());
+
+	if (popSeqPrj->FLocal() || !popSeqPrj->FHasOrderSpecs() ||
+		0 < pexprSeqPrj->DeriveOuterReferences()->Size() ||
+		!FRankingProjectList(pexprPrjList))
+	{
+		return;
+	}
+
+	CExpression *pexprWinFunc = nullptr;
+	CColRef *pcrLocal = nullptr;
+	CExpression *pexprLocalBound = PexprLocalBound(
+		mp, pexprPrjList, pexprPred, &pexprWinFunc, &pcrLocal);
+	if (nullptr == pexprLocalBound)
+	{
+		return;
+	}
+
+	// local sequence project computing the ranking on each segment
+	pexprWinFunc->AddRef();
+	CExpression *pexprLocalPrjList = GPOS_NEW(mp) CExpression(
+		mp, GPOS_NEW(mp) CScalarProjectList(mp),
+		GPOS_NEW(mp) CExpression(
+			mp, GPOS_NEW(mp) CScalarProjectElement(mp, pcrLocal),
+			pexprWinFunc));
+
+	CDistributionSpec *pds = popSeqPrj->Pds();
+	COrderSpecArray *pdrgpos = popSeqPrj->Pdrgpos();
+	CWindowFrameArray *pdrgpwf = popSeqPrj->Pdrgpwf();
+	pds->AddRef();
+	pdrgpos->AddRef();
+	pdrgpwf->AddRef();
+	pexprRelational->AddRef();
+	CExpression *pexprLocalSeqPrj = GPOS_NEW(mp) CExpression(
+		mp,
+		GPOS_NEW(mp) CLogicalSequenceProject(mp, pds, pdrgpos, pdrgpwf,
+											 true /* fLocal */),
+		pexprRelational, pexprLocalPrjList);
+
+	// keep the top rows of each partition on each segment
+	CExpression *pexprLocalSelect = GPOS_NEW(mp)
+		CExpression(mp, GPOS_NEW(mp) CLogicalSelect(mp), pexprLocalSeqPrj,
+					pexprLocalBound);
+
+	// assemble the global sequence project and filter on top
+	popSeqPrj->AddRef();
+	pexprPrjList->AddRef();
+	CExpression *pexprGlobalSeqPrj = GPOS_NEW(mp)
+		CExpression(mp, popSeqPrj, pexprLocalSelect, pexprPrjList);
+
+	pexprPred->AddRef();
+	CExpression *pexprResult = GPOS_NEW(mp) CExpression(
+		mp, GPOS_NEW(mp) CLogicalSelect(mp), pexprGlobalSeqPrj, pexprPred);
+
+	pxfres->Add(pexprResult);
+}
+
+// EOF
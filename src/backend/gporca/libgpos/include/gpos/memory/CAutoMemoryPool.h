@@ -48,6 +48,12 @@ public:
 		ElcStrict  // always check for leaks
 	};
 
+	enum EPoolType
+	{
+		EptDefault,	 // pool of the kind handled by the memory pool manager
+		EptArena	 // arena pool, freed in bulk when going out of scope
+	};
+
 private:
 	// memory pool to protect
 	CMemoryPool *m_mp;
@@ -61,7 +67,8 @@ public:
 	CAutoMemoryPool(const CAutoMemoryPool &) = delete;
 
 	// ctor
-	CAutoMemoryPool(ELeakCheck leak_check_type = ElcExc);
+	CAutoMemoryPool(ELeakCheck leak_check_type = ElcExc,
+					EPoolType pool_type = EptDefault);
 
 	// FIXME: should mark this noexcept in non-assert builds
 	// dtor
@@ -77,6 +77,12 @@ public:
 	using HashFuncPtr = ULONG (*)(const K &);
 	using EqualFuncPtr = BOOL (*)(const K &, const K &);
 
+	// type definition of function selecting the keys of entries to invalidate
+	using KeyFilterFuncPtr = BOOL (*)(const K &, void *);
+
+	// type definition of function visiting cached objects
+	using VisitorFuncPtr = void (*)(T, void *);
+
 private:
 	using CCacheHashTableEntry = CCacheEntry<T, K>;
 
@@ -186,7 +192,18 @@ private:
 		// if we do not allow duplicates, we need to check first
 		CCacheHashTableEntry *ret = entry;
 		CCacheHashTableEntry *found = nullptr;
-		if (!m_unique || (m_unique && nullptr == (found = acc.Find())))
+		if (m_unique)
+		{
+			// entries marked for deletion are invalidated and must not be
+			// handed out again, skip them
+			found = acc.Find();
+			while (nullptr != found && found->IsMarkedForDeletion())
+			{
+				found = acc.Next(found);
+			}
+		}
+
+		if (nullptr == found)
 		{
 			acc.Insert(entry);
 			m_cache_size += entry->Pmp()->TotalAllocatedSize();
@@ -507,6 +524,83 @@ public:
 		}
 	}
 
+	// Invalidate all entries whose key satisfies the given filter. Entries
+	// that are not in use are removed right away; entries that are still
+	// referenced are marked for deletion, so that they are no longer handed
+	// out and are removed as soon as they are released. Returns the number
+	// of invalidated entries.
+	ULONG
+	InvalidateEntries(KeyFilterFuncPtr filter_func, void *arg)
+	{
+		GPOS_ASSERT(nullptr != filter_func);
+
+		ULONG num_invalidated = 0;
+		CCacheHashtableIter iter(m_hash_table);
+
+		// if the iterator was already advanced by removing an entry
+		BOOL advanced = false;
+		while (advanced || iter.Advance())
+		{
+			advanced = false;
+			CCacheHashTableEntry *entry = nullptr;
+			BOOL deleted = false;
+			// Scope for CCacheHashtableIterAccessor
+			{
+				CCacheHashtableIterAccessor acc(iter);
+
+				entry = acc.Value();
+				if (nullptr != entry && !entry->IsMarkedForDeletion() &&
+					filter_func(entry->Key(), arg))
+				{
+					num_invalidated++;
+					m_cache_size -= entry->Pmp()->TotalAllocatedSize();
+
+					// as in eviction, the iterator accessor does not bump
+					// the ref counter of the entry
+					if (EXPECTED_REF_COUNT_FOR_DELETE == entry->RefCount())
+					{
+						// remove advances iterator automatically
+						acc.Remove(entry);
+						deleted = true;
+						advanced = true;
+					}
+					else
+					{
+						entry->MarkForDeletion();
+					}
+				}
+			}
+
+			if (deleted)
+			{
+				GPOS_ASSERT(nullptr != entry);
+				DestroyCacheEntry(entry);
+			}
+		}
+
+		return num_invalidated;
+	}
+
+	// Call the visitor on every cached object that is not marked for
+	// deletion. The visitor must not access the cache.
+	void
+	VisitEntries(VisitorFuncPtr visitor_func, void *arg)
+	{
+		GPOS_ASSERT(nullptr != visitor_func);
+
+		CCacheHashtableIter iter(m_hash_table);
+		while (iter.Advance())
+		{
+			CCacheHashtableIterAccessor acc(iter);
+
+			CCacheHashTableEntry *entry = acc.Value();
+			if (nullptr != entry && !entry->IsMarkedForDeletion())
+			{
+				visitor_func(entry->Val(), arg);
+			}
+		}
+	}
+
 	// return eviction factor (what percentage of cache size to evict)
 	float
 	GetEvictionFactor()
@@ -166,6 +166,13 @@ public:
 		return 0;
 	}
 
+	// return the highest total allocated size since the pool was created
+	virtual ULLONG
+	PeakAllocatedSize() const
+	{
+		return TotalAllocatedSize();
+	}
+
 	// requested size of allocation
 	static ULONG UserSizeOfAlloc(const void *ptr);
 
@@ -0,0 +1,187 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (c) 2023 VMware, Inc. or its affiliates. All Rights Reserved.
+//
+//	@filename:
+//		CMemoryPoolArena.h
+//
+//	@doc:
+//		Memory pool that carves allocations out of large blocks using a
+//		bump pointer; individual frees only update statistics, all memory
+//		is released in bulk when the pool is torn down
+//
+//---------------------------------------------------------------------------
+#ifndef GPOS_CMemoryPoolArena_H
+#define GPOS_CMemoryPoolArena_H
+
+#include "gpos/assert.h"
+#include "gpos/common/CList.h"
+#include "gpos/memory/CMemoryPool.h"
+#include "gpos/memory/CMemoryPoolStatistics.h"
+#include "gpos/types.h"
+
+// default size of a block requested from the backing pool
+#define GPOS_MEM_ARENA_BLOCK_SIZE (64 * 1024)
+
+// allocations larger than this get a dedicated block
+#define GPOS_MEM_ARENA_LARGE_ALLOC (GPOS_MEM_ARENA_BLOCK_SIZE / 4)
+
+namespace gpos
+{
+// Arena memory pool.
+//
+// Blocks are requested from a backing pool, which is a regular pool of the
+// kind the memory pool manager creates (CMemoryPoolTracker standalone,
+// CMemoryPoolPalloc inside GPDB), so the arena is accounted for wherever the
+// backing pool is. Freeing an object does not return its memory to the
+// arena; the pool is intended for short-lived, allocation-heavy work such as
+// a single optimization session.
+//
+// Every allocation is preceded by a small header that ends with a marker
+// word, which is how CMemoryPool::DeleteImpl recognizes arena allocations
+// regardless of the pool kind handled by the memory pool manager.
+class CMemoryPoolArena : public CMemoryPool
+{
+private:
+	// header of a block requested from the backing pool
+	struct SBlock
+	{
+		// next block in list
+		SBlock *m_next;
+
+		// usable size of block, excluding this header
+		ULONG m_size;
+
+		// bytes handed out from this block
+		ULONG m_used;
+	};
+
+	// header preceding each allocation; the marker must be the last member
+	struct SAllocHeader
+	{
+		// owning pool
+		CMemoryPoolArena *m_mp;
+
+		// user requested size
+		ULONG m_user_size;
+
+		// total size carved out of the block (including headers)
+		ULONG m_alloc_size;
+
+		// allocation type (singleton/array)
+		BYTE m_alloc_type;
+
+		// is the allocation linked in the live objects list
+		BOOL m_tracked;
+
+		// marker identifying arena allocations
+		ULONG_PTR m_marker;
+	};
+
+	// additional header of allocations made while tracking live objects;
+	// placed before SAllocHeader
+	struct STrackingHeader
+	{
+		// sequence number
+		ULLONG m_serial;
+
+		// file name
+		const CHAR *m_filename;
+
+		// line in file
+		ULONG m_line;
+
+		// link for live objects list
+		SLink m_link;
+	};
+
+	// pool blocks are requested from
+	CMemoryPool *m_backing_mp;
+
+	// list of blocks; the head is the block allocations are carved from
+	SBlock *m_blocks{nullptr};
+
+	// statistics
+	CMemoryPoolStatistics m_memory_pool_statistics;
+
+	// keep a list of live objects for leak checking
+	BOOL m_track_live_objects;
+
+	// allocation sequence number
+	ULLONG m_alloc_sequence{0};
+
+	// list of live objects, only maintained when tracking
+	CList<STrackingHeader> m_live_objects_list;
+
+	// request a block with the given usable size from the backing pool
+	SBlock *NewBlock(ULONG size);
+
+	// header of given user allocation
+	static SAllocHeader *
+	Header(const void *ptr)
+	{
+		return static_cast<SAllocHeader *>(const_cast<void *>(ptr)) - 1;
+	}
+
+	// tracking header of given allocation header
+	static STrackingHeader *TrackingHeader(SAllocHeader *header);
+
+protected:
+	// dtor
+	~CMemoryPoolArena() override;
+
+public:
+	CMemoryPoolArena(CMemoryPoolArena &) = delete;
+
+	// ctor
+	CMemoryPoolArena(CMemoryPool *backing_mp, BOOL track_live_objects);
+
+	// prepare the memory pool to be deleted
+	void TearDown() override;
+
+	// allocate memory
+	void *NewImpl(const ULONG bytes, const CHAR *file, const ULONG line,
+				  CMemoryPool::EAllocationType eat) override;
+
+	// check if the given pointer was allocated by an arena pool
+	static BOOL IsArenaAlloc(const void *ptr);
+
+	// free memory allocation
+	static void DeleteImpl(void *ptr, EAllocationType eat);
+
+	// get user requested size of allocation
+	static ULONG UserSizeOfAlloc(const void *ptr);
+
+	// return total size reserved from the backing pool
+	ULLONG
+	TotalAllocatedSize() const override
+	{
+		return m_memory_pool_statistics.ReservedSize();
+	}
+
+	// statistics accessor
+	const CMemoryPoolStatistics &
+	Statistics() const
+	{
+		return m_memory_pool_statistics;
+	}
+
+#ifdef GPOS_DEBUG
+
+	// check if the memory pool keeps track of live objects
+	BOOL
+	SupportsLiveObjectWalk() const override
+	{
+		return m_track_live_objects;
+	}
+
+	// walk the live objects
+	void WalkLiveObjects(gpos::IMemoryVisitor *visitor) override;
+
+#endif	// GPOS_DEBUG
+};
+}  // namespace gpos
+
+#endif	// !GPOS_CMemoryPoolArena_H
+
+// EOF
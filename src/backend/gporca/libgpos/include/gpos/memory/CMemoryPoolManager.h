@@ -62,6 +62,9 @@ private:
 	// create new pool of given type
 	virtual CMemoryPool *NewMemoryPool();
 
+	// add a newly created pool to the hash table of pools
+	void RegisterMemoryPool(CMemoryPool *mp);
+
 	// clean-up memory pools
 	static void Cleanup();
 
@@ -118,6 +121,10 @@ public:
 	// create new memory pool
 	static CMemoryPool *CreateMemoryPool();
 
+	// create new arena memory pool, carving allocations out of blocks
+	// of a pool of the kind handled by the manager
+	static CMemoryPool *CreateArenaMemoryPool(BOOL track_live_objects);
+
 	// release memory pool
 	static void Destroy(CMemoryPool *);
 
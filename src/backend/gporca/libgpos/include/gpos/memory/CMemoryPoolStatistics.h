@@ -38,6 +38,10 @@ private:
 
 	ULLONG m_live_obj_total_size{0};
 
+	ULLONG m_peak_live_obj_total_size{0};
+
+	ULLONG m_reserved_size{0};
+
 public:
 	CMemoryPoolStatistics(CMemoryPoolStatistics &) = delete;
 
@@ -90,6 +94,22 @@ public:
 		return m_live_obj_total_size;
 	}
 
+	// get the highest total data size of live objects seen so far
+	ULLONG
+	PeakLiveObjTotalSize() const
+	{
+		return m_peak_live_obj_total_size;
+	}
+
+	// get the size of memory reserved from the underlying allocator;
+	// exceeds the live objects size for pools that carve allocations out
+	// of larger blocks and do not reuse freed memory
+	ULLONG
+	ReservedSize() const
+	{
+		return m_reserved_size;
+	}
+
 	// record a successful allocation
 	void
 	RecordAllocation(ULONG user_data_size, ULONG total_data_size)
@@ -98,6 +118,10 @@ public:
 		++m_num_live_obj;
 		m_live_obj_user_size += user_data_size;
 		m_live_obj_total_size += total_data_size;
+		if (m_peak_live_obj_total_size < m_live_obj_total_size)
+		{
+			m_peak_live_obj_total_size = m_live_obj_total_size;
+		}
 	}
 
 	// record a successful free call (of a valid, non-NULL pointer)
@@ -110,6 +134,13 @@ public:
 		m_live_obj_total_size -= total_data_size;
 	}
 
+	// record memory reserved from the underlying allocator
+	void
+	RecordReservation(ULLONG size)
+	{
+		m_reserved_size += size;
+	}
+
 	// record a failed allocation attempt
 	void
 	RecordFailedAllocation()
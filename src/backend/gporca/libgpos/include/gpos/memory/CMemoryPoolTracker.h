@@ -108,6 +108,13 @@ public:
 		return m_memory_pool_statistics.TotalAllocatedSize();
 	}
 
+	// return the highest total allocated size
+	ULLONG
+	PeakAllocatedSize() const override
+	{
+		return m_memory_pool_statistics.PeakLiveObjTotalSize();
+	}
+
 #ifdef GPOS_DEBUG
 
 	// check if the memory pool keeps track of live objects
@@ -50,6 +50,12 @@ private:
 		//key equality function
 		static BOOL FMyEqual(ULONG *const &pvKey, ULONG *const &pvKeySecond);
 
+		// key filter selecting even keys
+		static BOOL FEvenKey(ULONG *const &pvKey, void *pvArg);
+
+		// visitor counting the visited objects
+		static void CountObject(SSimpleObject *pso, void *pvCount);
+
 		// equality for object-based comparison
 		BOOL
 		operator==(const SSimpleObject &obj) const
@@ -157,6 +163,7 @@ public:
 	static GPOS_RESULT EresUnittest_DeepObject();
 	static GPOS_RESULT EresUnittest_Iteration();
 	static GPOS_RESULT EresUnittest_IterativeDeletion();
+	static GPOS_RESULT EresUnittest_Invalidation();
 
 
 };	// class CCacheTest
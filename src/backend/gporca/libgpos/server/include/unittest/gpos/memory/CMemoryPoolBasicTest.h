@@ -31,9 +31,11 @@ private:
 
 	static GPOS_RESULT EresNewDelete();
 	static GPOS_RESULT EresThrowingCtor();
+	static GPOS_RESULT EresArenaNewDelete();
 #ifdef GPOS_DEBUG
 	static GPOS_RESULT EresLeak();
 	static GPOS_RESULT EresLeakByException();
+	static GPOS_RESULT EresArenaLeak();
 #endif	// GPOS_DEBUG
 
 	static ULONG Size(ULONG offset);
@@ -45,6 +47,7 @@ public:
 	static GPOS_RESULT EresUnittest_Print();
 #endif	// GPOS_DEBUG
 	static GPOS_RESULT EresUnittest_TestTracker();
+	static GPOS_RESULT EresUnittest_TestArena();
 	static GPOS_RESULT EresUnittest_TestSlab();
 
 };	// class CMemoryPoolBasicTest
@@ -47,7 +47,8 @@ CCacheTest::EresUnittest()
 		GPOS_UNITTEST_FUNC(CCacheTest::EresUnittest_Eviction),
 		GPOS_UNITTEST_FUNC(CCacheTest::EresUnittest_Iteration),
 		GPOS_UNITTEST_FUNC(CCacheTest::EresUnittest_DeepObject),
-		GPOS_UNITTEST_FUNC(CCacheTest::EresUnittest_IterativeDeletion)};
+		GPOS_UNITTEST_FUNC(CCacheTest::EresUnittest_IterativeDeletion),
+		GPOS_UNITTEST_FUNC(CCacheTest::EresUnittest_Invalidation)};
 
 	fUnique = true;
 	GPOS_RESULT eres = CUnittest::EresExecute(rgut, GPOS_ARRAY_SIZE(rgut));
@@ -974,4 +975,114 @@ CCacheTest::EresUnittest_IterativeDeletion()
 	return GPOS_OK;
 }
 
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CCacheTest::SSimpleObject::FEvenKey
+//
+//	@doc:
+//		Key filter selecting even keys
+//
+//---------------------------------------------------------------------------
+BOOL
+CCacheTest::SSimpleObject::FEvenKey(ULONG *const &pvKey, void *	 // pvArg
+)
+{
+	return 0 == *pvKey % 2;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CCacheTest::SSimpleObject::CountObject
+//
+//	@doc:
+//		Visitor counting the visited objects
+//
+//---------------------------------------------------------------------------
+void
+CCacheTest::SSimpleObject::CountObject(SSimpleObject *pso, void *pvCount)
+{
+	GPOS_ASSERT(nullptr != pso);
+
+	(*static_cast<ULONG *>(pvCount))++;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CCacheTest::EresUnittest_Invalidation
+//
+//	@doc:
+//		Invalidate selected entries while one of them is still in use
+//
+//---------------------------------------------------------------------------
+GPOS_RESULT
+CCacheTest::EresUnittest_Invalidation()
+{
+	CAutoP<CCache<SSimpleObject *, ULONG *> > apcache;
+	apcache = CCacheFactory::CreateCache<SSimpleObject *, ULONG *>(
+		fUnique, UNLIMITED_CACHE_QUOTA, SSimpleObject::UlMyHash,
+		SSimpleObject::FMyEqual);
+
+	CCache<SSimpleObject *, ULONG *> *pcache = apcache.Value();
+
+	for (ULONG i = 0; i < GPOS_CACHE_ELEMENTS; i++)
+	{
+		InsertOneElement(pcache, i);
+	}
+
+	// scope for accessor holding an entry that gets invalidated
+	{
+		CSimpleObjectCacheAccessor caHeld(pcache);
+		ULONG ulHeldKey = 0;
+		caHeld.Lookup(&ulHeldKey);
+		SSimpleObject *psoHeld = caHeld.Val();
+		GPOS_UNITTEST_ASSERT(nullptr != psoHeld);
+
+		// release object, the cache entry and the accessor still own it
+		psoHeld->Release();
+
+		ULONG ulInvalidated =
+			pcache->InvalidateEntries(SSimpleObject::FEvenKey, nullptr);
+		GPOS_UNITTEST_ASSERT(GPOS_CACHE_ELEMENTS / 2 == ulInvalidated);
+
+		// the held entry is only marked for deletion
+		GPOS_UNITTEST_ASSERT(GPOS_CACHE_ELEMENTS / 2 + 1 == pcache->Size());
+		GPOS_UNITTEST_ASSERT(0 == psoHeld->m_ulValue);
+
+		// but it is no longer visited
+		ULONG ulVisited = 0;
+		pcache->VisitEntries(SSimpleObject::CountObject, &ulVisited);
+		GPOS_UNITTEST_ASSERT(GPOS_CACHE_ELEMENTS / 2 == ulVisited);
+
+		for (ULONG i = 0; i < GPOS_CACHE_ELEMENTS; i++)
+		{
+			CSimpleObjectCacheAccessor ca(pcache);
+			ca.Lookup(&i);
+			SSimpleObject *pso = ca.Val();
+			GPOS_UNITTEST_ASSERT((0 == i % 2) == (nullptr == pso));
+
+			if (nullptr != pso)
+			{
+				pso->Release();
+			}
+		}
+
+		// an entry for the key of the held object can be inserted again
+		InsertOneElement(pcache, ulHeldKey);
+
+		CSimpleObjectCacheAccessor ca(pcache);
+		ca.Lookup(&ulHeldKey);
+		SSimpleObject *pso = ca.Val();
+		GPOS_UNITTEST_ASSERT(nullptr != pso && pso != psoHeld);
+		pso->Release();
+	}
+
+	// releasing the held entry removed it
+	GPOS_UNITTEST_ASSERT(GPOS_CACHE_ELEMENTS / 2 + 1 == pcache->Size());
+
+	return GPOS_OK;
+}
+
 // EOF
@@ -18,6 +18,7 @@
 #include "gpos/error/CException.h"
 #include "gpos/io/COstreamString.h"
 #include "gpos/memory/CAutoMemoryPool.h"
+#include "gpos/memory/CMemoryPoolArena.h"
 #include "gpos/memory/CMemoryVisitorPrint.h"
 #include "gpos/string/CWStringDynamic.h"
 #include "gpos/task/CAutoTaskProxy.h"
@@ -45,7 +46,8 @@ CMemoryPoolBasicTest::EresUnittest()
 #ifdef GPOS_DEBUG
 		GPOS_UNITTEST_FUNC(CMemoryPoolBasicTest::EresUnittest_Print),
 #endif	// GPOS_DEBUG
-		GPOS_UNITTEST_FUNC(CMemoryPoolBasicTest::EresUnittest_TestTracker)};
+		GPOS_UNITTEST_FUNC(CMemoryPoolBasicTest::EresUnittest_TestTracker),
+		GPOS_UNITTEST_FUNC(CMemoryPoolBasicTest::EresUnittest_TestArena)};
 
 	CAutoTraceFlag atf(EtraceTestMemoryPools, true /*value*/);
 
@@ -97,6 +99,31 @@ CMemoryPoolBasicTest::EresUnittest_TestTracker()
 }
 
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CMemoryPoolBasicTest::EresUnittest_TestArena
+//
+//	@doc:
+//		Run tests for arena pools
+//
+//---------------------------------------------------------------------------
+GPOS_RESULT
+CMemoryPoolBasicTest::EresUnittest_TestArena()
+{
+	if (GPOS_OK != EresArenaNewDelete()
+#ifdef GPOS_DEBUG
+		|| GPOS_OK !=
+			   EresTestExpectedError(EresArenaLeak, CException::ExmiAssert)
+#endif	// GPOS_DEBUG
+	)
+	{
+		return GPOS_FAILED;
+	}
+
+	return GPOS_OK;
+}
+
+
 //---------------------------------------------------------------------------
 //	@function:
 //		CMemoryPoolBasicTest::EresTestType
@@ -248,8 +275,95 @@ CMemoryPoolBasicTest::EresThrowingCtor()
 }
 
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CMemoryPoolBasicTest::EresArenaNewDelete
+//
+//	@doc:
+//		Allocation and free-ing in an arena pool, mixing block-sized and
+//		small allocations
+//
+//---------------------------------------------------------------------------
+GPOS_RESULT
+CMemoryPoolBasicTest::EresArenaNewDelete()
+{
+	CAutoTimer at("ArenaNewDelete test", true /*fPrint*/);
+	CAutoMemoryPool amp(CAutoMemoryPool::ElcStrict,
+						CAutoMemoryPool::EptArena);
+	CMemoryPool *mp = amp.Pmp();
+
+	const ULONG num_allocs = 1024;
+	ULONG *rgrgul[num_allocs];
+	for (ULONG ul = 0; ul < num_allocs; ul++)
+	{
+		// every 100th allocation does not fit in a regular block
+		const ULONG size =
+			(0 == ul % 100) ? GPOS_MEM_ARENA_BLOCK_SIZE : Size(ul);
+		rgrgul[ul] = GPOS_NEW_ARRAY(mp, ULONG, size);
+		rgrgul[ul][0] = ul;
+		rgrgul[ul][size - 1] = ul;
+
+		GPOS_UNITTEST_ASSERT(CMemoryPoolArena::IsArenaAlloc(rgrgul[ul]));
+		GPOS_UNITTEST_ASSERT(size * GPOS_SIZEOF(ULONG) ==
+							 CMemoryPool::UserSizeOfAlloc(rgrgul[ul]));
+	}
+
+	const CMemoryPoolStatistics &stats =
+		dynamic_cast<CMemoryPoolArena *>(mp)->Statistics();
+	GPOS_UNITTEST_ASSERT(num_allocs == stats.GetNumSuccessfulAllocations());
+	GPOS_UNITTEST_ASSERT(stats.LiveObjTotalSize() <= stats.ReservedSize());
+
+	for (ULONG ul = 0; ul < num_allocs; ul++)
+	{
+		GPOS_UNITTEST_ASSERT(ul == rgrgul[ul][0]);
+		GPOS_DELETE_ARRAY(rgrgul[ul]);
+	}
+
+	GPOS_UNITTEST_ASSERT(0 == stats.GetNumLiveObj());
+	GPOS_UNITTEST_ASSERT(0 < mp->TotalAllocatedSize());
+
+	return GPOS_OK;
+}
+
+
 #ifdef GPOS_DEBUG
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CMemoryPoolBasicTest::EresArenaLeak
+//
+//	@doc:
+//		Leak checking for arena pools
+//
+//---------------------------------------------------------------------------
+GPOS_RESULT
+CMemoryPoolBasicTest::EresArenaLeak()
+{
+	CAutoTraceFlag atfDump(EtracePrintMemoryLeakDump, true);
+	CAutoTimer at("ArenaLeak test", true /*fPrint*/);
+
+	// scope for pool
+	{
+		CAutoMemoryPool amp(CAutoMemoryPool::ElcStrict,
+							CAutoMemoryPool::EptArena);
+		CMemoryPool *mp = amp.Pmp();
+
+		for (ULONG i = 0; i < 10; i++)
+		{
+			ULONG *rgul = GPOS_NEW_ARRAY(mp, ULONG, 10);
+			rgul[2] = 1;
+
+			if (i < 8)
+			{
+				GPOS_DELETE_ARRAY(rgul);
+			}
+		}
+	}
+
+	return GPOS_FAILED;
+}
+
+
 //---------------------------------------------------------------------------
 //	@function:
 //		CMemoryPoolBasicTest::EresLeak
@@ -36,15 +36,28 @@ using namespace gpos;
 //
 //	@doc:
 //		Create an auto-managed pool; the managed pool is allocated from
-//  	the CMemoryPoolManager global instance
+//  	the CMemoryPoolManager global instance; arena pools keep track of
+//		live objects only in debug builds with leak checking
 //
 //---------------------------------------------------------------------------
-CAutoMemoryPool::CAutoMemoryPool(ELeakCheck leak_check_type GPOS_ASSERTS_ONLY)
+CAutoMemoryPool::CAutoMemoryPool(ELeakCheck leak_check_type GPOS_ASSERTS_ONLY,
+								 EPoolType pool_type)
 #ifdef GPOS_DEBUG
 	: m_leak_check_type(leak_check_type)
 #endif
 {
-	m_mp = CMemoryPoolManager::CreateMemoryPool();
+	if (EptArena == pool_type)
+	{
+		BOOL track_live_objects = false;
+#ifdef GPOS_DEBUG
+		track_live_objects = (ElcNone != leak_check_type);
+#endif	// GPOS_DEBUG
+		m_mp = CMemoryPoolManager::CreateArenaMemoryPool(track_live_objects);
+	}
+	else
+	{
+		m_mp = CMemoryPoolManager::CreateMemoryPool();
+	}
 }
 
 
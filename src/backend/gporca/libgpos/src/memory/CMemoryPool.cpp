@@ -14,6 +14,7 @@
 
 #include "gpos/memory/CMemoryPool.h"
 
+#include "gpos/memory/CMemoryPoolArena.h"
 #include "gpos/memory/CMemoryPoolManager.h"
 #include "gpos/memory/CMemoryPoolTracker.h"
 #include "gpos/memory/CMemoryVisitorPrint.h"
@@ -31,6 +32,12 @@ CMemoryPool::UserSizeOfAlloc(const void *ptr)
 {
 	GPOS_ASSERT(nullptr != ptr);
 
+	// arena pools may be created next to the pool kind handled by the manager
+	if (CMemoryPoolArena::IsArenaAlloc(ptr))
+	{
+		return CMemoryPoolArena::UserSizeOfAlloc(ptr);
+	}
+
 	return CMemoryPoolManager::GetMemoryPoolMgr()->UserSizeOfAlloc(ptr);
 }
 
@@ -38,6 +45,12 @@ CMemoryPool::UserSizeOfAlloc(const void *ptr)
 void
 CMemoryPool::DeleteImpl(void *ptr, EAllocationType eat)
 {
+	if (CMemoryPoolArena::IsArenaAlloc(ptr))
+	{
+		CMemoryPoolArena::DeleteImpl(ptr, eat);
+		return;
+	}
+
 	CMemoryPoolManager::GetMemoryPoolMgr()->DeleteImpl(ptr, eat);
 }
 
@@ -0,0 +1,249 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (c) 2023 VMware, Inc. or its affiliates. All Rights Reserved.
+//
+//	@filename:
+//		CMemoryPoolArena.cpp
+//
+//	@doc:
+//		Implementation of memory pool that carves allocations out of
+//		blocks of a backing pool and releases them in bulk
+//
+//---------------------------------------------------------------------------
+
+#include "gpos/memory/CMemoryPoolArena.h"
+
+#include "gpos/assert.h"
+#include "gpos/common/clibwrapper.h"
+#include "gpos/memory/IMemoryVisitor.h"
+#include "gpos/types.h"
+#include "gpos/utils.h"
+
+using namespace gpos;
+
+// marker stored in the last word of each allocation header; neither half of
+// it is a valid user-space address or a valid allocation size, so it can not
+// be mistaken for the trailing word of a tracker or palloc header
+#define GPOS_MEM_ARENA_MARKER ((ULONG_PTR) 0xA5E7A5E7A5E7A5E7ULL)
+
+#define GPOS_MEM_ARENA_BLOCK_HEADER_SIZE GPOS_MEM_ALIGNED_STRUCT_SIZE(SBlock)
+
+#define GPOS_MEM_ARENA_ALLOC_HEADER_SIZE \
+	GPOS_MEM_ALIGNED_STRUCT_SIZE(SAllocHeader)
+
+#define GPOS_MEM_ARENA_TRACKING_HEADER_SIZE \
+	GPOS_MEM_ALIGNED_STRUCT_SIZE(STrackingHeader)
+
+
+// ctor
+CMemoryPoolArena::CMemoryPoolArena(CMemoryPool *backing_mp,
+								   BOOL track_live_objects)
+	: CMemoryPool(),
+	  m_backing_mp(backing_mp),
+	  m_track_live_objects(track_live_objects)
+{
+	GPOS_ASSERT(nullptr != backing_mp);
+
+	m_live_objects_list.Init(GPOS_OFFSET(STrackingHeader, m_link));
+}
+
+
+// dtor
+CMemoryPoolArena::~CMemoryPoolArena()
+{
+	GPOS_ASSERT(nullptr == m_backing_mp);
+}
+
+
+// request a block with the given usable size from the backing pool
+CMemoryPoolArena::SBlock *
+CMemoryPoolArena::NewBlock(ULONG size)
+{
+	const ULONG block_size = GPOS_MEM_ARENA_BLOCK_HEADER_SIZE + size;
+
+	void *ptr = m_backing_mp->NewImpl(block_size, __FILE__, __LINE__,
+									  CMemoryPool::EatSingleton);
+
+	GPOS_OOM_CHECK(ptr);
+
+	SBlock *block = static_cast<SBlock *>(ptr);
+	block->m_next = nullptr;
+	block->m_size = size;
+	block->m_used = 0;
+
+	m_memory_pool_statistics.RecordReservation(block_size);
+
+	return block;
+}
+
+
+// tracking header of given allocation header
+CMemoryPoolArena::STrackingHeader *
+CMemoryPoolArena::TrackingHeader(SAllocHeader *header)
+{
+	GPOS_ASSERT(header->m_tracked);
+
+	return reinterpret_cast<STrackingHeader *>(
+		reinterpret_cast<BYTE *>(header) - GPOS_MEM_ARENA_TRACKING_HEADER_SIZE);
+}
+
+
+void *
+CMemoryPoolArena::NewImpl(const ULONG bytes, const CHAR *file,
+						  const ULONG line, CMemoryPool::EAllocationType eat)
+{
+	GPOS_ASSERT(bytes <= GPOS_MEM_ALLOC_MAX);
+	GPOS_ASSERT(nullptr != m_backing_mp);
+
+	const ULONG tracking_size =
+		m_track_live_objects ? GPOS_MEM_ARENA_TRACKING_HEADER_SIZE : 0;
+	const ULONG alloc_size = tracking_size + GPOS_MEM_ARENA_ALLOC_HEADER_SIZE +
+							 GPOS_MEM_ALIGNED_SIZE(bytes);
+
+	SBlock *block = m_blocks;
+	if (alloc_size > GPOS_MEM_ARENA_LARGE_ALLOC)
+	{
+		// large allocations get a dedicated block, which is linked behind
+		// the current block so that its remaining space is not wasted
+		block = NewBlock(alloc_size);
+		if (nullptr == m_blocks)
+		{
+			m_blocks = block;
+		}
+		else
+		{
+			block->m_next = m_blocks->m_next;
+			m_blocks->m_next = block;
+		}
+	}
+	else if (nullptr == block || block->m_size - block->m_used < alloc_size)
+	{
+		block = NewBlock(GPOS_MEM_ARENA_BLOCK_SIZE);
+		block->m_next = m_blocks;
+		m_blocks = block;
+	}
+
+	GPOS_ASSERT(block->m_size - block->m_used >= alloc_size);
+
+	BYTE *base = reinterpret_cast<BYTE *>(block) +
+				 GPOS_MEM_ARENA_BLOCK_HEADER_SIZE + block->m_used;
+	block->m_used += alloc_size;
+
+	SAllocHeader *header =
+		reinterpret_cast<SAllocHeader *>(base + tracking_size);
+	header->m_mp = this;
+	header->m_user_size = bytes;
+	header->m_alloc_size = alloc_size;
+	header->m_alloc_type = (BYTE) eat;
+	header->m_tracked = m_track_live_objects;
+	header->m_marker = GPOS_MEM_ARENA_MARKER;
+
+	if (m_track_live_objects)
+	{
+		STrackingHeader *tracking_header =
+			reinterpret_cast<STrackingHeader *>(base);
+		tracking_header->m_serial = m_alloc_sequence;
+		++m_alloc_sequence;
+		tracking_header->m_filename = file;
+		tracking_header->m_line = line;
+
+		m_live_objects_list.Prepend(tracking_header);
+	}
+
+	m_memory_pool_statistics.RecordAllocation(bytes, alloc_size);
+
+	void *ptr_result = header + 1;
+
+#ifdef GPOS_DEBUG
+	clib::Memset(ptr_result, GPOS_MEM_INIT_PATTERN_CHAR, bytes);
+#endif	// GPOS_DEBUG
+
+	return ptr_result;
+}
+
+
+// check if the given pointer was allocated by an arena pool
+BOOL
+CMemoryPoolArena::IsArenaAlloc(const void *ptr)
+{
+	GPOS_ASSERT(nullptr != ptr);
+
+	return GPOS_MEM_ARENA_MARKER == *(static_cast<const ULONG_PTR *>(ptr) - 1);
+}
+
+
+// free memory allocation; the memory itself is reclaimed at tear down
+void
+CMemoryPoolArena::DeleteImpl(void *ptr, EAllocationType eat)
+{
+	SAllocHeader *header = Header(ptr);
+
+	// this assert ensures we aren't writing past allocated memory
+	GPOS_RTL_ASSERT(eat == EatUnknown || header->m_alloc_type == eat);
+
+	CMemoryPoolArena *mp = header->m_mp;
+	GPOS_ASSERT(nullptr != mp);
+
+	if (header->m_tracked)
+	{
+		mp->m_live_objects_list.Remove(TrackingHeader(header));
+	}
+
+	mp->m_memory_pool_statistics.RecordFree(header->m_user_size,
+											header->m_alloc_size);
+
+#ifdef GPOS_DEBUG
+	// mark user memory as unused in debug mode
+	clib::Memset(ptr, GPOS_MEM_FREED_PATTERN_CHAR, header->m_user_size);
+#endif	// GPOS_DEBUG
+}
+
+
+// get user requested size of allocation
+ULONG
+CMemoryPoolArena::UserSizeOfAlloc(const void *ptr)
+{
+	return Header(ptr)->m_user_size;
+}
+
+
+// Prepare the memory pool to be deleted; all blocks are handed back to the
+// backing pool at once
+void
+CMemoryPoolArena::TearDown()
+{
+	m_live_objects_list.Init(GPOS_OFFSET(STrackingHeader, m_link));
+	m_blocks = nullptr;
+
+	m_backing_mp->TearDown();
+	GPOS_DELETE(m_backing_mp);
+	m_backing_mp = nullptr;
+}
+
+
+#ifdef GPOS_DEBUG
+
+void
+CMemoryPoolArena::WalkLiveObjects(gpos::IMemoryVisitor *visitor)
+{
+	GPOS_ASSERT(nullptr != visitor);
+
+	STrackingHeader *tracking_header = m_live_objects_list.First();
+	while (nullptr != tracking_header)
+	{
+		SAllocHeader *header = reinterpret_cast<SAllocHeader *>(
+			reinterpret_cast<BYTE *>(tracking_header) +
+			GPOS_MEM_ARENA_TRACKING_HEADER_SIZE);
+
+		visitor->Visit(header + 1, header->m_user_size, tracking_header,
+					   header->m_alloc_size, tracking_header->m_filename,
+					   tracking_header->m_line, tracking_header->m_serial,
+					   nullptr);
+
+		tracking_header = m_live_objects_list.Next(tracking_header);
+	}
+}
+
+#endif	// GPOS_DEBUG
+
+// EOF
@@ -18,6 +18,7 @@
 #include "gpos/common/clibwrapper.h"
 #include "gpos/error/CAutoTrace.h"
 #include "gpos/memory/CMemoryPool.h"
+#include "gpos/memory/CMemoryPoolArena.h"
 #include "gpos/memory/CMemoryPoolTracker.h"
 #include "gpos/memory/CMemoryVisitorPrint.h"
 #include "gpos/task/CAutoSuspendAbort.h"
@@ -80,19 +81,40 @@ CMemoryPoolManager::CreateMemoryPool()
 	GPOS_ASSERT(nullptr != m_memory_pool_mgr);
 	CMemoryPool *mp = m_memory_pool_mgr->NewMemoryPool();
 
-	// accessor scope
-	{
-		// HERE BE DRAGONS
-		// See comment in CCache::InsertEntry
-		const ULONG_PTR hashKey = mp->GetHashKey();
-		MemoryPoolKeyAccessor acc(*m_memory_pool_mgr->m_ht_all_pools, hashKey);
-		acc.Insert(mp);
-	}
+	m_memory_pool_mgr->RegisterMemoryPool(mp);
 
 	return mp;
 }
 
 
+// Create a new arena memory pool; the backing pool is owned by the arena and
+// is not registered with the manager
+CMemoryPool *
+CMemoryPoolManager::CreateArenaMemoryPool(BOOL track_live_objects)
+{
+	GPOS_ASSERT(nullptr != m_memory_pool_mgr);
+	CMemoryPool *backing_mp = m_memory_pool_mgr->NewMemoryPool();
+	CMemoryPool *mp = GPOS_NEW(m_memory_pool_mgr->m_internal_memory_pool)
+		CMemoryPoolArena(backing_mp, track_live_objects);
+
+	m_memory_pool_mgr->RegisterMemoryPool(mp);
+
+	return mp;
+}
+
+
+// Add a newly created pool to the hash table of pools
+void
+CMemoryPoolManager::RegisterMemoryPool(CMemoryPool *mp)
+{
+	// HERE BE DRAGONS
+	// See comment in CCache::InsertEntry
+	const ULONG_PTR hashKey = mp->GetHashKey();
+	MemoryPoolKeyAccessor acc(*m_ht_all_pools, hashKey);
+	acc.Insert(mp);
+}
+
+
 // Allocate a new NewMemoryPool
 CMemoryPool *
 CMemoryPoolManager::NewMemoryPool()
@@ -57,6 +57,15 @@ private:
 	// double value used for statistic computation
 	CDouble m_stats_comp_val_double;
 
+	// cached sort key (can be set from const methods)
+	mutable BYTE *m_sort_key;
+
+	// length of the cached sort key
+	mutable ULONG m_sort_key_len;
+
+	// batch the cached sort key was computed in
+	mutable ULONG m_sort_key_batch;
+
 public:
 	CDatumGenericGPDB(const CDatumGenericGPDB &) = delete;
 
@@ -126,6 +135,13 @@ public:
 	// byte array representation of datum
 	const BYTE *GetByteArrayValue() const override;
 
+	// cached sort key
+	const BYTE *GetSortKey(ULONG *key_len, ULONG *batch) const override;
+
+	// cache a sort key
+	void SetSortKey(const BYTE *key, ULONG key_len,
+					ULONG batch) const override;
+
 	// stats equality
 	BOOL StatsAreEqual(const IDatum *datum) const override;
 
@@ -45,6 +45,15 @@ public:
 		return IMDType::EtiGeneric;
 	}
 
+	// sort key cached on the datum, or null if none was computed; keys
+	// compare bytewise if they have the same batch number, batch zero
+	// keys are comparable with all other batch zero keys
+	virtual const BYTE *GetSortKey(ULONG *key_len, ULONG *batch) const = 0;
+
+	// cache a sort key on the datum (can be set from const methods)
+	virtual void SetSortKey(const BYTE *key, ULONG key_len,
+							ULONG batch) const = 0;
+
 };	// class IDatumGeneric
 
 }  // namespace gpnaucrates
@@ -87,6 +87,13 @@ public:
 	static CParseHandlerDXL *GetParseHandlerForDXLFile(
 		CMemoryPool *, const CHAR *dxl_filename, const CHAR *xsd_file_path);
 
+	// same as above for a file in binary DXL format
+	static CParseHandlerDXL *GetParseHandlerForDXLBinaryFile(
+		CMemoryPool *, const CHAR *dxl_filename);
+
+	// is the given file in binary DXL format
+	static BOOL IsDXLBinaryFile(const CHAR *dxl_filename);
+
 	// parse a DXL document containing a DXL plan
 	static CDXLNode *GetPlanDXLNode(CMemoryPool *, const CHAR *dxl_string,
 									const CHAR *xsd_file_path, ULLONG *plan_id,
@@ -145,6 +145,7 @@ enum Edxlopid
 	EdxlopPhysicalSort,
 	EdxlopPhysicalAppend,
 	EdxlopPhysicalMaterialize,
+	EdxlopPhysicalMemoize,
 	EdxlopPhysicalDynamicForeignScan,
 	EdxlopPhysicalSequence,
 	EdxlopPhysicalDynamicTableScan,
@@ -45,6 +45,10 @@ private:
 	// average row width in bytes
 	CWStringDynamic *m_width_str;
 
+	// fingerprint of the subexpression the rows are estimated for, zero if
+	// the rows are not reported back as cardinality feedback
+	ULLONG m_cardinality_fingerprint;
+
 public:
 	CDXLOperatorCost(const CDXLOperatorCost &) = delete;
 
@@ -69,6 +73,19 @@ public:
 
 	// set the total cost
 	void SetCost(CWStringDynamic *str);
+
+	// fingerprint for cardinality feedback
+	ULLONG
+	GetCardinalityFingerprint() const
+	{
+		return m_cardinality_fingerprint;
+	}
+
+	void
+	SetCardinalityFingerprint(ULLONG fingerprint)
+	{
+		m_cardinality_fingerprint = fingerprint;
+	}
 };
 }  // namespace gpdxl
 
@@ -43,16 +43,28 @@ enum Edxlhj
 class CDXLPhysicalHashJoin : public CDXLPhysicalJoin
 {
 private:
+	// true if the outer tuples are filtered by a runtime filter built from
+	// the hash keys of the inner tuples
+	BOOL m_runtime_filter;
+
 public:
 	CDXLPhysicalHashJoin(const CDXLPhysicalHashJoin &) = delete;
 
 	// ctor/dtor
-	CDXLPhysicalHashJoin(CMemoryPool *mp, EdxlJoinType join_type);
+	CDXLPhysicalHashJoin(CMemoryPool *mp, EdxlJoinType join_type,
+						 BOOL runtime_filter = false);
 
 	// accessors
 	Edxlopid GetDXLOperator() const override;
 	const CWStringConst *GetOpNameStr() const override;
 
+	// are the outer tuples filtered by a runtime filter
+	BOOL
+	HasRuntimeFilter() const
+	{
+		return m_runtime_filter;
+	}
+
 	// serialize operator in DXL format
 	void SerializeToDXL(CXMLSerializer *xml_serializer,
 						const CDXLNode *dxlnode) const override;
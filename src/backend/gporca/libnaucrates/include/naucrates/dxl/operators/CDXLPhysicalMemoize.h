@@ -0,0 +1,102 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (c) 2023 VMware, Inc. or its affiliates. All Rights Reserved.
+//
+//	@filename:
+//		CDXLPhysicalMemoize.h
+//
+//	@doc:
+//		Class for representing DXL physical memoize operators.
+//---------------------------------------------------------------------------
+
+#ifndef GPDXL_CDXLPhysicalMemoize_H
+#define GPDXL_CDXLPhysicalMemoize_H
+
+#include "gpos/base.h"
+
+#include "naucrates/dxl/operators/CDXLPhysical.h"
+
+
+namespace gpdxl
+{
+// indices of memoize elements in the children array
+enum Edxlmemoize
+{
+	EdxlmemoizeIndexProjList = 0,
+	EdxlmemoizeIndexFilter,
+	EdxlmemoizeIndexChild,
+	EdxlmemoizeIndexSentinel
+};
+
+//---------------------------------------------------------------------------
+//	@class:
+//		CDXLPhysicalMemoize
+//
+//	@doc:
+//		Class for representing DXL memoize operators, which cache the
+//		results of their child for each distinct value of the cache keys.
+//		The cache keys are outer references of the child that are bound by
+//		the parameters of an enclosing nested loop join.
+//
+//---------------------------------------------------------------------------
+class CDXLPhysicalMemoize : public CDXLPhysical
+{
+private:
+	// ids of the columns the results are cached by
+	ULongPtrArray *m_cache_key_colids;
+
+	// estimated number of distinct cache keys
+	CDouble m_num_distinct;
+
+public:
+	CDXLPhysicalMemoize(CDXLPhysicalMemoize &) = delete;
+
+	// ctor
+	CDXLPhysicalMemoize(CMemoryPool *mp, ULongPtrArray *cache_key_colids,
+						CDouble num_distinct);
+
+	// dtor
+	~CDXLPhysicalMemoize() override;
+
+	// accessors
+	Edxlopid GetDXLOperator() const override;
+	const CWStringConst *GetOpNameStr() const override;
+
+	// ids of the cache key columns
+	ULongPtrArray *
+	GetCacheKeyColIds() const
+	{
+		return m_cache_key_colids;
+	}
+
+	// estimated number of distinct cache keys
+	CDouble
+	GetNumDistinct() const
+	{
+		return m_num_distinct;
+	}
+
+	// serialize operator in DXL format
+	void SerializeToDXL(CXMLSerializer *xml_serializer,
+						const CDXLNode *node) const override;
+
+	// conversion function
+	static CDXLPhysicalMemoize *
+	Cast(CDXLOperator *dxl_op)
+	{
+		GPOS_ASSERT(nullptr != dxl_op);
+		GPOS_ASSERT(EdxlopPhysicalMemoize == dxl_op->GetDXLOperator());
+
+		return dynamic_cast<CDXLPhysicalMemoize *>(dxl_op);
+	}
+
+#ifdef GPOS_DEBUG
+	// checks whether the operator has valid structure, i.e. number and
+	// types of child nodes
+	void AssertValid(const CDXLNode *, BOOL validate_children) const override;
+#endif	// GPOS_DEBUG
+};
+}  // namespace gpdxl
+#endif	// !GPDXL_CDXLPhysicalMemoize_H
+
+// EOF
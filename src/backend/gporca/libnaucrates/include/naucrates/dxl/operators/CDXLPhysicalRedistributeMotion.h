@@ -28,6 +28,7 @@ enum Edxlrm
 	EdxlrmIndexSortColList,
 	EdxlrmIndexHashExprList,
 	EdxlrmIndexChild,
+	EdxlrmIndexSkewValuesList,	// only present in hybrid redistribute motions
 	EdxlrmIndexSentinel
 };
 
@@ -47,6 +48,11 @@ private:
 	// is this a duplicate sensitive redistribute motion
 	BOOL m_is_duplicate_sensitive;
 
+	// are the rows with a value of the skew values list routed apart
+	BOOL m_has_skew_values;
+
+	// are such rows broadcast rather than sent to a random segment
+	BOOL m_is_skew_broadcast;
 
 public:
 	CDXLPhysicalRedistributeMotion(const CDXLPhysicalRedistributeMotion &) =
@@ -54,7 +60,9 @@ public:
 
 	// ctor
 	CDXLPhysicalRedistributeMotion(CMemoryPool *mp,
-								   BOOL is_duplicate_sensitive);
+								   BOOL is_duplicate_sensitive,
+								   BOOL has_skew_values = false,
+								   BOOL is_skew_broadcast = false);
 
 	// accessors
 	Edxlopid GetDXLOperator() const override;
@@ -67,6 +75,20 @@ public:
 		return m_is_duplicate_sensitive;
 	}
 
+	// does motion route the rows with a skew value apart
+	BOOL
+	HasSkewValues() const
+	{
+		return m_has_skew_values;
+	}
+
+	// are the rows with a skew value broadcast
+	BOOL
+	IsSkewBroadcast() const
+	{
+		return m_is_skew_broadcast;
+	}
+
 	// index of relational child node in the children array
 	ULONG
 	GetRelationChildIdx() const override
@@ -46,18 +46,30 @@ private:
 	// whether sort discards duplicates
 	BOOL m_discard_duplicates;
 
+	// number of leading sort columns the input is already sorted on,
+	// non-zero for incremental sorts only
+	ULONG m_num_presorted_keys;
+
 
 public:
 	CDXLPhysicalSort(const CDXLPhysicalSort &) = delete;
 
 	// ctor/dtor
-	CDXLPhysicalSort(CMemoryPool *mp, BOOL discard_duplicates);
+	CDXLPhysicalSort(CMemoryPool *mp, BOOL discard_duplicates,
+					 ULONG num_presorted_keys = 0);
 
 	// accessors
 	Edxlopid GetDXLOperator() const override;
 	const CWStringConst *GetOpNameStr() const override;
 	BOOL FDiscardDuplicates() const;
 
+	// number of presorted keys
+	ULONG
+	GetNumPresortedKeys() const
+	{
+		return m_num_presorted_keys;
+	}
+
 	// serialize operator in DXL format
 	void SerializeToDXL(CXMLSerializer *xml_serializer,
 						const CDXLNode *dxlnode) const override;
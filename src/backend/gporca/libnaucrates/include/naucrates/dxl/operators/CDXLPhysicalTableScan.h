@@ -43,13 +43,17 @@ private:
 	// table descriptor for the scanned table
 	CDXLTableDescr *m_dxl_table_descr;
 
+	// number of workers sharing the scan on each segment, 0 if not parallel
+	ULONG m_parallel_workers;
+
 public:
 	CDXLPhysicalTableScan(CDXLPhysicalTableScan &) = delete;
 
 	// ctors
 	explicit CDXLPhysicalTableScan(CMemoryPool *mp);
 
-	CDXLPhysicalTableScan(CMemoryPool *mp, CDXLTableDescr *table_descr);
+	CDXLPhysicalTableScan(CMemoryPool *mp, CDXLTableDescr *table_descr,
+						  ULONG parallel_workers = 0);
 
 	// dtor
 	~CDXLPhysicalTableScan() override;
@@ -57,6 +61,12 @@ public:
 	// setters
 	void SetTableDescriptor(CDXLTableDescr *);
 
+	void
+	SetParallelWorkers(ULONG parallel_workers)
+	{
+		m_parallel_workers = parallel_workers;
+	}
+
 	// operator type
 	Edxlopid GetDXLOperator() const override;
 
@@ -66,6 +76,13 @@ public:
 	// table descriptor
 	const CDXLTableDescr *GetDXLTableDescr();
 
+	// number of workers sharing the scan on each segment
+	ULONG
+	GetParallelWorkers() const
+	{
+		return m_parallel_workers;
+	}
+
 	// serialize operator in DXL format
 	void SerializeToDXL(CXMLSerializer *xml_serializer,
 						const CDXLNode *dxlnode) const override;
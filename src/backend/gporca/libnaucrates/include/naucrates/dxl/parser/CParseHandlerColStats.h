@@ -22,6 +22,11 @@ namespace gpmd
 class CMDIdColStats;
 }
 
+namespace gpnaucrates
+{
+class CHyperLogLog;
+}
+
 namespace gpdxl
 {
 using namespace gpos;
@@ -62,6 +67,9 @@ private:
 	// is the column statistics missing in the database
 	BOOL m_is_column_stats_missing;
 
+	// sketch of the distinct values, if any
+	CHyperLogLog *m_hll;
+
 	// process the start of an element
 	void StartElement(
 		const XMLCh *const element_uri,			// URI of element's namespace
@@ -0,0 +1,83 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (c) 2023 VMware, Inc. or its affiliates. All Rights Reserved.
+//
+//	@filename:
+//		CParseHandlerExtStatsMCVList.h
+//
+//	@doc:
+//		SAX parse handler class for parsing an extended stats MCV list
+//---------------------------------------------------------------------------
+
+#ifndef GPDXL_CParseHandlerExtStatsMCVList_H
+#define GPDXL_CParseHandlerExtStatsMCVList_H
+
+#include "gpos/base.h"
+
+#include "naucrates/dxl/parser/CParseHandlerMetadataObject.h"
+#include "naucrates/md/CMDMCVList.h"
+
+namespace gpdxl
+{
+using namespace gpos;
+using namespace gpmd;
+using namespace gpnaucrates;
+
+XERCES_CPP_NAMESPACE_USE
+
+class CParseHandlerExtStatsMCVList : public CParseHandlerBase
+{
+private:
+	// attnos of the dimensions
+	CBitSet *m_attnos;
+
+	// items parsed so far
+	CMDMCVItemArray *m_items;
+
+	// frequency of the item being parsed
+	CDouble m_frequency;
+
+	// base frequency of the item being parsed
+	CDouble m_base_frequency;
+
+	// values of the item being parsed
+	CDXLDatumArray *m_values;
+
+	// MCV list object
+	CMDMCVList *m_mcv_list;
+
+	// process the start of an element
+	void StartElement(
+		const XMLCh *const element_uri,			// URI of element's namespace
+		const XMLCh *const element_local_name,	// local part of element's name
+		const XMLCh *const element_qname,		// element's qname
+		const Attributes &attr					// element's attributes
+		) override;
+
+	// process the end of an element
+	void EndElement(
+		const XMLCh *const element_uri,			// URI of element's namespace
+		const XMLCh *const element_local_name,	// local part of element's name
+		const XMLCh *const element_qname		// element's qname
+		) override;
+
+public:
+	CParseHandlerExtStatsMCVList(const CParseHandlerExtStatsMCVList &) =
+		delete;
+
+	// ctor
+	CParseHandlerExtStatsMCVList(CMemoryPool *mp,
+								 CParseHandlerManager *parse_handler_mgr,
+								 CParseHandlerBase *parse_handler_base);
+
+	// dtor
+	~CParseHandlerExtStatsMCVList() override;
+
+	// returns the constructed MCV list
+	CMDMCVList *GetMCVList() const;
+};
+}  // namespace gpdxl
+
+#endif	// !GPDXL_CParseHandlerExtStatsMCVList_H
+
+// EOF
@@ -202,6 +202,21 @@ private:
 		CMemoryPool *mp, CParseHandlerManager *parse_handler_mgr,
 		CParseHandlerBase *parse_handler_root);
 
+	// construct an extended stats MCV list parse handler
+	static CParseHandlerBase *CreateExtStatsMCVListParseHandler(
+		CMemoryPool *mp, CParseHandlerManager *parse_handler_mgr,
+		CParseHandlerBase *parse_handler_root);
+
+	// construct a parse handler for the materialized views of a relation
+	static CParseHandlerBase *CreateRelationMatViewsParseHandler(
+		CMemoryPool *mp, CParseHandlerManager *parse_handler_mgr,
+		CParseHandlerBase *parse_handler_root);
+
+	// construct a materialized view parse handler
+	static CParseHandlerBase *CreateMatViewParseHandler(
+		CMemoryPool *mp, CParseHandlerManager *parse_handler_mgr,
+		CParseHandlerBase *parse_handler_root);
+
 	// construct a column stats parse handler
 	static CParseHandlerBase *CreateColStatsParseHandler(
 		CMemoryPool *mp, CParseHandlerManager *parse_handler_mgr,
@@ -341,6 +356,11 @@ private:
 		CMemoryPool *mp, CParseHandlerManager *parse_handler_mgr,
 		CParseHandlerBase *parse_handler_root);
 
+	// construct a memoize parse handler
+	static CParseHandlerBase *CreateMemoizeParseHandler(
+		CMemoryPool *mp, CParseHandlerManager *parse_handler_mgr,
+		CParseHandlerBase *parse_handler_root);
+
 	// construct a dynamic table scan parse handler
 	static CParseHandlerBase *CreateDTSParseHandler(
 		CMemoryPool *mp, CParseHandlerManager *parse_handler_mgr,
@@ -0,0 +1,89 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (c) 2023 VMware, Inc. or its affiliates. All Rights Reserved.
+//
+//	@filename:
+//		CParseHandlerMatView.h
+//
+//	@doc:
+//		SAX parse handler class for parsing a materialized view definition
+//---------------------------------------------------------------------------
+
+#ifndef GPDXL_CParseHandlerMatView_H
+#define GPDXL_CParseHandlerMatView_H
+
+#include "gpos/base.h"
+
+#include "naucrates/dxl/parser/CParseHandlerBase.h"
+#include "naucrates/md/CMDMatView.h"
+
+namespace gpdxl
+{
+using namespace gpos;
+using namespace gpmd;
+
+XERCES_CPP_NAMESPACE_USE
+
+//---------------------------------------------------------------------------
+//	@class:
+//		CParseHandlerMatView
+//
+//	@doc:
+//		Parse handler class for a materialized view definition
+//
+//---------------------------------------------------------------------------
+class CParseHandlerMatView : public CParseHandlerBase
+{
+private:
+	// mdid of the view
+	IMDId *m_mdid;
+
+	// name of the view
+	CMDName *m_mdname;
+
+	// grouping attnos of the view, if any
+	ULongPtrArray *m_grouping_attnos;
+
+	// derivation of the view columns
+	CMDMatViewColumnArray *m_columns;
+
+	// filter of the view, if any
+	CDXLNode *m_filter;
+
+	// the constructed view
+	CMDMatView *m_matview;
+
+	// process the start of an element
+	void StartElement(
+		const XMLCh *const element_uri,			// URI of element's namespace
+		const XMLCh *const element_local_name,	// local part of element's name
+		const XMLCh *const element_qname,		// element's qname
+		const Attributes &attr					// element's attributes
+		) override;
+
+	// process the end of an element
+	void EndElement(
+		const XMLCh *const element_uri,			// URI of element's namespace
+		const XMLCh *const element_local_name,	// local part of element's name
+		const XMLCh *const element_qname		// element's qname
+		) override;
+
+public:
+	CParseHandlerMatView(const CParseHandlerMatView &) = delete;
+
+	// ctor
+	CParseHandlerMatView(CMemoryPool *mp,
+						 CParseHandlerManager *parse_handler_mgr,
+						 CParseHandlerBase *parse_handler_base);
+
+	// dtor
+	~CParseHandlerMatView() override;
+
+	// the constructed view
+	CMDMatView *GetMatView() const;
+};
+}  // namespace gpdxl
+
+#endif	// !GPDXL_CParseHandlerMatView_H
+
+// EOF
@@ -0,0 +1,69 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (c) 2023 VMware, Inc. or its affiliates. All Rights Reserved.
+//
+//	@filename:
+//		CParseHandlerMemoize.h
+//
+//	@doc:
+//		SAX parse handler class for parsing memoize operator nodes.
+//---------------------------------------------------------------------------
+
+#ifndef GPDXL_CParseHandlerMemoize_H
+#define GPDXL_CParseHandlerMemoize_H
+
+#include "gpos/base.h"
+
+#include "naucrates/dxl/operators/CDXLPhysicalMemoize.h"
+#include "naucrates/dxl/parser/CParseHandlerPhysicalOp.h"
+
+
+namespace gpdxl
+{
+using namespace gpos;
+
+
+XERCES_CPP_NAMESPACE_USE
+
+//---------------------------------------------------------------------------
+//	@class:
+//		CParseHandlerMemoize
+//
+//	@doc:
+//		Parse handler for parsing a memoize operator
+//
+//---------------------------------------------------------------------------
+class CParseHandlerMemoize : public CParseHandlerPhysicalOp
+{
+private:
+	// the memoize operator
+	CDXLPhysicalMemoize *m_dxl_op;
+
+	// process the start of an element
+	void StartElement(
+		const XMLCh *const element_uri,			// URI of element's namespace
+		const XMLCh *const element_local_name,	// local part of element's name
+		const XMLCh *const element_qname,		// element's qname
+		const Attributes &attr					// element's attributes
+		) override;
+
+	// process the end of an element
+	void EndElement(
+		const XMLCh *const element_uri,			// URI of element's namespace
+		const XMLCh *const element_local_name,	// local part of element's name
+		const XMLCh *const element_qname		// element's qname
+		) override;
+
+public:
+	CParseHandlerMemoize(const CParseHandlerMemoize &) = delete;
+
+	// ctor/dtor
+	CParseHandlerMemoize(CMemoryPool *mp,
+						 CParseHandlerManager *parse_handler_mgr,
+						 CParseHandlerBase *parse_handler_root);
+};
+}  // namespace gpdxl
+
+#endif	// !GPDXL_CParseHandlerMemoize_H
+
+// EOF
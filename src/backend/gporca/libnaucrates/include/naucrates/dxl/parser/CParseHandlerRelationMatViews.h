@@ -0,0 +1,73 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (c) 2023 VMware, Inc. or its affiliates. All Rights Reserved.
+//
+//	@filename:
+//		CParseHandlerRelationMatViews.h
+//
+//	@doc:
+//		SAX parse handler class for parsing the materialized views of a
+//		relation
+//---------------------------------------------------------------------------
+
+#ifndef GPDXL_CParseHandlerRelationMatViews_H
+#define GPDXL_CParseHandlerRelationMatViews_H
+
+#include "gpos/base.h"
+
+#include "naucrates/dxl/parser/CParseHandlerMetadataObject.h"
+#include "naucrates/md/CMDMatView.h"
+
+namespace gpdxl
+{
+using namespace gpos;
+using namespace gpmd;
+
+XERCES_CPP_NAMESPACE_USE
+
+//---------------------------------------------------------------------------
+//	@class:
+//		CParseHandlerRelationMatViews
+//
+//	@doc:
+//		Parse handler class for the materialized views of a relation
+//
+//---------------------------------------------------------------------------
+class CParseHandlerRelationMatViews : public CParseHandlerMetadataObject
+{
+private:
+	// mdid of the metadata object
+	IMDId *m_mdid;
+
+	// name of the relation
+	CMDName *m_mdname;
+
+	// process the start of an element
+	void StartElement(
+		const XMLCh *const element_uri,			// URI of element's namespace
+		const XMLCh *const element_local_name,	// local part of element's name
+		const XMLCh *const element_qname,		// element's qname
+		const Attributes &attr					// element's attributes
+		) override;
+
+	// process the end of an element
+	void EndElement(
+		const XMLCh *const element_uri,			// URI of element's namespace
+		const XMLCh *const element_local_name,	// local part of element's name
+		const XMLCh *const element_qname		// element's qname
+		) override;
+
+public:
+	CParseHandlerRelationMatViews(const CParseHandlerRelationMatViews &) =
+		delete;
+
+	// ctor
+	CParseHandlerRelationMatViews(CMemoryPool *mp,
+								  CParseHandlerManager *parse_handler_mgr,
+								  CParseHandlerBase *parse_handler_base);
+};
+}  // namespace gpdxl
+
+#endif	// !GPDXL_CParseHandlerRelationMatViews_H
+
+// EOF
@@ -40,6 +40,7 @@
 #include "naucrates/dxl/parser/CParseHandlerExtStatsDependencies.h"
 #include "naucrates/dxl/parser/CParseHandlerExtStatsDependency.h"
 #include "naucrates/dxl/parser/CParseHandlerExtStatsInfo.h"
+#include "naucrates/dxl/parser/CParseHandlerExtStatsMCVList.h"
 #include "naucrates/dxl/parser/CParseHandlerExtStatsNDistinct.h"
 #include "naucrates/dxl/parser/CParseHandlerExtStatsNDistinctList.h"
 #include "naucrates/dxl/parser/CParseHandlerFactory.h"
@@ -88,7 +89,9 @@
 #include "naucrates/dxl/parser/CParseHandlerMDRequest.h"
 #include "naucrates/dxl/parser/CParseHandlerMDScCmp.h"
 #include "naucrates/dxl/parser/CParseHandlerMDType.h"
+#include "naucrates/dxl/parser/CParseHandlerMatView.h"
 #include "naucrates/dxl/parser/CParseHandlerMaterialize.h"
+#include "naucrates/dxl/parser/CParseHandlerMemoize.h"
 #include "naucrates/dxl/parser/CParseHandlerMergeJoin.h"
 #include "naucrates/dxl/parser/CParseHandlerMetadata.h"
 #include "naucrates/dxl/parser/CParseHandlerMetadataColumn.h"
@@ -120,6 +123,7 @@
 #include "naucrates/dxl/parser/CParseHandlerRedistributeMotion.h"
 #include "naucrates/dxl/parser/CParseHandlerRelStats.h"
 #include "naucrates/dxl/parser/CParseHandlerRelationExtendedStats.h"
+#include "naucrates/dxl/parser/CParseHandlerRelationMatViews.h"
 #include "naucrates/dxl/parser/CParseHandlerResult.h"
 #include "naucrates/dxl/parser/CParseHandlerRoutedMotion.h"
 #include "naucrates/dxl/parser/CParseHandlerScalarAggref.h"
@@ -0,0 +1,104 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (c) 2023 VMware, Inc. or its affiliates. All Rights Reserved.
+//
+//	@filename:
+//		CDXLBinaryFormat.h
+//
+//	@doc:
+//		Constants of the binary encoding of DXL documents
+//---------------------------------------------------------------------------
+#ifndef GPDXL_CDXLBinaryFormat_H
+#define GPDXL_CDXLBinaryFormat_H
+
+#include "gpos/base.h"
+
+namespace gpdxl
+{
+using namespace gpos;
+
+//---------------------------------------------------------------------------
+//	@class:
+//		CDXLBinaryFormat
+//
+//	@doc:
+//		Binary DXL encodes the same elements and attributes as XML DXL, as a
+//		stream of records following a header made of a magic number and a
+//		version byte. Unsigned integers are varints of 7 bits per byte,
+//		strings are UTF-8 and prefixed by their length in bytes.
+//
+//		An open record holds the name of the element, the number of
+//		attributes and the attributes as pairs of name and value; a close
+//		record closes the innermost open element and holds no name; a text
+//		record holds character data other than whitespace.
+//
+//		A name is written out the first time it is used, with a reference
+//		of zero, and referenced by its number from then on. A value is
+//		either a literal string, a decimal integer stored as a zigzag
+//		varint, or a reference to an earlier literal; short literals are
+//		numbered in the order they appear until the dictionary is full.
+//
+//---------------------------------------------------------------------------
+class CDXLBinaryFormat
+{
+public:
+	// records
+	enum ERecord
+	{
+		ErecOpen = 1,
+		ErecClose,
+		ErecText,
+
+		ErecSentinel
+	};
+
+	// kinds of values, stored in the low bits of the value header
+	enum EValue
+	{
+		EvalLiteral = 0,
+		EvalInteger,
+		EvalReference,
+
+		EvalSentinel
+	};
+
+	// number of bits of the value header holding the kind of value
+	static const ULONG ValueKindBits = 2;
+
+	// longest literal, in bytes, added to the value dictionary
+	static const ULONG MaxDictionaryValueLength = 64;
+
+	// maximum number of values in the value dictionary
+	static const ULONG MaxDictionaryValues = 1 << 16;
+
+	// largest number of decimal digits of an integer value
+	static const ULONG MaxIntegerDigits = 18;
+
+	// length of the header
+	static const ULONG HeaderLength = 5;
+
+	// version of the encoding
+	static const BYTE Version = 1;
+
+	// header: the magic number cannot start an XML document
+	static const BYTE *
+	Header()
+	{
+		static const BYTE header[HeaderLength] = {0x89, 'D', 'X', 'B',
+												  Version};
+		return header;
+	}
+
+	// does the given buffer start with the header of binary DXL
+	static BOOL
+	HasHeader(const BYTE *data, ULONG size)
+	{
+		return HeaderLength <= size &&
+			   0 == clib::Memcmp(data, Header(), HeaderLength);
+	}
+};
+}  // namespace gpdxl
+
+#endif	// !GPDXL_CDXLBinaryFormat_H
+
+// EOF
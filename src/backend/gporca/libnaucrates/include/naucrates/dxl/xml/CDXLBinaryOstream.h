@@ -0,0 +1,220 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (c) 2023 VMware, Inc. or its affiliates. All Rights Reserved.
+//
+//	@filename:
+//		CDXLBinaryOstream.h
+//
+//	@doc:
+//		Output stream encoding DXL documents in binary format
+//---------------------------------------------------------------------------
+#ifndef GPDXL_CDXLBinaryOstream_H
+#define GPDXL_CDXLBinaryOstream_H
+
+#include <ostream>
+
+#include "gpos/base.h"
+#include "gpos/common/CHashMap.h"
+#include "gpos/io/COstream.h"
+#include "gpos/string/CWStringConst.h"
+
+namespace gpdxl
+{
+using namespace gpos;
+
+//---------------------------------------------------------------------------
+//	@class:
+//		CDXLBinaryOstream
+//
+//	@doc:
+//		Output stream taking the XML text of a DXL document, as written by
+//		CXMLSerializer and the minidump sections, and writing its binary
+//		encoding to a byte stream. The text is tokenized as it arrives, so
+//		a document may be written in fragments of any size.
+//
+//		Only the XML produced by DXL serialization, and found in hand-written
+//		minidumps, is understood: elements, quoted attributes, character
+//		references, predefined entities and CDATA sections. Declarations,
+//		comments and whitespace between elements are dropped.
+//
+//---------------------------------------------------------------------------
+class CDXLBinaryOstream : public COstream
+{
+private:
+	// states of the tokenizer
+	enum EState
+	{
+		EstText,		// character data
+		EstTagStart,	// after '<'
+		EstElemName,	// name of an element
+		EstInTag,		// between attributes
+		EstAttrName,	// name of an attribute
+		EstAttrEq,		// between the name and the value of an attribute
+		EstAttrValue,	// quoted value of an attribute
+		EstEmptyTag,	// after '/' in an open tag
+		EstCloseTag,	// close tag
+		EstMarkup,		// after "<!"
+		EstCData,		// CDATA section
+		EstComment,		// comment
+		EstSkip,		// declaration
+		EstEntity,		// entity or character reference
+
+		EstSentinel
+	};
+
+	// growable array of characters or bytes
+	template <class T>
+	struct SBuffer
+	{
+		// elements
+		T *m_data{nullptr};
+
+		// number of elements
+		ULONG m_size{0};
+
+		// number of allocated elements
+		ULONG m_capacity{0};
+	};
+
+	// map of names or values to their numbers
+	using StringToUlongMap =
+		CHashMap<CWStringConst, ULONG, CWStringConst::HashValue,
+				 CWStringConst::Equals, CleanupDelete<CWStringConst>,
+				 CleanupDelete<ULONG>>;
+
+	// maximum length of an entity name
+	static const ULONG MaxEntityLength = 16;
+
+	// memory pool
+	CMemoryPool *m_mp;
+
+	// underlying byte stream
+	std::ostream &m_os;
+
+	// state of the tokenizer
+	EState m_state{EstText};
+
+	// state to return to after an entity
+	EState m_state_entity_return{EstText};
+
+	// quote of the attribute value being read
+	WCHAR m_quote{'"'};
+
+	// name of the entity being read
+	WCHAR m_entity[MaxEntityLength];
+
+	// length of the name of the entity being read
+	ULONG m_entity_length{0};
+
+	// number of characters matched by the markup being read: the start of
+	// a CDATA section, or the dashes or brackets that may end a comment or
+	// a CDATA section
+	ULONG m_markup_length{0};
+
+	// does the character data being read contain non-whitespace
+	BOOL m_has_text{false};
+
+	// name being read
+	SBuffer<WCHAR> m_name;
+
+	// attribute value or character data being read
+	SBuffer<WCHAR> m_value;
+
+	// encoded name of the open element
+	SBuffer<BYTE> m_element;
+
+	// encoded attributes of the open element
+	SBuffer<BYTE> m_attributes;
+
+	// number of attributes of the open element
+	ULONG m_num_attributes{0};
+
+	// UTF-8 encoding of a string
+	SBuffer<BYTE> m_utf8;
+
+	// encoded records waiting to be written
+	SBuffer<BYTE> m_output;
+
+	// numbers of the names written so far
+	StringToUlongMap *m_names;
+
+	// numbers of the values in the dictionary
+	StringToUlongMap *m_values;
+
+	// make room for the given number of elements in a buffer
+	template <class T>
+	void Reserve(SBuffer<T> *buffer, ULONG size);
+
+	// append an element to a buffer
+	template <class T>
+	void Append(SBuffer<T> *buffer, T elem);
+
+	// terminate the string in a buffer without changing its size
+	void Terminate(SBuffer<WCHAR> *buffer);
+
+	// append the contents of a byte buffer to another one
+	void AppendBytes(SBuffer<BYTE> *buffer, const SBuffer<BYTE> *bytes);
+
+	// append an unsigned integer to a byte buffer
+	void AppendVarint(SBuffer<BYTE> *buffer, ULLONG value);
+
+	// encode a string in UTF-8 into m_utf8
+	void EncodeUTF8(const SBuffer<WCHAR> *str);
+
+	// append a name to a byte buffer and consume it
+	void AppendName(SBuffer<BYTE> *buffer);
+
+	// append a value to a byte buffer and consume it
+	void AppendValue(SBuffer<BYTE> *buffer);
+
+	// is the value being read a decimal integer, and which one
+	BOOL FInteger(LINT *value) const;
+
+	// process a character of the document
+	void Process(WCHAR wc);
+
+	// resolve the entity that was read into the value
+	void ResolveEntity();
+
+	// write an open record for the open element
+	void WriteOpen();
+
+	// write a close record
+	void WriteClose();
+
+	// write a text record for the character data read so far, if any
+	void WriteText();
+
+	// write the encoded records to the underlying stream
+	void Flush();
+
+public:
+	CDXLBinaryOstream(const CDXLBinaryOstream &) = delete;
+
+	// please see comments in COstream.h for an explanation
+	using COstream::operator<<;
+
+	// ctor; writes the header
+	CDXLBinaryOstream(CMemoryPool *mp, std::ostream &os);
+
+	// dtor; writes the pending records
+	~CDXLBinaryOstream() override;
+
+	// implement << operator on wide char array
+	IOstream &operator<<(const WCHAR *wc_array) override;
+
+	// implement << operator on char array
+	IOstream &operator<<(const CHAR *c_array) override;
+
+	// implement << operator on wide char
+	IOstream &operator<<(const WCHAR wc) override;
+
+	// implement << operator on char
+	IOstream &operator<<(const CHAR c) override;
+
+};	// class CDXLBinaryOstream
+}  // namespace gpdxl
+
+#endif	// !GPDXL_CDXLBinaryOstream_H
+
+// EOF
@@ -0,0 +1,228 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (c) 2023 VMware, Inc. or its affiliates. All Rights Reserved.
+//
+//	@filename:
+//		CDXLBinaryReader.h
+//
+//	@doc:
+//		Reader of DXL documents in binary format
+//---------------------------------------------------------------------------
+#ifndef GPDXL_CDXLBinaryReader_H
+#define GPDXL_CDXLBinaryReader_H
+
+#include <xercesc/sax2/Attributes.hpp>
+#include <xercesc/sax2/SAX2XMLReader.hpp>
+#include <xercesc/util/XercesDefs.hpp>
+
+#include "gpos/base.h"
+#include "gpos/common/CDynamicPtrArray.h"
+#include "gpos/common/CStack.h"
+
+namespace gpdxl
+{
+using namespace gpos;
+
+XERCES_CPP_NAMESPACE_USE
+
+//---------------------------------------------------------------------------
+//	@class:
+//		CDXLBinaryReader
+//
+//	@doc:
+//		Reads a DXL document in binary format and passes its elements to
+//		the content handler of a SAX reader, as the XML parser would. The
+//		parse handlers are activated on the SAX reader by the parse handler
+//		manager, so the same handlers parse binary and XML documents.
+//
+//		Namespace URIs are not used by the parse handlers and are passed as
+//		empty strings; namespace declarations are not passed as attributes.
+//
+//---------------------------------------------------------------------------
+class CDXLBinaryReader
+{
+private:
+	// name of an element or attribute
+	struct SName
+	{
+		// qualified name
+		XMLCh *m_qname;
+
+		// local part of the name, within m_qname
+		const XMLCh *m_local_name;
+
+		// is it a namespace declaration
+		BOOL m_is_namespace_decl;
+
+		SName(XMLCh *qname, const XMLCh *local_name, BOOL is_namespace_decl)
+			: m_qname(qname),
+			  m_local_name(local_name),
+			  m_is_namespace_decl(is_namespace_decl)
+		{
+		}
+
+		~SName()
+		{
+			GPOS_DELETE_ARRAY(m_qname);
+		}
+	};
+
+	// attribute of the current element
+	struct SAttribute
+	{
+		// name
+		const SName *m_name;
+
+		// value, once resolved
+		const XMLCh *m_value;
+
+		// offset of the value in the scratch buffer, if it is not in the
+		// dictionary
+		ULONG m_offset;
+	};
+
+	//---------------------------------------------------------------------------
+	//	@class:
+	//		CAttributes
+	//
+	//	@doc:
+	//		Attributes of the current element, as seen by the parse handlers
+	//
+	//---------------------------------------------------------------------------
+	class CAttributes : public Attributes
+	{
+	private:
+		// attributes
+		const SAttribute *m_attributes{nullptr};
+
+		// number of attributes
+		ULONG m_size{0};
+
+	public:
+		CAttributes(const CAttributes &) = delete;
+
+		CAttributes() = default;
+
+		~CAttributes() override = default;
+
+		// set the attributes of the current element
+		void
+		Set(const SAttribute *attributes, ULONG size)
+		{
+			m_attributes = attributes;
+			m_size = size;
+		}
+
+		// Attributes interface
+		XMLSize_t getLength() const override;
+		const XMLCh *getURI(const XMLSize_t index) const override;
+		const XMLCh *getLocalName(const XMLSize_t index) const override;
+		const XMLCh *getQName(const XMLSize_t index) const override;
+		const XMLCh *getType(const XMLSize_t index) const override;
+		const XMLCh *getValue(const XMLSize_t index) const override;
+		bool getIndex(const XMLCh *const uri, const XMLCh *const local_part,
+					  XMLSize_t &index) const override;
+		int getIndex(const XMLCh *const uri,
+					 const XMLCh *const local_part) const override;
+		bool getIndex(const XMLCh *const qname,
+					  XMLSize_t &index) const override;
+		int getIndex(const XMLCh *const qname) const override;
+		const XMLCh *getType(const XMLCh *const uri,
+							 const XMLCh *const local_part) const override;
+		const XMLCh *getType(const XMLCh *const qname) const override;
+		const XMLCh *getValue(const XMLCh *const uri,
+							  const XMLCh *const local_part) const override;
+		const XMLCh *getValue(const XMLCh *const qname) const override;
+	};
+
+	using SNameArray = CDynamicPtrArray<SName, CleanupDelete>;
+
+	using XMLChArray = CDynamicPtrArray<XMLCh, CleanupDeleteArray>;
+
+	using SNameStack = CStack<const SName>;
+
+	// memory pool
+	CMemoryPool *m_mp;
+
+	// document
+	const BYTE *m_data;
+
+	// size of the document
+	ULONG m_size;
+
+	// offset of the next byte to read
+	ULONG m_offset;
+
+	// names, in the order they were defined
+	SNameArray *m_names;
+
+	// values of the dictionary
+	XMLChArray *m_values;
+
+	// names of the open elements
+	SNameStack *m_open_elements;
+
+	// attributes of the current element
+	SAttribute *m_attributes;
+
+	// number of allocated attributes
+	ULONG m_attributes_capacity;
+
+	// values of the current element that are not in the dictionary, and
+	// text
+	XMLCh *m_scratch;
+
+	// number of characters used in the scratch buffer
+	ULONG m_scratch_size;
+
+	// number of allocated characters of the scratch buffer
+	ULONG m_scratch_capacity;
+
+	// raise an exception for malformed input
+	void RaiseMalformed() const;
+
+	// read a byte
+	BYTE ReadByte();
+
+	// read an unsigned integer
+	ULLONG ReadVarint();
+
+	// read a string of the given length in bytes into new characters
+	XMLCh *ReadString(ULONG length);
+
+	// read a name
+	const SName *ReadName();
+
+	// read a value; returns it if it is in the dictionary, otherwise
+	// stores it in the scratch buffer at the given offset and returns null
+	const XMLCh *ReadValue(ULONG *offset);
+
+	// make room for the given number of characters in the scratch buffer
+	void ReserveScratch(ULONG size);
+
+	// make room for the given number of attributes
+	void ReserveAttributes(ULONG size);
+
+	// decode UTF-8 into UTF-16; the output needs as many characters as
+	// there are bytes, plus one
+	static ULONG DecodeUTF8(const BYTE *data, ULONG length, XMLCh *out);
+
+public:
+	CDXLBinaryReader(const CDXLBinaryReader &) = delete;
+
+	// ctor
+	CDXLBinaryReader(CMemoryPool *mp, const BYTE *data, ULONG size);
+
+	// dtor
+	~CDXLBinaryReader();
+
+	// pass the elements of the document to the content handler that is
+	// active on the given SAX reader
+	void Parse(SAX2XMLReader *sax_2_xml_reader);
+
+};	// class CDXLBinaryReader
+}  // namespace gpdxl
+
+#endif	// !GPDXL_CDXLBinaryReader_H
+
+// EOF
@@ -72,6 +72,7 @@ enum Edxltoken
 	EdxltokenPushGroupByBelowSetopThreshold,
 	EdxltokenXformBindThreshold,
 	EdxltokenSkewFactor,
+	EdxltokenTimeBudget,
 	EdxltokenMaxStatsBuckets,
 	EdxltokenWindowOids,
 	EdxltokenOidRowNumber,
@@ -115,6 +116,7 @@ enum Edxltoken
 	EdxltokenPhysicalAggregate,
 	EdxltokenPhysicalAppend,
 	EdxltokenPhysicalMaterialize,
+	EdxltokenPhysicalMemoize,
 	EdxltokenPhysicalDynamicForeignScan,
 	EdxltokenPhysicalSequence,
 	EdxltokenPhysicalDynamicTableScan,
@@ -130,6 +132,8 @@ enum Edxltoken
 	EdxltokenPhysicalCTEConsumer,
 
 	EdxltokenDuplicateSensitive,
+	EdxltokenSkewBroadcast,
+	EdxltokenParallelWorkers,
 
 	EdxltokenSegmentIdCol,
 
@@ -307,6 +311,8 @@ enum Edxltoken
 
 	EdxltokenMergeJoinUniqueOuter,
 
+	EdxltokenHashJoinRuntimeFilter,
+
 	EdxltokenAggStrategy,
 	EdxltokenAggStrategyPlain,
 	EdxltokenAggStrategySorted,
@@ -339,6 +345,7 @@ enum Edxltoken
 	EdxltokenTotalCost,
 	EdxltokenRows,
 	EdxltokenWidth,
+	EdxltokenCardinalityFingerprint,
 	EdxltokenRelPages,
 	EdxltokenRelAllVisible,
 	EdxltokenCTASOptions,
@@ -365,6 +372,7 @@ enum Edxltoken
 	EdxltokenColNdvRemain,
 	EdxltokenColFreqRemain,
 	EdxltokenColStatsMissing,
+	EdxltokenColStatsHyperLogLog,
 
 	EdxltokenParamId,
 
@@ -420,8 +428,11 @@ enum Edxltoken
 	EdxltokenSortOpName,
 	EdxltokenSortDiscardDuplicates,
 	EdxltokenSortNullsFirst,
+	EdxltokenSortPresortedKeys,
 
 	EdxltokenMaterializeEager,
+	EdxltokenMemoizeCacheKeys,
+	EdxltokenMemoizeNumDistinct,
 	EdxltokenSpoolId,
 	EdxltokenSpoolType,
 	EdxltokenSpoolMaterialize,
@@ -485,6 +496,14 @@ enum Edxltoken
 	EdxltokenMVDependency,
 	EdxltokenMVNDistinctList,
 	EdxltokenMVNDistinct,
+	EdxltokenMVMCVList,
+	EdxltokenMVMCVItem,
+	EdxltokenMVMCVValue,
+	EdxltokenRelationMatViews,
+	EdxltokenMatView,
+	EdxltokenMatViewColumn,
+	EdxltokenMatViewFilter,
+	EdxltokenMatViewCombinable,
 	EdxltokenDegree,
 	EdxltokenFrom,
 	EdxltokenTo,
@@ -741,6 +760,7 @@ enum Edxltoken
 	EdxltokenStatsBucketLowerBound,
 	EdxltokenStatsBucketUpperBound,
 	EdxltokenStatsFrequency,
+	EdxltokenStatsBaseFrequency,
 	EdxltokenStatsDistinct,
 	EdxltokenStatsBoundClosed,
 
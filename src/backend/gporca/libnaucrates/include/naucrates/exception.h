@@ -49,6 +49,7 @@ enum ExMinor
 	ExmiExpr2DXLAttributeNotFound,
 	ExmiDXL2PlStmtAttributeNotFound,
 	ExmiDXL2ExprAttributeNotFound,
+	ExmiDXLBinaryParseError,
 
 	// MD related errors
 	ExmiMDCacheEntryDuplicate,
@@ -69,6 +69,9 @@ private:
 	// is column statistics missing in the database
 	BOOL m_is_col_stats_missing;
 
+	// sketch of the distinct values, if any
+	CHyperLogLog *m_hll;
+
 	// DXL string for object
 	CWStringDynamic *m_dxl_str = nullptr;
 
@@ -80,7 +83,7 @@ public:
 				 CMDName *mdname, CDouble width, CDouble null_freq,
 				 CDouble distinct_remaining, CDouble freq_remaining,
 				 CDXLBucketArray *dxl_stats_bucket_array,
-				 BOOL is_col_stats_missing);
+				 BOOL is_col_stats_missing, CHyperLogLog *hll = nullptr);
 
 	// dtor
 	~CDXLColStats() override;
@@ -135,6 +138,13 @@ public:
 	// get the bucket at the given position
 	const CDXLBucket *GetDXLBucketAt(ULONG ul) const override;
 
+	// sketch of the distinct values, if any
+	const CHyperLogLog *
+	GetHyperLogLog() const override
+	{
+		return m_hll;
+	}
+
 	// serialize column stats in DXL format
 	void Serialize(gpdxl::CXMLSerializer *) const override;
 
@@ -58,12 +58,16 @@ private:
 
 	CMDNDistinctArray *m_ndistinct_array;
 
+	// MCV list, null if there is none
+	CMDMCVList *m_mcv_list;
+
 public:
 	CDXLExtStats(const CDXLExtStats &) = delete;
 
 	CDXLExtStats(CMemoryPool *mp, IMDId *rel_stats_mdid, CMDName *mdname,
 				 CMDDependencyArray *extstats_dependency_array,
-				 CMDNDistinctArray *ndistinct_array);
+				 CMDNDistinctArray *ndistinct_array,
+				 CMDMCVList *mcv_list = nullptr);
 
 	~CDXLExtStats() override;
 
@@ -91,6 +95,12 @@ public:
 		return m_ndistinct_array;
 	}
 
+	CMDMCVList *
+	GetMCVList() const override
+	{
+		return m_mcv_list;
+	}
+
 #ifdef GPOS_DEBUG
 	// debug print of the metadata ext stats
 	void
@@ -0,0 +1,100 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (c) 2023 VMware, Inc. or its affiliates. All Rights Reserved.
+//
+//	@filename:
+//		CDXLMatViewInfo.h
+//
+//	@doc:
+//		Class representing the materialized views of a relation
+//---------------------------------------------------------------------------
+
+#ifndef GPMD_CDXLMatViewInfo_H
+#define GPMD_CDXLMatViewInfo_H
+
+#include "gpos/base.h"
+#include "gpos/string/CWStringDynamic.h"
+
+#include "naucrates/md/CMDMatView.h"
+#include "naucrates/md/IMDMatViewInfo.h"
+
+namespace gpdxl
+{
+class CXMLSerializer;
+}
+
+namespace gpmd
+{
+using namespace gpos;
+using namespace gpdxl;
+
+//---------------------------------------------------------------------------
+//	@class:
+//		CDXLMatViewInfo
+//
+//	@doc:
+//		Class representing the materialized views of a relation
+//
+//---------------------------------------------------------------------------
+class CDXLMatViewInfo : public IMDMatViewInfo
+{
+private:
+	// memory pool
+	CMemoryPool *m_mp;
+
+	// metadata id of the object
+	IMDId *m_mdid;
+
+	// table name
+	CMDName *m_mdname;
+
+	// DXL string for object
+	CWStringDynamic *m_dxl_str = nullptr;
+
+	// materialized views over the relation
+	CMDMatViewArray *m_matview_array;
+
+public:
+	CDXLMatViewInfo(const CDXLMatViewInfo &) = delete;
+
+	CDXLMatViewInfo(CMemoryPool *mp, IMDId *mdid, CMDName *mdname,
+					CMDMatViewArray *matview_array);
+
+	~CDXLMatViewInfo() override;
+
+	// the metadata id
+	IMDId *MDId() const override;
+
+	// relation name
+	CMDName Mdname() const override;
+
+	// DXL string representation of cache object
+	const CWStringDynamic *GetStrRepr() override;
+
+	// serialize materialized views in DXL format given a serializer object
+	void Serialize(gpdxl::CXMLSerializer *) const override;
+
+	CMDMatViewArray *
+	GetMatViewArray() const override
+	{
+		return m_matview_array;
+	}
+
+#ifdef GPOS_DEBUG
+	// debug print of the materialized views metadata
+	void
+	DebugPrint(IOstream &os GPOS_UNUSED) const override
+	{
+	}
+#endif
+
+	// relation without materialized views
+	static CDXLMatViewInfo *CreateDXLDummyMatViewInfo(CMemoryPool *mp,
+													  IMDId *mdid);
+};
+
+}  // namespace gpmd
+
+#endif	// !GPMD_CDXLMatViewInfo_H
+
+// EOF
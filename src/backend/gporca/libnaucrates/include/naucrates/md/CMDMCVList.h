@@ -0,0 +1,215 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (c) 2023 VMware, Inc. or its affiliates. All Rights Reserved.
+//
+//	@filename:
+//		CMDMCVList.h
+//
+//	@doc:
+//		Class representing MD extended stats multivariate MCV list.
+//
+//		The structure mirrors MCVList in statistics.h
+//---------------------------------------------------------------------------
+
+#ifndef GPMD_CMDMCVList_H
+#define GPMD_CMDMCVList_H
+
+#include "gpos/base.h"
+#include "gpos/common/CBitSetIter.h"
+#include "gpos/common/CDouble.h"
+#include "gpos/string/CWStringDynamic.h"
+
+#include "naucrates/dxl/operators/CDXLDatum.h"
+#include "naucrates/dxl/xml/CXMLSerializer.h"
+
+namespace gpmd
+{
+using namespace gpos;
+using namespace gpdxl;
+
+//---------------------------------------------------------------------------
+//	@class:
+//		CMDMCVItem
+//
+//	@doc:
+//		One combination of values of an MCV list. The values are in the
+//		order of the attnos of the list, a null value is a null datum.
+//
+//---------------------------------------------------------------------------
+class CMDMCVItem : public CRefCount
+{
+private:
+	// frequency of the combination of values
+	CDouble m_frequency;
+
+	// product of the per-column frequencies of the values
+	CDouble m_base_frequency;
+
+	// values, one per dimension
+	CDXLDatumArray *m_values;
+
+public:
+	CMDMCVItem(CDouble frequency, CDouble base_frequency,
+			   CDXLDatumArray *values)
+		: m_frequency(frequency),
+		  m_base_frequency(base_frequency),
+		  m_values(values)
+	{
+		GPOS_ASSERT(nullptr != values);
+	}
+
+	~CMDMCVItem() override
+	{
+		m_values->Release();
+	}
+
+	// serialize the item in DXL format given a serializer object
+	void
+	Serialize(gpdxl::CXMLSerializer *xml_serializer) const
+	{
+		xml_serializer->OpenElement(
+			CDXLTokens::GetDXLTokenStr(EdxltokenNamespacePrefix),
+			CDXLTokens::GetDXLTokenStr(EdxltokenMVMCVItem));
+
+		xml_serializer->SetFullPrecision(true);
+		xml_serializer->AddAttribute(
+			CDXLTokens::GetDXLTokenStr(EdxltokenStatsFrequency), m_frequency);
+		xml_serializer->AddAttribute(
+			CDXLTokens::GetDXLTokenStr(EdxltokenStatsBaseFrequency),
+			m_base_frequency);
+		xml_serializer->SetFullPrecision(false);
+
+		for (ULONG ul = 0; ul < m_values->Size(); ul++)
+		{
+			xml_serializer->OpenElement(
+				CDXLTokens::GetDXLTokenStr(EdxltokenNamespacePrefix),
+				CDXLTokens::GetDXLTokenStr(EdxltokenMVMCVValue));
+			(*m_values)[ul]->Serialize(xml_serializer);
+			xml_serializer->CloseElement(
+				CDXLTokens::GetDXLTokenStr(EdxltokenNamespacePrefix),
+				CDXLTokens::GetDXLTokenStr(EdxltokenMVMCVValue));
+		}
+
+		xml_serializer->CloseElement(
+			CDXLTokens::GetDXLTokenStr(EdxltokenNamespacePrefix),
+			CDXLTokens::GetDXLTokenStr(EdxltokenMVMCVItem));
+	}
+
+	CDouble
+	GetFrequency() const
+	{
+		return m_frequency;
+	}
+
+	CDouble
+	GetBaseFrequency() const
+	{
+		return m_base_frequency;
+	}
+
+	CDXLDatumArray *
+	GetValues() const
+	{
+		return m_values;
+	}
+};
+
+using CMDMCVItemArray = CDynamicPtrArray<CMDMCVItem, CleanupRelease>;
+
+//---------------------------------------------------------------------------
+//	@class:
+//		CMDMCVList
+//
+//	@doc:
+//		Most common combinations of values of the columns of an extended
+//		statistics object, with their frequencies
+//
+//---------------------------------------------------------------------------
+class CMDMCVList : public CRefCount
+{
+private:
+	// memory pool
+	CMemoryPool *m_mp;
+
+	// attnos of the dimensions, in dimension order
+	CBitSet *m_attrs;
+
+	// items
+	CMDMCVItemArray *m_items;
+
+public:
+	CMDMCVList(CMemoryPool *mp, CBitSet *attrs, CMDMCVItemArray *items)
+		: m_mp(mp), m_attrs(attrs), m_items(items)
+	{
+		GPOS_ASSERT(nullptr != attrs);
+		GPOS_ASSERT(nullptr != items);
+	}
+
+	~CMDMCVList() override
+	{
+		m_attrs->Release();
+		m_items->Release();
+	}
+
+	CWStringDynamic *
+	AttrsToStr() const
+	{
+		CWStringDynamic *str = GPOS_NEW(m_mp) CWStringDynamic(m_mp);
+		CBitSetIter bsiter(*m_attrs);
+
+		ULONG count = m_attrs->Size();
+		while (bsiter.Advance())
+		{
+			if (--count > 0)
+			{
+				str->AppendFormat(GPOS_WSZ_LIT("%d,"), bsiter.Bit());
+			}
+			else
+			{
+				str->AppendFormat(GPOS_WSZ_LIT("%d"), bsiter.Bit());
+			}
+		}
+
+		return str;
+	}
+
+	// serialize the MCV list in DXL format given a serializer object
+	void
+	Serialize(gpdxl::CXMLSerializer *xml_serializer) const
+	{
+		xml_serializer->OpenElement(
+			CDXLTokens::GetDXLTokenStr(EdxltokenNamespacePrefix),
+			CDXLTokens::GetDXLTokenStr(EdxltokenMVMCVList));
+
+		CWStringDynamic *attnos_str = AttrsToStr();
+		xml_serializer->AddAttribute(CDXLTokens::GetDXLTokenStr(EdxltokenAttno),
+									 attnos_str);
+		GPOS_DELETE(attnos_str);
+
+		for (ULONG ul = 0; ul < m_items->Size(); ul++)
+		{
+			(*m_items)[ul]->Serialize(xml_serializer);
+		}
+
+		xml_serializer->CloseElement(
+			CDXLTokens::GetDXLTokenStr(EdxltokenNamespacePrefix),
+			CDXLTokens::GetDXLTokenStr(EdxltokenMVMCVList));
+	}
+
+	CBitSet *
+	GetAttrs() const
+	{
+		return m_attrs;
+	}
+
+	CMDMCVItemArray *
+	GetItems() const
+	{
+		return m_items;
+	}
+};
+}  // namespace gpmd
+
+#endif	// !GPMD_CMDMCVList_H
+
+// EOF
@@ -0,0 +1,230 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (c) 2023 VMware, Inc. or its affiliates. All Rights Reserved.
+//
+//	@filename:
+//		CMDMatView.h
+//
+//	@doc:
+//		Class representing a materialized view defined over a single base
+//		relation, as seen by the view matching transformations
+//---------------------------------------------------------------------------
+
+#ifndef GPMD_CMDMatView_H
+#define GPMD_CMDMatView_H
+
+#include "gpos/base.h"
+#include "gpos/common/CDynamicPtrArray.h"
+#include "gpos/common/CRefCount.h"
+
+#include "gpopt/base/CColRef.h"
+#include "naucrates/dxl/operators/CDXLNode.h"
+#include "naucrates/md/CMDName.h"
+#include "naucrates/md/IMDId.h"
+
+// fwd decl
+namespace gpdxl
+{
+class CXMLSerializer;
+}
+
+namespace gpopt
+{
+class CExpression;
+class CMDAccessor;
+}  // namespace gpopt
+
+namespace gpmd
+{
+using namespace gpos;
+using namespace gpdxl;
+using gpopt::CColRefArray;
+
+//---------------------------------------------------------------------------
+//	@class:
+//		CMDMatViewColumn
+//
+//	@doc:
+//		Derivation of an output column of a materialized view from the base
+//		relation: either a plain column reference or a simple aggregate over
+//		at most one column
+//
+//---------------------------------------------------------------------------
+class CMDMatViewColumn : public CRefCount
+{
+private:
+	// attno of the referenced base relation column, 0 if none
+	INT m_attno;
+
+	// aggregate computing the column, nullptr for a plain column reference
+	IMDId *m_agg_mdid;
+
+	// can the aggregate be recomputed from its own results, i.e. it has no
+	// final function and a combine function over its result type
+	BOOL m_is_combinable;
+
+public:
+	CMDMatViewColumn(const CMDMatViewColumn &) = delete;
+
+	// ctor
+	CMDMatViewColumn(INT attno, IMDId *agg_mdid, BOOL is_combinable)
+		: m_attno(attno), m_agg_mdid(agg_mdid), m_is_combinable(is_combinable)
+	{
+	}
+
+	// dtor
+	~CMDMatViewColumn() override
+	{
+		CRefCount::SafeRelease(m_agg_mdid);
+	}
+
+	// attno of the referenced base relation column
+	INT
+	Attno() const
+	{
+		return m_attno;
+	}
+
+	// aggregate computing the column
+	IMDId *
+	AggMdid() const
+	{
+		return m_agg_mdid;
+	}
+
+	// is the column an aggregate
+	BOOL
+	IsAggregate() const
+	{
+		return nullptr != m_agg_mdid;
+	}
+
+	// is the column a plain reference to a base relation column
+	BOOL
+	IsColumnRef() const
+	{
+		return nullptr == m_agg_mdid && 0 < m_attno;
+	}
+
+	// can the aggregate be recomputed from its own results
+	BOOL
+	IsCombinable() const
+	{
+		return m_is_combinable;
+	}
+
+	// serialize column in DXL format
+	void Serialize(CXMLSerializer *xml_serializer) const;
+};
+
+using CMDMatViewColumnArray =
+	CDynamicPtrArray<CMDMatViewColumn, CleanupRelease>;
+
+//---------------------------------------------------------------------------
+//	@class:
+//		CMDMatView
+//
+//	@doc:
+//		Definition of a materialized view over a single base relation
+//
+//---------------------------------------------------------------------------
+class CMDMatView : public CRefCount
+{
+private:
+	// memory pool
+	CMemoryPool *m_mp;
+
+	// mdid of the materialized view relation
+	IMDId *m_mdid;
+
+	// name of the materialized view
+	CMDName *m_mdname;
+
+	// attnos of the base relation columns the view groups by, nullptr if
+	// the view has no aggregates
+	ULongPtrArray *m_grouping_attnos;
+
+	// derivation of the output columns of the view
+	CMDMatViewColumnArray *m_columns;
+
+	// filter of the view over the base relation columns, if any
+	CDXLNode *m_filter;
+
+public:
+	CMDMatView(const CMDMatView &) = delete;
+
+	// ctor
+	CMDMatView(CMemoryPool *mp, IMDId *mdid, CMDName *mdname,
+			   ULongPtrArray *grouping_attnos, CMDMatViewColumnArray *columns,
+			   CDXLNode *filter);
+
+	// dtor
+	~CMDMatView() override;
+
+	// mdid of the materialized view relation
+	IMDId *
+	MDId() const
+	{
+		return m_mdid;
+	}
+
+	// name of the materialized view
+	CMDName
+	Mdname() const
+	{
+		return *m_mdname;
+	}
+
+	// does the view aggregate the base relation
+	BOOL
+	IsAggregate() const
+	{
+		return nullptr != m_grouping_attnos;
+	}
+
+	// attnos of the grouping columns
+	ULongPtrArray *
+	GetGroupingAttnos() const
+	{
+		return m_grouping_attnos;
+	}
+
+	// number of output columns
+	ULONG
+	ColumnCount() const
+	{
+		return m_columns->Size();
+	}
+
+	// output column at the given position
+	const CMDMatViewColumn *
+	GetColumn(ULONG pos) const
+	{
+		return (*m_columns)[pos];
+	}
+
+	// does the view have a filter
+	BOOL
+	HasFilter() const
+	{
+		return nullptr != m_filter;
+	}
+
+	// scalar expression of the filter over the non-system columns of the
+	// base relation
+	gpopt::CExpression *GetFilterExpr(CMemoryPool *mp,
+									  gpopt::CMDAccessor *md_accessor,
+									  IMDId *rel_mdid,
+									  CColRefArray *colref_array) const;
+
+	// serialize view in DXL format
+	void Serialize(CXMLSerializer *xml_serializer) const;
+};
+
+using CMDMatViewArray = CDynamicPtrArray<CMDMatView, CleanupRelease>;
+
+}  // namespace gpmd
+
+#endif	// !GPMD_CMDMatView_H
+
+// EOF
@@ -74,6 +74,7 @@ public:
 		EmdtScCmp,
 		EmdtExtStats,
 		EmdtExtStatsInfo,
+		EmdtMatViewInfo,
 		EmdtSentinel
 	};
 
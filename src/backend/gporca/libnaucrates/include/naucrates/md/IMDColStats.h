@@ -18,11 +18,13 @@
 
 #include "naucrates/md/CDXLBucket.h"
 #include "naucrates/md/IMDCacheObject.h"
+#include "naucrates/statistics/CHyperLogLog.h"
 
 namespace gpmd
 {
 using namespace gpos;
 using namespace gpdxl;
+using namespace gpnaucrates;
 
 //---------------------------------------------------------------------------
 //	@class:
@@ -62,6 +64,9 @@ public:
 
 	// get the bucket at the given position
 	virtual const CDXLBucket *GetDXLBucketAt(ULONG ul) const = 0;
+
+	// sketch of the distinct values, if any
+	virtual const CHyperLogLog *GetHyperLogLog() const = 0;
 };
 }  // namespace gpmd
 
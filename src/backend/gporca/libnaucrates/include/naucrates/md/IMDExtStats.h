@@ -15,6 +15,7 @@
 #include "gpos/base.h"
 
 #include "naucrates/md/CMDDependency.h"
+#include "naucrates/md/CMDMCVList.h"
 #include "naucrates/md/CMDNDistinct.h"
 #include "naucrates/md/IMDCacheObject.h"
 #include "naucrates/statistics/IStatistics.h"
@@ -49,6 +50,9 @@ public:
 	virtual CMDDependencyArray *GetDependencies() const = 0;
 
 	virtual CMDNDistinctArray *GetNDistinctList() const = 0;
+
+	// MCV list, or null if the statistics object has none
+	virtual CMDMCVList *GetMCVList() const = 0;
 };
 
 }  // namespace gpmd
@@ -79,6 +79,7 @@ public:
 		EmdidCheckConstraint = 8,
 		EmdidExtStats = 9,
 		EmdidExtStatsInfo = 10,
+		EmdidMatViewInfo = 11,
 		EmdidSentinel
 	};
 
@@ -0,0 +1,51 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (c) 2023 VMware, Inc. or its affiliates. All Rights Reserved.
+//
+//	@filename:
+//		IMDMatViewInfo.h
+//
+//	@doc:
+//		Interface for the materialized views of a relation in the metadata
+//		cache
+//---------------------------------------------------------------------------
+#ifndef GPMD_IMDMatViewInfo_H
+#define GPMD_IMDMatViewInfo_H
+
+#include "gpos/base.h"
+
+#include "naucrates/md/CMDMatView.h"
+#include "naucrates/md/IMDCacheObject.h"
+
+namespace gpmd
+{
+using namespace gpos;
+using namespace gpdxl;
+
+//---------------------------------------------------------------------------
+//	@class:
+//		IMDMatViewInfo
+//
+//	@doc:
+//		Interface for the materialized views of a relation in the metadata
+//		cache
+//
+//---------------------------------------------------------------------------
+class IMDMatViewInfo : public IMDCacheObject
+{
+public:
+	// object type
+	Emdtype
+	MDType() const override
+	{
+		return EmdtMatViewInfo;
+	}
+
+	// materialized views that can answer queries over the relation
+	virtual CMDMatViewArray *GetMatViewArray() const = 0;
+};
+}  // namespace gpmd
+
+#endif	// !GPMD_IMDMatViewInfo_H
+
+// EOF
@@ -0,0 +1,119 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (c) 2023 VMware, Inc. or its affiliates. All Rights Reserved.
+//
+//	@filename:
+//		CCardinalityFeedback.h
+//
+//	@doc:
+//		Store of the cardinalities observed when executing plans, used to
+//		correct the estimates of later optimizations
+//---------------------------------------------------------------------------
+#ifndef GPNAUCRATES_CCardinalityFeedback_H
+#define GPNAUCRATES_CCardinalityFeedback_H
+
+#include "gpos/base.h"
+#include "gpos/common/CDouble.h"
+
+namespace gpnaucrates
+{
+using namespace gpos;
+
+//---------------------------------------------------------------------------
+//	@class:
+//		CCardinalityFeedback
+//
+//	@doc:
+//		Process-wide store mapping the fingerprint of a logical subexpression
+//		to the number of rows it produced the last time a plan containing it
+//		was executed with instrumentation. The store is a fixed-size, two-way
+//		set associative table, so its memory is bounded by the number of
+//		entries it is configured with; a new entry replaces the older entry
+//		of its set. Entries older than the configured maximum age are
+//		ignored and dropped on lookup.
+//
+//		The executor records into the store outside of optimization tasks,
+//		so recording never allocates; only configuring the store does.
+//
+//---------------------------------------------------------------------------
+class CCardinalityFeedback
+{
+private:
+	// an observed cardinality
+	struct SEntry
+	{
+		// fingerprint of the subexpression, zero for an empty entry
+		ULLONG m_fingerprint;
+
+		// number of rows observed
+		DOUBLE m_rows;
+
+		// time the rows were observed, in seconds since the epoch
+		ULLONG m_recorded_at;
+	};
+
+	// memory pool of the entries
+	static CMemoryPool *m_mp;
+
+	// entries, in sets of two
+	static SEntry *m_entries;
+
+	// number of entries
+	static ULONG m_num_entries;
+
+	// maximum age of the entries in seconds, zero if they never expire
+	static ULONG m_max_age;
+
+	// incremented whenever an observation changes the estimate of a
+	// subexpression significantly
+	static ULLONG m_version;
+
+	// current time in seconds since the epoch
+	static ULLONG UllNow();
+
+	// first entry of the set the given fingerprint maps to
+	static SEntry *PentrySet(ULLONG fingerprint);
+
+	// is the entry too old to be used
+	static BOOL FStale(const SEntry *pentry, ULLONG now);
+
+public:
+	CCardinalityFeedback(const CCardinalityFeedback &) = delete;
+
+	// allocate the store, or resize it, dropping its entries; a store with
+	// zero entries records nothing
+	static void Configure(ULONG num_entries, ULONG max_age);
+
+	// is the store allocated
+	static BOOL
+	FInitialized()
+	{
+		return nullptr != m_entries;
+	}
+
+	// record the rows observed for the given fingerprint
+	static void Record(ULLONG fingerprint, CDouble rows);
+
+	// look up the rows observed for the given fingerprint
+	static BOOL FLookup(ULLONG fingerprint, CDouble *rows);
+
+	// version of the store, changes when recorded rows differ significantly
+	// from the rows recorded before for the same fingerprint
+	static ULLONG
+	UllVersion()
+	{
+		return m_version;
+	}
+
+	// drop all entries
+	static void Reset();
+
+	// release the store
+	static void Shutdown();
+};
+
+}  // namespace gpnaucrates
+
+#endif	// !GPNAUCRATES_CCardinalityFeedback_H
+
+// EOF
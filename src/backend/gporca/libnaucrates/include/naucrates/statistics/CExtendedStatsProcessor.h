@@ -19,6 +19,12 @@ namespace gpnaucrates
 class CExtendedStatsProcessor
 {
 public:
+	static void ApplyMCVListToScaleFactorFilterCalculation(
+		CDoubleArray *scale_factors, CStatsPredConj *conjunctive_pred_stats,
+		const IMDExtStatsInfo *md_statsinfo,
+		UlongToIntMap *colid_to_attno_mapping, CMemoryPool *mp,
+		UlongToHistogramMap *result_histograms);
+
 	static void ApplyCorrelatedStatsToScaleFactorFilterCalculation(
 		CDoubleArray *scale_factors, CStatsPredConj *conjunctive_pred_stats,
 		const IMDExtStatsInfo *md_statsinfo,
@@ -16,6 +16,7 @@
 
 #include "gpopt/base/CKHeap.h"
 #include "naucrates/statistics/CBucket.h"
+#include "naucrates/statistics/CHyperLogLog.h"
 #include "naucrates/statistics/CStatsPred.h"
 
 namespace gpopt
@@ -95,6 +96,10 @@ private:
 	// is column statistics missing in the database
 	BOOL m_is_col_stats_missing;
 
+	// sketch of the distinct values of the column, if any; it is kept by
+	// operations that preserve the set of values, or a uniform part of it
+	CHyperLogLog *m_hll;
+
 	// return an array buckets after applying equality filter on the histogram buckets
 	CBucketArray *MakeBucketsWithEqualityFilter(CPoint *point) const;
 
@@ -175,6 +180,9 @@ private:
 	// check if the cardinality estimation should be done only via NDVs
 	static BOOL NeedsNDVBasedCardEstimationForEq(const CHistogram *histogram);
 
+	// fraction of the distinct values found in both histograms
+	CDouble GetContainment(const CHistogram *histogram) const;
+
 	BOOL IsHistogramForTextRelatedTypes() const;
 
 	// add residual union all buckets after the merge
@@ -251,6 +259,16 @@ public:
 		return m_NDVs_were_scaled;
 	}
 
+	// set the sketch of the distinct values; takes ownership
+	void SetHyperLogLog(CHyperLogLog *hll);
+
+	// sketch of the distinct values, if any
+	CHyperLogLog *
+	GetHyperLogLog() const
+	{
+		return m_hll;
+	}
+
 	// filter by comparing with point
 	CHistogram *MakeHistogramFilter(CStatsPred::EStatsCmpType stats_cmp_type,
 									CPoint *point) const;
@@ -363,6 +381,7 @@ public:
 	virtual ~CHistogram()
 	{
 		m_histogram_buckets->Release();
+		CRefCount::SafeRelease(m_hll);
 	}
 
 	// normalize histogram and return scaling factor
@@ -0,0 +1,115 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (c) 2023 VMware, Inc. or its affiliates. All Rights Reserved.
+//
+//	@filename:
+//		CHyperLogLog.h
+//
+//	@doc:
+//		HyperLogLog sketch of the distinct values of a column
+//---------------------------------------------------------------------------
+#ifndef GPNAUCRATES_CHyperLogLog_H
+#define GPNAUCRATES_CHyperLogLog_H
+
+#include "gpos/base.h"
+#include "gpos/common/CDouble.h"
+#include "gpos/common/CRefCount.h"
+#include "gpos/common/DbgPrintMixin.h"
+
+namespace gpnaucrates
+{
+using namespace gpos;
+
+//---------------------------------------------------------------------------
+//	@class:
+//		CHyperLogLog
+//
+//	@doc:
+//		Registers of a HyperLogLog sketch, as built by ANALYZE FULLSCAN. The
+//		register of a value is given by the top bits of its hash and holds
+//		the largest number of leading zeros, plus one, seen in the rest of
+//		the hash.
+//
+//		Sketches are stored at a lower precision than ANALYZE builds them,
+//		which keeps them small in the metadata cache and in minidumps. Two
+//		sketches merge into the sketch of the union of their values, which
+//		gives the overlap of the values of two columns through
+//		inclusion-exclusion.
+//
+//---------------------------------------------------------------------------
+class CHyperLogLog : public CRefCount, public DbgPrintMixin<CHyperLogLog>
+{
+private:
+	// memory pool
+	CMemoryPool *m_mp;
+
+	// number of bits of the hash giving the register
+	ULONG m_precision;
+
+	// registers
+	BYTE *m_registers;
+
+	// ctor; takes ownership of the registers
+	CHyperLogLog(CMemoryPool *mp, ULONG precision, BYTE *registers);
+
+public:
+	CHyperLogLog(const CHyperLogLog &) = delete;
+
+	// precision of the sketches kept by the optimizer
+	static const ULONG DefaultPrecision = 10;
+
+	// lowest and highest precisions of a sketch
+	static const ULONG MinPrecision = 4;
+
+	static const ULONG MaxPrecision = 18;
+
+	// dtor
+	~CHyperLogLog() override;
+
+	// number of bits of the hash giving the register
+	ULONG
+	GetPrecision() const
+	{
+		return m_precision;
+	}
+
+	// number of registers
+	ULONG
+	Size() const
+	{
+		return 1 << m_precision;
+	}
+
+	// registers
+	const BYTE *
+	GetRegisters() const
+	{
+		return m_registers;
+	}
+
+	// estimated number of distinct values
+	CDouble Estimate() const;
+
+	// sketch of the union of the values of this sketch and another one
+	CHyperLogLog *Merge(CMemoryPool *mp, const CHyperLogLog *other) const;
+
+	// estimated fraction of the values of the smaller of the two sketches
+	// that also appear in the larger one; one if it cannot be told apart
+	// from the error of the sketches
+	CDouble GetContainment(const CHyperLogLog *other) const;
+
+	// print function
+	IOstream &OsPrint(IOstream &os) const;
+
+	// sketch at the default precision from registers at the given
+	// precision, folding registers together if needed; null if the
+	// registers cannot be used
+	static CHyperLogLog *Make(CMemoryPool *mp, ULONG precision,
+							  const BYTE *registers, ULONG size);
+
+};	// class CHyperLogLog
+}  // namespace gpnaucrates
+
+#endif	// !GPNAUCRATES_CHyperLogLog_H
+
+// EOF
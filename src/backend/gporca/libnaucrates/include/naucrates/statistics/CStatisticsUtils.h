@@ -306,6 +306,12 @@ public:
 
 	static BOOL IsStatsCmpTypeNdvEq(CStatsPred::EStatsCmpType stats_cmp_type);
 
+	// scale the given statistics to the cardinality observed in earlier
+	// executions of a subexpression with the given fingerprint
+	static IStatistics *ApplyCardinalityFeedback(CMemoryPool *mp,
+												 IStatistics *stats,
+												 ULLONG fingerprint);
+
 };	// class CStatisticsUtils
 
 // comparison function for sorting MCVs
@@ -229,6 +229,37 @@ enum EOptTraceFlag
 	// Ordered Agg
 	EopttraceDisableOrderedAgg = 103047,
 
+	// Cache the inner child results of index nested loop joins
+	EopttraceEnableMemoize = 103048,
+
+	// Filter the outer tuples of hash joins by a bloom filter of the inner keys
+	EopttraceEnableRuntimeFilter = 103049,
+
+	// Sort only within groups of a presorted prefix of the required order
+	EopttraceEnableIncrementalSort = 103050,
+
+	// Prune plans whose cost bound exceeds the best complete plan so far
+	EopttraceEnableGlobalSpacePruning = 103051,
+
+	// Write minidumps in the binary DXL format
+	EopttraceMinidumpBinary = 103052,
+
+	// Answer queries using materialized views over their relation
+	EopttraceEnableMatViewRewrite = 103053,
+
+	// Quals on scans of column-oriented tables are pushed down into the scan
+	EopttraceEnablePredicatePushdown = 103054,
+
+	// Spread or broadcast the most common values of hash join keys
+	EopttraceEnableHybridRedistribute = 103055,
+
+	// Implement inner and left outer joins as merge joins
+	EopttraceEnableInnerOuterMergeJoin = 103056,
+
+	// Scans of column-oriented tables read the non-qual columns only for the
+	// rows passing the pushed down quals
+	EopttraceEnableAOCSLateMaterialize = 103057,
+
 	///////////////////////////////////////////////////////
 	///////////////////// statistics flags ////////////////
 	//////////////////////////////////////////////////////
@@ -259,6 +290,10 @@ enum EOptTraceFlag
 
 	// Use experimental cost model
 	EopttraceExperimentalCostModel = 104009,
+
+	// scale statistics to the cardinalities observed in earlier executions
+	EopttraceEnableCardinalityFeedback = 104010,
+
 	///////////////////////////////////////////////////////
 	/////////// constant expression evaluator flags ///////
 	///////////////////////////////////////////////////////
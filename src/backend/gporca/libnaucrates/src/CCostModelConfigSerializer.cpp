@@ -11,6 +11,7 @@
 
 using namespace gpdxl;
 using gpos::CAutoRef;
+using gpopt::ICostModelParams;
 
 void
 CCostModelConfigSerializer::Serialize(CXMLSerializer &xml_serializer) const
@@ -29,40 +30,50 @@ CCostModelConfigSerializer::Serialize(CXMLSerializer &xml_serializer) const
 		CDXLTokens::GetDXLTokenStr(EdxltokenNamespacePrefix),
 		CDXLTokens::GetDXLTokenStr(EdxltokenCostParams));
 
+	SerializeCostParam(xml_serializer, CCostModelParamsGPDB::EcpNLJFactor);
+
+	// parallel workers change the plan, so they are part of the plan cache
+	// key and of the minidump when enabled
+	if (1 < m_cost_model->UlParallelWorkers())
+	{
+		SerializeCostParam(xml_serializer,
+						   CCostModelParamsGPDB::EcpParallelWorkers);
+	}
+
+	xml_serializer.CloseElement(
+		CDXLTokens::GetDXLTokenStr(EdxltokenNamespacePrefix),
+		CDXLTokens::GetDXLTokenStr(EdxltokenCostParams));
+
+	xml_serializer.CloseElement(
+		CDXLTokens::GetDXLTokenStr(EdxltokenNamespacePrefix),
+		CDXLTokens::GetDXLTokenStr(EdxltokenCostModelConfig));
+}
+
+void
+CCostModelConfigSerializer::SerializeCostParam(CXMLSerializer &xml_serializer,
+											   ULONG id) const
+{
+	ICostModelParams::SCostParam *cost_param =
+		m_cost_model->GetCostModelParams()->PcpLookup(id);
+
 	xml_serializer.OpenElement(
 		CDXLTokens::GetDXLTokenStr(EdxltokenNamespacePrefix),
 		CDXLTokens::GetDXLTokenStr(EdxltokenCostParam));
 
 	xml_serializer.AddAttribute(
 		CDXLTokens::GetDXLTokenStr(EdxltokenName),
-		m_cost_model->GetCostModelParams()->SzNameLookup(
-			CCostModelParamsGPDB::EcpNLJFactor));
-	xml_serializer.AddAttribute(
-		CDXLTokens::GetDXLTokenStr(EdxltokenValue),
-		m_cost_model->GetCostModelParams()
-			->PcpLookup(CCostModelParamsGPDB::EcpNLJFactor)
-			->Get());
+		m_cost_model->GetCostModelParams()->SzNameLookup(id));
+	xml_serializer.AddAttribute(CDXLTokens::GetDXLTokenStr(EdxltokenValue),
+								cost_param->Get());
 	xml_serializer.AddAttribute(
 		CDXLTokens::GetDXLTokenStr(EdxltokenCostParamLowerBound),
-		m_cost_model->GetCostModelParams()
-			->PcpLookup(CCostModelParamsGPDB::EcpNLJFactor)
-			->GetLowerBoundVal());
+		cost_param->GetLowerBoundVal());
 	xml_serializer.AddAttribute(
 		CDXLTokens::GetDXLTokenStr(EdxltokenCostParamUpperBound),
-		m_cost_model->GetCostModelParams()
-			->PcpLookup(CCostModelParamsGPDB::EcpNLJFactor)
-			->GetUpperBoundVal());
+		cost_param->GetUpperBoundVal());
 	xml_serializer.CloseElement(
 		CDXLTokens::GetDXLTokenStr(EdxltokenNamespacePrefix),
 		CDXLTokens::GetDXLTokenStr(EdxltokenCostParam));
-
-	xml_serializer.CloseElement(
-		CDXLTokens::GetDXLTokenStr(EdxltokenNamespacePrefix),
-		CDXLTokens::GetDXLTokenStr(EdxltokenCostParams));
-
-	xml_serializer.CloseElement(
-		CDXLTokens::GetDXLTokenStr(EdxltokenNamespacePrefix),
-		CDXLTokens::GetDXLTokenStr(EdxltokenCostModelConfig));
 }
 
 CCostModelConfigSerializer::CCostModelConfigSerializer(
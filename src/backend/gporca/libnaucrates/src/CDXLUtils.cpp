@@ -39,6 +39,8 @@
 #include "naucrates/dxl/parser/CParseHandlerFactory.h"
 #include "naucrates/dxl/parser/CParseHandlerManager.h"
 #include "naucrates/dxl/parser/CParseHandlerPlan.h"
+#include "naucrates/dxl/xml/CDXLBinaryFormat.h"
+#include "naucrates/dxl/xml/CDXLBinaryReader.h"
 #include "naucrates/dxl/xml/CDXLMemoryManager.h"
 #include "naucrates/dxl/xml/CXMLSerializer.h"
 #include "naucrates/md/CDXLStatsDerivedRelation.h"
@@ -231,6 +233,92 @@ CDXLUtils::GetParseHandlerForDXLFile(CMemoryPool *mp, const CHAR *dxl_filename,
 	return parse_handler_dxl;
 }
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLUtils::GetParseHandlerForDXLBinaryFile
+//
+//	@doc:
+//		Parse the given file in binary DXL format and return the top-level
+//		parser. The SAX reader is not used for parsing, it only holds the
+//		active parse handler for the binary reader.
+//
+//---------------------------------------------------------------------------
+CParseHandlerDXL *
+CDXLUtils::GetParseHandlerForDXLBinaryFile(CMemoryPool *mp,
+										   const CHAR *dxl_filename)
+{
+	GPOS_ASSERT(nullptr != mp);
+
+	CFileReader fr;
+	fr.Open(dxl_filename);
+
+	ULONG_PTR file_size = (ULONG_PTR) fr.FileSize();
+	CAutoRg<BYTE> read_buffer(GPOS_NEW_ARRAY(mp, BYTE, file_size + 1));
+
+	ULONG_PTR read_bytes = 0;
+	if (0 < file_size)
+	{
+		read_bytes = fr.ReadBytesToBuffer(read_buffer.Rgt(), file_size);
+	}
+	fr.Close();
+
+	// setup own memory manager
+	CDXLMemoryManager mm(mp);
+	SAX2XMLReader *sax_2_xml_reader = XMLReaderFactory::createXMLReader(&mm);
+
+	CParseHandlerManager parse_handler_mgr(&mm, sax_2_xml_reader);
+	CParseHandlerDXL *parse_handler_dxl =
+		CParseHandlerFactory::GetParseHandlerDXL(mp, &parse_handler_mgr);
+	parse_handler_mgr.ActivateParseHandler(parse_handler_dxl);
+
+	GPOS_TRY
+	{
+		CDXLBinaryReader reader(mp, read_buffer.Rgt(), (ULONG) read_bytes);
+		reader.Parse(sax_2_xml_reader);
+	}
+	GPOS_CATCH_EX(ex)
+	{
+		GPOS_DELETE(parse_handler_dxl);
+		delete sax_2_xml_reader;
+
+		GPOS_RETHROW(ex);
+	}
+	GPOS_CATCH_END;
+
+	GPOS_CHECK_ABORT;
+
+	// cleanup
+	delete sax_2_xml_reader;
+
+	return parse_handler_dxl;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLUtils::IsDXLBinaryFile
+//
+//	@doc:
+//		Does the given file start with the header of binary DXL
+//
+//---------------------------------------------------------------------------
+BOOL
+CDXLUtils::IsDXLBinaryFile(const CHAR *dxl_filename)
+{
+	CFileReader fr;
+	fr.Open(dxl_filename);
+
+	BYTE header[CDXLBinaryFormat::HeaderLength];
+	ULONG_PTR read_bytes = 0;
+	if (CDXLBinaryFormat::HeaderLength <= fr.FileSize())
+	{
+		read_bytes =
+			fr.ReadBytesToBuffer(header, CDXLBinaryFormat::HeaderLength);
+	}
+	fr.Close();
+
+	return CDXLBinaryFormat::HasHeader(header, (ULONG) read_bytes);
+}
+
 
 //---------------------------------------------------------------------------
 //	@function:
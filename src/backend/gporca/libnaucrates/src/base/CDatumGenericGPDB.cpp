@@ -52,7 +52,10 @@ CDatumGenericGPDB::CDatumGenericGPDB(CMemoryPool *mp, IMDId *mdid,
 	  m_type_modifier(type_modifier),
 	  m_cached_type(nullptr),
 	  m_stats_comp_val_int(stats_comp_val_int),
-	  m_stats_comp_val_double(stats_comp_val_double)
+	  m_stats_comp_val_double(stats_comp_val_double),
+	  m_sort_key(nullptr),
+	  m_sort_key_len(0),
+	  m_sort_key_batch(0)
 {
 	GPOS_ASSERT(nullptr != mp);
 	GPOS_ASSERT(mdid->IsValid());
@@ -78,6 +81,7 @@ CDatumGenericGPDB::CDatumGenericGPDB(CMemoryPool *mp, IMDId *mdid,
 CDatumGenericGPDB::~CDatumGenericGPDB()
 {
 	GPOS_DELETE_ARRAY(m_bytearray_value);
+	GPOS_DELETE_ARRAY(m_sort_key);
 	m_mdid->Release();
 }
 
@@ -546,4 +550,52 @@ CDatumGenericGPDB::GetTrailingWildcardSelectivity(const BYTE *dest,
 	return CDouble(1.0);
 }
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CDatumGenericGPDB::GetSortKey
+//
+//	@doc:
+//		Return the cached sort key and the batch it was computed in, or null
+//		if there is none
+//
+//---------------------------------------------------------------------------
+const BYTE *
+CDatumGenericGPDB::GetSortKey(ULONG *key_len, ULONG *batch) const
+{
+	GPOS_ASSERT(nullptr != key_len);
+	GPOS_ASSERT(nullptr != batch);
+
+	*key_len = m_sort_key_len;
+	*batch = m_sort_key_batch;
+
+	return m_sort_key;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDatumGenericGPDB::SetSortKey
+//
+//	@doc:
+//		Cache a copy of the given sort key, replacing any previous one
+//
+//---------------------------------------------------------------------------
+void
+CDatumGenericGPDB::SetSortKey(const BYTE *key, ULONG key_len,
+							  ULONG batch) const
+{
+	GPOS_ASSERT(!IsNull());
+	GPOS_ASSERT_IMP(0 < key_len, nullptr != key);
+
+	GPOS_DELETE_ARRAY(m_sort_key);
+
+	// allocate an extra byte, so that an empty key is not null
+	m_sort_key = GPOS_NEW_ARRAY(m_mp, BYTE, key_len + 1);
+	if (0 < key_len)
+	{
+		(void) clib::Memcpy(m_sort_key, key, key_len);
+	}
+	m_sort_key_len = key_len;
+	m_sort_key_batch = batch;
+}
+
 // EOF
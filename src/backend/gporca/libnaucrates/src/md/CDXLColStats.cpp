@@ -34,7 +34,7 @@ CDXLColStats::CDXLColStats(CMemoryPool *mp, CMDIdColStats *mdid_col_stats,
 						   CMDName *mdname, CDouble width, CDouble null_freq,
 						   CDouble distinct_remaining, CDouble freq_remaining,
 						   CDXLBucketArray *dxl_stats_bucket_array,
-						   BOOL is_col_stats_missing)
+						   BOOL is_col_stats_missing, CHyperLogLog *hll)
 	: m_mp(mp),
 	  m_mdid_col_stats(mdid_col_stats),
 	  m_mdname(mdname),
@@ -43,7 +43,8 @@ CDXLColStats::CDXLColStats(CMemoryPool *mp, CMDIdColStats *mdid_col_stats,
 	  m_distinct_remaining(distinct_remaining),
 	  m_freq_remaining(freq_remaining),
 	  m_dxl_stats_bucket_array(dxl_stats_bucket_array),
-	  m_is_col_stats_missing(is_col_stats_missing)
+	  m_is_col_stats_missing(is_col_stats_missing),
+	  m_hll(hll)
 {
 	GPOS_ASSERT(mdid_col_stats->IsValid());
 	GPOS_ASSERT(nullptr != dxl_stats_bucket_array);
@@ -66,6 +67,7 @@ CDXLColStats::~CDXLColStats()
 	}
 	m_mdid_col_stats->Release();
 	m_dxl_stats_bucket_array->Release();
+	CRefCount::SafeRelease(m_hll);
 }
 
 const CWStringDynamic *
@@ -168,6 +170,13 @@ CDXLColStats::Serialize(CXMLSerializer *xml_serializer) const
 		CDXLTokens::GetDXLTokenStr(EdxltokenColStatsMissing),
 		m_is_col_stats_missing);
 
+	if (nullptr != m_hll)
+	{
+		xml_serializer->AddAttribute(
+			CDXLTokens::GetDXLTokenStr(EdxltokenColStatsHyperLogLog),
+			false /* is_null */, m_hll->GetRegisters(), m_hll->Size());
+	}
+
 	GPOS_CHECK_ABORT;
 
 	ULONG num_of_buckets = Buckets();
@@ -209,6 +218,12 @@ CDXLColStats::DebugPrint(IOstream &os) const
 		const CDXLBucket *dxl_bucket = GetDXLBucketAt(ul);
 		dxl_bucket->DebugPrint(os);
 	}
+
+	if (nullptr != m_hll)
+	{
+		m_hll->OsPrint(os);
+		os << std::endl;
+	}
 }
 
 #endif	// GPOS_DEBUG
@@ -25,12 +25,14 @@ using namespace gpmd;
 CDXLExtStats::CDXLExtStats(CMemoryPool *mp, IMDId *rel_stats_mdid,
 						   CMDName *mdname,
 						   CMDDependencyArray *extstats_dependency_array,
-						   CMDNDistinctArray *ndistinct_array)
+						   CMDNDistinctArray *ndistinct_array,
+						   CMDMCVList *mcv_list)
 	: m_mp(mp),
 	  m_rel_stats_mdid(rel_stats_mdid),
 	  m_mdname(mdname),
 	  m_dependency_array(extstats_dependency_array),
-	  m_ndistinct_array(ndistinct_array)
+	  m_ndistinct_array(ndistinct_array),
+	  m_mcv_list(mcv_list)
 {
 	GPOS_ASSERT(rel_stats_mdid->IsValid());
 }
@@ -45,6 +47,7 @@ CDXLExtStats::~CDXLExtStats()
 	m_rel_stats_mdid->Release();
 	m_dependency_array->Release();
 	m_ndistinct_array->Release();
+	CRefCount::SafeRelease(m_mcv_list);
 }
 
 //---------------------------------------------------------------------------
@@ -138,6 +141,12 @@ CDXLExtStats::Serialize(CXMLSerializer *xml_serializer) const
 		CDXLTokens::GetDXLTokenStr(EdxltokenNamespacePrefix),
 		CDXLTokens::GetDXLTokenStr(EdxltokenMVNDistinctList));
 
+	// serialize MCV list
+	if (nullptr != m_mcv_list)
+	{
+		m_mcv_list->Serialize(xml_serializer);
+	}
+
 	xml_serializer->CloseElement(
 		CDXLTokens::GetDXLTokenStr(EdxltokenNamespacePrefix),
 		CDXLTokens::GetDXLTokenStr(EdxltokenExtendedStats));
@@ -0,0 +1,148 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (c) 2023 VMware, Inc. or its affiliates. All Rights Reserved.
+//
+//	@filename:
+//		CDXLMatViewInfo.cpp
+//
+//	@doc:
+//		Implementation of the class representing the materialized views of a
+//		relation in DXL
+//---------------------------------------------------------------------------
+
+#include "naucrates/md/CDXLMatViewInfo.h"
+
+#include "gpos/common/CAutoP.h"
+#include "gpos/common/CAutoRef.h"
+#include "gpos/string/CWStringDynamic.h"
+
+#include "naucrates/dxl/CDXLUtils.h"
+#include "naucrates/dxl/xml/CXMLSerializer.h"
+
+using namespace gpdxl;
+using namespace gpmd;
+
+CDXLMatViewInfo::CDXLMatViewInfo(CMemoryPool *mp, IMDId *mdid,
+								 CMDName *mdname,
+								 CMDMatViewArray *matview_array)
+	: m_mp(mp), m_mdid(mdid), m_mdname(mdname), m_matview_array(matview_array)
+{
+	GPOS_ASSERT(mdid->IsValid());
+}
+
+CDXLMatViewInfo::~CDXLMatViewInfo()
+{
+	GPOS_DELETE(m_mdname);
+	if (nullptr != m_dxl_str)
+	{
+		GPOS_DELETE(m_dxl_str);
+	}
+	m_mdid->Release();
+	m_matview_array->Release();
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLMatViewInfo::MDId
+//
+//	@doc:
+//		Returns the metadata id of this object
+//
+//---------------------------------------------------------------------------
+IMDId *
+CDXLMatViewInfo::MDId() const
+{
+	return m_mdid;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLMatViewInfo::Mdname
+//
+//	@doc:
+//		Returns the name of the relation
+//
+//---------------------------------------------------------------------------
+CMDName
+CDXLMatViewInfo::Mdname() const
+{
+	return *m_mdname;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLMatViewInfo::GetStrRepr
+//
+//	@doc:
+//		Returns the DXL string for this object
+//
+//---------------------------------------------------------------------------
+const CWStringDynamic *
+CDXLMatViewInfo::GetStrRepr()
+{
+	if (nullptr == m_dxl_str)
+	{
+		m_dxl_str = CDXLUtils::SerializeMDObj(
+			m_mp, this, false /*fSerializeHeader*/, false /*indentation*/);
+	}
+	return m_dxl_str;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLMatViewInfo::Serialize
+//
+//	@doc:
+//		Serialize the materialized views in DXL format
+//
+//---------------------------------------------------------------------------
+void
+CDXLMatViewInfo::Serialize(CXMLSerializer *xml_serializer) const
+{
+	xml_serializer->OpenElement(
+		CDXLTokens::GetDXLTokenStr(EdxltokenNamespacePrefix),
+		CDXLTokens::GetDXLTokenStr(EdxltokenRelationMatViews));
+
+	m_mdid->Serialize(xml_serializer,
+					  CDXLTokens::GetDXLTokenStr(EdxltokenMdid));
+	xml_serializer->AddAttribute(CDXLTokens::GetDXLTokenStr(EdxltokenName),
+								 m_mdname->GetMDName());
+
+	for (ULONG ul = 0; ul < m_matview_array->Size(); ul++)
+	{
+		(*m_matview_array)[ul]->Serialize(xml_serializer);
+	}
+
+	xml_serializer->CloseElement(
+		CDXLTokens::GetDXLTokenStr(EdxltokenNamespacePrefix),
+		CDXLTokens::GetDXLTokenStr(EdxltokenRelationMatViews));
+
+	GPOS_CHECK_ABORT;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLMatViewInfo::CreateDXLDummyMatViewInfo
+//
+//	@doc:
+//		Relation without materialized views
+//
+//---------------------------------------------------------------------------
+CDXLMatViewInfo *
+CDXLMatViewInfo::CreateDXLDummyMatViewInfo(CMemoryPool *mp, IMDId *mdid)
+{
+	CAutoP<CWStringDynamic> str;
+	str = GPOS_NEW(mp) CWStringDynamic(mp, mdid->GetBuffer());
+	CAutoP<CMDName> mdname;
+	mdname = GPOS_NEW(mp) CMDName(mp, str.Value());
+	CAutoRef<CDXLMatViewInfo> matview_info_dxl;
+
+	CMDMatViewArray *matview_array = GPOS_NEW(mp) CMDMatViewArray(mp);
+
+	matview_info_dxl = GPOS_NEW(mp)
+		CDXLMatViewInfo(mp, mdid, mdname.Value(), matview_array);
+	mdname.Reset();
+	return matview_info_dxl.Reset();
+}
+
+// EOF
@@ -0,0 +1,176 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (c) 2023 VMware, Inc. or its affiliates. All Rights Reserved.
+//
+//	@filename:
+//		CMDMatView.cpp
+//
+//	@doc:
+//		Implementation of the class representing a materialized view over a
+//		single base relation
+//---------------------------------------------------------------------------
+
+#include "naucrates/md/CMDMatView.h"
+
+#include "gpopt/mdcache/CMDAccessor.h"
+#include "gpopt/translate/CTranslatorDXLToExpr.h"
+#include "naucrates/dxl/CDXLUtils.h"
+#include "naucrates/dxl/xml/CXMLSerializer.h"
+
+using namespace gpdxl;
+using namespace gpmd;
+using namespace gpopt;
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CMDMatViewColumn::Serialize
+//
+//	@doc:
+//		Serialize the derivation of a view column in DXL format
+//
+//---------------------------------------------------------------------------
+void
+CMDMatViewColumn::Serialize(CXMLSerializer *xml_serializer) const
+{
+	xml_serializer->OpenElement(
+		CDXLTokens::GetDXLTokenStr(EdxltokenNamespacePrefix),
+		CDXLTokens::GetDXLTokenStr(EdxltokenMatViewColumn));
+
+	xml_serializer->AddAttribute(CDXLTokens::GetDXLTokenStr(EdxltokenAttno),
+								 m_attno);
+	if (nullptr != m_agg_mdid)
+	{
+		m_agg_mdid->Serialize(xml_serializer,
+							  CDXLTokens::GetDXLTokenStr(EdxltokenAggrefOid));
+		xml_serializer->AddAttribute(
+			CDXLTokens::GetDXLTokenStr(EdxltokenMatViewCombinable),
+			m_is_combinable);
+	}
+
+	xml_serializer->CloseElement(
+		CDXLTokens::GetDXLTokenStr(EdxltokenNamespacePrefix),
+		CDXLTokens::GetDXLTokenStr(EdxltokenMatViewColumn));
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CMDMatView::CMDMatView
+//
+//	@doc:
+//		Ctor
+//
+//---------------------------------------------------------------------------
+CMDMatView::CMDMatView(CMemoryPool *mp, IMDId *mdid, CMDName *mdname,
+					   ULongPtrArray *grouping_attnos,
+					   CMDMatViewColumnArray *columns, CDXLNode *filter)
+	: m_mp(mp),
+	  m_mdid(mdid),
+	  m_mdname(mdname),
+	  m_grouping_attnos(grouping_attnos),
+	  m_columns(columns),
+	  m_filter(filter)
+{
+	GPOS_ASSERT(mdid->IsValid());
+	GPOS_ASSERT(nullptr != mdname);
+	GPOS_ASSERT(nullptr != columns);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CMDMatView::~CMDMatView
+//
+//	@doc:
+//		Dtor
+//
+//---------------------------------------------------------------------------
+CMDMatView::~CMDMatView()
+{
+	GPOS_DELETE(m_mdname);
+	m_mdid->Release();
+	CRefCount::SafeRelease(m_grouping_attnos);
+	m_columns->Release();
+	CRefCount::SafeRelease(m_filter);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CMDMatView::GetFilterExpr
+//
+//	@doc:
+//		Scalar expression of the filter of the view, in terms of the given
+//		non-system columns of the base relation
+//
+//---------------------------------------------------------------------------
+CExpression *
+CMDMatView::GetFilterExpr(CMemoryPool *mp, CMDAccessor *md_accessor,
+						  IMDId *rel_mdid, CColRefArray *colref_array) const
+{
+	GPOS_ASSERT(nullptr != m_filter);
+	GPOS_ASSERT(nullptr != colref_array);
+
+	const IMDRelation *mdrel = md_accessor->RetrieveRel(rel_mdid);
+	GPOS_ASSERT(mdrel->NonDroppedColsCount() - mdrel->SystemColumnsCount() ==
+				colref_array->Size());
+
+	// the filter uses the same column ids as check constraints
+	CTranslatorDXLToExpr dxltr(mp, md_accessor);
+	return dxltr.PexprTranslateScalar(m_filter, colref_array,
+									  mdrel->NonDroppedColsArray());
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CMDMatView::Serialize
+//
+//	@doc:
+//		Serialize the view in DXL format
+//
+//---------------------------------------------------------------------------
+void
+CMDMatView::Serialize(CXMLSerializer *xml_serializer) const
+{
+	GPOS_CHECK_ABORT;
+
+	xml_serializer->OpenElement(
+		CDXLTokens::GetDXLTokenStr(EdxltokenNamespacePrefix),
+		CDXLTokens::GetDXLTokenStr(EdxltokenMatView));
+
+	m_mdid->Serialize(xml_serializer,
+					  CDXLTokens::GetDXLTokenStr(EdxltokenMdid));
+	xml_serializer->AddAttribute(CDXLTokens::GetDXLTokenStr(EdxltokenName),
+								 m_mdname->GetMDName());
+
+	if (nullptr != m_grouping_attnos)
+	{
+		CWStringDynamic *grouping_attnos =
+			CDXLUtils::Serialize(m_mp, m_grouping_attnos);
+		xml_serializer->AddAttribute(
+			CDXLTokens::GetDXLTokenStr(EdxltokenGroupingCols),
+			grouping_attnos);
+		GPOS_DELETE(grouping_attnos);
+	}
+
+	for (ULONG ul = 0; ul < m_columns->Size(); ul++)
+	{
+		(*m_columns)[ul]->Serialize(xml_serializer);
+	}
+
+	if (nullptr != m_filter)
+	{
+		xml_serializer->OpenElement(
+			CDXLTokens::GetDXLTokenStr(EdxltokenNamespacePrefix),
+			CDXLTokens::GetDXLTokenStr(EdxltokenMatViewFilter));
+		m_filter->SerializeToDXL(xml_serializer);
+		xml_serializer->CloseElement(
+			CDXLTokens::GetDXLTokenStr(EdxltokenNamespacePrefix),
+			CDXLTokens::GetDXLTokenStr(EdxltokenMatViewFilter));
+	}
+
+	xml_serializer->CloseElement(
+		CDXLTokens::GetDXLTokenStr(EdxltokenNamespacePrefix),
+		CDXLTokens::GetDXLTokenStr(EdxltokenMatView));
+
+	GPOS_CHECK_ABORT;
+}
+
+// EOF
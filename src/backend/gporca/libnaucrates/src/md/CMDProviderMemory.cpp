@@ -24,6 +24,7 @@
 #include "naucrates/exception.h"
 #include "naucrates/md/CDXLColStats.h"
 #include "naucrates/md/CDXLExtStatsInfo.h"
+#include "naucrates/md/CDXLMatViewInfo.h"
 #include "naucrates/md/CDXLRelStats.h"
 #include "naucrates/md/CMDTypeBoolGPDB.h"
 #include "naucrates/md/CMDTypeInt4GPDB.h"
@@ -203,6 +204,17 @@ CMDProviderMemory::GetMDObjDXLStr(CMemoryPool *mp,
 					false /*findent*/);
 				break;
 			}
+			case IMDId::EmdidMatViewInfo:
+			{
+				mdid->AddRef();
+				CAutoRef<CDXLMatViewInfo> a_pdxlmatviews;
+				a_pdxlmatviews =
+					CDXLMatViewInfo::CreateDXLDummyMatViewInfo(mp, mdid);
+				a_pstrResult = CDXLUtils::SerializeMDObj(
+					mp, a_pdxlmatviews.Value(), true /*fSerializeHeaders*/,
+					false /*findent*/);
+				break;
+			}
 			default:
 			{
 				GPOS_RAISE(gpdxl::ExmaMD, gpdxl::ExmiMDCacheEntryNotFound,
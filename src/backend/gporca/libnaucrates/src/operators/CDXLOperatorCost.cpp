@@ -23,7 +23,8 @@ CDXLOperatorCost::CDXLOperatorCost(CWStringDynamic *startup_cost_str,
 	: m_startup_cost_str(startup_cost_str),
 	  m_total_cost_str(total_cost_str),
 	  m_rows_out_str(rows_out_str),
-	  m_width_str(width_str)
+	  m_width_str(width_str),
+	  m_cardinality_fingerprint(0)
 {
 }
 
@@ -106,6 +107,12 @@ CDXLOperatorCost::SerializeToDXL(CXMLSerializer *xml_serializer) const
 								 m_rows_out_str);
 	xml_serializer->AddAttribute(CDXLTokens::GetDXLTokenStr(EdxltokenWidth),
 								 m_width_str);
+	if (0 != m_cardinality_fingerprint)
+	{
+		xml_serializer->AddAttribute(
+			CDXLTokens::GetDXLTokenStr(EdxltokenCardinalityFingerprint),
+			m_cardinality_fingerprint);
+	}
 
 	xml_serializer->CloseElement(
 		CDXLTokens::GetDXLTokenStr(EdxltokenNamespacePrefix),
@@ -132,7 +132,12 @@ CDXLOperatorFactory::MakeDXLHashJoin(CDXLMemoryManager *dxl_memory_manager,
 	EdxlJoinType join_type = ParseJoinType(
 		join_type_xml, CDXLTokens::GetDXLTokenStr(EdxltokenPhysicalHashJoin));
 
-	return GPOS_NEW(mp) CDXLPhysicalHashJoin(mp, join_type);
+	BOOL runtime_filter = ExtractConvertAttrValueToBool(
+		dxl_memory_manager, attrs, EdxltokenHashJoinRuntimeFilter,
+		EdxltokenPhysicalHashJoin, true /*is_optional*/,
+		false /*default_value*/);
+
+	return GPOS_NEW(mp) CDXLPhysicalHashJoin(mp, join_type, runtime_filter);
 }
 
 //---------------------------------------------------------------------------
@@ -274,8 +279,22 @@ CDXLOperatorFactory::MakeDXLRedistributeMotion(
 			EdxltokenDuplicateSensitive, EdxltokenPhysicalRedistributeMotion);
 	}
 
+	BOOL has_skew_values = false;
+	BOOL is_skew_broadcast = false;
+
+	const XMLCh *skew_broadcast_xml =
+		attrs.getValue(CDXLTokens::XmlstrToken(EdxltokenSkewBroadcast));
+	if (nullptr != skew_broadcast_xml)
+	{
+		has_skew_values = true;
+		is_skew_broadcast = ConvertAttrValueToBool(
+			dxl_memory_manager, skew_broadcast_xml, EdxltokenSkewBroadcast,
+			EdxltokenPhysicalRedistributeMotion);
+	}
+
 	CDXLPhysicalRedistributeMotion *dxl_op =
-		GPOS_NEW(mp) CDXLPhysicalRedistributeMotion(mp, is_duplicate_sensitive);
+		GPOS_NEW(mp) CDXLPhysicalRedistributeMotion(
+			mp, is_duplicate_sensitive, has_skew_values, is_skew_broadcast);
 	SetSegmentInfo(dxl_memory_manager, dxl_op, attrs,
 				   EdxltokenPhysicalRedistributeMotion);
 
@@ -507,7 +526,13 @@ CDXLOperatorFactory::MakeDXLSort(CDXLMemoryManager *dxl_memory_manager,
 		dxl_memory_manager, attrs, EdxltokenSortDiscardDuplicates,
 		EdxltokenPhysicalSort);
 
-	return GPOS_NEW(mp) CDXLPhysicalSort(mp, discard_duplicates);
+	// the number of presorted keys is only given for incremental sorts
+	ULONG num_presorted_keys = ExtractConvertAttrValueToUlong(
+		dxl_memory_manager, attrs, EdxltokenSortPresortedKeys,
+		EdxltokenPhysicalSort, true /*is_optional*/, 0 /*default_value*/);
+
+	return GPOS_NEW(mp)
+		CDXLPhysicalSort(mp, discard_duplicates, num_presorted_keys);
 }
 
 //---------------------------------------------------------------------------
@@ -1499,8 +1524,13 @@ CDXLOperatorFactory::MakeDXLOperatorCost(CDXLMemoryManager *dxl_memory_manager,
 	CWStringDynamic *width_str = CDXLUtils::CreateDynamicStringFromXMLChArray(
 		dxl_memory_manager, width_xml);
 
-	return GPOS_NEW(mp) CDXLOperatorCost(startup_cost_str, total_cost_str,
-										 rows_out_str, width_str);
+	CDXLOperatorCost *cost = GPOS_NEW(mp) CDXLOperatorCost(
+		startup_cost_str, total_cost_str, rows_out_str, width_str);
+	cost->SetCardinalityFingerprint(ExtractConvertAttrValueToUllong(
+		dxl_memory_manager, attrs, EdxltokenCardinalityFingerprint,
+		EdxltokenCost, true /* is_optional */, 0 /* default_value */));
+
+	return cost;
 }
 
 //---------------------------------------------------------------------------
@@ -2310,6 +2340,7 @@ CDXLOperatorFactory::MakeMdIdFromStr(CDXLMemoryManager *dxl_memory_manager,
 		case IMDId::EmdidCheckConstraint:
 		case IMDId::EmdidExtStatsInfo:
 		case IMDId::EmdidExtStats:
+		case IMDId::EmdidMatViewInfo:
 			mdid = GetGPDBMdId(dxl_memory_manager, remaining_tokens,
 							   target_attr, target_elem, typ);
 			break;
@@ -27,8 +27,9 @@ using namespace gpdxl;
 //
 //---------------------------------------------------------------------------
 CDXLPhysicalHashJoin::CDXLPhysicalHashJoin(CMemoryPool *mp,
-										   EdxlJoinType join_type)
-	: CDXLPhysicalJoin(mp, join_type)
+										   EdxlJoinType join_type,
+										   BOOL runtime_filter)
+	: CDXLPhysicalJoin(mp, join_type), m_runtime_filter(runtime_filter)
 {
 }
 
@@ -80,6 +81,12 @@ CDXLPhysicalHashJoin::SerializeToDXL(CXMLSerializer *xml_serializer,
 
 	xml_serializer->AddAttribute(CDXLTokens::GetDXLTokenStr(EdxltokenJoinType),
 								 GetJoinTypeNameStr());
+	if (m_runtime_filter)
+	{
+		xml_serializer->AddAttribute(
+			CDXLTokens::GetDXLTokenStr(EdxltokenHashJoinRuntimeFilter),
+			m_runtime_filter);
+	}
 
 	// serialize properties
 	node->SerializePropertiesToDXL(xml_serializer);
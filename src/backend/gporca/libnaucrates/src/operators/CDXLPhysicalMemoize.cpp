@@ -0,0 +1,146 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (c) 2023 VMware, Inc. or its affiliates. All Rights Reserved.
+//
+//	@filename:
+//		CDXLPhysicalMemoize.cpp
+//
+//	@doc:
+//		Implementation of DXL physical memoize operator
+//---------------------------------------------------------------------------
+
+
+#include "naucrates/dxl/operators/CDXLPhysicalMemoize.h"
+
+#include "naucrates/dxl/CDXLUtils.h"
+#include "naucrates/dxl/operators/CDXLNode.h"
+#include "naucrates/dxl/xml/CXMLSerializer.h"
+
+using namespace gpos;
+using namespace gpdxl;
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLPhysicalMemoize::CDXLPhysicalMemoize
+//
+//	@doc:
+//		Ctor
+//
+//---------------------------------------------------------------------------
+CDXLPhysicalMemoize::CDXLPhysicalMemoize(CMemoryPool *mp,
+										 ULongPtrArray *cache_key_colids,
+										 CDouble num_distinct)
+	: CDXLPhysical(mp),
+	  m_cache_key_colids(cache_key_colids),
+	  m_num_distinct(num_distinct)
+{
+	GPOS_ASSERT(nullptr != cache_key_colids);
+	GPOS_ASSERT(0 < cache_key_colids->Size());
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLPhysicalMemoize::~CDXLPhysicalMemoize
+//
+//	@doc:
+//		Dtor
+//
+//---------------------------------------------------------------------------
+CDXLPhysicalMemoize::~CDXLPhysicalMemoize()
+{
+	m_cache_key_colids->Release();
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLPhysicalMemoize::GetDXLOperator
+//
+//	@doc:
+//		Operator type
+//
+//---------------------------------------------------------------------------
+Edxlopid
+CDXLPhysicalMemoize::GetDXLOperator() const
+{
+	return EdxlopPhysicalMemoize;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLPhysicalMemoize::GetOpNameStr
+//
+//	@doc:
+//		Operator name
+//
+//---------------------------------------------------------------------------
+const CWStringConst *
+CDXLPhysicalMemoize::GetOpNameStr() const
+{
+	return CDXLTokens::GetDXLTokenStr(EdxltokenPhysicalMemoize);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLPhysicalMemoize::SerializeToDXL
+//
+//	@doc:
+//		Serialize operator in DXL format
+//
+//---------------------------------------------------------------------------
+void
+CDXLPhysicalMemoize::SerializeToDXL(CXMLSerializer *xml_serializer,
+									const CDXLNode *node) const
+{
+	const CWStringConst *element_name = GetOpNameStr();
+
+	xml_serializer->OpenElement(
+		CDXLTokens::GetDXLTokenStr(EdxltokenNamespacePrefix), element_name);
+
+	CWStringDynamic *str_colids =
+		CDXLUtils::Serialize(m_mp, m_cache_key_colids);
+	xml_serializer->AddAttribute(
+		CDXLTokens::GetDXLTokenStr(EdxltokenMemoizeCacheKeys), str_colids);
+	GPOS_DELETE(str_colids);
+
+	xml_serializer->AddAttribute(
+		CDXLTokens::GetDXLTokenStr(EdxltokenMemoizeNumDistinct),
+		m_num_distinct);
+
+	// serialize properties
+	node->SerializePropertiesToDXL(xml_serializer);
+
+	// serialize children
+	node->SerializeChildrenToDXL(xml_serializer);
+
+	xml_serializer->CloseElement(
+		CDXLTokens::GetDXLTokenStr(EdxltokenNamespacePrefix), element_name);
+}
+
+#ifdef GPOS_DEBUG
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLPhysicalMemoize::AssertValid
+//
+//	@doc:
+//		Checks whether operator node is well-structured
+//
+//---------------------------------------------------------------------------
+void
+CDXLPhysicalMemoize::AssertValid(const CDXLNode *node,
+								 BOOL validate_children) const
+{
+	GPOS_ASSERT(EdxlmemoizeIndexSentinel == node->Arity());
+
+	CDXLNode *child_dxlnode = (*node)[EdxlmemoizeIndexChild];
+	GPOS_ASSERT(EdxloptypePhysical ==
+				child_dxlnode->GetOperator()->GetDXLOperatorType());
+
+	if (validate_children)
+	{
+		child_dxlnode->GetOperator()->AssertValid(child_dxlnode,
+												  validate_children);
+	}
+}
+#endif	// GPOS_DEBUG
+
+// EOF
@@ -27,9 +27,14 @@ using namespace gpdxl;
 //
 //---------------------------------------------------------------------------
 CDXLPhysicalRedistributeMotion::CDXLPhysicalRedistributeMotion(
-	CMemoryPool *mp, BOOL is_duplicate_sensitive)
-	: CDXLPhysicalMotion(mp), m_is_duplicate_sensitive(is_duplicate_sensitive)
+	CMemoryPool *mp, BOOL is_duplicate_sensitive, BOOL has_skew_values,
+	BOOL is_skew_broadcast)
+	: CDXLPhysicalMotion(mp),
+	  m_is_duplicate_sensitive(is_duplicate_sensitive),
+	  m_has_skew_values(has_skew_values),
+	  m_is_skew_broadcast(is_skew_broadcast)
 {
+	GPOS_ASSERT_IMP(is_skew_broadcast, has_skew_values);
 }
 
 
@@ -87,6 +92,14 @@ CDXLPhysicalRedistributeMotion::SerializeToDXL(CXMLSerializer *xml_serializer,
 			CDXLTokens::GetDXLTokenStr(EdxltokenDuplicateSensitive), true);
 	}
 
+	if (m_has_skew_values)
+	{
+		// the attribute announces the trailing skew values list
+		xml_serializer->AddAttribute(
+			CDXLTokens::GetDXLTokenStr(EdxltokenSkewBroadcast),
+			m_is_skew_broadcast);
+	}
+
 	// serialize properties
 	dxlnode->SerializePropertiesToDXL(xml_serializer);
 
@@ -119,7 +132,10 @@ CDXLPhysicalRedistributeMotion::AssertValid(const CDXLNode *dxlnode,
 	GPOS_ASSERT(m_output_segids_array != nullptr);
 	GPOS_ASSERT(0 < m_output_segids_array->Size());
 
-	GPOS_ASSERT(EdxlrmIndexSentinel == dxlnode->Arity());
+	GPOS_ASSERT_IMP(m_has_skew_values,
+					EdxlrmIndexSentinel == dxlnode->Arity());
+	GPOS_ASSERT_IMP(!m_has_skew_values,
+					EdxlrmIndexSkewValuesList == dxlnode->Arity());
 
 	CDXLNode *child_dxlnode = (*dxlnode)[EdxlrmIndexChild];
 	CDXLNode *hash_expr_list = (*dxlnode)[EdxlrmIndexHashExprList];
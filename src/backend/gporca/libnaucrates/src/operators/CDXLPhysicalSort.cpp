@@ -26,8 +26,11 @@ using namespace gpdxl;
 //		Constructor
 //
 //---------------------------------------------------------------------------
-CDXLPhysicalSort::CDXLPhysicalSort(CMemoryPool *mp, BOOL discard_duplicates)
-	: CDXLPhysical(mp), m_discard_duplicates(discard_duplicates)
+CDXLPhysicalSort::CDXLPhysicalSort(CMemoryPool *mp, BOOL discard_duplicates,
+								   ULONG num_presorted_keys)
+	: CDXLPhysical(mp),
+	  m_discard_duplicates(discard_duplicates),
+	  m_num_presorted_keys(num_presorted_keys)
 {
 }
 
@@ -96,6 +99,13 @@ CDXLPhysicalSort::SerializeToDXL(CXMLSerializer *xml_serializer,
 		CDXLTokens::GetDXLTokenStr(EdxltokenSortDiscardDuplicates),
 		m_discard_duplicates);
 
+	if (0 < m_num_presorted_keys)
+	{
+		xml_serializer->AddAttribute(
+			CDXLTokens::GetDXLTokenStr(EdxltokenSortPresortedKeys),
+			m_num_presorted_keys);
+	}
+
 	// serialize properties
 	dxlnode->SerializePropertiesToDXL(xml_serializer);
 
@@ -138,6 +148,7 @@ CDXLPhysicalSort::AssertValid(const CDXLNode *dxlnode,
 				limit_count_dxlnode->GetOperator()->GetDXLOperator());
 	GPOS_ASSERT(EdxlopScalarLimitOffset ==
 				limit_offset_dxlnode->GetOperator()->GetDXLOperator());
+	GPOS_ASSERT(m_num_presorted_keys < sort_col_list_dxlnode->Arity());
 
 	// there must be at least one sorting column
 	GPOS_ASSERT(sort_col_list_dxlnode->Arity() > 0);
@@ -27,7 +27,7 @@ using namespace gpdxl;
 //
 //---------------------------------------------------------------------------
 CDXLPhysicalTableScan::CDXLPhysicalTableScan(CMemoryPool *mp)
-	: CDXLPhysical(mp), m_dxl_table_descr(nullptr)
+	: CDXLPhysical(mp), m_dxl_table_descr(nullptr), m_parallel_workers(0)
 {
 }
 
@@ -41,8 +41,11 @@ CDXLPhysicalTableScan::CDXLPhysicalTableScan(CMemoryPool *mp)
 //
 //---------------------------------------------------------------------------
 CDXLPhysicalTableScan::CDXLPhysicalTableScan(CMemoryPool *mp,
-											 CDXLTableDescr *table_descr)
-	: CDXLPhysical(mp), m_dxl_table_descr(table_descr)
+											 CDXLTableDescr *table_descr,
+											 ULONG parallel_workers)
+	: CDXLPhysical(mp),
+	  m_dxl_table_descr(table_descr),
+	  m_parallel_workers(parallel_workers)
 {
 }
 
@@ -139,6 +142,13 @@ CDXLPhysicalTableScan::SerializeToDXL(CXMLSerializer *xml_serializer,
 	xml_serializer->OpenElement(
 		CDXLTokens::GetDXLTokenStr(EdxltokenNamespacePrefix), element_name);
 
+	if (0 < m_parallel_workers)
+	{
+		xml_serializer->AddAttribute(
+			CDXLTokens::GetDXLTokenStr(EdxltokenParallelWorkers),
+			m_parallel_workers);
+	}
+
 	// serialize properties
 	dxlnode->SerializePropertiesToDXL(xml_serializer);
 
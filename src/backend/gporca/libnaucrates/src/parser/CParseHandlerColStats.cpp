@@ -42,7 +42,8 @@ CParseHandlerColStats::CParseHandlerColStats(
 	  m_null_freq(0.0),
 	  m_distinct_remaining(0.0),
 	  m_freq_remaining(0.0),
-	  m_is_column_stats_missing(false)
+	  m_is_column_stats_missing(false),
+	  m_hll(nullptr)
 {
 }
 
@@ -129,6 +130,24 @@ CParseHandlerColStats::StartElement(const XMLCh *const element_uri,
 					parsed_is_column_stats_missing, EdxltokenColStatsMissing,
 					EdxltokenColumnStats);
 		}
+
+		const XMLCh *parsed_hll = attrs.getValue(
+			CDXLTokens::XmlstrToken(EdxltokenColStatsHyperLogLog));
+		if (nullptr != parsed_hll)
+		{
+			ULONG size = 0;
+			BYTE *registers = CDXLUtils::CreateStringFrom64XMLStr(
+				m_parse_handler_mgr->GetDXLMemoryManager(), parsed_hll, &size);
+
+			// the precision is the number of bits of the number of registers
+			ULONG precision = 0;
+			while ((ULONG)(1 << precision) < size)
+			{
+				precision++;
+			}
+			m_hll = CHyperLogLog::Make(m_mp, precision, registers, size);
+			GPOS_DELETE_ARRAY(registers);
+		}
 	}
 	else if (0 == XMLString::compareString(
 					  CDXLTokens::XmlstrToken(EdxltokenColumnStatsBucket),
@@ -198,7 +217,8 @@ CParseHandlerColStats::EndElement(const XMLCh *const,  // element_uri,
 
 	m_imd_obj = GPOS_NEW(m_mp) CDXLColStats(
 		m_mp, m_mdid, m_md_name, m_width, m_null_freq, m_distinct_remaining,
-		m_freq_remaining, dxl_stats_bucket_array, m_is_column_stats_missing);
+		m_freq_remaining, dxl_stats_bucket_array, m_is_column_stats_missing,
+		m_hll);
 
 	// deactivate handler
 	m_parse_handler_mgr->DeactivateHandler();
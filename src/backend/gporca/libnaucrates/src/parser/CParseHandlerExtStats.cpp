@@ -14,6 +14,7 @@
 
 #include "naucrates/dxl/operators/CDXLOperatorFactory.h"
 #include "naucrates/dxl/parser/CParseHandlerExtStatsDependencies.h"
+#include "naucrates/dxl/parser/CParseHandlerExtStatsMCVList.h"
 #include "naucrates/dxl/parser/CParseHandlerExtStatsNDistinctList.h"
 #include "naucrates/dxl/parser/CParseHandlerFactory.h"
 #include "naucrates/dxl/parser/CParseHandlerManager.h"
@@ -54,12 +55,29 @@ CParseHandlerExtStats::~CParseHandlerExtStats()
 //
 //---------------------------------------------------------------------------
 void
-CParseHandlerExtStats::StartElement(const XMLCh *const,	 // element_uri,
-									const XMLCh *const element_local_name
-										GPOS_UNUSED,
-									const XMLCh *const,	 // element_qname,
-									const Attributes &attrs GPOS_UNUSED)
+CParseHandlerExtStats::StartElement(const XMLCh *const element_uri,
+									const XMLCh *const element_local_name,
+									const XMLCh *const element_qname,
+									const Attributes &attrs)
 {
+	if (0 == XMLString::compareString(
+				 CDXLTokens::XmlstrToken(EdxltokenMVMCVList),
+				 element_local_name))
+	{
+		// the MCV list is optional and follows the ndistinct list
+		CParseHandlerBase *mcv_list_parse_handler =
+			CParseHandlerFactory::GetParseHandler(
+				m_mp, CDXLTokens::XmlstrToken(EdxltokenMVMCVList),
+				m_parse_handler_mgr, this);
+		m_parse_handler_mgr->ActivateParseHandler(mcv_list_parse_handler);
+
+		this->Append(mcv_list_parse_handler);
+
+		mcv_list_parse_handler->startElement(element_uri, element_local_name,
+											 element_qname, attrs);
+		return;
+	}
+
 	if (0 != XMLString::compareString(
 				 CDXLTokens::XmlstrToken(EdxltokenExtendedStats),
 				 element_local_name))
@@ -135,10 +153,19 @@ CParseHandlerExtStats::EndElement(const XMLCh *const,  // element_uri,
 		dynamic_cast<CParseHandlerExtStatsNDistinctList *>((*this)[0]);
 	ndistincts_parse_handler->GetNDistinctList()->AddRef();
 
+	CMDMCVList *mcv_list = nullptr;
+	if (2 < this->Length())
+	{
+		CParseHandlerExtStatsMCVList *mcv_list_parse_handler =
+			dynamic_cast<CParseHandlerExtStatsMCVList *>((*this)[2]);
+		mcv_list = mcv_list_parse_handler->GetMCVList();
+		mcv_list->AddRef();
+	}
+
 	m_mdid->AddRef();
 	m_imd_obj = GPOS_NEW(m_mp) CDXLExtStats(
 		m_mp, m_mdid, m_mdname, dependencies_parse_handler->GetDependencies(),
-		ndistincts_parse_handler->GetNDistinctList());
+		ndistincts_parse_handler->GetNDistinctList(), mcv_list);
 
 	// deactivate handler
 	m_parse_handler_mgr->DeactivateHandler();
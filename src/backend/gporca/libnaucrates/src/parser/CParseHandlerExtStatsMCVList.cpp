@@ -0,0 +1,175 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (c) 2023 VMware, Inc. or its affiliates. All Rights Reserved.
+//
+//	@filename:
+//		CParseHandlerExtStatsMCVList.cpp
+//
+//	@doc:
+//		Implementation of the SAX parse handler class for parsing an extended
+//		stats MCV list
+//---------------------------------------------------------------------------
+
+#include "naucrates/dxl/parser/CParseHandlerExtStatsMCVList.h"
+
+#include "naucrates/dxl/operators/CDXLOperatorFactory.h"
+#include "naucrates/dxl/parser/CParseHandlerManager.h"
+
+using namespace gpdxl;
+using namespace gpmd;
+using namespace gpnaucrates;
+
+XERCES_CPP_NAMESPACE_USE
+
+CParseHandlerExtStatsMCVList::CParseHandlerExtStatsMCVList(
+	CMemoryPool *mp, CParseHandlerManager *parse_handler_mgr,
+	CParseHandlerBase *parse_handler_base)
+	: CParseHandlerBase(mp, parse_handler_mgr, parse_handler_base),
+	  m_attnos(nullptr),
+	  m_items(nullptr),
+	  m_frequency(0.0),
+	  m_base_frequency(0.0),
+	  m_values(nullptr),
+	  m_mcv_list(nullptr)
+{
+}
+
+CParseHandlerExtStatsMCVList::~CParseHandlerExtStatsMCVList()
+{
+	CRefCount::SafeRelease(m_attnos);
+	CRefCount::SafeRelease(m_items);
+	CRefCount::SafeRelease(m_values);
+	CRefCount::SafeRelease(m_mcv_list);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CParseHandlerExtStatsMCVList::GetMCVList
+//
+//	@doc:
+//		The MCV list constructed by the parse handler
+//
+//---------------------------------------------------------------------------
+CMDMCVList *
+CParseHandlerExtStatsMCVList::GetMCVList() const
+{
+	return m_mcv_list;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CParseHandlerExtStatsMCVList::StartElement
+//
+//	@doc:
+//		Invoked by Xerces to process an opening tag
+//
+//---------------------------------------------------------------------------
+void
+CParseHandlerExtStatsMCVList::StartElement(
+	const XMLCh *const,	 // element_uri,
+	const XMLCh *const element_local_name,
+	const XMLCh *const,	 // element_qname,
+	const Attributes &attrs)
+{
+	if (0 ==
+		XMLString::compareString(CDXLTokens::XmlstrToken(EdxltokenMVMCVList),
+								 element_local_name))
+	{
+		GPOS_ASSERT(nullptr == m_items);
+
+		m_attnos = CDXLOperatorFactory::ExtractConvertValuesToIntBitSet(
+			m_parse_handler_mgr->GetDXLMemoryManager(), attrs, EdxltokenAttno,
+			EdxltokenMVMCVList);
+		m_items = GPOS_NEW(m_mp) CMDMCVItemArray(m_mp);
+	}
+	else if (0 == XMLString::compareString(
+					  CDXLTokens::XmlstrToken(EdxltokenMVMCVItem),
+					  element_local_name))
+	{
+		GPOS_ASSERT(nullptr != m_items);
+		GPOS_ASSERT(nullptr == m_values);
+
+		m_frequency = CDXLOperatorFactory::ExtractConvertAttrValueToDouble(
+			m_parse_handler_mgr->GetDXLMemoryManager(), attrs,
+			EdxltokenStatsFrequency, EdxltokenMVMCVItem);
+		m_base_frequency =
+			CDXLOperatorFactory::ExtractConvertAttrValueToDouble(
+				m_parse_handler_mgr->GetDXLMemoryManager(), attrs,
+				EdxltokenStatsBaseFrequency, EdxltokenMVMCVItem);
+		m_values = GPOS_NEW(m_mp) CDXLDatumArray(m_mp);
+	}
+	else if (0 == XMLString::compareString(
+					  CDXLTokens::XmlstrToken(EdxltokenMVMCVValue),
+					  element_local_name))
+	{
+		GPOS_ASSERT(nullptr != m_values);
+
+		m_values->Append(CDXLOperatorFactory::GetDatumVal(
+			m_parse_handler_mgr->GetDXLMemoryManager(), attrs,
+			EdxltokenMVMCVValue));
+	}
+	else
+	{
+		CWStringDynamic *str = CDXLUtils::CreateDynamicStringFromXMLChArray(
+			m_parse_handler_mgr->GetDXLMemoryManager(), element_local_name);
+		GPOS_RAISE(gpdxl::ExmaDXL, gpdxl::ExmiDXLUnexpectedTag,
+				   str->GetBuffer());
+	}
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CParseHandlerExtStatsMCVList::EndElement
+//
+//	@doc:
+//		Invoked by Xerces to process a closing tag
+//
+//---------------------------------------------------------------------------
+void
+CParseHandlerExtStatsMCVList::EndElement(
+	const XMLCh *const,	 // element_uri,
+	const XMLCh *const element_local_name,
+	const XMLCh *const	// element_qname
+)
+{
+	if (0 ==
+		XMLString::compareString(CDXLTokens::XmlstrToken(EdxltokenMVMCVList),
+								 element_local_name))
+	{
+		m_mcv_list = GPOS_NEW(m_mp) CMDMCVList(m_mp, m_attnos, m_items);
+		m_attnos = nullptr;
+		m_items = nullptr;
+
+		// deactivate handler
+		m_parse_handler_mgr->DeactivateHandler();
+	}
+	else if (0 == XMLString::compareString(
+					  CDXLTokens::XmlstrToken(EdxltokenMVMCVItem),
+					  element_local_name))
+	{
+		if (m_values->Size() != m_attnos->Size())
+		{
+			CWStringDynamic *str =
+				CDXLUtils::CreateDynamicStringFromXMLChArray(
+					m_parse_handler_mgr->GetDXLMemoryManager(),
+					element_local_name);
+			GPOS_RAISE(gpdxl::ExmaDXL, gpdxl::ExmiDXLIncorrectNumberOfChildren,
+					   str->GetBuffer());
+		}
+
+		m_items->Append(GPOS_NEW(m_mp) CMDMCVItem(
+			m_frequency, m_base_frequency, m_values));
+		m_values = nullptr;
+	}
+	else if (0 != XMLString::compareString(
+					  CDXLTokens::XmlstrToken(EdxltokenMVMCVValue),
+					  element_local_name))
+	{
+		CWStringDynamic *str = CDXLUtils::CreateDynamicStringFromXMLChArray(
+			m_parse_handler_mgr->GetDXLMemoryManager(), element_local_name);
+		GPOS_RAISE(gpdxl::ExmaDXL, gpdxl::ExmiDXLUnexpectedTag,
+				   str->GetBuffer());
+	}
+}
+
+// EOF
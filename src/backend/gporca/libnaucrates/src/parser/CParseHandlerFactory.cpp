@@ -79,6 +79,9 @@ CParseHandlerFactory::Init(CMemoryPool *mp)
 		{EdxltokenMVDependency, &CreateExtStatsDependencyParseHandler},
 		{EdxltokenMVNDistinctList, &CreateExtStatsNDistinctListParseHandler},
 		{EdxltokenMVNDistinct, &CreateExtStatsNDistinctParseHandler},
+		{EdxltokenMVMCVList, &CreateExtStatsMCVListParseHandler},
+		{EdxltokenRelationMatViews, &CreateRelationMatViewsParseHandler},
+		{EdxltokenMatView, &CreateMatViewParseHandler},
 		{EdxltokenColumnStats, &CreateColStatsParseHandler},
 		{EdxltokenMetadataIdList, &CreateMDIdListParseHandler},
 		{EdxltokenIndexInfoList, &CreateMDIndexInfoListParseHandler},
@@ -112,6 +115,7 @@ CParseHandlerFactory::Init(CMemoryPool *mp)
 		{EdxltokenPhysicalSort, &CreateSortParseHandler},
 		{EdxltokenPhysicalAppend, &CreateAppendParseHandler},
 		{EdxltokenPhysicalMaterialize, &CreateMaterializeParseHandler},
+		{EdxltokenPhysicalMemoize, &CreateMemoizeParseHandler},
 		{EdxltokenPhysicalDynamicTableScan, &CreateDTSParseHandler},
 		{EdxltokenPhysicalDynamicIndexScan, &CreateDynamicIdxScanParseHandler},
 		{EdxltokenPhysicalDynamicIndexOnlyScan,
@@ -562,6 +566,33 @@ CParseHandlerFactory::CreateExtStatsNDistinctParseHandler(
 													   parse_handler_root);
 }
 
+CParseHandlerBase *
+CParseHandlerFactory::CreateExtStatsMCVListParseHandler(
+	CMemoryPool *mp, CParseHandlerManager *parse_handler_mgr,
+	CParseHandlerBase *parse_handler_root)
+{
+	return GPOS_NEW(mp) CParseHandlerExtStatsMCVList(mp, parse_handler_mgr,
+													 parse_handler_root);
+}
+
+CParseHandlerBase *
+CParseHandlerFactory::CreateRelationMatViewsParseHandler(
+	CMemoryPool *mp, CParseHandlerManager *parse_handler_mgr,
+	CParseHandlerBase *parse_handler_root)
+{
+	return GPOS_NEW(mp) CParseHandlerRelationMatViews(mp, parse_handler_mgr,
+													  parse_handler_root);
+}
+
+CParseHandlerBase *
+CParseHandlerFactory::CreateMatViewParseHandler(
+	CMemoryPool *mp, CParseHandlerManager *parse_handler_mgr,
+	CParseHandlerBase *parse_handler_root)
+{
+	return GPOS_NEW(mp)
+		CParseHandlerMatView(mp, parse_handler_mgr, parse_handler_root);
+}
+
 // creates a parse handler for parsing column stats
 CParseHandlerBase *
 CParseHandlerFactory::CreateColStatsParseHandler(
@@ -831,6 +862,16 @@ CParseHandlerFactory::CreateMaterializeParseHandler(
 		CParseHandlerMaterialize(mp, parse_handler_mgr, parse_handler_root);
 }
 
+// creates a parse handler for parsing a memoize operator
+CParseHandlerBase *
+CParseHandlerFactory::CreateMemoizeParseHandler(
+	CMemoryPool *mp, CParseHandlerManager *parse_handler_mgr,
+	CParseHandlerBase *parse_handler_root)
+{
+	return GPOS_NEW(mp)
+		CParseHandlerMemoize(mp, parse_handler_mgr, parse_handler_root);
+}
+
 // creates a parse handler for parsing a dynamic table scan operator
 CParseHandlerBase *
 CParseHandlerFactory::CreateDTSParseHandler(
@@ -0,0 +1,209 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (c) 2023 VMware, Inc. or its affiliates. All Rights Reserved.
+//
+//	@filename:
+//		CParseHandlerMatView.cpp
+//
+//	@doc:
+//		Implementation of the SAX parse handler class for parsing a
+//		materialized view definition
+//---------------------------------------------------------------------------
+
+#include "naucrates/dxl/parser/CParseHandlerMatView.h"
+
+#include "naucrates/dxl/operators/CDXLOperatorFactory.h"
+#include "naucrates/dxl/parser/CParseHandlerFactory.h"
+#include "naucrates/dxl/parser/CParseHandlerManager.h"
+#include "naucrates/dxl/parser/CParseHandlerScalarOp.h"
+
+using namespace gpdxl;
+using namespace gpmd;
+
+XERCES_CPP_NAMESPACE_USE
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CParseHandlerMatView::CParseHandlerMatView
+//
+//	@doc:
+//		Constructor
+//
+//---------------------------------------------------------------------------
+CParseHandlerMatView::CParseHandlerMatView(
+	CMemoryPool *mp, CParseHandlerManager *parse_handler_mgr,
+	CParseHandlerBase *parse_handler_base)
+	: CParseHandlerBase(mp, parse_handler_mgr, parse_handler_base),
+	  m_mdid(nullptr),
+	  m_mdname(nullptr),
+	  m_grouping_attnos(nullptr),
+	  m_columns(nullptr),
+	  m_filter(nullptr),
+	  m_matview(nullptr)
+{
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CParseHandlerMatView::~CParseHandlerMatView
+//
+//	@doc:
+//		Destructor
+//
+//---------------------------------------------------------------------------
+CParseHandlerMatView::~CParseHandlerMatView()
+{
+	CRefCount::SafeRelease(m_matview);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CParseHandlerMatView::GetMatView
+//
+//	@doc:
+//		The view constructed by the parse handler
+//
+//---------------------------------------------------------------------------
+CMDMatView *
+CParseHandlerMatView::GetMatView() const
+{
+	return m_matview;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CParseHandlerMatView::StartElement
+//
+//	@doc:
+//		Invoked by Xerces to process an opening tag
+//
+//---------------------------------------------------------------------------
+void
+CParseHandlerMatView::StartElement(const XMLCh *const,	// element_uri,
+								   const XMLCh *const element_local_name,
+								   const XMLCh *const,	// element_qname
+								   const Attributes &attrs)
+{
+	CDXLMemoryManager *dxl_memory_manager =
+		m_parse_handler_mgr->GetDXLMemoryManager();
+
+	if (0 == XMLString::compareString(
+				 CDXLTokens::XmlstrToken(EdxltokenMatViewColumn),
+				 element_local_name))
+	{
+		GPOS_ASSERT(nullptr != m_columns);
+
+		INT attno = CDXLOperatorFactory::ExtractConvertAttrValueToInt(
+			dxl_memory_manager, attrs, EdxltokenAttno, EdxltokenMatViewColumn);
+		IMDId *agg_mdid = CDXLOperatorFactory::ExtractConvertAttrValueToMdId(
+			dxl_memory_manager, attrs, EdxltokenAggrefOid,
+			EdxltokenMatViewColumn, true /*is_optional*/);
+		BOOL is_combinable = CDXLOperatorFactory::ExtractConvertAttrValueToBool(
+			dxl_memory_manager, attrs, EdxltokenMatViewCombinable,
+			EdxltokenMatViewColumn, true /*is_optional*/,
+			false /*default_value*/);
+
+		m_columns->Append(GPOS_NEW(m_mp)
+							  CMDMatViewColumn(attno, agg_mdid, is_combinable));
+		return;
+	}
+
+	if (0 == XMLString::compareString(
+				 CDXLTokens::XmlstrToken(EdxltokenMatViewFilter),
+				 element_local_name))
+	{
+		GPOS_ASSERT(nullptr == m_filter);
+
+		// parse handler for the filter expression
+		CParseHandlerBase *filter_parse_handler =
+			CParseHandlerFactory::GetParseHandler(
+				m_mp, CDXLTokens::XmlstrToken(EdxltokenScalar),
+				m_parse_handler_mgr, this);
+		m_parse_handler_mgr->ActivateParseHandler(filter_parse_handler);
+		this->Append(filter_parse_handler);
+		return;
+	}
+
+	if (0 != XMLString::compareString(CDXLTokens::XmlstrToken(EdxltokenMatView),
+									  element_local_name))
+	{
+		CWStringDynamic *str = CDXLUtils::CreateDynamicStringFromXMLChArray(
+			dxl_memory_manager, element_local_name);
+		GPOS_RAISE(gpdxl::ExmaDXL, gpdxl::ExmiDXLUnexpectedTag,
+				   str->GetBuffer());
+	}
+
+	m_mdid = CDXLOperatorFactory::ExtractConvertAttrValueToMdId(
+		dxl_memory_manager, attrs, EdxltokenMdid, EdxltokenMatView);
+
+	const XMLCh *xml_str_name = CDXLOperatorFactory::ExtractAttrValue(
+		attrs, EdxltokenName, EdxltokenMatView);
+	CWStringDynamic *str_name = CDXLUtils::CreateDynamicStringFromXMLChArray(
+		dxl_memory_manager, xml_str_name);
+
+	// create a copy of the string in the CMDName constructor
+	m_mdname = GPOS_NEW(m_mp) CMDName(m_mp, str_name);
+	GPOS_DELETE(str_name);
+
+	// views without aggregates have no grouping columns
+	if (nullptr != CDXLOperatorFactory::ExtractAttrValue(
+					   attrs, EdxltokenGroupingCols, EdxltokenMatView,
+					   true /*is_optional*/))
+	{
+		m_grouping_attnos = CDXLOperatorFactory::ExtractConvertValuesToArray(
+			dxl_memory_manager, attrs, EdxltokenGroupingCols, EdxltokenMatView);
+	}
+
+	m_columns = GPOS_NEW(m_mp) CMDMatViewColumnArray(m_mp);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CParseHandlerMatView::EndElement
+//
+//	@doc:
+//		Invoked by Xerces to process a closing tag
+//
+//---------------------------------------------------------------------------
+void
+CParseHandlerMatView::EndElement(const XMLCh *const,  // element_uri,
+								 const XMLCh *const element_local_name,
+								 const XMLCh *const	 // element_qname
+)
+{
+	if (0 == XMLString::compareString(
+				 CDXLTokens::XmlstrToken(EdxltokenMatViewColumn),
+				 element_local_name))
+	{
+		return;
+	}
+
+	if (0 == XMLString::compareString(
+				 CDXLTokens::XmlstrToken(EdxltokenMatViewFilter),
+				 element_local_name))
+	{
+		CParseHandlerScalarOp *filter_parse_handler =
+			dynamic_cast<CParseHandlerScalarOp *>((*this)[Length() - 1]);
+		m_filter = filter_parse_handler->CreateDXLNode();
+		m_filter->AddRef();
+		return;
+	}
+
+	if (0 != XMLString::compareString(CDXLTokens::XmlstrToken(EdxltokenMatView),
+									  element_local_name))
+	{
+		CWStringDynamic *str = CDXLUtils::CreateDynamicStringFromXMLChArray(
+			m_parse_handler_mgr->GetDXLMemoryManager(), element_local_name);
+		GPOS_RAISE(gpdxl::ExmaDXL, gpdxl::ExmiDXLUnexpectedTag,
+				   str->GetBuffer());
+	}
+
+	m_matview =
+		GPOS_NEW(m_mp) CMDMatView(m_mp, m_mdid, m_mdname, m_grouping_attnos,
+								  m_columns, m_filter);
+
+	// deactivate handler
+	m_parse_handler_mgr->DeactivateHandler();
+}
+
+// EOF
@@ -18,6 +18,7 @@
 #include "naucrates/dxl/parser/CParseHandlerProjList.h"
 #include "naucrates/dxl/parser/CParseHandlerProperties.h"
 #include "naucrates/dxl/parser/CParseHandlerScalarOp.h"
+#include "naucrates/dxl/parser/CParseHandlerScalarValuesList.h"
 #include "naucrates/dxl/parser/CParseHandlerSortColList.h"
 #include "naucrates/dxl/parser/CParseHandlerUtils.h"
 
@@ -77,6 +78,17 @@ CParseHandlerRedistributeMotion::StartElement(
 	// create and activate the parse handler for the children nodes in reverse
 	// order of their expected appearance
 
+	// parse handler for the skew values of a hybrid redistribute motion
+	CParseHandlerBase *skew_values_list_parse_handler = nullptr;
+	if (m_dxl_op->HasSkewValues())
+	{
+		skew_values_list_parse_handler = CParseHandlerFactory::GetParseHandler(
+			m_mp, CDXLTokens::XmlstrToken(EdxltokenScalarValuesList),
+			m_parse_handler_mgr, this);
+		m_parse_handler_mgr->ActivateParseHandler(
+			skew_values_list_parse_handler);
+	}
+
 	// parse handler for child node
 	CParseHandlerBase *child_parse_handler =
 		CParseHandlerFactory::GetParseHandler(
@@ -126,6 +138,10 @@ CParseHandlerRedistributeMotion::StartElement(
 	this->Append(sort_col_list_parse_handler);
 	this->Append(hash_expr_list_parse_handler);
 	this->Append(child_parse_handler);
+	if (nullptr != skew_values_list_parse_handler)
+	{
+		this->Append(skew_values_list_parse_handler);
+	}
 }
 
 //---------------------------------------------------------------------------
@@ -179,6 +195,14 @@ CParseHandlerRedistributeMotion::EndElement(
 	AddChildFromParseHandler(hash_expr_list_parse_handler);
 	AddChildFromParseHandler(child_parse_handler);
 
+	if (m_dxl_op->HasSkewValues())
+	{
+		CParseHandlerScalarValuesList *skew_values_list_parse_handler =
+			dynamic_cast<CParseHandlerScalarValuesList *>(
+				(*this)[6]);
+		AddChildFromParseHandler(skew_values_list_parse_handler);
+	}
+
 	// deactivate handler
 	m_parse_handler_mgr->DeactivateHandler();
 }
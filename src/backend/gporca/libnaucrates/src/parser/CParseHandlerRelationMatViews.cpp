@@ -0,0 +1,144 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (c) 2023 VMware, Inc. or its affiliates. All Rights Reserved.
+//
+//	@filename:
+//		CParseHandlerRelationMatViews.cpp
+//
+//	@doc:
+//		Implementation of the SAX parse handler class for parsing the
+//		materialized views of a relation
+//---------------------------------------------------------------------------
+
+#include "naucrates/dxl/parser/CParseHandlerRelationMatViews.h"
+
+#include "naucrates/dxl/operators/CDXLOperatorFactory.h"
+#include "naucrates/dxl/parser/CParseHandlerFactory.h"
+#include "naucrates/dxl/parser/CParseHandlerManager.h"
+#include "naucrates/dxl/parser/CParseHandlerMatView.h"
+#include "naucrates/md/CDXLMatViewInfo.h"
+
+using namespace gpdxl;
+using namespace gpmd;
+
+XERCES_CPP_NAMESPACE_USE
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CParseHandlerRelationMatViews::CParseHandlerRelationMatViews
+//
+//	@doc:
+//		Constructor
+//
+//---------------------------------------------------------------------------
+CParseHandlerRelationMatViews::CParseHandlerRelationMatViews(
+	CMemoryPool *mp, CParseHandlerManager *parse_handler_mgr,
+	CParseHandlerBase *parse_handler_root)
+	: CParseHandlerMetadataObject(mp, parse_handler_mgr, parse_handler_root),
+	  m_mdid(nullptr),
+	  m_mdname(nullptr)
+{
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CParseHandlerRelationMatViews::StartElement
+//
+//	@doc:
+//		Invoked by Xerces to process an opening tag
+//
+//---------------------------------------------------------------------------
+void
+CParseHandlerRelationMatViews::StartElement(
+	const XMLCh *const element_uri, const XMLCh *const element_local_name,
+	const XMLCh *const element_qname, const Attributes &attrs)
+{
+	if (0 == XMLString::compareString(CDXLTokens::XmlstrToken(EdxltokenMatView),
+									  element_local_name))
+	{
+		CParseHandlerBase *matview_parse_handler =
+			CParseHandlerFactory::GetParseHandler(
+				m_mp, CDXLTokens::XmlstrToken(EdxltokenMatView),
+				m_parse_handler_mgr, this);
+		this->Append(matview_parse_handler);
+
+		m_parse_handler_mgr->ActivateParseHandler(matview_parse_handler);
+		matview_parse_handler->startElement(element_uri, element_local_name,
+											element_qname, attrs);
+		return;
+	}
+
+	if (0 != XMLString::compareString(
+				 CDXLTokens::XmlstrToken(EdxltokenRelationMatViews),
+				 element_local_name))
+	{
+		CWStringDynamic *str = CDXLUtils::CreateDynamicStringFromXMLChArray(
+			m_parse_handler_mgr->GetDXLMemoryManager(), element_local_name);
+		GPOS_RAISE(gpdxl::ExmaDXL, gpdxl::ExmiDXLUnexpectedTag,
+				   str->GetBuffer());
+	}
+
+	// parse table name
+	const XMLCh *xml_str_table_name = CDXLOperatorFactory::ExtractAttrValue(
+		attrs, EdxltokenName, EdxltokenRelationMatViews);
+
+	CWStringDynamic *str_table_name =
+		CDXLUtils::CreateDynamicStringFromXMLChArray(
+			m_parse_handler_mgr->GetDXLMemoryManager(), xml_str_table_name);
+
+	// create a copy of the string in the CMDName constructor
+	m_mdname = GPOS_NEW(m_mp) CMDName(m_mp, str_table_name);
+
+	GPOS_DELETE(str_table_name);
+
+	// parse metadata id info
+	m_mdid = CDXLOperatorFactory::ExtractConvertAttrValueToMdId(
+		m_parse_handler_mgr->GetDXLMemoryManager(), attrs, EdxltokenMdid,
+		EdxltokenRelationMatViews);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CParseHandlerRelationMatViews::EndElement
+//
+//	@doc:
+//		Invoked by Xerces to process a closing tag
+//
+//---------------------------------------------------------------------------
+void
+CParseHandlerRelationMatViews::EndElement(
+	const XMLCh *const,	 // element_uri,
+	const XMLCh *const element_local_name,
+	const XMLCh *const	// element_qname
+)
+{
+	if (0 != XMLString::compareString(
+				 CDXLTokens::XmlstrToken(EdxltokenRelationMatViews),
+				 element_local_name))
+	{
+		CWStringDynamic *str = CDXLUtils::CreateDynamicStringFromXMLChArray(
+			m_parse_handler_mgr->GetDXLMemoryManager(), element_local_name);
+		GPOS_RAISE(gpdxl::ExmaDXL, gpdxl::ExmiDXLUnexpectedTag,
+				   str->GetBuffer());
+	}
+
+	CMDMatViewArray *matview_array = GPOS_NEW(m_mp) CMDMatViewArray(m_mp);
+
+	for (ULONG ul = 0; ul < this->Length(); ul++)
+	{
+		CParseHandlerMatView *matview_parse_handler =
+			dynamic_cast<CParseHandlerMatView *>((*this)[ul]);
+		CMDMatView *matview = matview_parse_handler->GetMatView();
+		matview->AddRef();
+
+		matview_array->Append(matview);
+	}
+
+	m_imd_obj =
+		GPOS_NEW(m_mp) CDXLMatViewInfo(m_mp, m_mdid, m_mdname, matview_array);
+
+	// deactivate handler
+	m_parse_handler_mgr->DeactivateHandler();
+}
+
+// EOF
@@ -54,10 +54,15 @@ void
 CParseHandlerTableScan::StartElement(const XMLCh *const,  // element_uri,
 									 const XMLCh *const element_local_name,
 									 const XMLCh *const,  // element_qname
-									 const Attributes &	  // attrs
-)
+									 const Attributes &attrs)
 {
 	StartElement(element_local_name, EdxltokenPhysicalTableScan);
+
+	m_dxl_op->SetParallelWorkers(
+		CDXLOperatorFactory::ExtractConvertAttrValueToUlong(
+			m_parse_handler_mgr->GetDXLMemoryManager(), attrs,
+			EdxltokenParallelWorkers, EdxltokenPhysicalTableScan,
+			true /* is_optional */, 0 /* default_value */));
 }
 
 //---------------------------------------------------------------------------
@@ -0,0 +1,235 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (c) 2023 VMware, Inc. or its affiliates. All Rights Reserved.
+//
+//	@filename:
+//		CCardinalityFeedback.cpp
+//
+//	@doc:
+//		Implementation of the store of observed cardinalities
+//---------------------------------------------------------------------------
+
+#include "naucrates/statistics/CCardinalityFeedback.h"
+
+#include "gpos/common/clibwrapper.h"
+#include "gpos/common/syslibwrapper.h"
+#include "gpos/memory/CMemoryPoolManager.h"
+
+using namespace gpos;
+using namespace gpnaucrates;
+
+// observations within this ratio of the previous one of a fingerprint do not
+// change the version of the store
+#define GPNAUCRATES_FEEDBACK_SIGNIFICANT_RATIO 2.0
+
+CMemoryPool *CCardinalityFeedback::m_mp = nullptr;
+
+CCardinalityFeedback::SEntry *CCardinalityFeedback::m_entries = nullptr;
+
+ULONG CCardinalityFeedback::m_num_entries = 0;
+
+ULONG CCardinalityFeedback::m_max_age = 0;
+
+ULLONG CCardinalityFeedback::m_version = 0;
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CCardinalityFeedback::UllNow
+//
+//	@doc:
+//		Current time in seconds since the epoch
+//
+//---------------------------------------------------------------------------
+ULLONG
+CCardinalityFeedback::UllNow()
+{
+	TIMEVAL tv;
+	syslib::GetTimeOfDay(&tv, nullptr /*timezone*/);
+
+	return (ULLONG) tv.tv_sec;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CCardinalityFeedback::PentrySet
+//
+//	@doc:
+//		First entry of the set the given fingerprint maps to
+//
+//---------------------------------------------------------------------------
+CCardinalityFeedback::SEntry *
+CCardinalityFeedback::PentrySet(ULLONG fingerprint)
+{
+	GPOS_ASSERT(0 < m_num_entries && 0 == m_num_entries % 2);
+
+	return &m_entries[(fingerprint % (m_num_entries / 2)) * 2];
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CCardinalityFeedback::FStale
+//
+//	@doc:
+//		Is the entry too old to be used
+//
+//---------------------------------------------------------------------------
+BOOL
+CCardinalityFeedback::FStale(const SEntry *pentry, ULLONG now)
+{
+	return 0 != m_max_age && pentry->m_recorded_at + m_max_age < now;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CCardinalityFeedback::Configure
+//
+//	@doc:
+//		Allocate the store with the given number of entries, rounded up to
+//		an even number. The entries are dropped if the number changes.
+//
+//---------------------------------------------------------------------------
+void
+CCardinalityFeedback::Configure(ULONG num_entries, ULONG max_age)
+{
+	m_max_age = max_age;
+
+	num_entries += num_entries % 2;
+	if (num_entries == m_num_entries)
+	{
+		return;
+	}
+
+	Shutdown();
+	if (0 == num_entries)
+	{
+		return;
+	}
+
+	m_mp = CMemoryPoolManager::CreateMemoryPool();
+	m_entries = GPOS_NEW_ARRAY(m_mp, SEntry, num_entries);
+	m_num_entries = num_entries;
+	Reset();
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CCardinalityFeedback::Record
+//
+//	@doc:
+//		Record the rows observed for the given fingerprint, replacing the
+//		previous observation of the fingerprint, or else an empty or the
+//		older entry of its set
+//
+//---------------------------------------------------------------------------
+void
+CCardinalityFeedback::Record(ULLONG fingerprint, CDouble rows)
+{
+	if (!FInitialized() || 0 == fingerprint)
+	{
+		return;
+	}
+
+	SEntry *pentrySet = PentrySet(fingerprint);
+	SEntry *pentry = &pentrySet[0];
+	if (pentrySet[1].m_fingerprint == fingerprint ||
+		(pentrySet[0].m_fingerprint != fingerprint &&
+		 pentrySet[1].m_recorded_at < pentrySet[0].m_recorded_at))
+	{
+		pentry = &pentrySet[1];
+	}
+
+	DOUBLE dRows = std::max(rows.Get(), 1.0);
+	if (pentry->m_fingerprint != fingerprint ||
+		dRows > pentry->m_rows * GPNAUCRATES_FEEDBACK_SIGNIFICANT_RATIO ||
+		dRows * GPNAUCRATES_FEEDBACK_SIGNIFICANT_RATIO < pentry->m_rows)
+	{
+		m_version++;
+	}
+
+	pentry->m_fingerprint = fingerprint;
+	pentry->m_rows = dRows;
+	pentry->m_recorded_at = UllNow();
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CCardinalityFeedback::FLookup
+//
+//	@doc:
+//		Look up the rows observed for the given fingerprint
+//
+//---------------------------------------------------------------------------
+BOOL
+CCardinalityFeedback::FLookup(ULLONG fingerprint, CDouble *rows)
+{
+	GPOS_ASSERT(nullptr != rows);
+
+	if (!FInitialized() || 0 == fingerprint)
+	{
+		return false;
+	}
+
+	SEntry *pentrySet = PentrySet(fingerprint);
+	for (ULONG ul = 0; ul < 2; ul++)
+	{
+		SEntry *pentry = &pentrySet[ul];
+		if (pentry->m_fingerprint != fingerprint)
+		{
+			continue;
+		}
+
+		if (FStale(pentry, UllNow()))
+		{
+			pentry->m_fingerprint = 0;
+			return false;
+		}
+
+		*rows = CDouble(pentry->m_rows);
+		return true;
+	}
+
+	return false;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CCardinalityFeedback::Reset
+//
+//	@doc:
+//		Drop all entries
+//
+//---------------------------------------------------------------------------
+void
+CCardinalityFeedback::Reset()
+{
+	if (FInitialized())
+	{
+		clib::Memset(m_entries, 0, m_num_entries * sizeof(SEntry));
+		m_version++;
+	}
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CCardinalityFeedback::Shutdown
+//
+//	@doc:
+//		Release the store
+//
+//---------------------------------------------------------------------------
+void
+CCardinalityFeedback::Shutdown()
+{
+	if (nullptr != m_mp)
+	{
+		GPOS_DELETE_ARRAY(m_entries);
+		CMemoryPoolManager::Destroy(m_mp);
+	}
+
+	m_mp = nullptr;
+	m_entries = nullptr;
+	m_num_entries = 0;
+	m_version++;
+}
+
+// EOF
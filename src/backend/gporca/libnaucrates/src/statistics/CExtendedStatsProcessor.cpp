@@ -9,7 +9,8 @@
 //		Statistics helper routines for processing extended statistics.
 //
 //		Many functions in this file are mirrored versions of functions in
-//		dependencies.c and selfuncs.c. Ideally they should stay in sync.
+//		dependencies.c, mcv.c, extended_stats.c and selfuncs.c. Ideally they
+//		should stay in sync.
 //		Unfortunately, the duplication is necessary due ORCA's DXL abstraction
 //		that by design it to be independent of backend core. In other words, we
 //		do not necessarily have access to backend core functions. Hence the
@@ -22,6 +23,7 @@
 
 #include "naucrates/md/CMDExtStatsInfo.h"
 #include "naucrates/statistics/CFilterStatsProcessor.h"
+#include "naucrates/statistics/CStatsPredPoint.h"
 
 
 #define STATS_MAX_DIMENSIONS 8 /* max number of attributes */
@@ -228,6 +230,301 @@ find_strongest_dependency(CMDDependencyArray *dependencies, CBitSet *attnums)
 	return strongest;
 }
 
+/*
+ * IsMCVCapablePredicate
+ *		check that the predicate compares a column to a constant using an
+ *		operator that can be evaluated on the items of an MCV list
+ *
+ * NB: This function is a simplified version of
+ *     statext_is_compatible_clause() in extended_stats.c.
+ */
+static BOOL
+IsMCVCapablePredicate(CStatsPred *child_pred)
+{
+	if (child_pred->GetPredStatsType() != CStatsPred::EsptPoint)
+	{
+		return false;
+	}
+
+	CStatsPredPoint *point_pred = CStatsPredPoint::ConvertPredStats(child_pred);
+	switch (point_pred->GetCmpType())
+	{
+		case CStatsPred::EstatscmptEq:
+		case CStatsPred::EstatscmptNEq:
+		case CStatsPred::EstatscmptL:
+		case CStatsPred::EstatscmptLEq:
+		case CStatsPred::EstatscmptG:
+		case CStatsPred::EstatscmptGEq:
+			break;
+		default:
+			return false;
+	}
+
+	IDatum *datum = point_pred->GetPredPoint()->GetDatum();
+	return !datum->IsNull() && datum->StatsAreComparable(datum);
+}
+
+/*
+ * mcv_value_matches
+ *		evaluate a predicate on the value of one dimension of an MCV item
+ *
+ * NULL values never match, as all the operators are strict.
+ */
+static BOOL
+mcv_value_matches(CStatsPredPoint *point_pred, CPoint *value)
+{
+	if (value->GetDatum()->IsNull())
+	{
+		return false;
+	}
+
+	CPoint *pred_point = point_pred->GetPredPoint();
+	switch (point_pred->GetCmpType())
+	{
+		case CStatsPred::EstatscmptEq:
+			return value->Equals(pred_point);
+		case CStatsPred::EstatscmptNEq:
+			return value->IsNotEqual(pred_point);
+		case CStatsPred::EstatscmptL:
+			return value->IsLessThan(pred_point);
+		case CStatsPred::EstatscmptLEq:
+			return value->IsLessThanOrEqual(pred_point);
+		case CStatsPred::EstatscmptG:
+			return value->IsGreaterThan(pred_point);
+		case CStatsPred::EstatscmptGEq:
+			return value->IsGreaterThanOrEqual(pred_point);
+		default:
+			GPOS_ASSERT(false && "Unexpected MCV predicate");
+			return false;
+	}
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CExtendedStatsProcessor::ApplyMCVListToScaleFactorFilterCalculation
+//
+//	@doc:
+//		This function is essentially an ORCA version of the extended_stats.c
+//		function statext_mcv_clauselist_selectivity(). It determines the most
+//		suitable MCV list to apply, combines the selectivity of the matching
+//		MCV items with the selectivity of the non-MCV part estimated from the
+//		per-column histograms, and appends the resulting scale factor for the
+//		predicates it covered. The histograms of the covered columns are
+//		filtered by the predicates as usual.
+//
+//---------------------------------------------------------------------------
+void
+CExtendedStatsProcessor::ApplyMCVListToScaleFactorFilterCalculation(
+	CDoubleArray *scale_factors, CStatsPredConj *conjunctive_pred_stats,
+	const IMDExtStatsInfo *md_statsinfo, UlongToIntMap *colid_to_attno_mapping,
+	CMemoryPool *mp, UlongToHistogramMap *result_histograms)
+{
+	if (!md_statsinfo || md_statsinfo->GetExtStatInfoArray()->Size() == 0 ||
+		!colid_to_attno_mapping)
+	{
+		return;
+	}
+
+	/* collect the attnums of the compatible clauses */
+	CBitSet *clauses_attnums = GPOS_NEW(mp) CBitSet(mp);
+	for (ULONG ul = 0; ul < conjunctive_pred_stats->GetNumPreds(); ul++)
+	{
+		CStatsPred *child_pred = conjunctive_pred_stats->GetPredStats(ul);
+		if (child_pred->IsAlreadyUsedInScaleFactorEstimation() ||
+			!IsMCVCapablePredicate(child_pred))
+		{
+			continue;
+		}
+
+		ULONG colid = child_pred->GetColId();
+		INT *attnum = colid_to_attno_mapping->Find(&colid);
+		if (nullptr != attnum)
+		{
+			clauses_attnums->ExchangeSet(*attnum);
+		}
+	}
+
+	/* find the best suited statistics object for these attnums */
+	CMDExtStatsInfo *stat = nullptr;
+	if (clauses_attnums->Size() >= 2)
+	{
+		stat = choose_best_statistics(mp, md_statsinfo->GetExtStatInfoArray(),
+									  clauses_attnums,
+									  CMDExtStatsInfo::EstatMCV);
+	}
+	clauses_attnums->Release();
+
+	if (!stat)
+	{
+		return;
+	}
+
+	const COptCtxt *poctxt = COptCtxt::PoctxtFromTLS();
+	CMDAccessor *md_accessor = poctxt->Pmda();
+
+	CMDIdGPDB *pmdid =
+		GPOS_NEW(mp) CMDIdGPDB(IMDId::EmdidExtStats, stat->GetStatOid());
+	const IMDExtStats *extstats = md_accessor->RetrieveExtStats(pmdid);
+	pmdid->Release();
+
+	/* the MCV list may not be built yet */
+	CMDMCVList *mcv_list = extstats->GetMCVList();
+	if (nullptr == mcv_list || 0 == mcv_list->GetItems()->Size())
+	{
+		return;
+	}
+
+	/*
+	 * Pick the clauses covered by the statistics object, and the MCV
+	 * dimension of the attribute each of them references.
+	 */
+	CBitSet *stat_attnums = mcv_list->GetAttrs();
+	CStatsPredPtrArry *stat_clauses = GPOS_NEW(mp) CStatsPredPtrArry(mp);
+	ULongPtrArray *stat_clause_dims = GPOS_NEW(mp) ULongPtrArray(mp);
+	for (ULONG ul = 0; ul < conjunctive_pred_stats->GetNumPreds(); ul++)
+	{
+		CStatsPred *child_pred = conjunctive_pred_stats->GetPredStats(ul);
+		if (child_pred->IsAlreadyUsedInScaleFactorEstimation() ||
+			!IsMCVCapablePredicate(child_pred))
+		{
+			continue;
+		}
+
+		ULONG colid = child_pred->GetColId();
+		INT *attnum = colid_to_attno_mapping->Find(&colid);
+		if (nullptr == attnum || !stat_attnums->Get(*attnum))
+		{
+			continue;
+		}
+
+		ULONG dim = 0;
+		CBitSetIter bsiter(*stat_attnums);
+		while (bsiter.Advance() && (INT) bsiter.Bit() < *attnum)
+		{
+			dim++;
+		}
+
+		child_pred->AddRef();
+		stat_clauses->Append(child_pred);
+		stat_clause_dims->Append(GPOS_NEW(mp) ULONG(dim));
+	}
+
+	/*
+	 * Evaluate the clauses on the MCV items. Compute the total frequency of
+	 * the matching items, their base frequency (frequency assuming the
+	 * columns are independent), and the total frequency of all items.
+	 *
+	 * NB: This mirrors mcv_get_match_bitmap() and mcv_clauselist_selectivity()
+	 *     in mcv.c.
+	 */
+	DOUBLE mcv_sel = 0.0;
+	DOUBLE mcv_basesel = 0.0;
+	DOUBLE mcv_totalsel = 0.0;
+	BOOL is_comparable = true;
+
+	CMDMCVItemArray *items = mcv_list->GetItems();
+	for (ULONG i = 0; i < items->Size() && is_comparable; i++)
+	{
+		CMDMCVItem *item = (*items)[i];
+		BOOL matches = true;
+
+		for (ULONG ul = 0; ul < stat_clauses->Size() && matches; ul++)
+		{
+			CStatsPredPoint *point_pred =
+				CStatsPredPoint::ConvertPredStats((*stat_clauses)[ul]);
+			ULONG dim = *(*stat_clause_dims)[ul];
+			CDXLDatum *dxl_datum = (*item->GetValues())[dim];
+
+			CPoint *value = GPOS_NEW(mp)
+				CPoint(md_accessor->RetrieveType(dxl_datum->MDId())
+						   ->GetDatumForDXLDatum(mp, dxl_datum));
+
+			/*
+			 * Give up on the MCV list if the values can't be compared to the
+			 * constants of the clauses; the clauses are then estimated from
+			 * the histograms only.
+			 */
+			IDatum *datum = value->GetDatum();
+			IDatum *pred_datum = point_pred->GetPredPoint()->GetDatum();
+			if (!datum->IsNull() && !datum->StatsAreComparable(pred_datum))
+			{
+				is_comparable = false;
+			}
+
+			matches = is_comparable && mcv_value_matches(point_pred, value);
+			value->Release();
+		}
+
+		if (matches)
+		{
+			mcv_sel += item->GetFrequency().Get();
+			mcv_basesel += item->GetBaseFrequency().Get();
+		}
+		mcv_totalsel += item->GetFrequency().Get();
+	}
+
+	if (!is_comparable)
+	{
+		stat_clauses->Release();
+		stat_clause_dims->Release();
+		return;
+	}
+
+	/*
+	 * Compute the selectivity of the clauses assuming the columns are
+	 * independent, and filter the histograms of the covered columns.
+	 */
+	DOUBLE simple_sel = 1.0;
+	for (ULONG ul = 0; ul < stat_clauses->Size(); ul++)
+	{
+		CStatsPredPoint *point_pred =
+			CStatsPredPoint::ConvertPredStats((*stat_clauses)[ul]);
+		ULONG colid = point_pred->GetColId();
+		CHistogram *hist_before = result_histograms->Find(&colid);
+		GPOS_ASSERT(nullptr != hist_before);
+
+		if (hist_before->IsEmpty())
+		{
+			simple_sel *= CHistogram::DefaultSelectivity.Get();
+		}
+		else
+		{
+			CDouble local_scale_factor(1.0);
+			CHistogram *result_histogram =
+				hist_before->MakeHistogramFilterNormalize(
+					point_pred->GetCmpType(), point_pred->GetPredPoint(),
+					&local_scale_factor);
+			simple_sel /= local_scale_factor.Get();
+
+			CStatisticsUtils::AddHistogram(mp, colid, result_histogram,
+										   result_histograms,
+										   true /* fReplaceOld */);
+			GPOS_DELETE(result_histogram);
+		}
+
+		/* mark this one as done, so we don't touch it again. */
+		point_pred->SetEstimated();
+	}
+
+	/*
+	 * The MCV items cover the mcv_totalsel fraction of the rows exactly. For
+	 * the remaining rows, use the independence-based estimate minus the part
+	 * of it the matching MCV items already account for, capped by the
+	 * fraction of the rows not covered by the MCV list.
+	 *
+	 * NB: This mirrors mcv_combine_selectivities() in mcv.c.
+	 */
+	DOUBLE other_sel = std::max(simple_sel - mcv_basesel, 0.0);
+	other_sel = std::min(other_sel, std::max(1.0 - mcv_totalsel, 0.0));
+
+	DOUBLE sel = std::min(mcv_sel + other_sel, 1.0);
+	sel = std::max(sel, CStatistics::Epsilon.Get());
+	scale_factors->Append(GPOS_NEW(mp) CDouble(1.0 / sel));
+
+	stat_clauses->Release();
+	stat_clause_dims->Release();
+}
+
 //---------------------------------------------------------------------------
 //	@function:
 //		CExtendedStatsProcessor::ApplyCorrelatedStatsToScaleFactorFilterCalculation
@@ -245,8 +542,6 @@ CExtendedStatsProcessor::ApplyCorrelatedStatsToScaleFactorFilterCalculation(
 	const IMDExtStatsInfo *md_statsinfo, UlongToIntMap *colid_to_attno_mapping,
 	CMemoryPool *mp, UlongToHistogramMap *result_histograms)
 {
-	GPOS_ASSERT(scale_factors->Size() == 0);
-
 	if (!md_statsinfo || md_statsinfo->GetExtStatInfoArray()->Size() == 0)
 	{
 		return;
@@ -327,6 +327,12 @@ CFilterStatsProcessor::MakeHistHashMapConjFilter(
 	UlongToHistogramMap *result_histograms =
 		CStatisticsUtils::CopyHistHashMap(mp, input_histograms);
 
+	// estimate the predicates covered by an MCV list first, and then apply
+	// functional dependencies to the remaining ones, like the planner does
+	CExtendedStatsProcessor::ApplyMCVListToScaleFactorFilterCalculation(
+		scale_factors, conjunctive_pred_stats, input_stats->GetExtStatsInfo(),
+		input_stats->GetColidToAttnoMapping(), mp, result_histograms);
+
 	CExtendedStatsProcessor::ApplyCorrelatedStatsToScaleFactorFilterCalculation(
 		scale_factors, conjunctive_pred_stats, input_stats->GetExtStatsInfo(),
 		input_stats->GetColidToAttnoMapping(), mp, result_histograms);
@@ -62,7 +62,8 @@ CHistogram::CHistogram(CMemoryPool *mp, CBucketArray *histogram_buckets,
 	  m_skew_was_measured(false),
 	  m_skew(1.0),
 	  m_NDVs_were_scaled(false),
-	  m_is_col_stats_missing(false)
+	  m_is_col_stats_missing(false),
+	  m_hll(nullptr)
 {
 	GPOS_ASSERT(nullptr != histogram_buckets);
 }
@@ -78,7 +79,8 @@ CHistogram::CHistogram(CMemoryPool *mp, BOOL is_well_defined)
 	  m_skew_was_measured(false),
 	  m_skew(1.0),
 	  m_NDVs_were_scaled(false),
-	  m_is_col_stats_missing(false)
+	  m_is_col_stats_missing(false),
+	  m_hll(nullptr)
 {
 	m_histogram_buckets = GPOS_NEW(m_mp) CBucketArray(m_mp);
 }
@@ -97,7 +99,8 @@ CHistogram::CHistogram(CMemoryPool *mp, CBucketArray *histogram_buckets,
 	  m_skew_was_measured(false),
 	  m_skew(1.0),
 	  m_NDVs_were_scaled(false),
-	  m_is_col_stats_missing(is_col_stats_missing)
+	  m_is_col_stats_missing(is_col_stats_missing),
+	  m_hll(nullptr)
 {
 	GPOS_ASSERT(m_histogram_buckets);
 	// FIXME: These assertions are sometimes hit and is indicitive of a bug, but
@@ -122,6 +125,14 @@ CHistogram::SetNullFrequency(CDouble null_freq)
 	m_null_freq = null_freq;
 }
 
+// set the sketch of the distinct values
+void
+CHistogram::SetHyperLogLog(CHyperLogLog *hll)
+{
+	CRefCount::SafeRelease(m_hll);
+	m_hll = hll;
+}
+
 FORCE_GENERATE_DBGSTR(gpnaucrates::CHistogram);
 
 //	print function
@@ -641,6 +652,7 @@ CHistogram::MakeJoinHistogramNormalize(CStatsPred::EStatsCmpType stats_cmp_type,
 			std::max(CHistogram::MinDistinct.Get(), GetNumDistinct().Get()),
 			std::max(CHistogram::MinDistinct.Get(),
 					 other_histogram->GetNumDistinct().Get()));
+		*scale_factor = *scale_factor / GetContainment(other_histogram);
 		return MakeNDVBasedJoinHistogramEqualityFilter(other_histogram);
 	}
 
@@ -1026,6 +1038,12 @@ CHistogram::CopyHistogram() const
 		histogram_copy->SetNDVScaled();
 	}
 
+	if (nullptr != m_hll)
+	{
+		m_hll->AddRef();
+		histogram_copy->SetHyperLogLog(m_hll);
+	}
+
 	return histogram_copy;
 }
 
@@ -1195,8 +1213,10 @@ CHistogram::MakeNDVBasedJoinHistogramEqualityFilter(
 	}
 
 	// the estimated number of distinct value is the minimum of the non-null
-	// distinct values of the two inputs.
-	distinct_remaining = std::min(NDVs1, NDVs2);
+	// distinct values of the two inputs, scaled by the fraction of them
+	// that the sketches of the inputs find in both.
+	CDouble containment = GetContainment(histogram);
+	distinct_remaining = std::min(NDVs1, NDVs2) * containment;
 
 	// the frequency of a tuple in this histogram (with frequency freq_remain1) joining with
 	// a tuple in another relation (with frequency freq_remain2) is a product of the two frequencies divided by
@@ -1209,7 +1229,8 @@ CHistogram::MakeNDVBasedJoinHistogramEqualityFilter(
 	// freq_remain1 = freq_remain2 = 1, and std::max(NDVs1, NDVs2) = 5. Therefore freq_remaining = 1/5 = 0.2
 	if (CStatistics::Epsilon < distinct_remaining)
 	{
-		freq_remaining = freq_remain1 * freq_remain2 / std::max(NDVs1, NDVs2);
+		freq_remaining = freq_remain1 * freq_remain2 * containment /
+						 std::max(NDVs1, NDVs2);
 	}
 
 	return GPOS_NEW(m_mp)
@@ -1217,6 +1238,20 @@ CHistogram::MakeNDVBasedJoinHistogramEqualityFilter(
 				   0.0 /*null_freq*/, distinct_remaining, freq_remaining);
 }
 
+// fraction of the distinct values of the smaller of the two histograms
+// found in the other one, according to their sketches; without sketches
+// all of them are assumed to be found
+CDouble
+CHistogram::GetContainment(const CHistogram *histogram) const
+{
+	if (nullptr == m_hll || nullptr == histogram->m_hll)
+	{
+		return CDouble(1.0);
+	}
+
+	return m_hll->GetContainment(histogram->m_hll);
+}
+
 // construct a new histogram for an INDF join predicate
 CHistogram *
 CHistogram::MakeJoinHistogramINDFFilter(const CHistogram *histogram) const
@@ -1422,6 +1457,13 @@ CHistogram::MakeGroupByHistogramNormalize(CDouble,	// rows,
 				   m_distinct_remaining, freq_remaining);
 	*result_distinct_values = result_histogram->GetNumDistinct();
 
+	// removing duplicates keeps the set of values
+	if (nullptr != m_hll)
+	{
+		m_hll->AddRef();
+		result_histogram->SetHyperLogLog(m_hll);
+	}
+
 	return result_histogram;
 }
 
@@ -1532,6 +1574,11 @@ CHistogram::MakeUnionAllHistogramNormalize(CDouble rows,
 	(void) result_histogram->NormalizeHistogram();
 	GPOS_ASSERT(result_histogram->IsValid());
 
+	if (nullptr != m_hll && nullptr != histogram->m_hll)
+	{
+		result_histogram->SetHyperLogLog(m_hll->Merge(m_mp, histogram->m_hll));
+	}
+
 	new_buckets->Release();
 	return result_histogram;
 }
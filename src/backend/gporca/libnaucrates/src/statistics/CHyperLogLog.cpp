@@ -0,0 +1,279 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (c) 2023 VMware, Inc. or its affiliates. All Rights Reserved.
+//
+//	@filename:
+//		CHyperLogLog.cpp
+//
+//	@doc:
+//		Implementation of the HyperLogLog sketch of a column
+//---------------------------------------------------------------------------
+
+#include "naucrates/statistics/CHyperLogLog.h"
+
+#include <cmath>
+
+using namespace gpnaucrates;
+
+// largest value of a register
+#define GPNAUCRATES_HLL_MAX_REGISTER 255
+
+// fold registers at the given precision into new registers at a lower one;
+// the bits of the register number that are dropped become the leading bits
+// of the rest of the hash
+static BYTE *
+PbFold(CMemoryPool *mp, ULONG precision, const BYTE *registers,
+	   ULONG target_precision)
+{
+	GPOS_ASSERT(target_precision <= precision);
+
+	const ULONG size = 1 << target_precision;
+	const ULONG shift = precision - target_precision;
+
+	BYTE *folded = GPOS_NEW_ARRAY(mp, BYTE, size);
+	clib::Memset(folded, 0, size);
+
+	for (ULONG ul = 0; ul < (ULONG)(1 << precision); ul++)
+	{
+		if (0 == registers[ul])
+		{
+			continue;
+		}
+
+		ULONG dropped = ul & ((1 << shift) - 1);
+		ULONG value = registers[ul] + shift;
+		if (0 != dropped)
+		{
+			// leading zeros of the dropped bits, plus one
+			ULONG msb = 0;
+			while (0 != (dropped >> (msb + 1)))
+			{
+				msb++;
+			}
+			value = shift - msb;
+		}
+
+		value = std::min(value, (ULONG) GPNAUCRATES_HLL_MAX_REGISTER);
+		BYTE *target = &folded[ul >> shift];
+		*target = std::max(*target, (BYTE) value);
+	}
+
+	return folded;
+}
+
+// estimate the number of distinct values of registers, or of the union of
+// two sets of registers at the same precision
+static DOUBLE
+DEstimate(ULONG precision, const BYTE *registers, const BYTE *other_registers)
+{
+	const ULONG size = 1 << precision;
+
+	DOUBLE sum = 0.0;
+	ULONG num_empty = 0;
+	for (ULONG ul = 0; ul < size; ul++)
+	{
+		BYTE value = registers[ul];
+		if (nullptr != other_registers)
+		{
+			value = std::max(value, other_registers[ul]);
+		}
+
+		sum += std::ldexp(1.0, -(INT) value);
+		if (0 == value)
+		{
+			num_empty++;
+		}
+	}
+
+	DOUBLE m = (DOUBLE) size;
+	DOUBLE alpha = 0.7213 / (1.0 + 1.079 / m);
+	if (16 == size)
+	{
+		alpha = 0.673;
+	}
+	else if (32 == size)
+	{
+		alpha = 0.697;
+	}
+	else if (64 == size)
+	{
+		alpha = 0.709;
+	}
+
+	DOUBLE estimate = alpha * m * m / sum;
+	if (estimate <= 2.5 * m && 0 < num_empty)
+	{
+		// linear counting is more accurate for small cardinalities
+		estimate = m * std::log(m / (DOUBLE) num_empty);
+	}
+
+	return estimate;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CHyperLogLog::CHyperLogLog
+//
+//	@doc:
+//		Ctor
+//
+//---------------------------------------------------------------------------
+CHyperLogLog::CHyperLogLog(CMemoryPool *mp, ULONG precision, BYTE *registers)
+	: m_mp(mp), m_precision(precision), m_registers(registers)
+{
+	GPOS_ASSERT(MinPrecision <= precision && MaxPrecision >= precision);
+	GPOS_ASSERT(nullptr != registers);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CHyperLogLog::~CHyperLogLog
+//
+//	@doc:
+//		Dtor
+//
+//---------------------------------------------------------------------------
+CHyperLogLog::~CHyperLogLog()
+{
+	GPOS_DELETE_ARRAY(m_registers);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CHyperLogLog::Make
+//
+//	@doc:
+//		Sketch at the default precision from registers at the given
+//		precision; sketches at a lower precision are kept as they are
+//
+//---------------------------------------------------------------------------
+CHyperLogLog *
+CHyperLogLog::Make(CMemoryPool *mp, ULONG precision, const BYTE *registers,
+				   ULONG size)
+{
+	if (MinPrecision > precision || MaxPrecision < precision ||
+		(ULONG)(1 << precision) != size)
+	{
+		return nullptr;
+	}
+
+	ULONG target_precision = std::min(precision, (ULONG) DefaultPrecision);
+	BYTE *folded = PbFold(mp, precision, registers, target_precision);
+
+	return GPOS_NEW(mp) CHyperLogLog(mp, target_precision, folded);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CHyperLogLog::Estimate
+//
+//	@doc:
+//		Estimated number of distinct values
+//
+//---------------------------------------------------------------------------
+CDouble
+CHyperLogLog::Estimate() const
+{
+	return CDouble(DEstimate(m_precision, m_registers, nullptr));
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CHyperLogLog::Merge
+//
+//	@doc:
+//		Sketch of the union of the values of this sketch and another one,
+//		at the lower of their precisions
+//
+//---------------------------------------------------------------------------
+CHyperLogLog *
+CHyperLogLog::Merge(CMemoryPool *mp, const CHyperLogLog *other) const
+{
+	GPOS_ASSERT(nullptr != other);
+
+	ULONG precision = std::min(m_precision, other->m_precision);
+	BYTE *registers = PbFold(mp, m_precision, m_registers, precision);
+	BYTE *other_registers =
+		PbFold(mp, other->m_precision, other->m_registers, precision);
+
+	for (ULONG ul = 0; ul < (ULONG)(1 << precision); ul++)
+	{
+		registers[ul] = std::max(registers[ul], other_registers[ul]);
+	}
+	GPOS_DELETE_ARRAY(other_registers);
+
+	return GPOS_NEW(mp) CHyperLogLog(mp, precision, registers);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CHyperLogLog::GetContainment
+//
+//	@doc:
+//		Estimated fraction of the values of the smaller of the two sketches
+//		that also appear in the larger one. The overlap is the sum of the
+//		estimates of the two sketches less the estimate of their union, so
+//		it is only meaningful when the smaller sketch is large compared to
+//		the error of the union; otherwise all its values are assumed to be
+//		contained, as the optimizer does without sketches.
+//
+//---------------------------------------------------------------------------
+CDouble
+CHyperLogLog::GetContainment(const CHyperLogLog *other) const
+{
+	GPOS_ASSERT(nullptr != other);
+
+	DOUBLE estimate = 0.0;
+	DOUBLE other_estimate = 0.0;
+	DOUBLE union_estimate = 0.0;
+	ULONG precision = m_precision;
+	if (m_precision == other->m_precision)
+	{
+		estimate = DEstimate(precision, m_registers, nullptr);
+		other_estimate = DEstimate(precision, other->m_registers, nullptr);
+		union_estimate =
+			DEstimate(precision, m_registers, other->m_registers);
+	}
+	else
+	{
+		CHyperLogLog *merged = Merge(m_mp, other);
+		precision = merged->m_precision;
+		estimate = Estimate().Get();
+		other_estimate = other->Estimate().Get();
+		union_estimate = merged->Estimate().Get();
+		merged->Release();
+	}
+
+	// twice the standard error of the union
+	DOUBLE error = 2.0 * 1.04 / std::sqrt((DOUBLE)(1 << precision)) *
+				   union_estimate;
+	DOUBLE smaller = std::min(estimate, other_estimate);
+	if (smaller <= error || 1.0 > smaller)
+	{
+		return CDouble(1.0);
+	}
+
+	// at least one value is assumed to be common
+	DOUBLE overlap = estimate + other_estimate - union_estimate;
+	overlap = std::max(overlap, 1.0);
+
+	return CDouble(std::min(1.0, overlap / smaller));
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CHyperLogLog::OsPrint
+//
+//	@doc:
+//		Print function
+//
+//---------------------------------------------------------------------------
+IOstream &
+CHyperLogLog::OsPrint(IOstream &os) const
+{
+	os << "HyperLogLog: precision " << m_precision << ", ndv " << Estimate();
+
+	return os;
+}
+
+// EOF
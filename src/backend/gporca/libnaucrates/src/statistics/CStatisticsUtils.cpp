@@ -41,6 +41,7 @@
 #include "naucrates/md/IMDTypeInt4.h"
 #include "naucrates/md/IMDTypeInt8.h"
 #include "naucrates/md/IMDTypeOid.h"
+#include "naucrates/statistics/CCardinalityFeedback.h"
 #include "naucrates/statistics/CExtendedStatsProcessor.h"
 #include "naucrates/statistics/CFilterStatsProcessor.h"
 #include "naucrates/statistics/CHistogram.h"
@@ -1938,4 +1939,44 @@ CStatisticsUtils::ComputeCardUpperBounds(
 	}
 }
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CStatisticsUtils::ApplyCardinalityFeedback
+//
+//	@doc:
+//		Scale the given statistics to the cardinality observed in earlier
+//		executions of a subexpression with the given fingerprint. Returns
+//		the given statistics when there is no feedback, otherwise releases
+//		them and returns scaled statistics.
+//
+//---------------------------------------------------------------------------
+IStatistics *
+CStatisticsUtils::ApplyCardinalityFeedback(CMemoryPool *mp,
+										   IStatistics *stats,
+										   ULLONG fingerprint)
+{
+	GPOS_ASSERT(nullptr != stats);
+
+	CDouble observed_rows(0.0);
+	if (0 == fingerprint ||
+		!CCardinalityFeedback::FLookup(fingerprint, &observed_rows))
+	{
+		return stats;
+	}
+
+	CDouble estimated_rows = std::max(CStatistics::MinRows.Get(),
+									  stats->Rows().Get());
+	observed_rows = std::max(CStatistics::MinRows.Get(), observed_rows.Get());
+	if (observed_rows == estimated_rows)
+	{
+		return stats;
+	}
+
+	IStatistics *scaled_stats =
+		stats->ScaleStats(mp, observed_rows / estimated_rows);
+	stats->Release();
+
+	return scaled_stats;
+}
+
 // EOF
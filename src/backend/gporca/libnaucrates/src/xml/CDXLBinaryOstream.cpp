@@ -0,0 +1,825 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (c) 2023 VMware, Inc. or its affiliates. All Rights Reserved.
+//
+//	@filename:
+//		CDXLBinaryOstream.cpp
+//
+//	@doc:
+//		Implementation of the output stream encoding DXL in binary format
+//---------------------------------------------------------------------------
+
+#include "naucrates/dxl/xml/CDXLBinaryOstream.h"
+
+#include "naucrates/dxl/xml/CDXLBinaryFormat.h"
+
+using namespace gpdxl;
+
+// size of the encoded records above which they are written out
+#define GPDXL_BINARY_FLUSH_SIZE (64 * 1024)
+
+// initial number of elements of a buffer
+#define GPDXL_BINARY_BUFFER_SIZE 256
+
+// is the given character whitespace
+static BOOL
+FSpace(WCHAR wc)
+{
+	return ' ' == wc || '\t' == wc || '\n' == wc || '\r' == wc;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLBinaryOstream::CDXLBinaryOstream
+//
+//	@doc:
+//		Ctor
+//
+//---------------------------------------------------------------------------
+CDXLBinaryOstream::CDXLBinaryOstream(CMemoryPool *mp, std::ostream &os)
+	: COstream(), m_mp(mp), m_os(os)
+{
+	m_names = GPOS_NEW(mp) StringToUlongMap(mp);
+	m_values = GPOS_NEW(mp) StringToUlongMap(mp);
+
+	m_os.write((const char *) CDXLBinaryFormat::Header(),
+			   CDXLBinaryFormat::HeaderLength);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLBinaryOstream::~CDXLBinaryOstream
+//
+//	@doc:
+//		Dtor
+//
+//---------------------------------------------------------------------------
+CDXLBinaryOstream::~CDXLBinaryOstream()
+{
+	Flush();
+	m_os.flush();
+
+	GPOS_DELETE_ARRAY(m_name.m_data);
+	GPOS_DELETE_ARRAY(m_value.m_data);
+	GPOS_DELETE_ARRAY(m_element.m_data);
+	GPOS_DELETE_ARRAY(m_attributes.m_data);
+	GPOS_DELETE_ARRAY(m_utf8.m_data);
+	GPOS_DELETE_ARRAY(m_output.m_data);
+	m_names->Release();
+	m_values->Release();
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLBinaryOstream::Reserve
+//
+//	@doc:
+//		Make room for the given number of elements in a buffer
+//
+//---------------------------------------------------------------------------
+template <class T>
+void
+CDXLBinaryOstream::Reserve(SBuffer<T> *buffer, ULONG size)
+{
+	if (size <= buffer->m_capacity)
+	{
+		return;
+	}
+
+	ULONG capacity = std::max((ULONG) GPDXL_BINARY_BUFFER_SIZE,
+							  2 * buffer->m_capacity);
+	capacity = std::max(capacity, size);
+
+	T *data = GPOS_NEW_ARRAY(m_mp, T, capacity);
+	if (0 < buffer->m_size)
+	{
+		clib::Memcpy(data, buffer->m_data, buffer->m_size * sizeof(T));
+	}
+	GPOS_DELETE_ARRAY(buffer->m_data);
+
+	buffer->m_data = data;
+	buffer->m_capacity = capacity;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLBinaryOstream::Append
+//
+//	@doc:
+//		Append an element to a buffer
+//
+//---------------------------------------------------------------------------
+template <class T>
+void
+CDXLBinaryOstream::Append(SBuffer<T> *buffer, T elem)
+{
+	Reserve(buffer, buffer->m_size + 1);
+	buffer->m_data[buffer->m_size++] = elem;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLBinaryOstream::Terminate
+//
+//	@doc:
+//		Terminate the string in a buffer without changing its size
+//
+//---------------------------------------------------------------------------
+void
+CDXLBinaryOstream::Terminate(SBuffer<WCHAR> *buffer)
+{
+	Reserve(buffer, buffer->m_size + 1);
+	buffer->m_data[buffer->m_size] = '\0';
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLBinaryOstream::AppendBytes
+//
+//	@doc:
+//		Append the contents of a byte buffer to another one
+//
+//---------------------------------------------------------------------------
+void
+CDXLBinaryOstream::AppendBytes(SBuffer<BYTE> *buffer,
+							   const SBuffer<BYTE> *bytes)
+{
+	if (0 == bytes->m_size)
+	{
+		return;
+	}
+
+	Reserve(buffer, buffer->m_size + bytes->m_size);
+	clib::Memcpy(buffer->m_data + buffer->m_size, bytes->m_data,
+				 bytes->m_size);
+	buffer->m_size += bytes->m_size;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLBinaryOstream::AppendVarint
+//
+//	@doc:
+//		Append an unsigned integer to a byte buffer, 7 bits per byte with
+//		the high bit set on all bytes but the last
+//
+//---------------------------------------------------------------------------
+void
+CDXLBinaryOstream::AppendVarint(SBuffer<BYTE> *buffer, ULLONG value)
+{
+	while (0x80 <= value)
+	{
+		Append(buffer, (BYTE)(0x80 | (value & 0x7f)));
+		value >>= 7;
+	}
+
+	Append(buffer, (BYTE) value);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLBinaryOstream::EncodeUTF8
+//
+//	@doc:
+//		Encode a string in UTF-8 into m_utf8
+//
+//---------------------------------------------------------------------------
+void
+CDXLBinaryOstream::EncodeUTF8(const SBuffer<WCHAR> *str)
+{
+	m_utf8.m_size = 0;
+	Reserve(&m_utf8, 4 * str->m_size);
+
+	for (ULONG ul = 0; ul < str->m_size; ul++)
+	{
+		ULONG code_point = (ULONG) str->m_data[ul];
+		BYTE *out = m_utf8.m_data + m_utf8.m_size;
+
+		if (0x80 > code_point)
+		{
+			out[0] = (BYTE) code_point;
+			m_utf8.m_size += 1;
+		}
+		else if (0x800 > code_point)
+		{
+			out[0] = (BYTE)(0xc0 | (code_point >> 6));
+			out[1] = (BYTE)(0x80 | (code_point & 0x3f));
+			m_utf8.m_size += 2;
+		}
+		else if (0x10000 > code_point)
+		{
+			out[0] = (BYTE)(0xe0 | (code_point >> 12));
+			out[1] = (BYTE)(0x80 | ((code_point >> 6) & 0x3f));
+			out[2] = (BYTE)(0x80 | (code_point & 0x3f));
+			m_utf8.m_size += 3;
+		}
+		else
+		{
+			out[0] = (BYTE)(0xf0 | ((code_point >> 18) & 0x07));
+			out[1] = (BYTE)(0x80 | ((code_point >> 12) & 0x3f));
+			out[2] = (BYTE)(0x80 | ((code_point >> 6) & 0x3f));
+			out[3] = (BYTE)(0x80 | (code_point & 0x3f));
+			m_utf8.m_size += 4;
+		}
+	}
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLBinaryOstream::AppendName
+//
+//	@doc:
+//		Append the name that was read to a byte buffer, as a reference if
+//		it was written before
+//
+//---------------------------------------------------------------------------
+void
+CDXLBinaryOstream::AppendName(SBuffer<BYTE> *buffer)
+{
+	Terminate(&m_name);
+	CWStringConst str(m_name.m_data);
+
+	const ULONG *id = m_names->Find(&str);
+	if (nullptr != id)
+	{
+		AppendVarint(buffer, *id);
+	}
+	else
+	{
+		// names are numbered from one, zero introduces a new name
+		m_names->Insert(GPOS_NEW(m_mp) CWStringConst(m_mp, m_name.m_data),
+						GPOS_NEW(m_mp) ULONG(m_names->Size() + 1));
+
+		EncodeUTF8(&m_name);
+		AppendVarint(buffer, 0);
+		AppendVarint(buffer, m_utf8.m_size);
+		AppendBytes(buffer, &m_utf8);
+	}
+
+	m_name.m_size = 0;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLBinaryOstream::FInteger
+//
+//	@doc:
+//		Is the value that was read the canonical decimal representation of
+//		an integer, so that it can be stored as one
+//
+//---------------------------------------------------------------------------
+BOOL
+CDXLBinaryOstream::FInteger(LINT *value) const
+{
+	const WCHAR *wsz = m_value.m_data;
+	ULONG length = m_value.m_size;
+	BOOL negative = (0 < length && '-' == wsz[0]);
+	if (negative)
+	{
+		wsz++;
+		length--;
+	}
+
+	if (0 == length || CDXLBinaryFormat::MaxIntegerDigits < length ||
+		('0' == wsz[0] && (1 < length || negative)))
+	{
+		return false;
+	}
+
+	LINT result = 0;
+	for (ULONG ul = 0; ul < length; ul++)
+	{
+		if ('0' > wsz[ul] || '9' < wsz[ul])
+		{
+			return false;
+		}
+		result = 10 * result + (wsz[ul] - '0');
+	}
+
+	*value = negative ? -result : result;
+
+	return true;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLBinaryOstream::AppendValue
+//
+//	@doc:
+//		Append the value that was read to a byte buffer, as an integer, as a
+//		reference to the dictionary or as a literal
+//
+//---------------------------------------------------------------------------
+void
+CDXLBinaryOstream::AppendValue(SBuffer<BYTE> *buffer)
+{
+	const ULONG kind_bits = CDXLBinaryFormat::ValueKindBits;
+
+	LINT integer = 0;
+	if (FInteger(&integer))
+	{
+		// zigzag encoding keeps small negative numbers short
+		ULLONG zigzag = (0 > integer) ? (((ULLONG)(-(integer + 1))) << 1) | 1
+									  : ((ULLONG) integer) << 1;
+		AppendVarint(buffer,
+					 (zigzag << kind_bits) | CDXLBinaryFormat::EvalInteger);
+		m_value.m_size = 0;
+		return;
+	}
+
+	// a character takes at least one byte, so longer values cannot be in
+	// the dictionary
+	BOOL fDictionary =
+		m_value.m_size <= CDXLBinaryFormat::MaxDictionaryValueLength;
+	Terminate(&m_value);
+	CWStringConst str(m_value.m_data);
+
+	const ULONG *id = fDictionary ? m_values->Find(&str) : nullptr;
+	if (nullptr != id)
+	{
+		AppendVarint(buffer, (((ULLONG) *id) << kind_bits) |
+								 CDXLBinaryFormat::EvalReference);
+		m_value.m_size = 0;
+		return;
+	}
+
+	EncodeUTF8(&m_value);
+	AppendVarint(buffer, (((ULLONG) m_utf8.m_size) << kind_bits) |
+							 CDXLBinaryFormat::EvalLiteral);
+	AppendBytes(buffer, &m_utf8);
+
+	if (m_utf8.m_size <= CDXLBinaryFormat::MaxDictionaryValueLength &&
+		m_values->Size() < CDXLBinaryFormat::MaxDictionaryValues)
+	{
+		m_values->Insert(GPOS_NEW(m_mp) CWStringConst(m_mp, m_value.m_data),
+						 GPOS_NEW(m_mp) ULONG(m_values->Size()));
+	}
+
+	m_value.m_size = 0;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLBinaryOstream::ResolveEntity
+//
+//	@doc:
+//		Append the character denoted by the entity or character reference
+//		that was read to the value; unknown entities are kept as they are
+//
+//---------------------------------------------------------------------------
+void
+CDXLBinaryOstream::ResolveEntity()
+{
+	static const struct
+	{
+		const WCHAR *m_wszName;
+		WCHAR m_wc;
+	} rgentity[] = {
+		{GPOS_WSZ_LIT("quot"), '"'}, {GPOS_WSZ_LIT("apos"), '\''},
+		{GPOS_WSZ_LIT("lt"), '<'},	 {GPOS_WSZ_LIT("gt"), '>'},
+		{GPOS_WSZ_LIT("amp"), '&'},
+	};
+
+	m_entity[m_entity_length] = '\0';
+
+	if (1 < m_entity_length && '#' == m_entity[0])
+	{
+		BOOL hex = ('x' == m_entity[1]);
+		ULONG code_point = 0;
+		BOOL valid = !hex || 2 < m_entity_length;
+		for (ULONG ul = hex ? 2 : 1; valid && ul < m_entity_length; ul++)
+		{
+			WCHAR wc = m_entity[ul];
+			if ('0' <= wc && '9' >= wc)
+			{
+				code_point = (hex ? 16 : 10) * code_point + (wc - '0');
+			}
+			else if (hex && 'a' <= (wc | 0x20) && 'f' >= (wc | 0x20))
+			{
+				code_point = 16 * code_point + ((wc | 0x20) - 'a' + 10);
+			}
+			else
+			{
+				valid = false;
+			}
+		}
+
+		if (valid)
+		{
+			Append(&m_value, (WCHAR) code_point);
+			return;
+		}
+	}
+
+	for (ULONG ul = 0; ul < GPOS_ARRAY_SIZE(rgentity); ul++)
+	{
+		if (0 == clib::Wcsncmp(m_entity, rgentity[ul].m_wszName,
+							   MaxEntityLength))
+		{
+			Append(&m_value, rgentity[ul].m_wc);
+			return;
+		}
+	}
+
+	Append(&m_value, (WCHAR) '&');
+	for (ULONG ul = 0; ul < m_entity_length; ul++)
+	{
+		Append(&m_value, m_entity[ul]);
+	}
+	Append(&m_value, (WCHAR) ';');
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLBinaryOstream::Process
+//
+//	@doc:
+//		Process a character of the document
+//
+//---------------------------------------------------------------------------
+void
+CDXLBinaryOstream::Process(WCHAR wc)
+{
+	switch (m_state)
+	{
+		case EstText:
+			// character data goes on across CDATA sections and comments, so
+			// it is written once the next tag is known
+			if ('<' == wc)
+			{
+				m_state = EstTagStart;
+			}
+			else if ('&' == wc)
+			{
+				m_has_text = true;
+				m_entity_length = 0;
+				m_state_entity_return = EstText;
+				m_state = EstEntity;
+			}
+			else
+			{
+				m_has_text = m_has_text || !FSpace(wc);
+				Append(&m_value, wc);
+			}
+			break;
+
+		case EstTagStart:
+			if ('/' == wc)
+			{
+				WriteText();
+				m_state = EstCloseTag;
+			}
+			else if ('!' == wc)
+			{
+				m_markup_length = 0;
+				m_state = EstMarkup;
+			}
+			else if ('?' == wc)
+			{
+				WriteText();
+				m_state = EstSkip;
+			}
+			else
+			{
+				WriteText();
+				Append(&m_name, wc);
+				m_state = EstElemName;
+			}
+			break;
+
+		case EstElemName:
+			if (FSpace(wc) || '/' == wc || '>' == wc)
+			{
+				m_element.m_size = 0;
+				m_attributes.m_size = 0;
+				m_num_attributes = 0;
+				AppendName(&m_element);
+
+				m_state = EstInTag;
+				Process(wc);
+			}
+			else
+			{
+				Append(&m_name, wc);
+			}
+			break;
+
+		case EstInTag:
+			if ('/' == wc)
+			{
+				m_state = EstEmptyTag;
+			}
+			else if ('>' == wc)
+			{
+				WriteOpen();
+				m_state = EstText;
+			}
+			else if (!FSpace(wc))
+			{
+				Append(&m_name, wc);
+				m_state = EstAttrName;
+			}
+			break;
+
+		case EstAttrName:
+			if ('=' == wc || FSpace(wc))
+			{
+				AppendName(&m_attributes);
+				m_num_attributes++;
+				m_state = EstAttrEq;
+			}
+			else
+			{
+				Append(&m_name, wc);
+			}
+			break;
+
+		case EstAttrEq:
+			if ('"' == wc || '\'' == wc)
+			{
+				m_quote = wc;
+				m_state = EstAttrValue;
+			}
+			break;
+
+		case EstAttrValue:
+			if (m_quote == wc)
+			{
+				AppendValue(&m_attributes);
+				m_state = EstInTag;
+			}
+			else if ('&' == wc)
+			{
+				m_entity_length = 0;
+				m_state_entity_return = EstAttrValue;
+				m_state = EstEntity;
+			}
+			else
+			{
+				Append(&m_value, wc);
+			}
+			break;
+
+		case EstEmptyTag:
+			if ('>' == wc)
+			{
+				WriteOpen();
+				WriteClose();
+				m_state = EstText;
+			}
+			break;
+
+		case EstCloseTag:
+			if ('>' == wc)
+			{
+				WriteClose();
+				m_state = EstText;
+			}
+			break;
+
+		case EstMarkup:
+		{
+			const WCHAR *wszCData = GPOS_WSZ_LIT("[CDATA[");
+			if (wszCData[m_markup_length] == wc)
+			{
+				if ('\0' == wszCData[++m_markup_length])
+				{
+					m_markup_length = 0;
+					m_state = EstCData;
+				}
+			}
+			else if (0 == m_markup_length && '-' == wc)
+			{
+				m_state = EstComment;
+			}
+			else
+			{
+				WriteText();
+				m_state = EstSkip;
+				Process(wc);
+			}
+			break;
+		}
+
+		case EstCData:
+			// hold back brackets until it is known whether they end the
+			// section
+			if (']' == wc)
+			{
+				m_markup_length++;
+			}
+			else if ('>' == wc && 2 <= m_markup_length)
+			{
+				for (ULONG ul = 2; ul < m_markup_length; ul++)
+				{
+					Append(&m_value, (WCHAR) ']');
+				}
+				m_has_text = true;
+				m_markup_length = 0;
+				m_state = EstText;
+			}
+			else
+			{
+				for (ULONG ul = 0; ul < m_markup_length; ul++)
+				{
+					Append(&m_value, (WCHAR) ']');
+				}
+				m_has_text = m_has_text || 0 < m_markup_length || !FSpace(wc);
+				m_markup_length = 0;
+				Append(&m_value, wc);
+			}
+			break;
+
+		case EstComment:
+			if ('>' == wc && 2 <= m_markup_length)
+			{
+				m_state = EstText;
+			}
+			m_markup_length = ('-' == wc) ? m_markup_length + 1 : 0;
+			break;
+
+		case EstSkip:
+			if ('>' == wc)
+			{
+				m_state = EstText;
+			}
+			break;
+
+		case EstEntity:
+			if (';' == wc)
+			{
+				ResolveEntity();
+				m_state = m_state_entity_return;
+			}
+			else if (m_entity_length < MaxEntityLength - 1)
+			{
+				m_entity[m_entity_length++] = wc;
+			}
+			break;
+
+		default:
+			GPOS_ASSERT(!"Unexpected tokenizer state");
+	}
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLBinaryOstream::WriteOpen
+//
+//	@doc:
+//		Write an open record for the element that was read
+//
+//---------------------------------------------------------------------------
+void
+CDXLBinaryOstream::WriteOpen()
+{
+	Append(&m_output, (BYTE) CDXLBinaryFormat::ErecOpen);
+	AppendBytes(&m_output, &m_element);
+	AppendVarint(&m_output, m_num_attributes);
+	AppendBytes(&m_output, &m_attributes);
+
+	if (GPDXL_BINARY_FLUSH_SIZE <= m_output.m_size)
+	{
+		Flush();
+	}
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLBinaryOstream::WriteClose
+//
+//	@doc:
+//		Write a close record
+//
+//---------------------------------------------------------------------------
+void
+CDXLBinaryOstream::WriteClose()
+{
+	Append(&m_output, (BYTE) CDXLBinaryFormat::ErecClose);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLBinaryOstream::WriteText
+//
+//	@doc:
+//		Write a text record for the character data read so far; whitespace
+//		between elements is dropped
+//
+//---------------------------------------------------------------------------
+void
+CDXLBinaryOstream::WriteText()
+{
+	if (m_has_text)
+	{
+		Append(&m_output, (BYTE) CDXLBinaryFormat::ErecText);
+		AppendValue(&m_output);
+		m_has_text = false;
+	}
+
+	m_value.m_size = 0;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLBinaryOstream::Flush
+//
+//	@doc:
+//		Write the encoded records to the underlying stream
+//
+//---------------------------------------------------------------------------
+void
+CDXLBinaryOstream::Flush()
+{
+	if (0 < m_output.m_size)
+	{
+		m_os.write((const char *) m_output.m_data, m_output.m_size);
+		m_output.m_size = 0;
+	}
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLBinaryOstream::operator<<
+//
+//	@doc:
+//		Write a wide character array
+//
+//---------------------------------------------------------------------------
+IOstream &
+CDXLBinaryOstream::operator<<(const WCHAR *wc_array)
+{
+	for (const WCHAR *wc = wc_array; '\0' != *wc; wc++)
+	{
+		Process(*wc);
+	}
+
+	return *this;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLBinaryOstream::operator<<
+//
+//	@doc:
+//		Write a character array; arrays that are not plain ASCII are
+//		converted to wide characters first
+//
+//---------------------------------------------------------------------------
+IOstream &
+CDXLBinaryOstream::operator<<(const CHAR *c_array)
+{
+	for (const CHAR *c = c_array; '\0' != *c; c++)
+	{
+		if (0 != (0x80 & (BYTE) *c))
+		{
+			return COstream::operator<<(c_array);
+		}
+	}
+
+	for (const CHAR *c = c_array; '\0' != *c; c++)
+	{
+		Process((WCHAR) *c);
+	}
+
+	return *this;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLBinaryOstream::operator<<
+//
+//	@doc:
+//		Write a wide character
+//
+//---------------------------------------------------------------------------
+IOstream &
+CDXLBinaryOstream::operator<<(const WCHAR wc)
+{
+	Process(wc);
+
+	return *this;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLBinaryOstream::operator<<
+//
+//	@doc:
+//		Write a character
+//
+//---------------------------------------------------------------------------
+IOstream &
+CDXLBinaryOstream::operator<<(const CHAR c)
+{
+	if (0 != (0x80 & (BYTE) c))
+	{
+		return COstream::operator<<(c);
+	}
+
+	Process((WCHAR) c);
+
+	return *this;
+}
+
+// EOF
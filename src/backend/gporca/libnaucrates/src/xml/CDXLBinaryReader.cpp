@@ -0,0 +1,776 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (c) 2023 VMware, Inc. or its affiliates. All Rights Reserved.
+//
+//	@filename:
+//		CDXLBinaryReader.cpp
+//
+//	@doc:
+//		Implementation of the reader of DXL documents in binary format
+//---------------------------------------------------------------------------
+
+#include "naucrates/dxl/xml/CDXLBinaryReader.h"
+
+#include <xercesc/util/XMLString.hpp>
+
+#include "naucrates/dxl/xml/CDXLBinaryFormat.h"
+#include "naucrates/exception.h"
+
+using namespace gpdxl;
+
+XERCES_CPP_NAMESPACE_USE
+
+// initial number of characters of the scratch buffer
+#define GPDXL_BINARY_SCRATCH_SIZE 1024
+
+// number of characters needed to print an integer value
+#define GPDXL_BINARY_INTEGER_SIZE 24
+
+// empty namespace URI
+static const XMLCh xmlszEmpty[] = {0};
+
+// type of all attributes
+static const XMLCh xmlszCDATA[] = {'C', 'D', 'A', 'T', 'A', 0};
+
+// prefix of namespace declarations
+static const XMLCh xmlszXmlns[] = {'x', 'm', 'l', 'n', 's', 0};
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLBinaryReader::CDXLBinaryReader
+//
+//	@doc:
+//		Ctor
+//
+//---------------------------------------------------------------------------
+CDXLBinaryReader::CDXLBinaryReader(CMemoryPool *mp, const BYTE *data,
+								   ULONG size)
+	: m_mp(mp),
+	  m_data(data),
+	  m_size(size),
+	  m_offset(0),
+	  m_attributes(nullptr),
+	  m_attributes_capacity(0),
+	  m_scratch(nullptr),
+	  m_scratch_size(0),
+	  m_scratch_capacity(0)
+{
+	GPOS_ASSERT(nullptr != data);
+
+	m_names = GPOS_NEW(mp) SNameArray(mp);
+	m_values = GPOS_NEW(mp) XMLChArray(mp);
+	m_open_elements = GPOS_NEW(mp) SNameStack(mp);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLBinaryReader::~CDXLBinaryReader
+//
+//	@doc:
+//		Dtor
+//
+//---------------------------------------------------------------------------
+CDXLBinaryReader::~CDXLBinaryReader()
+{
+	m_names->Release();
+	m_values->Release();
+	GPOS_DELETE(m_open_elements);
+	GPOS_DELETE_ARRAY(m_attributes);
+	GPOS_DELETE_ARRAY(m_scratch);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLBinaryReader::RaiseMalformed
+//
+//	@doc:
+//		Raise an exception for malformed input
+//
+//---------------------------------------------------------------------------
+void
+CDXLBinaryReader::RaiseMalformed() const
+{
+	GPOS_RAISE(gpdxl::ExmaDXL, gpdxl::ExmiDXLBinaryParseError, m_offset);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLBinaryReader::ReadByte
+//
+//	@doc:
+//		Read a byte
+//
+//---------------------------------------------------------------------------
+BYTE
+CDXLBinaryReader::ReadByte()
+{
+	if (m_offset >= m_size)
+	{
+		RaiseMalformed();
+	}
+
+	return m_data[m_offset++];
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLBinaryReader::ReadVarint
+//
+//	@doc:
+//		Read an unsigned integer of 7 bits per byte
+//
+//---------------------------------------------------------------------------
+ULLONG
+CDXLBinaryReader::ReadVarint()
+{
+	ULLONG value = 0;
+	for (ULONG shift = 0; shift < 64; shift += 7)
+	{
+		BYTE byte = ReadByte();
+		value |= ((ULLONG)(byte & 0x7f)) << shift;
+		if (0 == (byte & 0x80))
+		{
+			return value;
+		}
+	}
+
+	RaiseMalformed();
+	return 0;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLBinaryReader::DecodeUTF8
+//
+//	@doc:
+//		Decode UTF-8 into terminated UTF-16 and return the number of
+//		characters; bytes that do not start a valid sequence are taken as
+//		Latin-1 characters
+//
+//---------------------------------------------------------------------------
+ULONG
+CDXLBinaryReader::DecodeUTF8(const BYTE *data, ULONG length, XMLCh *out)
+{
+	ULONG size = 0;
+	ULONG ul = 0;
+	while (ul < length)
+	{
+		BYTE lead = data[ul];
+		ULONG num_bytes = 1;
+		ULONG code_point = lead;
+
+		if (0xc0 == (lead & 0xe0))
+		{
+			num_bytes = 2;
+			code_point = lead & 0x1f;
+		}
+		else if (0xe0 == (lead & 0xf0))
+		{
+			num_bytes = 3;
+			code_point = lead & 0x0f;
+		}
+		else if (0xf0 == (lead & 0xf8))
+		{
+			num_bytes = 4;
+			code_point = lead & 0x07;
+		}
+
+		BOOL valid = (ul + num_bytes <= length);
+		for (ULONG ulByte = 1; valid && ulByte < num_bytes; ulByte++)
+		{
+			BYTE byte = data[ul + ulByte];
+			valid = (0x80 == (byte & 0xc0));
+			code_point = (code_point << 6) | (byte & 0x3f);
+		}
+
+		if (!valid)
+		{
+			num_bytes = 1;
+			code_point = lead;
+		}
+
+		if (0x10000 <= code_point)
+		{
+			// surrogate pair; a sequence of four bytes always has room
+			code_point -= 0x10000;
+			out[size++] = (XMLCh)(0xd800 | (code_point >> 10));
+			out[size++] = (XMLCh)(0xdc00 | (code_point & 0x3ff));
+		}
+		else
+		{
+			out[size++] = (XMLCh) code_point;
+		}
+
+		ul += num_bytes;
+	}
+
+	out[size] = 0;
+
+	return size;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLBinaryReader::ReadString
+//
+//	@doc:
+//		Read a string of the given length in bytes into new characters
+//
+//---------------------------------------------------------------------------
+XMLCh *
+CDXLBinaryReader::ReadString(ULONG length)
+{
+	if (length > m_size - m_offset)
+	{
+		RaiseMalformed();
+	}
+
+	XMLCh *str = GPOS_NEW_ARRAY(m_mp, XMLCh, length + 1);
+	DecodeUTF8(m_data + m_offset, length, str);
+	m_offset += length;
+
+	return str;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLBinaryReader::ReadName
+//
+//	@doc:
+//		Read a name, defining it if it is new
+//
+//---------------------------------------------------------------------------
+const CDXLBinaryReader::SName *
+CDXLBinaryReader::ReadName()
+{
+	ULLONG id = ReadVarint();
+	if (0 < id)
+	{
+		if (id > m_names->Size())
+		{
+			RaiseMalformed();
+		}
+
+		return (*m_names)[id - 1];
+	}
+
+	XMLCh *qname = ReadString(ReadVarint());
+
+	const XMLCh *local_name = qname;
+	for (const XMLCh *xmlsz = qname; 0 != *xmlsz; xmlsz++)
+	{
+		if (':' == *xmlsz)
+		{
+			local_name = xmlsz + 1;
+		}
+	}
+
+	// "xmlns" and "xmlns:prefix" declare namespaces
+	ULONG prefix_length = local_name - qname;
+	BOOL is_namespace_decl =
+		XMLString::equals(qname, xmlszXmlns) ||
+		(6 == prefix_length && XMLString::startsWith(qname, xmlszXmlns));
+
+	SName *name = GPOS_NEW(m_mp) SName(qname, local_name, is_namespace_decl);
+	m_names->Append(name);
+
+	return name;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLBinaryReader::ReserveScratch
+//
+//	@doc:
+//		Make room for the given number of characters in the scratch buffer
+//
+//---------------------------------------------------------------------------
+void
+CDXLBinaryReader::ReserveScratch(ULONG size)
+{
+	if (size <= m_scratch_capacity)
+	{
+		return;
+	}
+
+	ULONG capacity = std::max((ULONG) GPDXL_BINARY_SCRATCH_SIZE,
+							  2 * m_scratch_capacity);
+	capacity = std::max(capacity, size);
+
+	XMLCh *scratch = GPOS_NEW_ARRAY(m_mp, XMLCh, capacity);
+	if (0 < m_scratch_size)
+	{
+		clib::Memcpy(scratch, m_scratch, m_scratch_size * sizeof(XMLCh));
+	}
+	GPOS_DELETE_ARRAY(m_scratch);
+
+	m_scratch = scratch;
+	m_scratch_capacity = capacity;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLBinaryReader::ReserveAttributes
+//
+//	@doc:
+//		Make room for the given number of attributes
+//
+//---------------------------------------------------------------------------
+void
+CDXLBinaryReader::ReserveAttributes(ULONG size)
+{
+	if (size <= m_attributes_capacity)
+	{
+		return;
+	}
+
+	ULONG capacity = std::max(size, 2 * m_attributes_capacity);
+
+	GPOS_DELETE_ARRAY(m_attributes);
+	m_attributes = GPOS_NEW_ARRAY(m_mp, SAttribute, capacity);
+	m_attributes_capacity = capacity;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLBinaryReader::ReadValue
+//
+//	@doc:
+//		Read a value. Values from the dictionary, and new ones that go into
+//		it, are returned; other values are stored in the scratch buffer at
+//		the returned offset.
+//
+//---------------------------------------------------------------------------
+const XMLCh *
+CDXLBinaryReader::ReadValue(ULONG *offset)
+{
+	ULLONG header = ReadVarint();
+	ULLONG payload = header >> CDXLBinaryFormat::ValueKindBits;
+
+	switch (header & ((1 << CDXLBinaryFormat::ValueKindBits) - 1))
+	{
+		case CDXLBinaryFormat::EvalLiteral:
+		{
+			if (payload > m_size - m_offset)
+			{
+				RaiseMalformed();
+			}
+
+			ULONG length = (ULONG) payload;
+			if (length <= CDXLBinaryFormat::MaxDictionaryValueLength &&
+				m_values->Size() < CDXLBinaryFormat::MaxDictionaryValues)
+			{
+				XMLCh *value = ReadString(length);
+				m_values->Append(value);
+
+				return value;
+			}
+
+			ReserveScratch(m_scratch_size + length + 1);
+			*offset = m_scratch_size;
+			m_scratch_size += 1 + DecodeUTF8(m_data + m_offset, length,
+											 m_scratch + m_scratch_size);
+			m_offset += length;
+
+			return nullptr;
+		}
+
+		case CDXLBinaryFormat::EvalInteger:
+		{
+			// undo the zigzag encoding and print the digits backwards
+			BOOL negative = (1 == (payload & 1));
+			ULLONG magnitude = (payload >> 1) + (negative ? 1 : 0);
+
+			XMLCh digits[GPDXL_BINARY_INTEGER_SIZE];
+			ULONG num_digits = 0;
+			do
+			{
+				digits[num_digits++] = (XMLCh)('0' + magnitude % 10);
+				magnitude /= 10;
+			} while (0 < magnitude);
+
+			ReserveScratch(m_scratch_size + num_digits + 2);
+			*offset = m_scratch_size;
+			if (negative)
+			{
+				m_scratch[m_scratch_size++] = '-';
+			}
+			while (0 < num_digits)
+			{
+				m_scratch[m_scratch_size++] = digits[--num_digits];
+			}
+			m_scratch[m_scratch_size++] = 0;
+
+			return nullptr;
+		}
+
+		case CDXLBinaryFormat::EvalReference:
+			if (payload >= m_values->Size())
+			{
+				RaiseMalformed();
+			}
+
+			return (*m_values)[(ULONG) payload];
+
+		default:
+			RaiseMalformed();
+	}
+
+	return nullptr;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLBinaryReader::Parse
+//
+//	@doc:
+//		Pass the elements of the document to the content handler that is
+//		active on the given SAX reader. The parse handlers change the
+//		active handler as they go, so it is looked up for every record.
+//
+//---------------------------------------------------------------------------
+void
+CDXLBinaryReader::Parse(SAX2XMLReader *sax_2_xml_reader)
+{
+	GPOS_ASSERT(nullptr != sax_2_xml_reader);
+
+	if (!CDXLBinaryFormat::HasHeader(m_data, m_size))
+	{
+		RaiseMalformed();
+	}
+	m_offset = CDXLBinaryFormat::HeaderLength;
+
+	CAttributes attributes;
+	BOOL has_root = false;
+
+	while (m_offset < m_size)
+	{
+		BYTE record = ReadByte();
+		switch (record)
+		{
+			case CDXLBinaryFormat::ErecOpen:
+			{
+				const SName *name = ReadName();
+
+				// an attribute takes at least two bytes
+				ULLONG num_attributes = ReadVarint();
+				if (num_attributes > (m_size - m_offset) / 2)
+				{
+					RaiseMalformed();
+				}
+				ReserveAttributes((ULONG) num_attributes);
+
+				m_scratch_size = 0;
+				ULONG size = 0;
+				for (ULONG ul = 0; ul < num_attributes; ul++)
+				{
+					const SName *attr_name = ReadName();
+					ULONG offset = 0;
+					const XMLCh *value = ReadValue(&offset);
+					if (!attr_name->m_is_namespace_decl)
+					{
+						m_attributes[size].m_name = attr_name;
+						m_attributes[size].m_value = value;
+						m_attributes[size].m_offset = offset;
+						size++;
+					}
+				}
+
+				// the scratch buffer does not move any more
+				for (ULONG ul = 0; ul < size; ul++)
+				{
+					if (nullptr == m_attributes[ul].m_value)
+					{
+						m_attributes[ul].m_value =
+							m_scratch + m_attributes[ul].m_offset;
+					}
+				}
+				attributes.Set(m_attributes, size);
+
+				m_open_elements->Push(name);
+				has_root = true;
+				ContentHandler *handler = sax_2_xml_reader->getContentHandler();
+				if (nullptr != handler)
+				{
+					handler->startElement(xmlszEmpty, name->m_local_name,
+										  name->m_qname, attributes);
+				}
+				break;
+			}
+
+			case CDXLBinaryFormat::ErecClose:
+			{
+				if (m_open_elements->IsEmpty())
+				{
+					RaiseMalformed();
+				}
+
+				const SName *name = m_open_elements->Pop();
+				ContentHandler *handler = sax_2_xml_reader->getContentHandler();
+				if (nullptr != handler)
+				{
+					handler->endElement(xmlszEmpty, name->m_local_name,
+										name->m_qname);
+				}
+				break;
+			}
+
+			case CDXLBinaryFormat::ErecText:
+			{
+				m_scratch_size = 0;
+				ULONG offset = 0;
+				const XMLCh *text = ReadValue(&offset);
+				if (nullptr == text)
+				{
+					text = m_scratch + offset;
+				}
+
+				ContentHandler *handler = sax_2_xml_reader->getContentHandler();
+				if (nullptr != handler)
+				{
+					handler->characters(text, XMLString::stringLen(text));
+				}
+				break;
+			}
+
+			default:
+				RaiseMalformed();
+		}
+	}
+
+	// a document truncated after the header has no elements
+	if (!has_root || !m_open_elements->IsEmpty())
+	{
+		RaiseMalformed();
+	}
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLBinaryReader::CAttributes::getLength
+//
+//	@doc:
+//		Number of attributes
+//
+//---------------------------------------------------------------------------
+XMLSize_t
+CDXLBinaryReader::CAttributes::getLength() const
+{
+	return m_size;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLBinaryReader::CAttributes::getURI
+//
+//	@doc:
+//		Namespace URI of an attribute
+//
+//---------------------------------------------------------------------------
+const XMLCh *
+CDXLBinaryReader::CAttributes::getURI(const XMLSize_t index) const
+{
+	return index < m_size ? xmlszEmpty : nullptr;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLBinaryReader::CAttributes::getLocalName
+//
+//	@doc:
+//		Local name of an attribute
+//
+//---------------------------------------------------------------------------
+const XMLCh *
+CDXLBinaryReader::CAttributes::getLocalName(const XMLSize_t index) const
+{
+	return index < m_size ? m_attributes[index].m_name->m_local_name
+						  : nullptr;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLBinaryReader::CAttributes::getQName
+//
+//	@doc:
+//		Qualified name of an attribute
+//
+//---------------------------------------------------------------------------
+const XMLCh *
+CDXLBinaryReader::CAttributes::getQName(const XMLSize_t index) const
+{
+	return index < m_size ? m_attributes[index].m_name->m_qname : nullptr;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLBinaryReader::CAttributes::getType
+//
+//	@doc:
+//		Type of an attribute; DXL has no DTD, so all attributes are CDATA
+//
+//---------------------------------------------------------------------------
+const XMLCh *
+CDXLBinaryReader::CAttributes::getType(const XMLSize_t index) const
+{
+	return index < m_size ? xmlszCDATA : nullptr;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLBinaryReader::CAttributes::getValue
+//
+//	@doc:
+//		Value of an attribute
+//
+//---------------------------------------------------------------------------
+const XMLCh *
+CDXLBinaryReader::CAttributes::getValue(const XMLSize_t index) const
+{
+	return index < m_size ? m_attributes[index].m_value : nullptr;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLBinaryReader::CAttributes::getIndex
+//
+//	@doc:
+//		Index of an attribute given its local name; namespace URIs are
+//		ignored
+//
+//---------------------------------------------------------------------------
+bool
+CDXLBinaryReader::CAttributes::getIndex(const XMLCh *const,	 // uri
+										const XMLCh *const local_part,
+										XMLSize_t &index) const
+{
+	for (ULONG ul = 0; ul < m_size; ul++)
+	{
+		if (XMLString::equals(local_part,
+							  m_attributes[ul].m_name->m_local_name))
+		{
+			index = ul;
+			return true;
+		}
+	}
+
+	return false;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLBinaryReader::CAttributes::getIndex
+//
+//	@doc:
+//		Index of an attribute given its local name, -1 if there is none
+//
+//---------------------------------------------------------------------------
+int
+CDXLBinaryReader::CAttributes::getIndex(const XMLCh *const uri,
+										const XMLCh *const local_part) const
+{
+	XMLSize_t index = 0;
+	return getIndex(uri, local_part, index) ? (int) index : -1;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLBinaryReader::CAttributes::getIndex
+//
+//	@doc:
+//		Index of an attribute given its qualified name
+//
+//---------------------------------------------------------------------------
+bool
+CDXLBinaryReader::CAttributes::getIndex(const XMLCh *const qname,
+										XMLSize_t &index) const
+{
+	for (ULONG ul = 0; ul < m_size; ul++)
+	{
+		if (XMLString::equals(qname, m_attributes[ul].m_name->m_qname))
+		{
+			index = ul;
+			return true;
+		}
+	}
+
+	return false;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLBinaryReader::CAttributes::getIndex
+//
+//	@doc:
+//		Index of an attribute given its qualified name, -1 if there is none
+//
+//---------------------------------------------------------------------------
+int
+CDXLBinaryReader::CAttributes::getIndex(const XMLCh *const qname) const
+{
+	XMLSize_t index = 0;
+	return getIndex(qname, index) ? (int) index : -1;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLBinaryReader::CAttributes::getType
+//
+//	@doc:
+//		Type of an attribute given its local name
+//
+//---------------------------------------------------------------------------
+const XMLCh *
+CDXLBinaryReader::CAttributes::getType(const XMLCh *const uri,
+									   const XMLCh *const local_part) const
+{
+	return 0 <= getIndex(uri, local_part) ? xmlszCDATA : nullptr;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLBinaryReader::CAttributes::getType
+//
+//	@doc:
+//		Type of an attribute given its qualified name
+//
+//---------------------------------------------------------------------------
+const XMLCh *
+CDXLBinaryReader::CAttributes::getType(const XMLCh *const qname) const
+{
+	return 0 <= getIndex(qname) ? xmlszCDATA : nullptr;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLBinaryReader::CAttributes::getValue
+//
+//	@doc:
+//		Value of an attribute given its local name
+//
+//---------------------------------------------------------------------------
+const XMLCh *
+CDXLBinaryReader::CAttributes::getValue(const XMLCh *const uri,
+										const XMLCh *const local_part) const
+{
+	XMLSize_t index = 0;
+	return getIndex(uri, local_part, index) ? m_attributes[index].m_value
+											: nullptr;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLBinaryReader::CAttributes::getValue
+//
+//	@doc:
+//		Value of an attribute given its qualified name
+//
+//---------------------------------------------------------------------------
+const XMLCh *
+CDXLBinaryReader::CAttributes::getValue(const XMLCh *const qname) const
+{
+	XMLSize_t index = 0;
+	return getIndex(qname, index) ? m_attributes[index].m_value : nullptr;
+}
+
+// EOF
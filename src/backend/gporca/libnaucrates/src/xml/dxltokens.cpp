@@ -93,6 +93,7 @@ CDXLTokens::Init(CMemoryPool *mp)
 		 GPOS_WSZ_LIT("PushGroupByBelowSetopThreshold")},
 		{EdxltokenXformBindThreshold, GPOS_WSZ_LIT("XformBindThreshold")},
 		{EdxltokenSkewFactor, GPOS_WSZ_LIT("SkewFactor")},
+		{EdxltokenTimeBudget, GPOS_WSZ_LIT("TimeBudget")},
 		{EdxltokenWindowOids, GPOS_WSZ_LIT("WindowOids")},
 		{EdxltokenOidRowNumber, GPOS_WSZ_LIT("RowNumber")},
 		{EdxltokenOidRank, GPOS_WSZ_LIT("Rank")},
@@ -136,6 +137,7 @@ CDXLTokens::Init(CMemoryPool *mp)
 		{EdxltokenPhysicalValuesScan, GPOS_WSZ_LIT("Values")},
 		{EdxltokenPhysicalAppend, GPOS_WSZ_LIT("Append")},
 		{EdxltokenPhysicalMaterialize, GPOS_WSZ_LIT("Materialize")},
+		{EdxltokenPhysicalMemoize, GPOS_WSZ_LIT("Memoize")},
 		{EdxltokenPhysicalDynamicForeignScan,
 		 GPOS_WSZ_LIT("DynamicForeignScan")},
 		{EdxltokenPhysicalSequence, GPOS_WSZ_LIT("Sequence")},
@@ -170,6 +172,8 @@ CDXLTokens::Init(CMemoryPool *mp)
 		{EdxltokenOnCommitDrop, GPOS_WSZ_LIT("Drop")},
 
 		{EdxltokenDuplicateSensitive, GPOS_WSZ_LIT("DuplicateSensitive")},
+		{EdxltokenSkewBroadcast, GPOS_WSZ_LIT("SkewBroadcast")},
+		{EdxltokenParallelWorkers, GPOS_WSZ_LIT("ParallelWorkers")},
 
 		{EdxltokenSegmentIdCol, GPOS_WSZ_LIT("SegmentIdCol")},
 
@@ -300,6 +304,7 @@ CDXLTokens::Init(CMemoryPool *mp)
 		 GPOS_WSZ_LIT("LeftAntiSemiJoinNotIn")},
 
 		{EdxltokenMergeJoinUniqueOuter, GPOS_WSZ_LIT("UniqueOuter")},
+		{EdxltokenHashJoinRuntimeFilter, GPOS_WSZ_LIT("RuntimeFilter")},
 
 		{EdxltokenWindowLeadingBoundary, GPOS_WSZ_LIT("LeadingBoundary")},
 		{EdxltokenWindowTrailingBoundary, GPOS_WSZ_LIT("TrailingBoundary")},
@@ -387,6 +392,8 @@ CDXLTokens::Init(CMemoryPool *mp)
 		{EdxltokenTotalCost, GPOS_WSZ_LIT("TotalCost")},
 		{EdxltokenRows, GPOS_WSZ_LIT("Rows")},
 		{EdxltokenWidth, GPOS_WSZ_LIT("Width")},
+		{EdxltokenCardinalityFingerprint,
+		 GPOS_WSZ_LIT("CardinalityFingerprint")},
 		{EdxltokenRelPages, GPOS_WSZ_LIT("RelPages")},
 		{EdxltokenRelAllVisible, GPOS_WSZ_LIT("RelAllVisible")},
 		{EdxltokenTableName, GPOS_WSZ_LIT("TableName")},
@@ -411,6 +418,7 @@ CDXLTokens::Init(CMemoryPool *mp)
 		{EdxltokenColNdvRemain, GPOS_WSZ_LIT("NdvRemain")},
 		{EdxltokenColFreqRemain, GPOS_WSZ_LIT("FreqRemain")},
 		{EdxltokenColStatsMissing, GPOS_WSZ_LIT("ColStatsMissing")},
+		{EdxltokenColStatsHyperLogLog, GPOS_WSZ_LIT("HyperLogLog")},
 
 		{EdxltokenParamId, GPOS_WSZ_LIT("ParamId")},
 
@@ -466,8 +474,11 @@ CDXLTokens::Init(CMemoryPool *mp)
 		{EdxltokenSortOpName, GPOS_WSZ_LIT("SortOperatorName")},
 		{EdxltokenSortDiscardDuplicates, GPOS_WSZ_LIT("SortDiscardDuplicates")},
 		{EdxltokenSortNullsFirst, GPOS_WSZ_LIT("SortNullsFirst")},
+		{EdxltokenSortPresortedKeys, GPOS_WSZ_LIT("PresortedKeys")},
 
 		{EdxltokenMaterializeEager, GPOS_WSZ_LIT("Eager")},
+		{EdxltokenMemoizeCacheKeys, GPOS_WSZ_LIT("CacheKeys")},
+		{EdxltokenMemoizeNumDistinct, GPOS_WSZ_LIT("NumDistinct")},
 
 		{EdxltokenSpoolId, GPOS_WSZ_LIT("SpoolId")},
 		{EdxltokenSpoolType, GPOS_WSZ_LIT("SpoolType")},
@@ -529,6 +540,14 @@ CDXLTokens::Init(CMemoryPool *mp)
 		{EdxltokenMVDependency, GPOS_WSZ_LIT("MVDependency")},
 		{EdxltokenMVNDistinctList, GPOS_WSZ_LIT("MVNDistinctList")},
 		{EdxltokenMVNDistinct, GPOS_WSZ_LIT("MVNDistinct")},
+		{EdxltokenMVMCVList, GPOS_WSZ_LIT("MVMCVList")},
+		{EdxltokenMVMCVItem, GPOS_WSZ_LIT("MVMCVItem")},
+		{EdxltokenMVMCVValue, GPOS_WSZ_LIT("MVMCVValue")},
+		{EdxltokenRelationMatViews, GPOS_WSZ_LIT("RelationMaterializedViews")},
+		{EdxltokenMatView, GPOS_WSZ_LIT("MaterializedView")},
+		{EdxltokenMatViewColumn, GPOS_WSZ_LIT("MaterializedViewColumn")},
+		{EdxltokenMatViewFilter, GPOS_WSZ_LIT("MaterializedViewFilter")},
+		{EdxltokenMatViewCombinable, GPOS_WSZ_LIT("Combinable")},
 		{EdxltokenDegree, GPOS_WSZ_LIT("Degree")},
 		{EdxltokenFrom, GPOS_WSZ_LIT("From")},
 		{EdxltokenTo, GPOS_WSZ_LIT("To")},
@@ -776,6 +795,7 @@ CDXLTokens::Init(CMemoryPool *mp)
 		{EdxltokenStatsBucketLowerBound, GPOS_WSZ_LIT("LowerBound")},
 		{EdxltokenStatsBucketUpperBound, GPOS_WSZ_LIT("UpperBound")},
 		{EdxltokenStatsFrequency, GPOS_WSZ_LIT("Frequency")},
+		{EdxltokenStatsBaseFrequency, GPOS_WSZ_LIT("BaseFrequency")},
 		{EdxltokenStatsDistinct, GPOS_WSZ_LIT("DistinctValues")},
 		{EdxltokenStatsBoundClosed, GPOS_WSZ_LIT("Closed")},
 
@@ -0,0 +1,467 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (c) 2023 VMware, Inc. or its affiliates. All Rights Reserved.
+//
+//	@filename:
+//		gporca_bench.cpp
+//
+//	@doc:
+//		Benchmark that replays minidumps through the optimizer and reports,
+//		per minidump, the wall time of each optimization, the peak memory
+//		used by an optimization, the size of the memo and the time spent in
+//		each xform, in JSON format.
+//
+//		Usage:
+//			gporca_bench [-n iterations] [-o file] [-T traceflag] dump...
+//
+//		Each minidump is optimized the given number of times, after its
+//		metadata has been loaded once. The JSON report goes to the given
+//		file, or to stdout.
+//---------------------------------------------------------------------------
+
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+
+#include "gpos/_api.h"
+#include "gpos/common/CBitSet.h"
+#include "gpos/common/CMainArgs.h"
+#include "gpos/common/CWallClock.h"
+#include "gpos/error/CErrorHandlerStandard.h"
+#include "gpos/error/CException.h"
+#include "gpos/memory/CAutoMemoryPool.h"
+#include "gpos/test/CUnittest.h"
+#include "gpos/types.h"
+
+#include "gpopt/cost/ICostModel.h"
+#include "gpopt/init.h"
+#include "gpopt/mdcache/CMDCache.h"
+#include "gpopt/minidump/CDXLMinidump.h"
+#include "gpopt/minidump/CMetadataAccessorFactory.h"
+#include "gpopt/minidump/CMinidumperUtils.h"
+#include "gpopt/optimizer/COptimizationProfile.h"
+#include "gpopt/optimizer/COptimizer.h"
+#include "gpopt/optimizer/COptimizerConfig.h"
+#include "gpopt/xforms/CXformFactory.h"
+#include "naucrates/init.h"
+#include "naucrates/traceflags/traceflags.h"
+
+using namespace gpos;
+using namespace gpopt;
+using namespace gpdxl;
+
+// minimum number of segments to optimize for, as in the minidump tests
+#define GPORCA_BENCH_SEGMENTS 2
+
+// default number of optimizations per minidump
+#define GPORCA_BENCH_ITERATIONS 10
+
+// exit code of the benchmark, set by PvExec once all minidumps ran
+static INT bench_result = 1;
+
+//---------------------------------------------------------------------------
+//	@struct:
+//		SBenchResult
+//
+//	@doc:
+//		Measurements of the optimizations of one minidump
+//
+//---------------------------------------------------------------------------
+struct SBenchResult
+{
+	// number of optimizations that completed
+	ULONG m_ulIterations{0};
+
+	// wall time of each completed optimization, in microseconds
+	ULONG *m_rgulWallTimeUS{nullptr};
+
+	// highest peak memory of an optimization, in bytes
+	ULLONG m_ullPeakMemory{0};
+
+	// counters accumulated over all completed optimizations
+	COptimizationProfile m_profile;
+
+	// exception that stopped the optimizations, if any
+	BOOL m_fError{false};
+	ULONG m_ulMajor{0};
+	ULONG m_ulMinor{0};
+};
+
+//---------------------------------------------------------------------------
+//	@function:
+//		PrintJSONString
+//
+//	@doc:
+//		Print a string as a JSON string literal
+//
+//---------------------------------------------------------------------------
+static void
+PrintJSONString(std::ostream &os, const CHAR *sz)
+{
+	os << '"';
+	for (const CHAR *pch = sz; '\0' != *pch; pch++)
+	{
+		if ('"' == *pch || '\\' == *pch)
+		{
+			os << '\\';
+		}
+		os << *pch;
+	}
+	os << '"';
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		RunMinidump
+//
+//	@doc:
+//		Load the given minidump and optimize its query the given number of
+//		times, recording the measurements into the given result. Each
+//		optimization runs in a memory pool of its own, so that its peak
+//		memory does not include the metadata.
+//
+//---------------------------------------------------------------------------
+static void
+RunMinidump(CMemoryPool *mp, const CHAR *file_name, ULONG ulIterations,
+			SBenchResult *result)
+{
+	CDXLMinidump *pdxlmd = CMinidumperUtils::PdxlmdLoad(mp, file_name);
+
+	COptimizerConfig *optimizer_config = pdxlmd->GetOptimizerConfig();
+	if (nullptr == optimizer_config)
+	{
+		optimizer_config = COptimizerConfig::PoconfDefault(mp);
+	}
+	else
+	{
+		optimizer_config->AddRef();
+	}
+
+	ULONG ulSegments = GPORCA_BENCH_SEGMENTS;
+	if (nullptr != optimizer_config->GetCostModel())
+	{
+		ulSegments = std::max(ulSegments,
+							  optimizer_config->GetCostModel()->UlHosts());
+	}
+
+	// start every minidump from an empty metadata cache
+	CMDCache::Reset();
+	CMetadataAccessorFactory factory(mp, pdxlmd, file_name);
+
+	CBitSet *pbsEnabled = nullptr;
+	CBitSet *pbsDisabled = nullptr;
+	SetTraceflags(mp, pdxlmd->Pbs(), &pbsEnabled, &pbsDisabled);
+
+	// there is no executor to evaluate constant expressions
+	GPOS_UNSET_TRACE(EopttraceEnableConstantExpressionEvaluation);
+
+	CErrorHandlerStandard errhdl;
+	GPOS_TRY_HDL(&errhdl)
+	{
+		for (ULONG ul = 0; ul < ulIterations; ul++)
+		{
+			CAutoMemoryPool amp;
+			CMemoryPool *pmpOpt = amp.Pmp();
+
+			CWallClock clock;
+			CDXLNode *pdxlnPlan = COptimizer::PdxlnOptimize(
+				pmpOpt, factory.Pmda(), pdxlmd->GetQueryDXLRoot(),
+				pdxlmd->PdrgpdxlnQueryOutput(),
+				pdxlmd->GetCTEProducerDXLArray(), nullptr /*pceeval*/,
+				ulSegments, 1 /*ulSessionId*/, 1 /*ulCmdId*/,
+				nullptr /*search_stage_array*/, optimizer_config,
+				nullptr /*szMinidumpFileName*/, &result->m_profile);
+			result->m_rgulWallTimeUS[ul] = clock.ElapsedUS();
+
+			pdxlnPlan->Release();
+			result->m_ullPeakMemory =
+				std::max(result->m_ullPeakMemory, pmpOpt->PeakAllocatedSize());
+			result->m_ulIterations++;
+		}
+	}
+	GPOS_CATCH_EX(ex)
+	{
+		result->m_fError = true;
+		result->m_ulMajor = ex.Major();
+		result->m_ulMinor = ex.Minor();
+		GPOS_RESET_EX;
+	}
+	GPOS_CATCH_END;
+
+	ResetTraceflags(pbsEnabled, pbsDisabled);
+	CRefCount::SafeRelease(pbsEnabled);
+	CRefCount::SafeRelease(pbsDisabled);
+
+	optimizer_config->Release();
+	GPOS_DELETE(pdxlmd);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		PrintResult
+//
+//	@doc:
+//		Print the measurements of one minidump as a JSON object
+//
+//---------------------------------------------------------------------------
+static void
+PrintResult(std::ostream &os, const CHAR *file_name, SBenchResult *result)
+{
+	const ULONG ulIterations = result->m_ulIterations;
+	const COptimizationProfile &profile = result->m_profile;
+
+	os << "    {\n      \"file\": ";
+	PrintJSONString(os, file_name);
+	os << ",\n      \"iterations\": " << ulIterations;
+
+	if (result->m_fError)
+	{
+		os << ",\n      \"error\": {\"major\": " << result->m_ulMajor
+		   << ", \"minor\": " << result->m_ulMinor << "}";
+	}
+
+	if (0 == ulIterations)
+	{
+		os << "\n    }";
+		return;
+	}
+
+	os << ",\n      \"wall_time_us\": [";
+	ULLONG ullTotalUS = 0;
+	for (ULONG ul = 0; ul < ulIterations; ul++)
+	{
+		os << (0 == ul ? "" : ", ") << result->m_rgulWallTimeUS[ul];
+		ullTotalUS += result->m_rgulWallTimeUS[ul];
+	}
+	os << "]";
+
+	std::sort(result->m_rgulWallTimeUS,
+			  result->m_rgulWallTimeUS + ulIterations);
+	os << ",\n      \"min_us\": " << result->m_rgulWallTimeUS[0]
+	   << ",\n      \"median_us\": "
+	   << result->m_rgulWallTimeUS[ulIterations / 2]
+	   << ",\n      \"mean_us\": " << ullTotalUS / ulIterations;
+
+	// the memo is the same in every optimization, report one of them
+	os << ",\n      \"peak_memory_bytes\": " << result->m_ullPeakMemory
+	   << ",\n      \"memo\": {\"groups\": "
+	   << profile.UlGroups() / ulIterations
+	   << ", \"group_expressions\": " << profile.UlGroupExprs() / ulIterations
+	   << ", \"duplicate_groups\": "
+	   << profile.UlDuplicateGroups() / ulIterations << "}";
+
+	// report xform counters per optimization, skipping unused xforms
+	os << ",\n      \"xforms\": [";
+	BOOL fFirst = true;
+	for (ULONG ul = 0; ul < CXform::ExfSentinel; ul++)
+	{
+		CXform::EXformId exfid = (CXform::EXformId) ul;
+		if (0 == profile.UllXformCalls(exfid))
+		{
+			continue;
+		}
+
+		os << (fFirst ? "" : ",") << "\n        {\"name\": ";
+		PrintJSONString(os, CXformFactory::Pxff()->Pxf(exfid)->SzId());
+		os << ", \"calls\": " << profile.UllXformCalls(exfid) / ulIterations
+		   << ", \"bindings\": "
+		   << profile.UllXformBindings(exfid) / ulIterations
+		   << ", \"results\": "
+		   << profile.UllXformResults(exfid) / ulIterations
+		   << ", \"time_us\": "
+		   << profile.UllXformTimeUS(exfid) / ulIterations << "}";
+		fFirst = false;
+	}
+	os << (fFirst ? "" : "\n      ") << "]";
+
+	os << ",\n      \"jobs\": [";
+	fFirst = true;
+	for (ULONG ul = 0; ul < CJob::EjtSentinel; ul++)
+	{
+		CJob::EJobType ejt = (CJob::EJobType) ul;
+		if (0 == profile.UllJobCalls(ejt))
+		{
+			continue;
+		}
+
+		os << (fFirst ? "" : ",") << "\n        {\"name\": ";
+		PrintJSONString(os, COptimizationProfile::SzJobType(ejt));
+		os << ", \"calls\": " << profile.UllJobCalls(ejt) / ulIterations
+		   << ", \"time_us\": " << profile.UllJobTimeUS(ejt) / ulIterations
+		   << "}";
+		fFirst = false;
+	}
+	os << (fFirst ? "" : "\n      ") << "]";
+
+	os << ",\n      \"phases\": [";
+	for (ULONG ul = 0; ul < COptimizationProfile::EphSentinel; ul++)
+	{
+		COptimizationProfile::EPhase eph = (COptimizationProfile::EPhase) ul;
+
+		os << (0 == ul ? "" : ",") << "\n        {\"name\": ";
+		PrintJSONString(os, COptimizationProfile::SzPhase(eph));
+		os << ", \"calls\": " << profile.UllPhaseCalls(eph) / ulIterations
+		   << ", \"time_us\": " << profile.UllPhaseTimeUS(eph) / ulIterations
+		   << "}";
+	}
+	os << "\n      ]\n    }";
+}
+
+//---------------------------------------------------------------------------
+//	@struct:
+//		SBenchArgs
+//
+//	@doc:
+//		Command line of the benchmark
+//
+//---------------------------------------------------------------------------
+struct SBenchArgs
+{
+	INT m_iArgs;
+	const CHAR **m_rgszArgs;
+};
+
+//---------------------------------------------------------------------------
+//	@function:
+//		PvExec
+//
+//	@doc:
+//		Function driving execution
+//
+//---------------------------------------------------------------------------
+static void *
+PvExec(void *pv)
+{
+	SBenchArgs *pba = (SBenchArgs *) pv;
+	CMainArgs ma(pba->m_iArgs, pba->m_rgszArgs, "n:o:T:");
+
+	ULONG ulIterations = GPORCA_BENCH_ITERATIONS;
+	const CHAR *szOutput = nullptr;
+
+	CHAR ch = '\0';
+	while (ma.Getopt(&ch))
+	{
+		switch (ch)
+		{
+			case 'n':
+				ulIterations = (ULONG) std::max(1L, atol(optarg));
+				break;
+
+			case 'o':
+				szOutput = optarg;
+				break;
+
+			case 'T':
+				CUnittest::SetTraceFlag(optarg);
+				break;
+
+			default:
+				return nullptr;
+		}
+	}
+
+	// remaining arguments are minidump files
+	const INT iFirstFile = optind;
+	if (iFirstFile >= pba->m_iArgs)
+	{
+		std::cerr << "usage: " << pba->m_rgszArgs[0]
+				  << " [-n iterations] [-o file] [-T traceflag] dump..."
+				  << std::endl;
+		return nullptr;
+	}
+
+	std::ofstream osFile;
+	if (nullptr != szOutput)
+	{
+		osFile.open(szOutput);
+		if (!osFile.is_open())
+		{
+			std::cerr << "could not open " << szOutput << std::endl;
+			return nullptr;
+		}
+	}
+	std::ostream &os = (nullptr != szOutput) ? osFile : std::cout;
+
+	InitDXL();
+	CMDCache::Init();
+
+	BOOL fSuccess = true;
+	os << "{\n  \"iterations\": " << ulIterations << ",\n  \"queries\": [\n";
+	for (INT i = iFirstFile; i < pba->m_iArgs; i++)
+	{
+		const CHAR *file_name = pba->m_rgszArgs[i];
+
+		// each minidump uses a new memory pool
+		CAutoMemoryPool amp;
+		CMemoryPool *mp = amp.Pmp();
+
+		SBenchResult result;
+		result.m_rgulWallTimeUS = GPOS_NEW_ARRAY(mp, ULONG, ulIterations);
+
+		GPOS_TRY
+		{
+			RunMinidump(mp, file_name, ulIterations, &result);
+		}
+		GPOS_CATCH_EX(ex)
+		{
+			// the minidump could not be loaded
+			result.m_fError = true;
+			result.m_ulMajor = ex.Major();
+			result.m_ulMinor = ex.Minor();
+			GPOS_RESET_EX;
+		}
+		GPOS_CATCH_END;
+
+		fSuccess = fSuccess && !result.m_fError;
+		PrintResult(os, file_name, &result);
+		os << (i + 1 < pba->m_iArgs ? ",\n" : "\n");
+
+		GPOS_DELETE_ARRAY(result.m_rgulWallTimeUS);
+	}
+	os << "  ]\n}" << std::endl;
+
+	CMDCache::Shutdown();
+
+	bench_result = fSuccess ? 0 : 1;
+
+	return nullptr;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		main
+//
+//	@doc:
+//		Entry point of the benchmark
+//
+//---------------------------------------------------------------------------
+INT
+main(INT iArgs, const CHAR **rgszArgs)
+{
+	// Use default allocator
+	struct gpos_init_params gpos_params = {nullptr};
+
+	gpos_init(&gpos_params);
+	gpdxl_init();
+	gpopt_init();
+
+	SBenchArgs ba = {iArgs, rgszArgs};
+
+	gpos_exec_params params;
+	params.func = PvExec;
+	params.arg = &ba;
+	params.stack_start = &params;
+	params.error_buffer = nullptr;
+	params.error_buffer_size = -1;
+	params.abort_requested = nullptr;
+
+	if (gpos_exec(&params))
+	{
+		return 1;
+	}
+
+	return bench_result;
+}
+
+// EOF
@@ -0,0 +1,46 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (c) 2023 VMware, Inc. or its affiliates. All Rights Reserved.
+//
+//	@filename:
+//		CDXLBinaryTest.h
+//
+//	@doc:
+//		Tests the binary encoding of DXL documents
+//---------------------------------------------------------------------------
+
+
+#ifndef GPOPT_CDXLBinaryTest_H
+#define GPOPT_CDXLBinaryTest_H
+
+#include "gpos/base.h"
+
+namespace gpdxl
+{
+using namespace gpos;
+
+//---------------------------------------------------------------------------
+//	@class:
+//		CDXLBinaryTest
+//
+//	@doc:
+//		Static unit tests
+//
+//---------------------------------------------------------------------------
+
+class CDXLBinaryTest
+{
+public:
+	// unittests
+	static GPOS_RESULT EresUnittest();
+	static GPOS_RESULT EresUnittest_RoundTripMinidumps();
+	static GPOS_RESULT EresUnittest_Escaping();
+	static GPOS_RESULT EresUnittest_Truncated();
+	static GPOS_RESULT EresUnittest_Corrupt();
+
+};	// class CDXLBinaryTest
+}  // namespace gpdxl
+
+#endif	// !GPOPT_CDXLBinaryTest_H
+
+// EOF
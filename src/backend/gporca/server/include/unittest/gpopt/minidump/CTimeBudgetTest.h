@@ -0,0 +1,58 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (c) 2023 VMware, Inc. or its affiliates. All Rights Reserved.
+//
+//	@filename:
+//		CTimeBudgetTest.h
+//
+//	@doc:
+//		Test for optimizing queries under a time budget
+//---------------------------------------------------------------------------
+#ifndef GPOPT_CTimeBudgetTest_H
+#define GPOPT_CTimeBudgetTest_H
+
+#include "gpos/base.h"
+
+namespace gpopt
+{
+using namespace gpos;
+
+//---------------------------------------------------------------------------
+//	@class:
+//		CTimeBudgetTest
+//
+//	@doc:
+//		Unittests
+//
+//---------------------------------------------------------------------------
+class CTimeBudgetTest
+{
+	struct STimeBudgetTestCase
+	{
+		// input minidump file
+		const CHAR *m_szInputFile;
+
+		// time budget in ms, zero means no budget
+		ULONG m_ulTimeBudget;
+
+		// is the budget expected to expire before the search completes
+		BOOL m_fExpectExpired;
+
+	};	// STimeBudgetTestCase
+
+private:
+	// counter used to mark last successful test
+	static gpos::ULONG m_ulTimeBudgetTestCounter;
+
+public:
+	// unittests
+	static gpos::GPOS_RESULT EresUnittest();
+
+	static gpos::GPOS_RESULT EresUnittest_RunTests();
+
+};	// class CTimeBudgetTest
+}  // namespace gpopt
+
+#endif	// !GPOPT_CTimeBudgetTest_H
+
+// EOF
@@ -27,6 +27,7 @@
 // test headers
 
 #include "unittest/base.h"
+#include "unittest/dxl/CDXLBinaryTest.h"
 #include "unittest/dxl/CDXLMemoryManagerTest.h"
 #include "unittest/dxl/CDXLUtilsTest.h"
 #include "unittest/dxl/CParseHandlerCostModelTest.h"
@@ -91,6 +92,7 @@
 #include "unittest/gpopt/minidump/CPullUpProjectElementTest.h"
 #include "unittest/gpopt/minidump/CSubqueryTest.h"
 #include "unittest/gpopt/minidump/CTVFTest.h"
+#include "unittest/gpopt/minidump/CTimeBudgetTest.h"
 #include "unittest/gpopt/minidump/CWindowTest.h"
 #include "unittest/gpopt/minidump/MinidumpTestHeaders.h"  // auto generated header file
 #include "unittest/gpopt/operators/CContradictionTest.h"
@@ -123,6 +125,7 @@ static gpos::CUnittest rgut[] = {
 
 	// naucrates
 	GPOS_UNITTEST_STD(CCostTest), GPOS_UNITTEST_STD(CDatumTest),
+	GPOS_UNITTEST_STD(CDXLBinaryTest),
 	GPOS_UNITTEST_STD(CDXLMemoryManagerTest), GPOS_UNITTEST_STD(CDXLUtilsTest),
 	GPOS_UNITTEST_STD(CMDAccessorTest), GPOS_UNITTEST_STD(CMDProviderTest),
 	GPOS_UNITTEST_STD(CMiniDumperDXLTest),
@@ -134,7 +137,8 @@ static gpos::CUnittest rgut[] = {
 	GPOS_UNITTEST_STD(CCollapseProjectTest),
 	GPOS_UNITTEST_STD(CPruneColumnsTest),
 	GPOS_UNITTEST_STD(CPhysicalParallelUnionAllTest),
-	GPOS_UNITTEST_STD(CMissingStatsTest), GPOS_UNITTEST_STD(CBitmapTest),
+	GPOS_UNITTEST_STD(CMissingStatsTest), GPOS_UNITTEST_STD(CTimeBudgetTest),
+	GPOS_UNITTEST_STD(CBitmapTest),
 	GPOS_UNITTEST_STD(CCTETest), GPOS_UNITTEST_STD(CExternalTableTest),
 	GPOS_UNITTEST_STD(CEscapeMechanismTest),
 
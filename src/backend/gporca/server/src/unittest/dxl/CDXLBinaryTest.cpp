@@ -0,0 +1,522 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (c) 2023 VMware, Inc. or its affiliates. All Rights Reserved.
+//
+//	@filename:
+//		CDXLBinaryTest.cpp
+//
+//	@doc:
+//		Tests the binary encoding of DXL documents: every minidump must
+//		decode to the same elements, attributes and character data as its
+//		XML text, and malformed input must be rejected
+//---------------------------------------------------------------------------
+
+#include "unittest/dxl/CDXLBinaryTest.h"
+
+#include <dirent.h>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <xercesc/framework/MemBufInputSource.hpp>
+#include <xercesc/sax2/Attributes.hpp>
+#include <xercesc/sax2/DefaultHandler.hpp>
+#include <xercesc/sax2/SAX2XMLReader.hpp>
+#include <xercesc/sax2/XMLReaderFactory.hpp>
+
+#include "gpos/base.h"
+#include "gpos/common/CAutoRg.h"
+#include "gpos/memory/CAutoMemoryPool.h"
+#include "gpos/test/CUnittest.h"
+
+#include "naucrates/dxl/CDXLUtils.h"
+#include "naucrates/dxl/xml/CDXLBinaryFormat.h"
+#include "naucrates/dxl/xml/CDXLBinaryOstream.h"
+#include "naucrates/dxl/xml/CDXLBinaryReader.h"
+#include "naucrates/dxl/xml/CDXLMemoryManager.h"
+#include "naucrates/exception.h"
+
+XERCES_CPP_NAMESPACE_USE
+
+using namespace gpos;
+using namespace gpdxl;
+
+static const CHAR *szMinidumpDir = "../data/dxl/minidump";
+static const CHAR *szPlanFile = "../data/dxl/expressiontests/TableScanPlan.xml";
+
+// document with entities, character references, CDATA and values that
+// look like integers without being written as their canonical digits
+static const CHAR *szEscapingDoc =
+	"<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+	"<dxl:DXLMessage xmlns:dxl=\"http://greenplum.com/dxl/2010/12/\">\n"
+	"  <dxl:Comment><![CDATA[a < b && c > d]]></dxl:Comment>\n"
+	"  <dxl:Escaped Lt=\"&lt;\" Gt=\"&gt;\" Amp=\"&amp;\" Quot=\"&quot;\" "
+	"Apos=\"&apos;\" Single='say \"hi\"' Refs=\"&#65;&#x42;&#x3c;\" "
+	"Umlaut=\"&#252;ber\" Utf8=\"\xc3\xbc\xe2\x82\xac\" "
+	"Mixed=\"a &amp;&amp; b &lt;= c\">\n"
+	"    x &lt; y &amp; z &#x26; \xc3\xa9\n"
+	"  </dxl:Escaped>\n"
+	"  <dxl:Values Zero=\"0\" Negative=\"-42\" Padded=\"007\" Signed=\"+5\" "
+	"NegZero=\"-0\" Long=\"123456789012345678901234567890\" "
+	"Min=\"-999999999999999999\" Space=\" 1\" Empty=\"\" First=\"dup\" "
+	"Second=\"dup\"/>\n"
+	"</dxl:DXLMessage>\n";
+
+namespace
+{
+//---------------------------------------------------------------------------
+//	@class:
+//		CElementTreeRecorder
+//
+//	@doc:
+//		Content handler that records the elements, attributes and character
+//		data of a document; whitespace between elements is not recorded
+//
+//---------------------------------------------------------------------------
+class CElementTreeRecorder : public DefaultHandler
+{
+private:
+	std::vector<XMLCh> m_tree;
+
+	std::vector<XMLCh> m_text;
+
+	void
+	Append(const XMLCh *xmlsz)
+	{
+		for (; 0 != *xmlsz; xmlsz++)
+		{
+			m_tree.push_back(*xmlsz);
+		}
+	}
+
+	void
+	Append(XMLCh xmlch)
+	{
+		m_tree.push_back(xmlch);
+	}
+
+	void
+	AppendText()
+	{
+		BOOL is_whitespace = true;
+		for (XMLCh xmlch : m_text)
+		{
+			is_whitespace = is_whitespace && (' ' == xmlch || '\t' == xmlch ||
+											  '\n' == xmlch || '\r' == xmlch);
+		}
+
+		if (!is_whitespace)
+		{
+			Append('"');
+			m_tree.insert(m_tree.end(), m_text.begin(), m_text.end());
+			Append('"');
+		}
+		m_text.clear();
+	}
+
+public:
+	CElementTreeRecorder(const CElementTreeRecorder &) = delete;
+
+	CElementTreeRecorder() = default;
+
+	~CElementTreeRecorder() override = default;
+
+	void
+	startElement(const XMLCh *const,  // element_uri
+				 const XMLCh *const element_local_name,
+				 const XMLCh *const,  // element_qname
+				 const Attributes &attrs) override
+	{
+		AppendText();
+		Append('<');
+		Append(element_local_name);
+		for (XMLSize_t ul = 0; ul < attrs.getLength(); ul++)
+		{
+			Append(' ');
+			Append(attrs.getLocalName(ul));
+			Append('=');
+			Append('"');
+			Append(attrs.getValue(ul));
+			Append('"');
+		}
+		Append('>');
+	}
+
+	void
+	endElement(const XMLCh *const,	// element_uri
+			   const XMLCh *const element_local_name,
+			   const XMLCh *const  // element_qname
+			   ) override
+	{
+		AppendText();
+		Append('<');
+		Append('/');
+		Append(element_local_name);
+		Append('>');
+	}
+
+	void
+	characters(const XMLCh *const xmlsz, const XMLSize_t length) override
+	{
+		m_text.insert(m_text.end(), xmlsz, xmlsz + length);
+	}
+
+	const std::vector<XMLCh> &
+	Tree() const
+	{
+		return m_tree;
+	}
+};	// class CElementTreeRecorder
+}  // namespace
+
+//---------------------------------------------------------------------------
+//	@function:
+//		WriteUTF8
+//
+//	@doc:
+//		Write a document in UTF-8 to the given stream as wide characters,
+//		the way the serializer writes to a binary DXL stream
+//
+//---------------------------------------------------------------------------
+static void
+WriteUTF8(IOstream &os, const CHAR *sz)
+{
+	const BYTE *data = (const BYTE *) sz;
+	while (0 != *data)
+	{
+		BYTE lead = *data++;
+		ULONG num_bytes = 0;
+		ULONG code_point = lead;
+		if (0xc0 == (lead & 0xe0))
+		{
+			num_bytes = 1;
+			code_point = lead & 0x1f;
+		}
+		else if (0xe0 == (lead & 0xf0))
+		{
+			num_bytes = 2;
+			code_point = lead & 0x0f;
+		}
+		else if (0xf0 == (lead & 0xf8))
+		{
+			num_bytes = 3;
+			code_point = lead & 0x07;
+		}
+
+		for (ULONG ul = 0; ul < num_bytes && 0 != *data; ul++)
+		{
+			code_point = (code_point << 6) | (*data++ & 0x3f);
+		}
+
+		os << (WCHAR) code_point;
+	}
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		EncodeBinary
+//
+//	@doc:
+//		Encode an XML document as binary DXL
+//
+//---------------------------------------------------------------------------
+static std::string
+EncodeBinary(CMemoryPool *mp, const CHAR *sz)
+{
+	std::ostringstream oss(std::ios_base::out | std::ios_base::binary);
+	{
+		CDXLBinaryOstream os(mp, oss);
+		WriteUTF8(os, sz);
+	}
+
+	return oss.str();
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		RecordXML
+//
+//	@doc:
+//		Parse an XML document into the given recorder
+//
+//---------------------------------------------------------------------------
+static void
+RecordXML(CMemoryPool *mp, const CHAR *sz, CElementTreeRecorder *recorder)
+{
+	CDXLMemoryManager mm(mp);
+	std::unique_ptr<SAX2XMLReader> sax_2_xml_reader(
+		XMLReaderFactory::createXMLReader(&mm));
+	sax_2_xml_reader->setContentHandler(recorder);
+
+	MemBufInputSource input((const XMLByte *) sz, clib::Strlen(sz),
+							"binary dxl test", false, &mm);
+	sax_2_xml_reader->parse(input);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		RecordBinary
+//
+//	@doc:
+//		Parse a binary DXL document into the given recorder, if any
+//
+//---------------------------------------------------------------------------
+static void
+RecordBinary(CMemoryPool *mp, const BYTE *data, ULONG size,
+			 CElementTreeRecorder *recorder)
+{
+	CDXLMemoryManager mm(mp);
+	std::unique_ptr<SAX2XMLReader> sax_2_xml_reader(
+		XMLReaderFactory::createXMLReader(&mm));
+	sax_2_xml_reader->setContentHandler(recorder);
+
+	CDXLBinaryReader reader(mp, data, size);
+	reader.Parse(sax_2_xml_reader.get());
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		FRoundTrips
+//
+//	@doc:
+//		Does an XML document decode from binary DXL to the same tree
+//
+//---------------------------------------------------------------------------
+static BOOL
+FRoundTrips(CMemoryPool *mp, const CHAR *sz)
+{
+	CElementTreeRecorder xml_recorder;
+	RecordXML(mp, sz, &xml_recorder);
+
+	std::string binary = EncodeBinary(mp, sz);
+	CElementTreeRecorder binary_recorder;
+	RecordBinary(mp, (const BYTE *) binary.data(), (ULONG) binary.size(),
+				 &binary_recorder);
+
+	return !xml_recorder.Tree().empty() &&
+		   xml_recorder.Tree() == binary_recorder.Tree();
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		FMalformed
+//
+//	@doc:
+//		Is the given binary DXL rejected as malformed
+//
+//---------------------------------------------------------------------------
+static BOOL
+FMalformed(CMemoryPool *mp, const BYTE *data, ULONG size)
+{
+	BOOL is_malformed = false;
+
+	GPOS_TRY
+	{
+		RecordBinary(mp, data, size, nullptr /*recorder*/);
+	}
+	GPOS_CATCH_EX(ex)
+	{
+		if (!GPOS_MATCH_EX(ex, gpdxl::ExmaDXL,
+						   gpdxl::ExmiDXLBinaryParseError))
+		{
+			GPOS_RETHROW(ex);
+		}
+
+		is_malformed = true;
+		GPOS_RESET_EX;
+	}
+	GPOS_CATCH_END;
+
+	return is_malformed;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLBinaryTest::EresUnittest
+//
+//	@doc:
+//		Unittest for binary DXL
+//
+//---------------------------------------------------------------------------
+GPOS_RESULT
+CDXLBinaryTest::EresUnittest()
+{
+	CUnittest rgut[] = {
+		GPOS_UNITTEST_FUNC(CDXLBinaryTest::EresUnittest_RoundTripMinidumps),
+		GPOS_UNITTEST_FUNC(CDXLBinaryTest::EresUnittest_Escaping),
+		GPOS_UNITTEST_FUNC(CDXLBinaryTest::EresUnittest_Truncated),
+		GPOS_UNITTEST_FUNC(CDXLBinaryTest::EresUnittest_Corrupt),
+	};
+
+	return CUnittest::EresExecute(rgut, GPOS_ARRAY_SIZE(rgut));
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLBinaryTest::EresUnittest_RoundTripMinidumps
+//
+//	@doc:
+//		Write every minidump as binary DXL, read it back and compare the
+//		element trees
+//
+//---------------------------------------------------------------------------
+GPOS_RESULT
+CDXLBinaryTest::EresUnittest_RoundTripMinidumps()
+{
+	DIR *dir = opendir(szMinidumpDir);
+	GPOS_UNITTEST_ASSERT(nullptr != dir);
+
+	GPOS_RESULT eres = GPOS_OK;
+	ULONG num_files = 0;
+	for (struct dirent *entry = readdir(dir); nullptr != entry;
+		 entry = readdir(dir))
+	{
+		std::string file_name(entry->d_name);
+		if (4 >= file_name.size() ||
+			0 != file_name.compare(file_name.size() - 4, 4, ".mdp"))
+		{
+			continue;
+		}
+
+		std::string path = std::string(szMinidumpDir) + "/" + file_name;
+
+		// each file gets its own pool, the largest minidumps take megabytes
+		CAutoMemoryPool amp;
+		CMemoryPool *mp = amp.Pmp();
+		CAutoRg<CHAR> a_sz(CDXLUtils::Read(mp, path.c_str()));
+
+		if (!FRoundTrips(mp, a_sz.Rgt()))
+		{
+			GPOS_TRACE_FORMAT("Binary DXL changed the element tree of %s",
+							  path.c_str());
+			eres = GPOS_FAILED;
+		}
+		num_files++;
+	}
+	closedir(dir);
+
+	GPOS_UNITTEST_ASSERT(0 < num_files);
+
+	return eres;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLBinaryTest::EresUnittest_Escaping
+//
+//	@doc:
+//		Entities, character references, CDATA sections and non-ASCII
+//		characters decode to the characters the XML parser reports, and
+//		values are only stored as integers when they print the same
+//
+//---------------------------------------------------------------------------
+GPOS_RESULT
+CDXLBinaryTest::EresUnittest_Escaping()
+{
+	CAutoMemoryPool amp;
+	CMemoryPool *mp = amp.Pmp();
+
+	GPOS_UNITTEST_ASSERT(FRoundTrips(mp, szEscapingDoc));
+
+	return GPOS_OK;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLBinaryTest::EresUnittest_Truncated
+//
+//	@doc:
+//		Every proper prefix of a binary DXL document is rejected
+//
+//---------------------------------------------------------------------------
+GPOS_RESULT
+CDXLBinaryTest::EresUnittest_Truncated()
+{
+	CAutoMemoryPool amp;
+	CMemoryPool *mp = amp.Pmp();
+
+	const CHAR *rgsz[2] = {nullptr, szEscapingDoc};
+	CAutoRg<CHAR> a_szPlan(CDXLUtils::Read(mp, szPlanFile));
+	rgsz[0] = a_szPlan.Rgt();
+
+	for (ULONG ulDoc = 0; ulDoc < GPOS_ARRAY_SIZE(rgsz); ulDoc++)
+	{
+		std::string binary = EncodeBinary(mp, rgsz[ulDoc]);
+		const BYTE *data = (const BYTE *) binary.data();
+		const ULONG size = (ULONG) binary.size();
+
+		GPOS_UNITTEST_ASSERT(!FMalformed(mp, data, size));
+		for (ULONG ul = 0; ul < size; ul++)
+		{
+			GPOS_UNITTEST_ASSERT(FMalformed(mp, data, ul));
+		}
+	}
+
+	return GPOS_OK;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLBinaryTest::EresUnittest_Corrupt
+//
+//	@doc:
+//		Corrupt records are rejected instead of being read past the end of
+//		the input or into undefined names and values
+//
+//---------------------------------------------------------------------------
+GPOS_RESULT
+CDXLBinaryTest::EresUnittest_Corrupt()
+{
+	CAutoMemoryPool amp;
+	CMemoryPool *mp = amp.Pmp();
+
+	const BYTE open = CDXLBinaryFormat::ErecOpen;
+	const BYTE close = CDXLBinaryFormat::ErecClose;
+	const BYTE literal = CDXLBinaryFormat::EvalLiteral;
+	const BYTE reference = CDXLBinaryFormat::EvalReference;
+	const BYTE version = CDXLBinaryFormat::Version;
+
+	// <a b="c"/>
+	const std::vector<BYTE> valid = {
+		0x89,	'D', 'X', 'B', version, open, 0, 1, 'a', 1,
+		0,		1,	 'b', (1 << 2) | literal, 'c', close};
+
+	const std::vector<std::vector<BYTE>> rgdoc = {
+		// wrong magic number
+		{0x89, 'D', 'X', 'C', version, open, 0, 1, 'a', 0, close},
+		// unknown version
+		{0x89, 'D', 'X', 'B', version + 1, open, 0, 1, 'a', 0, close},
+		// unknown record
+		{0x89, 'D', 'X', 'B', version, CDXLBinaryFormat::ErecSentinel},
+		// close record without an open element
+		{0x89, 'D', 'X', 'B', version, close},
+		// unclosed element
+		{0x89, 'D', 'X', 'B', version, open, 0, 1, 'a', 0},
+		// reference to a name that was not defined
+		{0x89, 'D', 'X', 'B', version, open, 1, 0, close},
+		// name longer than the input
+		{0x89, 'D', 'X', 'B', version, open, 0, 10, 'a'},
+		// more attributes than the input can hold
+		{0x89, 'D', 'X', 'B', version, open, 0, 1, 'a', 100, close},
+		// reference to a value that was not defined
+		{0x89, 'D', 'X', 'B', version, open, 0, 1, 'a', 1, 0, 1, 'b',
+		 (0 << 2) | reference, close},
+		// unknown kind of value
+		{0x89, 'D', 'X', 'B', version, open, 0, 1, 'a', 1, 0, 1, 'b',
+		 CDXLBinaryFormat::EvalSentinel, close},
+		// varint of more than 64 bits
+		{0x89, 'D', 'X', 'B', version, open, 0xff, 0xff, 0xff, 0xff, 0xff,
+		 0xff, 0xff, 0xff, 0xff, 0xff, 0xff},
+	};
+
+	GPOS_UNITTEST_ASSERT(!FMalformed(mp, valid.data(), (ULONG) valid.size()));
+
+	for (const std::vector<BYTE> &doc : rgdoc)
+	{
+		GPOS_UNITTEST_ASSERT(FMalformed(mp, doc.data(), (ULONG) doc.size()));
+	}
+
+	return GPOS_OK;
+}
+
+// EOF
@@ -0,0 +1,145 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (c) 2023 VMware, Inc. or its affiliates. All Rights Reserved.
+//
+//	@filename:
+//		CTimeBudgetTest.cpp
+//
+//	@doc:
+//		Test for optimizing queries under a time budget
+//---------------------------------------------------------------------------
+
+#include "unittest/gpopt/minidump/CTimeBudgetTest.h"
+
+#include "gpos/base.h"
+#include "gpos/memory/CAutoMemoryPool.h"
+#include "gpos/test/CUnittest.h"
+
+#include "gpopt/engine/CCTEConfig.h"
+#include "gpopt/engine/CEnumeratorConfig.h"
+#include "gpopt/engine/CHint.h"
+#include "gpopt/engine/CStatisticsConfig.h"
+#include "gpopt/minidump/CMinidumperUtils.h"
+#include "gpopt/optimizer/COptimizerConfig.h"
+
+#include "unittest/gpopt/CTestUtils.h"
+
+using namespace gpopt;
+
+ULONG CTimeBudgetTest::m_ulTimeBudgetTestCounter = 0;  // start from first test
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CTimeBudgetTest::EresUnittest
+//
+//	@doc:
+//		Unittest for expressions
+//
+//---------------------------------------------------------------------------
+GPOS_RESULT
+CTimeBudgetTest::EresUnittest()
+{
+	CUnittest rgut[] = {
+		GPOS_UNITTEST_FUNC(EresUnittest_RunTests),
+	};
+
+	GPOS_RESULT eres = CUnittest::EresExecute(rgut, GPOS_ARRAY_SIZE(rgut));
+
+	// reset metadata cache
+	CMDCache::Reset();
+
+	return eres;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CTimeBudgetTest::EresUnittest_RunTests
+//
+//	@doc:
+//		Optimize minidumps under a time budget; a budget that expires before
+//		the search completes must still produce a plan, and must be reported
+//		in the enumerator config
+//
+//---------------------------------------------------------------------------
+GPOS_RESULT
+CTimeBudgetTest::EresUnittest_RunTests()
+{
+	STimeBudgetTestCase rgtc[] = {
+		{"../data/dxl/minidump/TPCH-Partitioned-256GB.mdp", 1 /*ulTimeBudget*/,
+		 true /*fExpectExpired*/},
+		{"../data/dxl/minidump/TPCH-Partitioned-256GB.mdp", 0 /*ulTimeBudget*/,
+		 false /*fExpectExpired*/},
+		{"../data/dxl/minidump/TPCH-Partitioned-256GB.mdp", 3600000 /*ulTimeBudget*/,
+		 false /*fExpectExpired*/},
+	};
+
+	CAutoMemoryPool amp(CAutoMemoryPool::ElcNone);
+	CMemoryPool *mp = amp.Pmp();
+
+	GPOS_RESULT eres = GPOS_OK;
+	const ULONG ulTests = GPOS_ARRAY_SIZE(rgtc);
+	for (ULONG ul = m_ulTimeBudgetTestCounter;
+		 ((ul < ulTests) && (GPOS_OK == eres)); ul++)
+	{
+		STimeBudgetTestCase testCase = rgtc[ul];
+		ICostModel *pcm = CTestUtils::GetCostModel(mp);
+
+		CHint *phint = GPOS_NEW(mp) CHint(
+			gpos::int_max, /* join_arity_for_associativity_commutativity */
+			gpos::int_max, /* array_expansion_threshold */
+			JOIN_ORDER_DP_THRESHOLD,			 /*ulJoinOrderDPLimit*/
+			BROADCAST_THRESHOLD,				 /*broadcast_threshold*/
+			true,								 /* enforce_constraint_on_dml */
+			PUSH_GROUP_BY_BELOW_SETOP_THRESHOLD, /* push_group_by_below_setop_threshold */
+			XFORM_BIND_THRESHOLD,				 /* xform_bind_threshold */
+			SKEW_FACTOR,						 /* skew_factor */
+			testCase.m_ulTimeBudget				 /* time_budget */
+		);
+
+		COptimizerConfig *optimizer_config = GPOS_NEW(mp) COptimizerConfig(
+			CEnumeratorConfig::GetEnumeratorCfg(mp, 0 /*plan_id*/),
+			CStatisticsConfig::PstatsconfDefault(mp),
+			CCTEConfig::PcteconfDefault(mp), pcm, phint,
+			nullptr /* pplanhint */, CWindowOids::GetWindowOids(mp));
+
+		CDXLNode *pdxlnPlan = CMinidumperUtils::PdxlnExecuteMinidump(
+			mp, testCase.m_szInputFile, GPOPT_TEST_SEGMENTS /*ulSegments*/,
+			1 /*ulSessionId*/, 1,	  /*ulCmdId*/
+			optimizer_config, nullptr /*pceeval*/
+		);
+
+		BOOL fExpired =
+			optimizer_config->GetEnumeratorCfg()->FTimeBudgetExpired();
+		if (nullptr == pdxlnPlan || fExpired != testCase.m_fExpectExpired)
+		{
+			CWStringDynamic str(mp);
+			COstreamString oss(&str);
+
+			oss << std::endl
+				<< "Time budget: " << testCase.m_ulTimeBudget << "ms"
+				<< std::endl
+				<< "Plan found: " << (nullptr != pdxlnPlan) << std::endl
+				<< "Expected budget to expire: " << testCase.m_fExpectExpired
+				<< std::endl
+				<< "Budget expired: " << fExpired << std::endl;
+
+			GPOS_TRACE(str.GetBuffer());
+			eres = GPOS_FAILED;
+		}
+
+		GPOS_CHECK_ABORT;
+		optimizer_config->Release();
+		CRefCount::SafeRelease(pdxlnPlan);
+
+		m_ulTimeBudgetTestCounter++;
+	}
+
+	if (GPOS_OK == eres)
+	{
+		m_ulTimeBudgetTestCounter = 0;
+	}
+
+	return eres;
+}
+
+// EOF
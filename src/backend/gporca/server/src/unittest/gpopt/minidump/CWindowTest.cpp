@@ -38,6 +38,9 @@ CWindowTest::EresUnittest()
 		"../data/dxl/minidump/WindowFrameExcludeCurrentRow.mdp",
 		"../data/dxl/minidump/WindowFrameRangePrecedingAndFollowing.mdp",
 		"../data/dxl/minidump/WindowFrameGroups.mdp",
+		"../data/dxl/minidump/WindowRank-LocalFilter.mdp",
+		"../data/dxl/minidump/WindowRank-LocalFilter-Rank.mdp",
+		"../data/dxl/minidump/WindowRank-LocalFilter-Off.mdp",
 	};
 
 	return CTestUtils::EresUnittest_RunTestsWithoutAdditionalTraceFlags(
@@ -152,6 +152,7 @@ _copyPlannedStmt(const PlannedStmt *from)
 	COPY_NODE_FIELD(refreshClause);
 	COPY_SCALAR_FIELD(metricsQueryType);
 	COPY_NODE_FIELD(extensionContext);
+	COPY_NODE_FIELD(optimizerProfile);
 
 	return newnode;
 }
@@ -261,6 +262,7 @@ CopyPlanFields(const Plan *from, Plan *newnode)
 	COPY_SCALAR_FIELD(parallel);
 
 	COPY_SCALAR_FIELD(operatorMemKB);
+	COPY_SCALAR_FIELD(cardinality_fingerprint);
 }
 
 /*
@@ -1743,6 +1745,8 @@ _copyMotion(const Motion *from)
 
 	COPY_NODE_FIELD(hashExprs);
 	COPY_POINTER_FIELD(hashFuncs, list_length(from->hashExprs) * sizeof(Oid));
+	COPY_NODE_FIELD(hashSkewValues);
+	COPY_SCALAR_FIELD(hashSkewBroadcast);
 
 	COPY_SCALAR_FIELD(numSortCols);
 	COPY_POINTER_FIELD(sortColIdx, from->numSortCols * sizeof(AttrNumber));
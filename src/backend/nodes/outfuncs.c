@@ -385,6 +385,7 @@ _outPlannedStmt(StringInfo str, const PlannedStmt *node)
 	WRITE_NODE_FIELD(refreshClause);
 	WRITE_INT_FIELD(metricsQueryType);
 	WRITE_NODE_FIELD(extensionContext);
+	WRITE_NODE_FIELD(optimizerProfile);
 
 }
 
@@ -415,6 +416,7 @@ _outPlanInfo(StringInfo str, const Plan *node)
 #endif /* COMPILING_BINARY_FUNCS */
 
 	WRITE_UINT64_FIELD(operatorMemKB);
+	WRITE_UINT64_FIELD(cardinality_fingerprint);
 }
 
 /*
@@ -414,6 +414,8 @@ _outMotion(StringInfo str, const Motion *node)
 
 	WRITE_NODE_FIELD(hashExprs);
 	WRITE_OID_ARRAY(hashFuncs, list_length(node->hashExprs));
+	WRITE_NODE_FIELD(hashSkewValues);
+	WRITE_BOOL_FIELD(hashSkewBroadcast);
 	WRITE_INT_FIELD(numSortCols);
 	WRITE_ATTRNUMBER_ARRAY(sortColIdx, node->numSortCols);
 	WRITE_INT_ARRAY(sortOperators, node->numSortCols);
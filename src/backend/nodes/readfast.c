@@ -1030,6 +1030,8 @@ _readMotion(void)
 
 	READ_NODE_FIELD(hashExprs);
 	READ_OID_ARRAY(hashFuncs, list_length(local_node->hashExprs));
+	READ_NODE_FIELD(hashSkewValues);
+	READ_BOOL_FIELD(hashSkewBroadcast);
 
 	READ_INT_FIELD(numSortCols);
 	READ_ATTRNUMBER_ARRAY(sortColIdx, local_node->numSortCols);
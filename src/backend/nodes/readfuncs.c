@@ -1665,6 +1665,7 @@ _readPlannedStmt(void)
 	READ_NODE_FIELD(refreshClause);
 	READ_INT_FIELD(metricsQueryType);
 	READ_NODE_FIELD(extensionContext);
+	READ_NODE_FIELD(optimizerProfile);
 
 	READ_DONE();
 }
@@ -1699,6 +1700,7 @@ ReadCommonPlan(Plan *local_node)
 #endif /* COMPILING_BINARY_FUNCS */
 
 	READ_UINT64_FIELD(operatorMemKB);
+	READ_UINT64_FIELD(cardinality_fingerprint);
 }
 
 /*
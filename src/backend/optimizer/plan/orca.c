@@ -21,10 +21,12 @@
 
 #include "postgres.h"
 
+#include "cdb/cdbexplain.h"
 #include "cdb/cdbmutate.h"		/* apply_shareinput */
 #include "cdb/cdbplan.h"
 #include "cdb/cdbvars.h"
 #include "nodes/makefuncs.h"
+#include "nodes/nodeFuncs.h"
 #include "optimizer/clauses.h"
 #include "optimizer/optimizer.h"
 #include "optimizer/orca.h"
@@ -40,13 +42,15 @@
 #include "utils/guc.h"
 #include "utils/lsyscache.h"
 
-/* GPORCA entry point */
+/* GPORCA entry points */
 extern PlannedStmt * GPOPTOptimizedPlan(Query *parse, bool *had_unexpected_failure);
+extern void GPOPTRecordCardinalityFeedback(uint64 fingerprint, double rows);
 
 static Plan *remove_redundant_results(PlannerInfo *root, Plan *plan);
 static Node *remove_redundant_results_mutator(Node *node, void *);
 static bool can_replace_tlist(Plan *plan);
 static Node *push_down_expr_mutator(Node *node, List *child_tlist);
+static bool record_cardinality_feedback_walker(PlanState *planstate, void *context);
 
 /*
  * Logging of optimization outcome
@@ -281,6 +285,38 @@ optimize_query(Query *parse, int cursorOptions, ParamListInfo boundParams)
 	return result;
 }
 
+/*
+ * record_cardinality_feedback
+ *		Report the rows produced by the nodes of an executed GPORCA plan back
+ *		to GPORCA, so that later optimizations of the same subexpressions
+ *		can use them instead of their estimates
+ *
+ * Must be called on the QD after cdbexplain_recvExecStats(), only the nodes
+ * executed by QEs have statistics then.
+ */
+void
+record_cardinality_feedback(PlanState *planstate)
+{
+	record_cardinality_feedback_walker(planstate, NULL);
+}
+
+static bool
+record_cardinality_feedback_walker(PlanState *planstate, void *context)
+{
+	double		rows;
+
+	if (planstate == NULL)
+		return false;
+
+	if (planstate->plan->cardinality_fingerprint != 0 &&
+		cdbexplain_getNodeRows(planstate, &rows))
+		GPOPTRecordCardinalityFeedback(planstate->plan->cardinality_fingerprint,
+									   rows);
+
+	return planstate_tree_walker(planstate, record_cardinality_feedback_walker,
+								 context);
+}
+
 /*
  * ORCA tends to generate gratuitous Result nodes for various reasons. We
  * try to clean it up here, as much as we can, by eliminating the Results
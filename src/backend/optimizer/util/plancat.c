@@ -1655,6 +1655,39 @@ GetExtStatisticsKinds(Oid statOid)
 	return types;
 }
 
+/*
+ *	GetExtStatisticsKeys
+ *
+ * Retrieve the attribute numbers of the columns of an extended statistic
+ * object. They are sorted, which is also the order of the dimensions of its
+ * MCV list. Returns NIL if the object is also defined on expressions, whose
+ * dimensions don't map to columns.
+ */
+List *
+GetExtStatisticsKeys(Oid statOid)
+{
+	Form_pg_statistic_ext staForm;
+	HeapTuple	htup;
+	List	   *keys = NIL;
+	int			i;
+
+	htup = SearchSysCache1(STATEXTOID, ObjectIdGetDatum(statOid));
+	if (!HeapTupleIsValid(htup))
+		elog(ERROR, "cache lookup failed for statistics object %u", statOid);
+
+	staForm = (Form_pg_statistic_ext) GETSTRUCT(htup);
+
+	if (heap_attisnull(htup, Anum_pg_statistic_ext_stxexprs, NULL))
+	{
+		for (i = 0; i < staForm->stxkeys.dim1; i++)
+			keys = lappend_int(keys, staForm->stxkeys.values[i]);
+	}
+
+	ReleaseSysCache(htup);
+
+	return keys;
+}
+
 /*
  * GetRelationExtStatistics
  *		GPDB: Interface to get_relation_statistics.
@@ -559,7 +559,7 @@ build_column_frequencies(SortItem *groups, int ngroups,
  *		Load the MCV list for the indicated pg_statistic_ext tuple.
  */
 MCVList *
-statext_mcv_load(Oid mvoid)
+statext_mcv_load(Oid mvoid, bool allow_null)
 {
 	MCVList    *result;
 	bool		isnull;
@@ -573,9 +573,15 @@ statext_mcv_load(Oid mvoid)
 							  Anum_pg_statistic_ext_data_stxdmcv, &isnull);
 
 	if (isnull)
-		elog(ERROR,
-			 "requested statistics kind \"%c\" is not yet built for statistics object %u",
-			 STATS_EXT_DEPENDENCIES, mvoid);
+	{
+		if (!allow_null)
+			elog(ERROR,
+				 "requested statistics kind \"%c\" is not yet built for statistics object %u",
+				 STATS_EXT_DEPENDENCIES, mvoid);
+
+		ReleaseSysCache(htup);
+		return NULL;
+	}
 
 	result = statext_mcv_deserialize(DatumGetByteaP(mcvlist));
 
@@ -2044,7 +2050,7 @@ mcv_clauselist_selectivity(PlannerInfo *root, StatisticExtInfo *stat,
 	bool	   *matches = NULL;
 
 	/* load the MCV list stored in the statistics object */
-	mcv = statext_mcv_load(stat->statOid);
+	mcv = statext_mcv_load(stat->statOid, false);
 
 	/* build a match bitmap for the clauses */
 	matches = mcv_get_match_bitmap(root, clauses, stat->keys, stat->exprs,
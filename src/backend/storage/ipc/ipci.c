@@ -62,6 +62,7 @@
 #include "utils/faultinjector.h"
 #include "utils/sharedsnapshot.h"
 #include "utils/gpexpand.h"
+#include "utils/orcamdcache.h"
 #include "utils/snapmgr.h"
 
 #include "libpq-fe.h"
@@ -234,6 +235,9 @@ CreateSharedMemoryAndSemaphores(void)
 		/* size of expand version */
 		size = add_size(size, GpExpandVersionShmemSize());
 
+		/* size of the shared ORCA metadata cache snapshot */
+		size = add_size(size, OrcaMDCacheShmemSize());
+
 		/* size of token and endpoint shared memory */
 		size = add_size(size, EndpointShmemSize());
 #ifndef USE_INTERNAL_FTS
@@ -400,6 +404,7 @@ CreateSharedMemoryAndSemaphores(void)
 		InstrShmemInit();
 
 	GpExpandVersionShmemInit();
+	OrcaMDCacheShmemInit();
 	KmgrShmemInit();
 
 #ifdef EXEC_BACKEND
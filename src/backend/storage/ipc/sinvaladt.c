@@ -177,6 +177,13 @@ typedef struct SISeg
 
 	slock_t		msgnumLock;		/* spinlock protecting maxMsgNum */
 
+	/*
+	 * GPDB: total number of messages ever inserted. Unlike maxMsgNum, it is
+	 * not adjusted on wraparound, so it can serve as a version number of the
+	 * catalog caches. Protected by msgnumLock like maxMsgNum.
+	 */
+	uint64		numMsgsInserted;
+
 	/*
 	 * Circular buffer holding shared-inval messages
 	 */
@@ -229,6 +236,7 @@ CreateSharedInvalidationState(void)
 	/* Clear message counters, save size of procState array, init spinlock */
 	shmInvalBuffer->minMsgNum = 0;
 	shmInvalBuffer->maxMsgNum = 0;
+	shmInvalBuffer->numMsgsInserted = 0;
 	shmInvalBuffer->nextThreshold = CLEANUP_MIN;
 	shmInvalBuffer->lastBackend = 0;
 	shmInvalBuffer->maxBackends = MaxBackends;
@@ -483,6 +491,7 @@ SIInsertDataEntries(const SharedInvalidationMessage *data, int n)
 
 		/* Update current value of maxMsgNum using spinlock */
 		SpinLockAcquire(&segP->msgnumLock);
+		segP->numMsgsInserted += max - segP->maxMsgNum;
 		segP->maxMsgNum = max;
 		SpinLockRelease(&segP->msgnumLock);
 
@@ -504,6 +513,26 @@ SIInsertDataEntries(const SharedInvalidationMessage *data, int n)
 	}
 }
 
+/*
+ * SIGetNumMessagesInserted
+ *		Return the total number of messages inserted since startup.
+ *
+ * GPDB: a caller that reads this before calling AcceptInvalidationMessages()
+ * is guaranteed to have processed every message counted by the result.
+ */
+uint64
+SIGetNumMessagesInserted(void)
+{
+	SISeg	   *segP = shmInvalBuffer;
+	uint64		result;
+
+	SpinLockAcquire(&segP->msgnumLock);
+	result = segP->numMsgsInserted;
+	SpinLockRelease(&segP->msgnumLock);
+
+	return result;
+}
+
 /*
  * SIGetDataEntries
  *		get next SI message(s) for current backend, if there are any
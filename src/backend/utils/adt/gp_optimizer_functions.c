@@ -8,11 +8,14 @@
  *
  * gp_opt_version: This function wraps LibraryVersion. 
  *
+ * gp_orca_plan_cache_stats: This function wraps PlanCacheStats.
+ *
  * Copyright(c) 2012 - present, EMC/Greenplum
  */
 
 #include "postgres.h"
 
+#include "access/htup_details.h"
 #include "funcapi.h"
 #include "utils/builtins.h"
 #include "optimizer/planner.h"
@@ -85,3 +88,36 @@ gp_opt_version(PG_FUNCTION_ARGS pg_attribute_unused())
 	return CStringGetTextDatum("Server has been compiled without ORCA");
 #endif
 }
+
+extern void PlanCacheStats(int64 *hits, int64 *misses, int64 *entries,
+						   int64 *size);
+
+/*
+* Returns the statistics of the optimizer plan cache of the current session.
+*/
+Datum
+gp_orca_plan_cache_stats(PG_FUNCTION_ARGS)
+{
+	TupleDesc	tupdesc;
+	Datum		values[4];
+	bool		nulls[4];
+	int64		hits = 0;
+	int64		misses = 0;
+	int64		entries = 0;
+	int64		size = 0;
+
+	if (get_call_result_type(fcinfo, NULL, &tupdesc) != TYPEFUNC_COMPOSITE)
+		elog(ERROR, "return type must be a row type");
+
+#ifdef USE_ORCA
+	PlanCacheStats(&hits, &misses, &entries, &size);
+#endif
+
+	MemSet(nulls, 0, sizeof(nulls));
+	values[0] = Int64GetDatum(hits);
+	values[1] = Int64GetDatum(misses);
+	values[2] = Int64GetDatum(entries);
+	values[3] = Int64GetDatum(size);
+
+	PG_RETURN_DATUM(HeapTupleGetDatum(heap_form_tuple(tupdesc, values, nulls)));
+}
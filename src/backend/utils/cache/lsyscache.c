@@ -2094,6 +2094,36 @@ is_agg_partial_capable(Oid aggid)
 	return result;
 }
 
+/*
+ * is_agg_rollup_capable
+ *		Given aggregate id, check if its results can be aggregated again
+ *		by combining them, as if they were partial aggregation results.
+ *
+ * It must have a combine function and no final function, and the
+ * transition type must not be 'internal'.
+ */
+bool
+is_agg_rollup_capable(Oid aggid)
+{
+	HeapTuple	aggTuple;
+	Form_pg_aggregate aggform;
+	bool		result;
+
+	aggTuple = SearchSysCache1(AGGFNOID,
+							   ObjectIdGetDatum(aggid));
+	if (!HeapTupleIsValid(aggTuple))
+		elog(ERROR, "cache lookup failed for aggregate %u", aggid);
+	aggform = (Form_pg_aggregate) GETSTRUCT(aggTuple);
+
+	result = (aggform->aggcombinefn != InvalidOid &&
+			  aggform->aggfinalfn == InvalidOid &&
+			  aggform->aggtranstype != INTERNALOID);
+
+	ReleaseSysCache(aggTuple);
+
+	return result;
+}
+
 /*
  * get_rel_relisivm
  *
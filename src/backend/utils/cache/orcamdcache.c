@@ -0,0 +1,195 @@
+/*-------------------------------------------------------------------------
+ *
+ * orcamdcache.c
+ *	  Shared snapshot of the ORCA metadata cache.
+ *
+ * The ORCA metadata cache lives in the memory of each backend, so a new
+ * session has to translate all the metadata it needs from the relcache and
+ * syscaches again. To let new sessions start with a warm cache, a backend
+ * publishes the serialized contents of its metadata cache into a fixed-size
+ * area of shared memory, from which a new backend loads it before planning
+ * its first query.
+ *
+ * The snapshot is versioned by the number of shared invalidation messages
+ * ever inserted (see SIGetNumMessagesInserted()). The publishing backend
+ * reads that number before accepting invalidation messages and evicting the
+ * affected entries from its cache, so its cache reflects at least all the
+ * catalog changes counted by the version. A backend only loads a snapshot
+ * whose version equals the current number of messages: no catalog change has
+ * been announced since the snapshot was taken, and anything announced later
+ * will be processed by the loading backend like any other invalidation.
+ *
+ * A backend whose transaction has an xid may have changed the catalog, and
+ * its caches then reflect changes no other session can see. If the
+ * transaction rolls back, no shared invalidation message is sent, so the
+ * version would not tell other sessions that the snapshot is wrong. Such a
+ * backend neither publishes nor loads a snapshot.
+ *
+ * There is a single snapshot slot. It is replaced by a snapshot with a newer
+ * version, or by a larger snapshot with the same version.
+ *
+ *
+ * Copyright (c) 2023 VMware, Inc. or its affiliates.
+ *
+ * IDENTIFICATION
+ *	    src/backend/utils/cache/orcamdcache.c
+ *
+ *-------------------------------------------------------------------------
+ */
+#include "postgres.h"
+
+#include "access/transam.h"
+#include "access/xact.h"
+#include "miscadmin.h"
+#include "storage/lwlock.h"
+#include "storage/shmem.h"
+#include "storage/sinvaladt.h"
+#include "utils/guc.h"
+#include "utils/orcamdcache.h"
+
+typedef struct OrcaMDCacheSnapshot
+{
+	uint64		version;		/* invalidation message count at snapshot */
+	Oid			dbid;			/* database the snapshot was taken in */
+	Size		size;			/* bytes used in data[], 0 if no snapshot */
+	char		data[FLEXIBLE_ARRAY_MEMBER];
+} OrcaMDCacheSnapshot;
+
+static OrcaMDCacheSnapshot *orcaMDCacheSnapshot = NULL;
+
+/* capacity of the data[] array of the snapshot */
+static Size
+OrcaMDCacheCapacity(void)
+{
+	return (Size) optimizer_mdcache_shared_size * 1024;
+}
+
+Size
+OrcaMDCacheShmemSize(void)
+{
+	if (optimizer_mdcache_shared_size <= 0)
+		return 0;
+
+	return add_size(offsetof(OrcaMDCacheSnapshot, data), OrcaMDCacheCapacity());
+}
+
+void
+OrcaMDCacheShmemInit(void)
+{
+	bool		found;
+
+	if (optimizer_mdcache_shared_size <= 0)
+		return;
+
+	orcaMDCacheSnapshot = (OrcaMDCacheSnapshot *)
+		ShmemInitStruct("ORCA metadata cache snapshot", OrcaMDCacheShmemSize(),
+						&found);
+	if (!found)
+	{
+		orcaMDCacheSnapshot->version = 0;
+		orcaMDCacheSnapshot->dbid = InvalidOid;
+		orcaMDCacheSnapshot->size = 0;
+	}
+}
+
+/*
+ * Is the shared snapshot of the metadata cache configured?
+ */
+bool
+OrcaMDCacheSnapshotEnabled(void)
+{
+	return orcaMDCacheSnapshot != NULL;
+}
+
+/*
+ * Can the current transaction see its own uncommitted catalog changes?
+ *
+ * Catalog changes assign an xid, so a transaction without one has made none.
+ */
+static bool
+OrcaMDCacheInCatalogChangingXact(void)
+{
+	return TransactionIdIsValid(GetTopTransactionIdIfAny());
+}
+
+/*
+ * Return the current catalog version a snapshot is compared against.
+ *
+ * Must be called before AcceptInvalidationMessages() when publishing.
+ */
+uint64
+OrcaMDCacheGetVersion(void)
+{
+	return SIGetNumMessagesInserted();
+}
+
+/*
+ * Return a palloc'd copy of the snapshot taken in the current database, if
+ * it is consistent with the given catalog version. Returns NULL otherwise.
+ */
+char *
+OrcaMDCacheFetchSnapshot(uint64 version, Size *size)
+{
+	char	   *result = NULL;
+
+	Assert(size != NULL);
+	*size = 0;
+
+	if (!OrcaMDCacheSnapshotEnabled() || OrcaMDCacheInCatalogChangingXact())
+		return NULL;
+
+	LWLockAcquire(OrcaMDCacheLock, LW_SHARED);
+
+	if (orcaMDCacheSnapshot->size > 0 &&
+		orcaMDCacheSnapshot->version == version &&
+		orcaMDCacheSnapshot->dbid == MyDatabaseId)
+	{
+		/* don't error out while holding the lock */
+		result = palloc_extended(orcaMDCacheSnapshot->size,
+								 MCXT_ALLOC_NO_OOM);
+		if (result != NULL)
+		{
+			memcpy(result, orcaMDCacheSnapshot->data,
+				   orcaMDCacheSnapshot->size);
+			*size = orcaMDCacheSnapshot->size;
+		}
+	}
+
+	LWLockRelease(OrcaMDCacheLock);
+
+	return result;
+}
+
+/*
+ * Publish a snapshot consistent with the given catalog version.
+ *
+ * Returns false if the snapshot does not fit, if the stored snapshot is
+ * newer or larger, or if the current transaction may have changed the
+ * catalog.
+ */
+bool
+OrcaMDCacheStoreSnapshot(uint64 version, const char *data, Size size)
+{
+	bool		stored = false;
+
+	if (!OrcaMDCacheSnapshotEnabled() || size == 0 ||
+		size > OrcaMDCacheCapacity() || OrcaMDCacheInCatalogChangingXact())
+		return false;
+
+	LWLockAcquire(OrcaMDCacheLock, LW_EXCLUSIVE);
+
+	if (version > orcaMDCacheSnapshot->version ||
+		(version == orcaMDCacheSnapshot->version &&
+		 size > orcaMDCacheSnapshot->size))
+	{
+		memcpy(orcaMDCacheSnapshot->data, data, size);
+		orcaMDCacheSnapshot->version = version;
+		orcaMDCacheSnapshot->dbid = MyDatabaseId;
+		orcaMDCacheSnapshot->size = size;
+		stored = true;
+	}
+
+	LWLockRelease(OrcaMDCacheLock);
+
+	return stored;
+}
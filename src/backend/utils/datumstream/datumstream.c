@@ -1489,6 +1489,48 @@ datumstreamread_find(DatumStreamRead * datumStream,
 	Assert(rowNumInBlock == DatumStreamBlockRead_Nth(&datumStream->blockRead));
 }
 
+/*
+ * Move a sequential read forward to the given row of the current segment
+ * file. The blocks in between are skipped after reading their header only,
+ * so their content is never read nor decompressed. Returns false if the
+ * file ends before the row.
+ */
+bool
+datumstreamread_skip_to_row(DatumStreamRead * acc, int64 rowNum)
+{
+	Assert(acc);
+
+	while (rowNum >= acc->blockFirstRowNum + acc->blockRowCount)
+	{
+		int64		nextFirstRowNum = acc->blockFirstRowNum + acc->blockRowCount;
+
+		if (!datumstreamread_block_info(acc))
+			return false;
+
+		/*
+		 * Pre-4.0 blocks do not store firstRowNum and their rowCnt may not
+		 * be valid, so we need to read the block content to know which rows
+		 * it holds. See datumstreamread_block().
+		 */
+		if (acc->getBlockInfo.firstRow < 0)
+		{
+			acc->blockFirstRowNum = nextFirstRowNum;
+			datumstreamread_block_content(acc);
+			continue;
+		}
+
+		if (rowNum < acc->blockFirstRowNum + acc->blockRowCount)
+			datumstreamread_block_content(acc);
+		else
+			AppendOnlyStorageRead_SkipCurrentBlock(&acc->ao_read);
+	}
+
+	Assert(rowNum >= acc->blockFirstRowNum);
+	datumstreamread_find(acc, (int32) (rowNum - acc->blockFirstRowNum));
+
+	return true;
+}
+
 /*
  * Find the block that contains the given row.
  */
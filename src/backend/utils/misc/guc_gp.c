@@ -293,10 +293,18 @@ bool		optimizer_control = true;
 bool		optimizer_trace_fallback;
 bool		optimizer_partition_selection_log;
 int			optimizer_minidump;
+bool		optimizer_minidump_binary;
 int			optimizer_cost_model;
 bool		optimizer_metadata_caching;
 int			optimizer_mdcache_size;
+int			optimizer_mdcache_shared_size;
+bool		optimizer_plan_caching;
+int			optimizer_plan_cache_size;
+bool		optimizer_cardinality_feedback;
+int			optimizer_cardinality_feedback_entries;
+int			optimizer_cardinality_feedback_max_age;
 bool		optimizer_use_gpdb_allocators;
+bool		optimizer_use_arena_memory_pool;
 
 /* Optimizer debugging GUCs */
 bool		optimizer_print_query;
@@ -311,6 +319,7 @@ bool		optimizer_print_group_properties;
 bool		optimizer_print_optimization_context;
 bool		optimizer_print_optimization_stats;
 bool		optimizer_print_xform_results;
+bool		optimizer_collect_profile;
 
 /* array of xforms disable flags */
 bool		optimizer_xforms[OPTIMIZER_XFORMS_COUNT] = {[0 ... OPTIMIZER_XFORMS_COUNT - 1] = false};
@@ -356,6 +365,9 @@ bool		optimizer_enable_hashagg;
 bool		optimizer_enable_groupagg;
 bool		optimizer_expand_fulljoin;
 bool		optimizer_enable_mergejoin;
+bool		optimizer_enable_inner_outer_mergejoin;
+bool		optimizer_enable_memoize;
+bool		optimizer_enable_incremental_sort;
 bool		optimizer_enable_redistribute_nestloop_loj_inner_child;
 bool		optimizer_force_comprehensive_join_implementation;
 bool		optimizer_enable_replicated_table;
@@ -396,11 +408,13 @@ int			optimizer_cte_inlining_bound;
 int			optimizer_push_group_by_below_setop_threshold;
 int			optimizer_xform_bind_threshold;
 int			optimizer_skew_factor;
+int			optimizer_time_budget;
 bool		optimizer_force_multistage_agg;
 bool		optimizer_force_three_stage_scalar_dqa;
 bool		optimizer_force_expanded_distinct_aggs;
 bool		optimizer_force_agg_skew_avoidance;
 bool		optimizer_penalize_skew;
+bool		optimizer_enable_hybrid_redistribute;
 bool		optimizer_prune_computed_columns;
 bool		optimizer_push_requirements_from_consumer_to_producer;
 bool		optimizer_enforce_subplans;
@@ -412,11 +426,13 @@ bool 		optimizer_parallel_union;
 bool		optimizer_array_constraints;
 bool		optimizer_cte_inlining;
 bool		optimizer_enable_space_pruning;
+bool		optimizer_enable_global_space_pruning;
 bool		optimizer_enable_associativity;
 bool		optimizer_enable_eageragg;
 bool		optimizer_enable_range_predicate_dpe;
 bool		optimizer_enable_use_distribution_in_dqa;
 bool		optimizer_enable_push_join_below_union_all;
+bool		optimizer_enable_window_rank_pushdown;
 bool		optimizer_enable_orderedagg;
 
 /* Analyze related GUCs for Optimizer */
@@ -457,6 +473,7 @@ bool		gp_external_enable_filter_pushdown = true;
 bool		gp_enable_global_deadlock_detector = false;
 
 bool gp_enable_predicate_pushdown;
+bool gp_enable_aocs_late_materialize = false;
 int  gp_predicate_pushdown_sample_rows;
 
 bool        enable_offload_entry_to_qe = false;
@@ -703,6 +720,15 @@ struct config_bool ConfigureNamesBool_gp[] =
 		&gp_enable_predicate_pushdown,
 		true, NULL, NULL
 	},
+	{
+		{"gp_enable_aocs_late_materialize", PGC_USERSET, DEVELOPER_OPTIONS,
+			gettext_noop("Read the non-qual columns of an AOCS scan only for the rows passing the pushed down quals."),
+			NULL,
+			GUC_NO_SHOW_ALL | GUC_NOT_IN_SAMPLE
+		},
+		&gp_enable_aocs_late_materialize,
+		false, NULL, NULL
+	},
 	{
 		{"debug_print_prelim_plan", PGC_USERSET, LOGGING_WHAT,
 			gettext_noop("Prints the preliminary execution plan to server log."),
@@ -1986,6 +2012,26 @@ struct config_bool ConfigureNamesBool_gp[] =
 		NULL, NULL, NULL
 	},
 
+	{
+		{"optimizer_plan_caching", PGC_USERSET, QUERY_TUNING_METHOD,
+			gettext_noop("This guc enables the optimizer to cache and reuse plans of identical queries."),
+			NULL
+		},
+		&optimizer_plan_caching,
+		false,
+		NULL, NULL, NULL
+	},
+
+	{
+		{"optimizer_cardinality_feedback", PGC_USERSET, QUERY_TUNING_METHOD,
+			gettext_noop("This guc enables the optimizer to correct its row estimates with the rows observed when executing earlier plans."),
+			gettext_noop("Rows are only observed when the executor collects instrumentation, such as for EXPLAIN ANALYZE.")
+		},
+		&optimizer_cardinality_feedback,
+		false,
+		NULL, NULL, NULL
+	},
+
 	{
 		{"optimizer_print_missing_stats", PGC_USERSET, LOGGING_WHAT,
 			gettext_noop("Print columns with missing statistics."),
@@ -2008,6 +2054,30 @@ struct config_bool ConfigureNamesBool_gp[] =
 		NULL, NULL, NULL
 	},
 
+	{
+		{"optimizer_collect_profile", PGC_USERSET, LOGGING_WHAT,
+			gettext_noop("Collect optimizer search counters and show them in EXPLAIN VERBOSE."),
+			gettext_noop("Counts and times transformations, optimizer jobs, "
+						 "memo groups, statistics derivation and metadata lookups."),
+			GUC_NOT_IN_SAMPLE
+		},
+		&optimizer_collect_profile,
+		false,
+		NULL, NULL, NULL
+	},
+
+	{
+		{"optimizer_minidump_binary", PGC_USERSET, LOGGING_WHAT,
+			gettext_noop("Write optimizer minidumps in the compact binary DXL format."),
+			gettext_noop("Binary minidumps are smaller and faster to write; "
+						 "they are read back like XML ones."),
+			GUC_NOT_IN_SAMPLE
+		},
+		&optimizer_minidump_binary,
+		false,
+		NULL, NULL, NULL
+	},
+
 	{
 		{"optimizer_print_memo_after_exploration", PGC_USERSET, LOGGING_WHAT,
 			gettext_noop("Print optimizer memo structure after the exploration phase."),
@@ -2275,6 +2345,16 @@ struct config_bool ConfigureNamesBool_gp[] =
 		true,
 		NULL, NULL, NULL
 	},
+	{
+		{"optimizer_enable_global_space_pruning", PGC_USERSET, DEVELOPER_OPTIONS,
+			gettext_noop("Prune plan alternatives that cannot beat the best complete plan found so far."),
+			NULL,
+			GUC_NO_SHOW_ALL | GUC_NOT_IN_SAMPLE
+		},
+		&optimizer_enable_global_space_pruning,
+		false,
+		NULL, NULL, NULL
+	},
 
 	{
 		{"optimizer_enable_master_only_queries", PGC_USERSET, DEVELOPER_OPTIONS,
@@ -2419,6 +2499,17 @@ struct config_bool ConfigureNamesBool_gp[] =
 		NULL, NULL, NULL
 	},
 
+	{
+		{"optimizer_enable_hybrid_redistribute", PGC_USERSET, QUERY_TUNING_METHOD,
+			gettext_noop("Spread or broadcast the most common values of a hash join key instead of redistributing them."),
+			NULL,
+			GUC_NO_SHOW_ALL | GUC_NOT_IN_SAMPLE
+		},
+		&optimizer_enable_hybrid_redistribute,
+		false,
+		NULL, NULL, NULL
+	},
+
 	{
 		{"optimizer_multilevel_partitioning", PGC_USERSET, DEVELOPER_OPTIONS,
 			gettext_noop("Enable optimization of queries on multilevel partitioned tables."),
@@ -2546,6 +2637,36 @@ struct config_bool ConfigureNamesBool_gp[] =
 		true,
 		NULL, NULL, NULL
 	},
+	{
+		{"optimizer_enable_inner_outer_mergejoin", PGC_USERSET, DEVELOPER_OPTIONS,
+			gettext_noop("Enables the optimizer's support of inner and left outer merge joins."),
+			NULL,
+			GUC_NO_SHOW_ALL | GUC_NOT_IN_SAMPLE
+		},
+		&optimizer_enable_inner_outer_mergejoin,
+		false,
+		NULL, NULL, NULL
+	},
+	{
+		{"optimizer_enable_memoize", PGC_USERSET, DEVELOPER_OPTIONS,
+			gettext_noop("Enables the optimizer's support of caching the inner side of index nested loop joins."),
+			NULL,
+			GUC_NO_SHOW_ALL | GUC_NOT_IN_SAMPLE
+		},
+		&optimizer_enable_memoize,
+		false,
+		NULL, NULL, NULL
+	},
+	{
+		{"optimizer_enable_incremental_sort", PGC_USERSET, DEVELOPER_OPTIONS,
+			gettext_noop("Enables the optimizer's use of incremental sort steps."),
+			NULL,
+			GUC_NO_SHOW_ALL | GUC_NOT_IN_SAMPLE
+		},
+		&optimizer_enable_incremental_sort,
+		false,
+		NULL, NULL, NULL
+	},
 	{
 		{"optimizer_enable_streaming_material", PGC_USERSET, DEVELOPER_OPTIONS,
 			gettext_noop("Enable plans with a streaming material node in the optimizer."),
@@ -2815,6 +2936,17 @@ struct config_bool ConfigureNamesBool_gp[] =
 		NULL, NULL, NULL
 	},
 
+	{
+		{"optimizer_use_arena_memory_pool", PGC_USERSET, RESOURCES_MEM,
+			gettext_noop("Allocate ORCA optimization memory from an arena that is freed in bulk."),
+			NULL,
+			GUC_NOT_IN_SAMPLE
+		},
+		&optimizer_use_arena_memory_pool,
+		false,
+		NULL, NULL, NULL
+	},
+
 	{
 		{"vmem_process_interrupt", PGC_USERSET, DEVELOPER_OPTIONS,
 			gettext_noop("Checks for interrupts before reserving VMEM"),
@@ -3044,6 +3176,17 @@ struct config_bool ConfigureNamesBool_gp[] =
 		NULL, NULL, NULL
 	},
 
+	{
+		{"optimizer_enable_window_rank_pushdown", PGC_USERSET, DEVELOPER_OPTIONS,
+			gettext_noop("Enable filtering the top rows of each partition of a row_number or rank filter before redistributing them."),
+			NULL,
+			GUC_NOT_IN_SAMPLE
+		},
+		&optimizer_enable_window_rank_pushdown,
+		false,
+		NULL, NULL, NULL
+	},
+
 	{
 		{"gp_pause_on_restore_point_replay", PGC_SIGHUP, DEVELOPER_OPTIONS,
 		 gettext_noop("Pause recovery when a restore point is replayed."),
@@ -4385,6 +4528,18 @@ struct config_int ConfigureNamesInt_gp[] =
             NULL, NULL, NULL
     },
 
+	{
+		{"optimizer_time_budget", PGC_USERSET, QUERY_TUNING_METHOD,
+			gettext_noop("Time after which the optimizer returns the best plan found so far."),
+			gettext_noop("The budget only applies once a complete plan was found. "
+						 "A value of 0 disables it."),
+			GUC_UNIT_MS
+		},
+		&optimizer_time_budget,
+		0, 0, INT_MAX,
+		NULL, NULL, NULL
+	},
+
 	{
 		{"optimizer_join_order_threshold", PGC_USERSET, QUERY_TUNING_METHOD,
 			gettext_noop("Maximum number of join children to use dynamic programming based join ordering algorithm."),
@@ -4428,6 +4583,49 @@ struct config_int ConfigureNamesInt_gp[] =
 		NULL, NULL, NULL
 	},
 
+	{
+		{"optimizer_mdcache_shared_size", PGC_POSTMASTER, RESOURCES_MEM,
+			gettext_noop("Sets the size of the shared snapshot of MDCache new sessions start with."),
+			gettext_noop("0 disables the shared snapshot."),
+			GUC_UNIT_KB | GUC_NOT_IN_SAMPLE
+		},
+		&optimizer_mdcache_shared_size,
+		0, 0, MAX_KILOBYTES,
+		NULL, NULL, NULL
+	},
+
+	{
+		{"optimizer_plan_cache_size", PGC_USERSET, RESOURCES_MEM,
+			gettext_noop("Sets the size of the optimizer plan cache."),
+			NULL,
+			GUC_UNIT_KB
+		},
+		&optimizer_plan_cache_size,
+		16384, 0, INT_MAX,
+		NULL, NULL, NULL
+	},
+
+	{
+		{"optimizer_cardinality_feedback_entries", PGC_USERSET, QUERY_TUNING_METHOD,
+			gettext_noop("Sets the number of row counts the optimizer keeps as cardinality feedback."),
+			NULL
+		},
+		&optimizer_cardinality_feedback_entries,
+		4096, 0, INT_MAX / 2,
+		NULL, NULL, NULL
+	},
+
+	{
+		{"optimizer_cardinality_feedback_max_age", PGC_USERSET, QUERY_TUNING_METHOD,
+			gettext_noop("Sets the age after which the optimizer stops using an observed row count."),
+			gettext_noop("0 keeps observed row counts until they are replaced."),
+			GUC_UNIT_S
+		},
+		&optimizer_cardinality_feedback_max_age,
+		3600, 0, INT_MAX,
+		NULL, NULL, NULL
+	},
+
 	{
 		{"memory_profiler_dataset_size", PGC_USERSET, DEVELOPER_OPTIONS,
 			gettext_noop("Set the size in GB"),
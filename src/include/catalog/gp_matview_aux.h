@@ -90,4 +90,6 @@ extern bool MatviewIsGeneralyUpToDate(Oid mvoid);
 
 extern bool MatviewIsUpToDate(Oid mvoid);
 
+extern List *GetRelationUsableMatviews(Oid relid);
+
 #endif			/* GP_MATVIEW_AUX_H */
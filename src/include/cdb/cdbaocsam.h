@@ -203,6 +203,12 @@ typedef struct AOCSScanDescData
 	int				aos_scaned_rows;
 	int				*aos_qual_rows;
 
+	/*
+	 * Whether the columns not referenced by the pushed down quals are read
+	 * for the rows passing them only, decided when opening each segment.
+	 */
+	bool			aos_late_materialize;
+
 	/*
 	 * The total number of bytes read, compressed, across all segment files, and
 	 * across all columns projected, so far. It is used for scan progress reporting.
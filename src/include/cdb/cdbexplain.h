@@ -107,6 +107,15 @@ cdbexplain_recvExecStats(struct PlanState              *planstate,
                          int                            sliceIndex,
                          struct CdbExplain_ShowStatCtx *showstatctx);
 
+/*
+ * cdbexplain_getNodeRows
+ *    Called by qDisp after cdbexplain_recvExecStats() to get the average
+ *    number of rows a node produced per loop, summed over all the QEs that
+ *    executed it.  Returns false if no QE reported statistics for the node.
+ */
+bool
+cdbexplain_getNodeRows(struct PlanState *planstate, double *rows);
+
 /*
  * cdbexplain_showExecStatsBegin
  *    Called by qDisp process to create a CdbExplain_ShowStatCtx structure
@@ -40,6 +40,9 @@ public:
 	static void InitGPOPT();
 
 	static void TerminateGPOPT();
+
+	// record the rows an executed plan node produced as cardinality feedback
+	static void RecordCardinalityFeedback(uint64 fingerprint, double rows);
 };
 
 extern "C" {
@@ -49,6 +52,7 @@ extern PlannedStmt *GPOPTOptimizedPlan(Query *query,
 extern char *SerializeDXLPlan(Query *query);
 extern void InitGPOPT();
 extern void TerminateGPOPT();
+extern void GPOPTRecordCardinalityFeedback(uint64 fingerprint, double rows);
 }
 
 #endif	// CGPOptimizer_H
@@ -166,6 +166,17 @@ Oid ExprCollation(Node *expr);
 // expression collation - GPDB_91_MERGE_FIXME
 Oid TypeCollation(Oid type);
 
+// does the given collation sort strings bytewise
+bool CollationIsC(Oid collation);
+
+// bytes of a text, varchar or bpchar value that sort bytewise under the
+// C collation
+const char *TextSortKey(Oid type, Datum value, int *len);
+
+// dense ranks of the given values in the sort order of their type
+bool RankDatums(Oid type, Oid collation, Datum *values, int num_values,
+				int *ranks);
+
 // extract nodes with specific tag from a plan tree
 List *ExtractNodesPlan(Plan *pl, int node_tag, bool descend_into_subqueries);
 
@@ -195,6 +206,9 @@ bool IsRepSafeAgg(Oid aggid);
 // does aggregate have a combine function (and serial/deserial functions, if needed)
 bool IsAggPartialCapable(Oid aggid);
 
+// can aggregate results be combined again (no final function)
+bool IsAggRollupCapable(Oid aggid);
+
 // intermediate result type of given aggregate
 Oid GetAggregate(const char *agg, Oid type_oid);
 
@@ -211,11 +225,26 @@ void FreeAttrStatsSlot(AttStatsSlot *sslot);
 // attribute statistics
 HeapTuple GetAttStats(Oid relid, AttrNumber attnum);
 
+// registers of the HyperLogLog counter built by ANALYZE FULLSCAN, one byte
+// per register, from an attribute statistics tuple; null if there is none
+uint8 *GetAttStatsHLLRegisters(HeapTuple statstuple, int *precision);
+
 List *GetExtStats(Relation rel);
 
 char *GetExtStatsName(Oid statOid);
 List *GetExtStatsKinds(Oid statOid);
 
+// attnos of the columns of an extended statistic object, NIL if it is
+// also defined on expressions
+List *GetExtStatsKeys(Oid statOid);
+
+// oids of the materialized views over a relation that can answer queries
+// of the current user
+List *GetRelationUsableMatViews(Oid relid);
+
+// copy of the query defining a materialized view
+Query *GetMatViewQuery(Oid mvoid);
+
 // does a function exist with the given oid
 bool FunctionExists(Oid oid);
 
@@ -310,6 +339,9 @@ char *GetTypeName(Oid typid);
 // number of GP segments
 int GetGPSegmentCount(void);
 
+// the user whose privileges the current query is checked against
+Oid GetCurrentUserId(void);
+
 // heap attribute is null
 bool HeapAttIsNull(HeapTuple tup, int attnum);
 
@@ -398,6 +430,12 @@ Value *MakeStringValue(char *str);
 // create a value node for an integer
 Value *MakeIntegerValue(long i);
 
+// create a value node for a floating point number given as a string
+Value *MakeFloatValue(char *str);
+
+// create a named option with the given argument
+DefElem *MakeDefElem(char *name, Node *arg);
+
 // create a constant of type int4
 Node *MakeIntConst(int32 intValue);
 
@@ -522,6 +560,9 @@ MVNDistinct *GetMVNDistinct(Oid stat_oid);
 
 MVDependencies *GetMVDependencies(Oid stat_oid);
 
+// MCV list of an extended statistic object, null if it is not built
+MCVList *GetMVMCVList(Oid stat_oid);
+
 // get relation with given oid
 RelationWrapper GetRelation(Oid rel_oid);
 
@@ -552,6 +593,9 @@ StringInfo MakeStringInfo(void);
 // append the two given strings to the StringInfo object
 void AppendStringInfo(StringInfo str, const char *str1, const char *str2);
 
+// append binary data to the StringInfo object
+void AppendBinaryStringInfo(StringInfo str, const char *data, int datalen);
+
 // look for the given node tags in the given tree and return the index of
 // the first one found, or -1 if there are none
 int FindNodes(Node *node, List *nodeTags);
@@ -623,9 +667,55 @@ FaultInjectorType_e InjectFaultInOptTasks(const char *fault_name);
 #endif
 
 // Does the metadata cache need to be reset (because of a catalog
-// table has been changed?)
+// table has been changed in a way that can't be tracked per entry?)
 bool MDCacheNeedsReset(void);
 
+// have any metadata cache entries been invalidated?
+bool MDCacheHasInvalidations(void);
+
+// forget the recorded metadata cache invalidations
+void MDCacheClearInvalidations(void);
+
+// has the relation or index with the given OID been invalidated?
+bool MDCacheIsRelationInvalidated(Oid relid);
+
+// has any relation been invalidated?
+bool MDCacheIsAnyRelationInvalidated(void);
+
+// have the materialized views over any relation changed?
+bool MDCacheIsMatViewInvalidated(void);
+
+// has the type, operator, function, aggregate or constraint been invalidated?
+bool MDCacheIsObjectInvalidated(Oid oid);
+
+// has the cast between the given types been invalidated?
+bool MDCacheIsCastInvalidated(Oid src_type, Oid dest_type);
+
+// have any column statistics been invalidated?
+bool MDCacheIsColumnStatsInvalidated(void);
+
+// have any operators been invalidated?
+bool MDCacheIsOperatorInvalidated(void);
+
+// is the shared snapshot of the metadata cache configured?
+bool MDCacheSnapshotEnabled(void);
+
+// process pending catalog invalidation messages, returns the catalog version
+// to compare metadata cache snapshots against
+uint64 MDCacheProcessInvalidations(void);
+
+// fetch the shared metadata cache snapshot matching the given version
+char *FetchMDCacheSnapshot(uint64 version, Size *size);
+
+// publish a metadata cache snapshot consistent with the given version
+bool StoreMDCacheSnapshot(uint64 version, const char *data, Size size);
+
+// maximum amount of memory a hash table of the executor may use
+Size GetHashMemoryLimit(void);
+
+// memory overhead of a memoize cache entry holding the given number of tuples
+double EstimateMemoizeEntryOverheadBytes(double ntuples);
+
 // returns true if a query cancel is requested in GPDB
 bool IsAbortRequested(void);
 
@@ -683,6 +773,9 @@ IndexAmRoutine *GetIndexAmRoutineFromAmHandler(Oid am_handler);
 
 bool TestexprIsHashable(Node *testexpr, List *param_ids);
 
+// most restrictive parallel-safety marking of the functions in a query
+char MaxParallelHazard(Query *query);
+
 gpos::BOOL WalkQueryTree(Query *query, bool (*walker)(), void *context,
 						 int flags);
 
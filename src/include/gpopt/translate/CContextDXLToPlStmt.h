@@ -135,6 +135,13 @@ private:
 	// hash map of the queryid (of DML query) and the target relation index
 	HMUlIndex *m_used_rte_indexes;
 
+	// hash map of the plan id of a seq scan that may run in parallel and
+	// its number of workers
+	UlongToUlongMap *m_parallel_scan_workers;
+
+	// number of those seq scans whose slice runs in parallel
+	ULONG m_num_parallel_aware_scans;
+
 public:
 	// ctor/dtor
 	CContextDXLToPlStmt(CMemoryPool *mp, CIdGenerator *plan_id_counter,
@@ -248,6 +255,18 @@ public:
 
 	Index GetRTEIndexByAssignedQueryId(ULONG assigned_query_id_for_target_rel,
 									   BOOL *is_rte_exists);
+
+	// record a seq scan that may run with the given number of workers
+	void AddParallelScan(ULONG plan_id, ULONG parallel_workers);
+
+	// number of workers of a seq scan, 0 if it must run serially
+	ULONG GetParallelScanWorkers(ULONG plan_id) const;
+
+	// record seq scans that were made parallel aware
+	void AddParallelAwareScans(ULONG num_scans);
+
+	// does any seq scan ORCA costed with several workers run serially
+	BOOL HasSerialParallelScans() const;
 };
 
 }  // namespace gpdxl
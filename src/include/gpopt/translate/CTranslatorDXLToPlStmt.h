@@ -121,6 +121,28 @@ private:
 		}
 	};	// SContextSecurityQuals
 
+	// how the rows of a plan subtree are spread over the workers of a slice
+	enum EParallelLocus
+	{
+		EplInvalid,	 // the subtree cannot run with several workers
+		EplFull,	 // every worker produces all rows of its segment
+		EplStrewn,	 // every row is produced by one arbitrary worker
+		EplHashed	 // every row is produced by the worker its hash maps to
+	};
+
+	// context for deciding whether a slice can run with several workers
+	struct SContextParallelSlice
+	{
+		// number of workers of the parallel scans in the slice
+		ULONG m_parallel_workers{0};
+
+		// seq scans that become parallel aware
+		List *m_parallel_scans{NIL};
+
+		// hash joins whose workers share one hash table
+		List *m_shared_hash_joins{NIL};
+	};	// SContextParallelSlice
+
 	// memory pool
 	CMemoryPool *m_mp;
 
@@ -268,6 +290,26 @@ private:
 			ctxt_translation_prev_siblings	// translation contexts of previous siblings
 	);
 
+	// let the slice sending to the given motion run with several workers
+	// on each segment if its plan allows it
+	void SetSliceParallelWorkers(Motion *motion, PlanSlice *sendslice);
+
+	// derive how the rows of a plan subtree of a slice are spread over its
+	// workers
+	EParallelLocus DeriveParallelLocus(Plan *plan,
+									   SContextParallelSlice *ctxt_parallel);
+
+	// derive the parallel locus of a join from the ones of its children
+	EParallelLocus DeriveParallelLocusJoin(
+		Join *join, SContextParallelSlice *ctxt_parallel);
+
+	// check if a plan subtree of a slice contains a node of the given type
+	static BOOL SliceContainsNode(Plan *plan, NodeTag tag,
+								  BOOL parallel_aware_only);
+
+	// set the number of workers of the plan nodes of a slice
+	static void SetSliceParallel(Plan *plan, ULONG parallel_workers);
+
 	// translate DXL motion node
 	Plan *TranslateDXLDuplicateSensitiveMotion(
 		const CDXLNode *motion_dxlnode, CDXLTranslateContext *output_context,
@@ -304,6 +346,9 @@ private:
 			ctxt_translation_prev_siblings	// translation contexts of previous siblings
 	);
 
+	// create a RuntimeFilter node filtering the outer child of a hash join
+	RuntimeFilter *TranslateRuntimeFilter(Plan *child_plan);
+
 	// translate a DXL node into a Hash node
 	Plan *TranslateDXLHash(
 		const CDXLNode *dxlnode, CDXLTranslateContext *output_context,
@@ -354,6 +399,12 @@ private:
 			ctxt_translation_prev_siblings	// translation contexts of previous siblings
 	);
 
+	Plan *TranslateDXLMemoize(
+		const CDXLNode *memoize_dxlnode, CDXLTranslateContext *output_context,
+		CDXLTranslationContextArray *
+			ctxt_translation_prev_siblings	// translation contexts of previous siblings
+	);
+
 	Plan *TranslateDXLSharedScan(
 		const CDXLNode *shared_scan_dxlnode,
 		CDXLTranslateContext *output_context,
@@ -41,6 +41,7 @@ extern "C" {
 #include "naucrates/md/IMDFunction.h"
 #include "naucrates/md/IMDId.h"
 #include "naucrates/md/IMDIndex.h"
+#include "naucrates/md/IMDMatViewInfo.h"
 #include "naucrates/md/IMDType.h"
 #include "naucrates/statistics/CHistogram.h"
 #include "naucrates/statistics/CStatisticsUtils.h"
@@ -291,8 +292,26 @@ public:
 
 	static IMDCacheObject *RetrieveExtStats(CMemoryPool *mp, IMDId *mdid);
 
+	// retrieve the MCV list of an extended statistic object
+	static CMDMCVList *RetrieveExtStatsMCVList(CMemoryPool *mp, OID stat_oid);
+
 	static IMDCacheObject *RetrieveExtStatsInfo(CMemoryPool *mp, IMDId *mdid);
 
+	// retrieve the materialized views that can answer queries over a
+	// relation
+	static IMDCacheObject *RetrieveMatViewInfo(CMemoryPool *mp,
+											   CMDAccessor *md_accessor,
+											   IMDId *mdid);
+
+	// describe how a materialized view over a single relation is derived
+	// from it, nullptr if the view can not be matched
+	static CMDMatView *RetrieveMatView(CMemoryPool *mp,
+									   CMDAccessor *md_accessor, OID rel_oid,
+									   OID mv_oid);
+
+	// walker finding the nodes a materialized view filter can not contain
+	static BOOL HasUnsupportedMatViewFilterNode(Node *node, void *context);
+
 	// retrieve a relation from the relcache
 	static IMDRelation *RetrieveRel(CMemoryPool *mp, CMDAccessor *md_accessor,
 									IMDId *mdid);
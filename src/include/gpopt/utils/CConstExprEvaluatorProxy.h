@@ -75,6 +75,9 @@ private:
 	// translator for the DXL input -> GPDB Expr
 	CTranslatorDXLToScalar m_dxl2scalar_translator;
 
+	// last batch of sort keys computed by any evaluator
+	static ULONG m_ulSortKeyBatch;
+
 public:
 	// ctor
 	CConstExprEvaluatorProxy(CMemoryPool *mp, CMDAccessor *md_accessor)
@@ -99,6 +102,11 @@ public:
 	{
 		return true;
 	}
+
+	// compute the sort keys of the given datums in a single call, using the
+	// bytes of the values for character types under the C collation, and
+	// their ranks in the sort order of the type otherwise
+	BOOL FComputeSortKeys(const IDatumArray *pdrgpdatum) override;
 };
 }  // namespace gpdxl
 
@@ -0,0 +1,72 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (c) 2023 VMware, Inc. or its affiliates. All Rights Reserved.
+//
+//	@filename:
+//		CMDCacheSnapshot.h
+//
+//	@doc:
+//		Loading and publishing the shared snapshot of the metadata cache
+//
+//---------------------------------------------------------------------------
+
+#ifndef GPOPT_CMDCacheSnapshot_H
+#define GPOPT_CMDCacheSnapshot_H
+
+#include "gpos/base.h"
+
+#include "naucrates/md/IMDCacheObject.h"
+
+struct StringInfoData;
+
+namespace gpopt
+{
+using namespace gpos;
+using namespace gpmd;
+
+//---------------------------------------------------------------------------
+//	@class:
+//		CMDCacheSnapshot
+//
+//	@doc:
+//		The snapshot is a sequence of null-terminated DXL documents, one per
+//		cached metadata object, kept in shared memory (see orcamdcache.c).
+//		A backend publishes the contents of its metadata cache whenever it
+//		has grown, and a backend starting with an empty cache loads the
+//		snapshot if it is consistent with the current catalog version.
+//
+//---------------------------------------------------------------------------
+class CMDCacheSnapshot
+{
+private:
+	// number of cached objects when the snapshot was last loaded or
+	// published by this backend
+	static ULONG_PTR m_ulpObjects;
+
+	// context of the visitor serializing cached objects
+	struct SSerializeCtxt
+	{
+		// memory pool for temporary allocations
+		CMemoryPool *m_mp;
+
+		// buffer the serialized objects are appended to
+		StringInfoData *m_str;
+	};
+
+	// serialize a cached object into the buffer of the given context
+	static void SerializeObject(IMDCacheObject *mdobj, void *ctxt);
+
+public:
+	// load the snapshot into the metadata cache if it is consistent with
+	// the given catalog version, returns the number of loaded objects
+	static ULONG Load(ULLONG version);
+
+	// publish the metadata cache as consistent with the given catalog
+	// version, if it has grown since last loaded or published
+	static void Publish(CMemoryPool *mp, ULLONG version);
+};
+}  // namespace gpopt
+
+#endif	// !GPOPT_CMDCacheSnapshot_H
+
+// EOF
@@ -43,11 +43,13 @@ class CQueryContext;
 class COptimizerConfig;
 class ICostModel;
 class CPlanHint;
+class COptimizationProfile;
 }  // namespace gpopt
 
 struct PlannedStmt;
 struct Query;
 struct List;
+struct DefElem;
 struct MemoryContextData;
 
 using namespace gpos;
@@ -131,7 +133,8 @@ private:
 	static PlannedStmt *ConvertToPlanStmtFromDXL(
 		CMemoryPool *mp, CMDAccessor *md_accessor, const Query *orig_query,
 		const CDXLNode *dxlnode, bool can_set_tag,
-		DistributionHashOpsKind distribution_hashops);
+		DistributionHashOpsKind distribution_hashops,
+		BOOL *has_serial_parallel_scans);
 
 	// load search strategy from given path
 	static CSearchStageArray *LoadSearchStrategy(CMemoryPool *mp, char *path);
@@ -145,6 +148,12 @@ private:
 	// generate an instance of optimizer cost model
 	static ICostModel *GetCostModel(CMemoryPool *mp, ULONG num_segments);
 
+	// allow parallel table scans if the query can run in parallel mode
+	static void SetParallelWorkers(ICostModel *cost_model, Query *query);
+
+	// let every table scan run serially
+	static void ResetParallelWorkers(ICostModel *cost_model);
+
 	// create optimizer plan hints
 	static CPlanHint *GetPlanHints(CMemoryPool *mp, Query *query);
 
@@ -154,6 +163,17 @@ private:
 										 IMdIdArray *col_stats,
 										 MdidHashSet *phsmdidRel);
 
+	// is the metadata cache entry with the given mdid invalidated by a
+	// catalog change?
+	static BOOL IsMDCacheEntryInvalidated(const IMDId *mdid, void *arg);
+
+	// create an entry of the optimizer profile
+	static DefElem *MakeProfileEntry(const CHAR *name, ULLONG calls,
+									 ULLONG time_us, const CHAR *calls_name);
+
+	// convert the counters of an optimization for the planned statement
+	static List *CreateOptimizerProfile(const COptimizationProfile *profile);
+
 public:
 	// convert Query->DXL->LExpr->Optimize->PExpr->DXL
 	static char *Optimize(Query *query);
@@ -0,0 +1,269 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (c) 2023 VMware, Inc. or its affiliates. All Rights Reserved.
+//
+//	@filename:
+//		CPlanCache.h
+//
+//	@doc:
+//		Cache of the plans produced by the optimizer
+//
+//---------------------------------------------------------------------------
+
+#ifndef GPOPT_CPlanCache_H
+#define GPOPT_CPlanCache_H
+
+#include "gpos/base.h"
+#include "gpos/common/CRefCount.h"
+#include "gpos/memory/CCache.h"
+#include "gpos/memory/CCacheAccessor.h"
+#include "gpos/string/CWStringConst.h"
+#include "gpos/string/CWStringDynamic.h"
+
+#include "naucrates/dxl/operators/CDXLNode.h"
+#include "naucrates/md/IMDId.h"
+
+namespace gpopt
+{
+using namespace gpos;
+using namespace gpmd;
+using namespace gpdxl;
+
+class CMDAccessor;
+class COptimizerConfig;
+
+//---------------------------------------------------------------------------
+//	@class:
+//		CPlanCacheKey
+//
+//	@doc:
+//		Key of a cached plan. The string identifies the optimization problem,
+//		i.e. the serialized query and optimizer configuration, and is all that
+//		is hashed and compared. The mdids of the metadata the plan was
+//		optimized against are carried along for invalidation. Like metadata
+//		cache keys, plan cache keys do not own their members, which live in
+//		the memory pool of their cache entry.
+//
+//---------------------------------------------------------------------------
+class CPlanCacheKey
+{
+private:
+	// serialized query and optimizer configuration
+	const CWStringBase *m_str;
+
+	// mdids of the metadata accessed during optimization, or null for keys
+	// used for lookups only
+	IMdIdArray *m_mdids;
+
+	// hash value of the string
+	ULONG m_hash;
+
+public:
+	// ctor
+	CPlanCacheKey(const CWStringBase *str, IMdIdArray *mdids);
+
+	// dtor
+	~CPlanCacheKey() = default;
+
+	// mdids of the metadata the plan depends on
+	IMdIdArray *
+	GetMdIds() const
+	{
+		return m_mdids;
+	}
+
+	// equality function for using plan cache keys in a cache
+	static BOOL FEqualPlanCacheKey(CPlanCacheKey *const &pvLeft,
+								   CPlanCacheKey *const &pvRight);
+
+	// hash function for using plan cache keys in a cache
+	static ULONG UlHashPlanCacheKey(CPlanCacheKey *const &pv);
+};
+
+//---------------------------------------------------------------------------
+//	@class:
+//		CCachedPlan
+//
+//	@doc:
+//		A DXL plan stored in the plan cache, allocated in the memory pool of
+//		its cache entry
+//
+//---------------------------------------------------------------------------
+class CCachedPlan : public CRefCount
+{
+private:
+	// plan
+	CDXLNode *m_plan_dxl;
+
+	// id of the plan in the plan space
+	ULLONG m_plan_id;
+
+	// size of the plan space the plan was chosen from
+	ULLONG m_plan_space_size;
+
+public:
+	CCachedPlan(const CCachedPlan &) = delete;
+
+	// ctor
+	CCachedPlan(CDXLNode *plan_dxl, ULLONG plan_id, ULLONG plan_space_size)
+		: m_plan_dxl(plan_dxl),
+		  m_plan_id(plan_id),
+		  m_plan_space_size(plan_space_size)
+	{
+		GPOS_ASSERT(nullptr != plan_dxl);
+	}
+
+	// dtor
+	~CCachedPlan() override
+	{
+		m_plan_dxl->Release();
+	}
+
+	// plan
+	CDXLNode *
+	GetPlanDXL() const
+	{
+		return m_plan_dxl;
+	}
+
+	// id of the plan in the plan space
+	ULLONG
+	GetPlanId() const
+	{
+		return m_plan_id;
+	}
+
+	// size of the plan space
+	ULLONG
+	GetPlanSpaceSize() const
+	{
+		return m_plan_space_size;
+	}
+};
+
+//---------------------------------------------------------------------------
+//	@class:
+//		CPlanCache
+//
+//	@doc:
+//		A wrapper for a generic cache holding the plans of previously
+//		optimized queries, so that optimizing an identical query under the
+//		same configuration can skip the search. Plans are invalidated along
+//		with the metadata they were optimized against.
+//
+//---------------------------------------------------------------------------
+class CPlanCache
+{
+public:
+	// type definition of the underlying cache and of its accessor
+	using PlanCache = CCache<CCachedPlan *, CPlanCacheKey *>;
+	using PlanCacheAccessor = CCacheAccessor<CCachedPlan *, CPlanCacheKey *>;
+
+	// type definition of function selecting the mdids of plans to invalidate
+	using MDIdFilterFuncPtr = BOOL (*)(const IMDId *, void *);
+
+private:
+	// pointer to the underlying cache
+	static PlanCache *m_pcache;
+
+	// the maximum size of the cache
+	static ULLONG m_ullCacheQuota;
+
+	// number of lookups that found a plan
+	static ULLONG m_ullHits;
+
+	// number of lookups that did not find a plan
+	static ULLONG m_ullMisses;
+
+	// filter function and argument passed through to the underlying cache
+	struct SInvalidationFilter
+	{
+		MDIdFilterFuncPtr m_filter_func;
+
+		void *m_arg;
+	};
+
+	// adapt a filter on mdids to a filter on cache keys
+	static BOOL FFilterKey(CPlanCacheKey *const &pkey, void *pv);
+
+	// private ctor
+	CPlanCache() = default;
+
+	// private dtor
+	~CPlanCache() = default;
+
+public:
+	CPlanCache(const CPlanCache &) = delete;
+
+	// initialize underlying cache
+	static void Init();
+
+	// has cache been initialized?
+	static BOOL
+	FInitialized()
+	{
+		return (nullptr != m_pcache);
+	}
+
+	// destroy global instance
+	static void Shutdown();
+
+	// set the maximum size of the cache
+	static void SetCacheQuota(ULLONG ullCacheQuota);
+
+	// get the maximum size of the cache
+	static ULLONG ULLGetCacheQuota();
+
+	// reset global instance
+	static void Reset();
+
+	// invalidate the plans depending on an mdid satisfying the given filter
+	static ULONG Invalidate(MDIdFilterFuncPtr filter_func, void *arg);
+
+	// build the string identifying the optimization of the given query
+	// under the given configuration, the trace flags of the current task and
+	// the current user
+	static CWStringDynamic *CreateKeyString(
+		CMemoryPool *mp, const CDXLNode *query_dxl,
+		const CDXLNodeArray *query_output_dxlnode_array,
+		const CDXLNodeArray *cte_dxlnode_array,
+		const COptimizerConfig *optimizer_config, ULONG num_segments);
+
+	// look up the plan for the given key string; the returned plan, if any,
+	// is pinned by the accessor and must be released by the caller
+	static CCachedPlan *Lookup(PlanCacheAccessor *acc,
+							   const CWStringBase *key_str);
+
+	// cache a plan under the given key string, returns false if the plan
+	// can not be cached
+	static BOOL Insert(CMemoryPool *mp, CMDAccessor *md_accessor,
+					   const CWStringBase *key_str, const CDXLNode *plan_dxl,
+					   ULLONG plan_id, ULLONG plan_space_size);
+
+	// global accessor
+	static PlanCache *
+	Pcache()
+	{
+		return m_pcache;
+	}
+
+	// number of lookups that found a plan
+	static ULLONG
+	ULLGetHits()
+	{
+		return m_ullHits;
+	}
+
+	// number of lookups that did not find a plan
+	static ULLONG
+	ULLGetMisses()
+	{
+		return m_ullMisses;
+	}
+};	// class CPlanCache
+
+}  // namespace gpopt
+
+#endif	// !GPOPT_CPlanCache_H
+
+// EOF
@@ -21,6 +21,8 @@ extern "C" {
 extern Datum DisableXform(PG_FUNCTION_ARGS);
 extern Datum EnableXform(PG_FUNCTION_ARGS);
 extern Datum LibraryVersion();
+extern void PlanCacheStats(int64 *hits, int64 *misses, int64 *entries,
+						   int64 *size);
 }
 
 #endif	// GPOPT_funcs_H
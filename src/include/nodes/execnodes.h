@@ -3253,6 +3253,9 @@ typedef struct MotionState
 	struct CdbHash *cdbhash;	/* hash api object */
 	struct CdbHash *cdbhashworkers;	/* hash api object for parallel workers */
 	int			numHashSegments;	/* number of segments to use when calculating hash */
+	uint32	   *skewHashes;		/* hash values of the skew values, see
+								 * Motion.hashSkewValues */
+	int			numSkewHashes;	/* number of entries in skewHashes */
 
 	/* For Motion recv */
 	int			routeIdNext;	/* for a sorted motion node, the routeId to get next (same as
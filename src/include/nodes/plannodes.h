@@ -157,6 +157,12 @@ typedef struct PlannedStmt
 	 * Facilitate various extensions to pass context
 	 */
 	List 		*extensionContext;
+
+	/*
+	 * GPDB: counters collected by ORCA while optimizing the query, as a
+	 * tree of DefElems, when optimizer_collect_profile is on
+	 */
+	List	   *optimizerProfile;
 } PlannedStmt;
 
 /*
@@ -334,6 +340,13 @@ typedef struct Plan
 	 * How much memory (in KB) should be used to execute this plan node?
 	 */
 	uint64 operatorMemKB;
+
+	/*
+	 * GPORCA fingerprint of the subexpression this node computes, used to
+	 * report the rows it produced back to the optimizer as cardinality
+	 * feedback. Zero if the rows are not reported.
+	 */
+	uint64		cardinality_fingerprint;
 } Plan;
 
 /* ----------------
@@ -1616,6 +1629,10 @@ typedef struct Motion
 	List		*hashExprs;			/* list of hash expressions */
 	Oid			*hashFuncs;			/* corresponding hash functions */
 	int         numHashSegments;	/* the module number of the hash function */
+	List	   *hashSkewValues;		/* Consts of the skew values of the single
+									 * hash expression, or NIL */
+	bool		hashSkewBroadcast;	/* broadcast rows with a skew value, rather
+									 * than sending them to a random segment */
 
 	/* For Explicit */
 	AttrNumber segidColIdx;			/* index of the segid column in the target list */
@@ -22,6 +22,7 @@
 #ifdef USE_ORCA
 
 extern PlannedStmt * optimize_query(Query *parse, int cursorOptions, ParamListInfo boundParams);
+extern void record_cardinality_feedback(struct PlanState *planstate);
 extern Node *transformGroupedWindows(Node *node, void *context);
 
 // plan_hint_hook generates HintState by parsing a Query.
@@ -56,6 +56,7 @@ extern List *GetRelationExtStatistics(Relation relation);
 
 extern char *GetExtStatisticsName(Oid statOid);
 extern List *GetExtStatisticsKinds(Oid statOid);
+extern List *GetExtStatisticsKeys(Oid statOid);
 
 extern bool relation_excluded_by_constraints(PlannerInfo *root,
 											 RelOptInfo *rel, RangeTblEntry *rte);
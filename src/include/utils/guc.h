@@ -472,9 +472,16 @@ extern bool	optimizer_log;
 extern int  optimizer_log_failure;
 extern bool	optimizer_trace_fallback;
 extern int optimizer_minidump;
+extern bool optimizer_minidump_binary;
 extern int  optimizer_cost_model;
 extern bool optimizer_metadata_caching;
 extern int	optimizer_mdcache_size;
+extern int	optimizer_mdcache_shared_size;
+extern bool optimizer_plan_caching;
+extern int	optimizer_plan_cache_size;
+extern bool optimizer_cardinality_feedback;
+extern int	optimizer_cardinality_feedback_entries;
+extern int	optimizer_cardinality_feedback_max_age;
 
 /* Optimizer debugging GUCs */
 extern bool optimizer_print_query;
@@ -489,6 +496,7 @@ extern bool	optimizer_print_group_properties;
 extern bool	optimizer_print_optimization_context;
 extern bool optimizer_print_optimization_stats;
 extern bool optimizer_print_xform_results;
+extern bool optimizer_collect_profile;
 
 /* array of xforms disable flags */
 extern bool optimizer_xforms[OPTIMIZER_XFORMS_COUNT];
@@ -536,6 +544,9 @@ extern bool optimizer_expand_fulljoin;
 extern bool optimizer_enable_hashagg;
 extern bool optimizer_enable_groupagg;
 extern bool optimizer_enable_mergejoin;
+extern bool optimizer_enable_inner_outer_mergejoin;
+extern bool optimizer_enable_memoize;
+extern bool optimizer_enable_incremental_sort;
 extern bool optimizer_enable_redistribute_nestloop_loj_inner_child;
 extern bool optimizer_force_comprehensive_join_implementation;
 extern bool optimizer_enable_replicated_table;
@@ -576,11 +587,13 @@ extern int optimizer_cte_inlining_bound;
 extern int optimizer_push_group_by_below_setop_threshold;
 extern int optimizer_xform_bind_threshold;
 extern int optimizer_skew_factor;
+extern int optimizer_time_budget;
 extern bool optimizer_force_multistage_agg;
 extern bool optimizer_force_three_stage_scalar_dqa;
 extern bool optimizer_force_expanded_distinct_aggs;
 extern bool optimizer_force_agg_skew_avoidance;
 extern bool optimizer_penalize_skew;
+extern bool optimizer_enable_hybrid_redistribute;
 extern bool optimizer_prune_computed_columns;
 extern bool optimizer_push_requirements_from_consumer_to_producer;
 extern bool optimizer_enforce_subplans;
@@ -592,16 +605,19 @@ extern bool optimizer_parallel_union;
 extern bool optimizer_array_constraints;
 extern bool optimizer_cte_inlining;
 extern bool optimizer_enable_space_pruning;
+extern bool optimizer_enable_global_space_pruning;
 extern bool optimizer_enable_associativity;
 extern bool optimizer_enable_range_predicate_dpe;
 extern bool optimizer_enable_use_distribution_in_dqa;
 extern bool optimizer_enable_push_join_below_union_all;
+extern bool optimizer_enable_window_rank_pushdown;
 
 /* Analyze related GUCs for Optimizer */
 extern bool optimizer_analyze_root_partition;
 extern bool optimizer_analyze_midlevel_partition;
 
 extern bool optimizer_use_gpdb_allocators;
+extern bool optimizer_use_arena_memory_pool;
 
 /* optimizer GUCs for replicated table */
 extern bool optimizer_replicated_table_insert;
@@ -639,6 +655,7 @@ extern bool gp_enable_global_deadlock_detector;
 extern bool	gp_enable_refresh_fast_path;
 
 extern bool gp_enable_predicate_pushdown;
+extern bool gp_enable_aocs_late_materialize;
 extern int  gp_predicate_pushdown_sample_rows;
 
 extern bool gp_log_endpoints;
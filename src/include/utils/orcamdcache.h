@@ -0,0 +1,26 @@
+/*-------------------------------------------------------------------------
+ *
+ * orcamdcache.h
+ *	  Shared snapshot of the ORCA metadata cache.
+ *
+ *
+ * Copyright (c) 2023 VMware, Inc. or its affiliates.
+ *
+ * src/include/utils/orcamdcache.h
+ *
+ *-------------------------------------------------------------------------
+ */
+
+#ifndef ORCAMDCACHE_H
+#define ORCAMDCACHE_H
+
+extern Size OrcaMDCacheShmemSize(void);
+extern void OrcaMDCacheShmemInit(void);
+
+extern bool OrcaMDCacheSnapshotEnabled(void);
+extern uint64 OrcaMDCacheGetVersion(void);
+extern char *OrcaMDCacheFetchSnapshot(uint64 version, Size *size);
+extern bool OrcaMDCacheStoreSnapshot(uint64 version, const char *data,
+									 Size size);
+
+#endif   /* ORCAMDCACHE_H */
@@ -61,6 +61,7 @@
 		"gp_default_storage_options",
 		"gp_detect_data_correctness",
 		"gp_disable_tuple_hints",
+		"gp_enable_aocs_late_materialize",
 		"gp_enable_interconnect_aggressive_retry",
 		"gp_enable_runtime_filter",
 		"gp_enable_segment_copy_checking",
@@ -375,6 +375,10 @@
 		"optimizer_apply_left_outer_to_union_all_disregarding_stats",
 		"optimizer_array_constraints",
 		"optimizer_array_expansion_threshold",
+		"optimizer_cardinality_feedback",
+		"optimizer_cardinality_feedback_entries",
+		"optimizer_cardinality_feedback_max_age",
+		"optimizer_collect_profile",
 		"optimizer_control",
 		"optimizer_cost_model",
 		"optimizer_cost_threshold",
@@ -401,16 +405,21 @@
 		"optimizer_enable_eageragg",
 		"optimizer_enable_orderedagg",
 		"optimizer_enable_gather_on_segment_for_dml",
+		"optimizer_enable_global_space_pruning",
 		"optimizer_enable_groupagg",
 		"optimizer_enable_hashagg",
 		"optimizer_enable_hashjoin",
 		"optimizer_enable_hashjoin_redistribute_broadcast_children",
 		"optimizer_discard_redistribute_hashjoin",
+		"optimizer_enable_hybrid_redistribute",
+		"optimizer_enable_incremental_sort",
 		"optimizer_enable_indexjoin",
 		"optimizer_enable_indexonlyscan",
 		"optimizer_enable_indexscan",
+		"optimizer_enable_inner_outer_mergejoin",
 		"optimizer_enable_master_only_queries",
 		"optimizer_enable_materialize",
+		"optimizer_enable_memoize",
 		"optimizer_enable_mergejoin",
 		"optimizer_enable_motion_broadcast",
 		"optimizer_enable_motion_gather",
@@ -424,6 +433,7 @@
 		"optimizer_enable_partition_propagation",
 		"optimizer_enable_partition_selection",
 		"optimizer_enable_push_join_below_union_all",
+		"optimizer_enable_window_rank_pushdown",
 		"optimizer_enable_range_predicate_dpe",
 		"optimizer_enable_use_distribution_in_dqa",
 		"optimizer_enable_redistribute_nestloop_loj_inner_child",
@@ -450,15 +460,19 @@
 		"optimizer_join_order_threshold",
 		"optimizer_log",
 		"optimizer_log_failure",
+		"optimizer_mdcache_shared_size",
 		"optimizer_mdcache_size",
 		"optimizer_metadata_caching",
 		"optimizer_minidump",
+		"optimizer_minidump_binary",
 		"optimizer_multilevel_partitioning",
 		"optimizer_nestloop_factor",
 		"optimizer_parallel_union",
 		"optimizer_partition_selection_log",
 		"optimizer_penalize_broadcast_threshold",
 		"optimizer_penalize_skew",
+		"optimizer_plan_cache_size",
+		"optimizer_plan_caching",
 		"optimizer_plan_id",
 		"optimizer_print_expression_properties",
 		"optimizer_print_group_properties",
@@ -484,8 +498,10 @@
 		"optimizer_segments",
 		"optimizer_spilling_mem_threshold",
 		"optimizer_sort_factor",
+		"optimizer_time_budget",
 		"optimizer_trace_fallback",
 		"optimizer_skew_factor",
+		"optimizer_use_arena_memory_pool",
 		"optimizer_use_external_constant_expression_evaluation_for_ints",
 		"optimizer_use_gpdb_allocators",
 		"optimizer_xform_bind_threshold",
@@ -0,0 +1,40 @@
+-- The shared snapshot of the ORCA metadata cache must not carry catalog
+-- changes of a transaction that rolls back. A rollback sends no shared
+-- invalidation, so other sessions could not tell that a snapshot published
+-- inside the transaction is wrong.
+
+!\retcode gpconfig -c optimizer_mdcache_shared_size -v 1024 --skipvalidation;
+!\retcode gpstop -ari;
+
+1: create table mdsnap_big (a int, b int) distributed by (a);
+1: create table mdsnap_small (a int, b int) distributed by (a);
+1: insert into mdsnap_big select i, i from generate_series(1, 1000) i;
+1: insert into mdsnap_small select i, i from generate_series(1, 10) i;
+1: analyze mdsnap_big;
+1: analyze mdsnap_small;
+1q:
+
+-- Plan, and so cache the metadata of, a table whose distribution key has
+-- been changed in a transaction that rolls back
+2: set optimizer = on;
+2: begin;
+2: alter table mdsnap_big set distributed by (b);
+2: select count(*) from mdsnap_big join mdsnap_small using (a);
+2: rollback;
+
+-- A new session must see the committed distribution key, so the join needs
+-- no motion
+3: set optimizer = on;
+3: explain (costs off) select * from mdsnap_big join mdsnap_small using (a);
+3: select count(*) from mdsnap_big join mdsnap_small using (a);
+
+-- The session that rolled back sees it as well
+2: explain (costs off) select * from mdsnap_big join mdsnap_small using (a);
+
+2: drop table mdsnap_big;
+2: drop table mdsnap_small;
+2q:
+3q:
+
+!\retcode gpconfig -r optimizer_mdcache_shared_size --skipvalidation;
+!\retcode gpstop -ari;
@@ -0,0 +1,43 @@
+--
+-- Late materialization of the non-qual columns in scans of AOCS tables
+-- with pushed down quals. Every query is run with and without it and must
+-- return the same rows.
+--
+CREATE SCHEMA aocs_late_materialize;
+SET search_path TO aocs_late_materialize;
+
+-- compressed, with many small blocks per segment
+CREATE TABLE aocs_lm (a int, b int, c text, d numeric)
+  WITH (appendonly=true, orientation=column, compresstype=zlib, compresslevel=1, blocksize=8192)
+  DISTRIBUTED BY (a);
+INSERT INTO aocs_lm
+  SELECT i, i % 100, repeat('x', i % 50) || i, i * 1.5
+  FROM generate_series(1, 100000) i;
+
+-- scattered and whole block ranges of invisible rows
+DELETE FROM aocs_lm WHERE a % 7 = 0;
+DELETE FROM aocs_lm WHERE a BETWEEN 60001 AND 70000;
+
+-- a column added after the first rows were loaded
+ALTER TABLE aocs_lm ADD COLUMN e int DEFAULT 42;
+INSERT INTO aocs_lm
+  SELECT i, i % 100, 'y' || i, i, i
+  FROM generate_series(100001, 101000) i;
+
+SET gp_enable_predicate_pushdown TO on;
+
+SET gp_enable_aocs_late_materialize TO off;
+SELECT count(*), sum(a), sum(length(c)), sum(d), sum(e) FROM aocs_lm WHERE b = 3;
+SELECT count(*), sum(length(c)), sum(e) FROM aocs_lm WHERE b < 10 AND a > 50000;
+SELECT a, b, c, d, e FROM aocs_lm WHERE a BETWEEN 40000 AND 40010 ORDER BY a;
+SELECT count(*), min(c), max(c) FROM aocs_lm WHERE e > 100500;
+
+SET gp_enable_aocs_late_materialize TO on;
+SELECT count(*), sum(a), sum(length(c)), sum(d), sum(e) FROM aocs_lm WHERE b = 3;
+SELECT count(*), sum(length(c)), sum(e) FROM aocs_lm WHERE b < 10 AND a > 50000;
+SELECT a, b, c, d, e FROM aocs_lm WHERE a BETWEEN 40000 AND 40010 ORDER BY a;
+SELECT count(*), min(c), max(c) FROM aocs_lm WHERE e > 100500;
+
+RESET gp_enable_aocs_late_materialize;
+RESET gp_enable_predicate_pushdown;
+DROP SCHEMA aocs_late_materialize CASCADE;
@@ -0,0 +1,65 @@
+--
+-- ORCA parallel table scans
+--
+-- ORCA may split the scan of a large table among the workers of each
+-- segment. A slice that cannot run with several workers runs serially,
+-- and the query is then optimized again with serial scans, so that its
+-- plan has no motions for the random distribution of a parallel scan.
+--
+create schema orca_parallel;
+set search_path to orca_parallel;
+
+-- the motions and scans of the plan of a query
+create function plan_nodes(query text) returns setof text language plpgsql as
+$$
+declare
+  ln text;
+begin
+  for ln in execute 'explain (costs off) ' || query loop
+    if ln ~ '(Seq Scan|Motion)' then
+      return next regexp_replace(ln, '^[ ->]*|  \(.*$', '', 'g');
+    end if;
+  end loop;
+end;
+$$;
+
+create table t_par(a int, b int) distributed by (a);
+insert into t_par select i, i % 10 from generate_series(1, 10000) i;
+create table t_rep(a int, b int) distributed replicated;
+insert into t_rep select i, i from generate_series(0, 4) i;
+analyze t_par;
+analyze t_rep;
+
+-- make the table look large enough for a parallel scan to pay off
+set allow_system_table_mods = on;
+update pg_class set reltuples = 100000000, relpages = 1000000
+  where oid = 't_par'::regclass;
+reset allow_system_table_mods;
+
+set enable_parallel = on;
+set max_parallel_workers_per_gather = 4;
+
+select plan_nodes('select count(*) from t_par where b = 1');
+select count(*) from t_par where b = 1;
+
+-- a slice with a subplan runs serially, and the grouping on the
+-- distribution key needs no redistribute motion then
+set optimizer_enforce_subplans = on;
+select plan_nodes($$
+select a, count(*) from t_par
+where b = (select max(r.b) from t_rep r where r.a = t_par.b)
+group by a order by a limit 3
+$$);
+select a, count(*) from t_par
+where b = (select max(r.b) from t_rep r where r.a = t_par.b)
+group by a order by a limit 3;
+reset optimizer_enforce_subplans;
+
+-- the same results without parallel scans
+set enable_parallel = off;
+select plan_nodes('select count(*) from t_par where b = 1');
+select count(*) from t_par where b = 1;
+
+reset enable_parallel;
+reset max_parallel_workers_per_gather;
+drop schema orca_parallel cascade;
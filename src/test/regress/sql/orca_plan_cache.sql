@@ -0,0 +1,43 @@
+--
+-- ORCA plan cache: a repeated query is a hit, a query over an object
+-- changed by DDL and a query of another user are misses. The counters are
+-- read with the cache turned off, so that reading them is not counted.
+--
+CREATE SCHEMA orca_plan_cache;
+SET search_path TO orca_plan_cache;
+
+CREATE TABLE pc (a int, b int) DISTRIBUTED BY (a);
+INSERT INTO pc SELECT i, i % 10 FROM generate_series(1, 100) i;
+ANALYZE pc;
+
+CREATE ROLE regress_orca_plan_cache_user;
+GRANT USAGE ON SCHEMA orca_plan_cache TO regress_orca_plan_cache_user;
+GRANT SELECT ON pc TO regress_orca_plan_cache_user;
+
+-- a miss, then a hit
+SET optimizer_plan_caching TO on;
+SELECT count(*) FROM pc WHERE b = 3;
+SELECT count(*) FROM pc WHERE b = 3;
+SET optimizer_plan_caching TO off;
+SELECT hits, misses FROM gp_orca_plan_cache_stats();
+
+-- DDL on the table invalidates the plan
+CREATE INDEX pc_b ON pc (b);
+SET optimizer_plan_caching TO on;
+SELECT count(*) FROM pc WHERE b = 3;
+SELECT count(*) FROM pc WHERE b = 3;
+SET optimizer_plan_caching TO off;
+SELECT hits, misses FROM gp_orca_plan_cache_stats();
+
+-- another user does not share the plan
+SET ROLE regress_orca_plan_cache_user;
+SET optimizer_plan_caching TO on;
+SELECT count(*) FROM pc WHERE b = 3;
+SELECT count(*) FROM pc WHERE b = 3;
+SET optimizer_plan_caching TO off;
+SELECT hits, misses FROM gp_orca_plan_cache_stats();
+RESET ROLE;
+
+RESET optimizer_plan_caching;
+DROP SCHEMA orca_plan_cache CASCADE;
+DROP ROLE regress_orca_plan_cache_user;
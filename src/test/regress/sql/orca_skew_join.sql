@@ -0,0 +1,41 @@
+--
+-- Hash joins on skewed keys. Half of the outer rows have the key 1 and a
+-- tenth are NULL, so with optimizer_enable_hybrid_redistribute ORCA
+-- broadcasts the inner rows of those keys and spreads the outer ones.
+-- Every query is run with and without it and must return the same rows.
+--
+CREATE SCHEMA orca_skew_join;
+SET search_path TO orca_skew_join;
+
+CREATE TABLE skew_o (a int, b int) DISTRIBUTED BY (a);
+INSERT INTO skew_o
+  SELECT i, CASE WHEN i % 10 = 0 THEN NULL WHEN i % 2 = 0 THEN 1 ELSE i % 100 END
+  FROM generate_series(1, 3000) i;
+
+CREATE TABLE skew_i (c int, d int) DISTRIBUTED BY (c);
+INSERT INTO skew_i
+  SELECT i, CASE WHEN i % 3 = 0 THEN 1 WHEN i % 7 = 0 THEN NULL ELSE i % 200 END
+  FROM generate_series(1, 2000) i;
+
+ANALYZE skew_o;
+ANALYZE skew_i;
+
+SET optimizer_skew_factor = 100;
+
+SET optimizer_enable_hybrid_redistribute TO off;
+SELECT count(*), sum(a), sum(c) FROM skew_o JOIN skew_i ON b = d;
+SELECT count(*), count(c), sum(c) FROM skew_o LEFT JOIN skew_i ON b = d;
+SELECT count(*), sum(a) FROM skew_o WHERE EXISTS (SELECT 1 FROM skew_i WHERE b = d);
+SELECT count(*), sum(a) FROM skew_o WHERE NOT EXISTS (SELECT 1 FROM skew_i WHERE b = d);
+SELECT b, count(*) FROM skew_o JOIN skew_i ON b = d WHERE b IN (1, 3, 5) GROUP BY b ORDER BY b;
+
+SET optimizer_enable_hybrid_redistribute TO on;
+SELECT count(*), sum(a), sum(c) FROM skew_o JOIN skew_i ON b = d;
+SELECT count(*), count(c), sum(c) FROM skew_o LEFT JOIN skew_i ON b = d;
+SELECT count(*), sum(a) FROM skew_o WHERE EXISTS (SELECT 1 FROM skew_i WHERE b = d);
+SELECT count(*), sum(a) FROM skew_o WHERE NOT EXISTS (SELECT 1 FROM skew_i WHERE b = d);
+SELECT b, count(*) FROM skew_o JOIN skew_i ON b = d WHERE b IN (1, 3, 5) GROUP BY b ORDER BY b;
+
+RESET optimizer_enable_hybrid_redistribute;
+RESET optimizer_skew_factor;
+DROP SCHEMA orca_skew_join CASCADE;
@@ -0,0 +1,50 @@
+--
+-- Filters on row_number() and rank(). With
+-- optimizer_enable_window_rank_pushdown ORCA ranks the rows of each
+-- segment first and only moves those that can pass the filter. Every
+-- query is run with and without it and must return the same rows; c has
+-- many ties, so rank() leaves gaps.
+--
+CREATE SCHEMA orca_window_rank_pushdown;
+SET search_path TO orca_window_rank_pushdown;
+
+CREATE TABLE t_rank (a int, b int, c int) DISTRIBUTED BY (a);
+INSERT INTO t_rank SELECT i, i % 7, i % 13 FROM generate_series(1, 1000) i;
+ANALYZE t_rank;
+
+SET optimizer_enable_window_rank_pushdown TO off;
+SELECT b, count(*), sum(a) FROM
+  (SELECT a, b, row_number() OVER (PARTITION BY b ORDER BY c, a) rn FROM t_rank) s
+  WHERE rn <= 3 GROUP BY b ORDER BY b;
+SELECT b, count(*), sum(a) FROM
+  (SELECT a, b, rank() OVER (PARTITION BY b ORDER BY c) rk FROM t_rank) s
+  WHERE rk <= 2 GROUP BY b ORDER BY b;
+SELECT b, count(*), sum(a) FROM
+  (SELECT a, b, rank() OVER (PARTITION BY b ORDER BY c) rk FROM t_rank) s
+  WHERE rk = 12 GROUP BY b ORDER BY b;
+SELECT a FROM
+  (SELECT a, row_number() OVER (ORDER BY c DESC, a) rn FROM t_rank) s
+  WHERE rn < 4 ORDER BY a;
+SELECT count(*), sum(a) FROM
+  (SELECT a, row_number() OVER (PARTITION BY b, c ORDER BY a) rn FROM t_rank) s
+  WHERE rn = 1;
+
+SET optimizer_enable_window_rank_pushdown TO on;
+SELECT b, count(*), sum(a) FROM
+  (SELECT a, b, row_number() OVER (PARTITION BY b ORDER BY c, a) rn FROM t_rank) s
+  WHERE rn <= 3 GROUP BY b ORDER BY b;
+SELECT b, count(*), sum(a) FROM
+  (SELECT a, b, rank() OVER (PARTITION BY b ORDER BY c) rk FROM t_rank) s
+  WHERE rk <= 2 GROUP BY b ORDER BY b;
+SELECT b, count(*), sum(a) FROM
+  (SELECT a, b, rank() OVER (PARTITION BY b ORDER BY c) rk FROM t_rank) s
+  WHERE rk = 12 GROUP BY b ORDER BY b;
+SELECT a FROM
+  (SELECT a, row_number() OVER (ORDER BY c DESC, a) rn FROM t_rank) s
+  WHERE rn < 4 ORDER BY a;
+SELECT count(*), sum(a) FROM
+  (SELECT a, row_number() OVER (PARTITION BY b, c ORDER BY a) rn FROM t_rank) s
+  WHERE rn = 1;
+
+RESET optimizer_enable_window_rank_pushdown;
+DROP SCHEMA orca_window_rank_pushdown CASCADE;